@@ -91,6 +91,7 @@
 #define CM7_2_VTOR_ADDR             (__CORE2_VTOR)
 #define CM7_3_VTOR_ADDR             (__CORE3_VTOR)
 #define LC_CONFIG_ADDR              (0)
+#define STACK_PAINT_PATTERN         (0xA5A5A5A5)
 
     .syntax unified
     .arch armv7-m
@@ -580,6 +581,23 @@ ITCM_LOOP:
     blt     ITCM_LOOP
 ITCM_LOOP_END:
 
+#ifdef STACK_PAINT
+/******************************************************************/
+/* Fill the stack and the unused DTCM below it with a known       */
+/* pattern, so the stack high-water mark can be measured later.   */
+/******************************************************************/
+StackPaint:
+    ldr  r2, =__INT_DTCM_FREE_START
+    ldr  r3, =__Stack_dtcm_start
+    ldr  r0, =STACK_PAINT_PATTERN
+STACK_PAINT_LOOP:
+    cmp  r2, r3
+    bge  STACK_PAINT_END
+    str  r0, [r2], #4
+    b    STACK_PAINT_LOOP
+STACK_PAINT_END:
+#endif
+
 DebuggerHeldCoreLoop:
     ldr  r0, =RESET_CATCH_CORE
     ldr  r0, [r0]
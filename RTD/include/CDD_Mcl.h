@@ -128,6 +128,12 @@ extern uint8 Mcl_au8FlexioLogicToHwInstance[FLEXIO_INSTANCE_COUNT];
 /*==================================================================================================
 *                                        DEFINES AND MACROS
 ==================================================================================================*/
+/* Latency statistics of the DMA, cache and eMIOS counter bus period services, reported through the
+   Mcl_ApiStatsStartHook/Mcl_ApiStatsStopHook callouts */
+#ifndef MCL_API_STATS
+#define MCL_API_STATS                                (STD_OFF)
+#endif
+
 /* DET APIs */
 /**
 * @brief API service ID for Mcl_Init function
@@ -453,6 +459,12 @@ extern uint8 Mcl_au8FlexioLogicToHwInstance[FLEXIO_INSTANCE_COUNT];
 /** @brief All API's called with wrong logic channel shall return this error. */
 #define MCL_DET_EMIOS_E_INVALID_SET                   ((uint8)0x51)
 
+/**
+* @brief API service ID for Mcl_Emios_SetCounterBusPeriod function
+* @details Identifies the service to the ApiStats latency statistics
+* */
+#define MCL_DET_EMIOS_SET_COUNTER_BUS_PERIOD          ((uint8)0x54)
+
 #endif /* STD_ON == MCL_EMIOS_IS_AVAILABLE */
 
 #if (STD_ON == MCL_TRGMUX_IS_AVAILABLE)
@@ -1976,6 +1988,29 @@ void Mcl_GetVersionInfo(Std_VersionInfoType * const VersionInfo);
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
 
+#if (STD_ON == MCL_API_STATS)
+/**
+* @brief        Callout opening a latency measurement, implemented by the application.
+* @details      Called on entry of each measured service when MCL_API_STATS is STD_ON.
+*
+* @return       uint32          Time stamp handed back to Mcl_ApiStatsStopHook
+*
+*/
+uint32 Mcl_ApiStatsStartHook(void);
+
+/**
+* @brief        Callout closing a latency measurement, implemented by the application.
+* @details      Called on exit of each measured service when MCL_API_STATS is STD_ON.
+*
+* @param[in]    ServiceId       Service ID of the measured API
+* @param[in]    Start           Value returned by Mcl_ApiStatsStartHook on entry
+*
+* @return       void
+*
+*/
+void Mcl_ApiStatsStopHook(uint8 ServiceId, uint32 Start);
+#endif /* MCL_API_STATS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -623,6 +623,84 @@ Dma_Ip_ReturnType Dma_Ip_GetLogicChannelParam(const uint32 LogicCh, const Dma_Ip
  * */
 Dma_Ip_ReturnType Dma_Ip_SetLogicChannelScatterGatherConfig(const uint32 LogicCh, const uint32 Element);
 
+/**
+ * @brief This function compiles a Dma Ip Logic Channel Transfer List into a TCD image.
+ * @details This service is a reentrant function that shall build a complete TCD in RAM
+ *          from a Transfer List, using the same parameters as
+ *          Dma_Ip_SetLogicChannelTransferList. The hardware TCD is not accessed.
+ *          The image is meant to be built once and loaded many times with
+ *          Dma_Ip_LoadLogicChannelTcdImage. Since it has the Software TCD layout it can
+ *          also be used as a scatter/gather element (32 bytes aligned).
+ *
+ * @param[in]  LogicCh           Selection value of the Logic Channel (selects the hardware
+ *                               version used to encode the parameters).
+ * @param[in]  List              Pointer to the Transfer List.
+ * @param[in]  ListDimension     Number of elements in the list.
+ * @param[out] TcdImage          Pointer to the TCD image to be built.
+ *
+ * @return     Dma_Ip_ReturnType DMA_IP_STATUS_SUCCESS is returned if the image was built.
+ *
+ * */
+Dma_Ip_ReturnType Dma_Ip_CompileLogicChannelTransferList(const uint32 LogicCh, const Dma_Ip_LogicChannelTransferListType List[], const uint32 ListDimension, Dma_Ip_SwTcdRegType * const TcdImage);
+
+/**
+ * @brief This function loads a TCD image into the Dma Ip Logic Channel.
+ * @details This service is a reentrant function that shall copy a TCD image built by
+ *          Dma_Ip_CompileLogicChannelTransferList into the Dma Channel's Hardware TCD
+ *          in one pass. The CSR is written last.
+ *          The channel is moved to the transfer state. An image linked with
+ *          Dma_Ip_LinkTcdImage starts the chain of images it points to.
+ *
+ * @param[in]  LogicCh           Selection value of the Logic Channel.
+ * @param[in]  TcdImage          Pointer to the TCD image.
+ *
+ * @return     Dma_Ip_ReturnType DMA_IP_STATUS_SUCCESS is returned if the image was loaded.
+ *                               DMA_IP_STATUS_WRONG_STATE is returned if the Dma Ip Channel state is
+ *                               not Dma_Ip_Ch_ReadyState, Dma_Ip_Ch_TransferState or
+ *                               Dma_Ip_Ch_ScatterGatherState.
+ *                               DMA_IP_STATUS_ERROR is returned if the Dma Ip Channel contains an error.
+ *
+ * */
+Dma_Ip_ReturnType Dma_Ip_LoadLogicChannelTcdImage(const uint32 LogicCh, const Dma_Ip_SwTcdRegType * const TcdImage);
+
+/**
+ * @brief This function re-arms the Dma Ip Logic Channel with new addresses and length.
+ * @details This service is a reentrant function that shall update only the source address,
+ *          the destination address and the major loop count of the Dma Channel's Hardware TCD.
+ *          All other transfer settings (offsets, sizes, minor loop, interrupts) are kept
+ *          from the previous Transfer List or TCD image.
+ *
+ * @param[in]  LogicCh           Selection value of the Logic Channel.
+ * @param[in]  SrcAddr           New source address.
+ * @param[in]  DstAddr           New destination address.
+ * @param[in]  MajorCount        New major loop count.
+ *
+ * @return     Dma_Ip_ReturnType DMA_IP_STATUS_SUCCESS is returned if the channel was re-armed.
+ *                               DMA_IP_STATUS_WRONG_STATE is returned if the Dma Ip Channel state is
+ *                               not Dma_Ip_Ch_TransferState.
+ *                               DMA_IP_STATUS_ERROR is returned if the Dma Ip Channel contains an error.
+ *
+ * */
+Dma_Ip_ReturnType Dma_Ip_RearmLogicChannel(const uint32 LogicCh, const uint32 SrcAddr, const uint32 DstAddr, const uint32 MajorCount);
+
+/**
+ * @brief This function links a TCD image to the next one of a scatter/gather chain.
+ * @details This service is a reentrant function that shall set the scatter/gather address
+ *          of a TCD image built by Dma_Ip_CompileLogicChannelTransferList and enable
+ *          scatter/gather processing on it. Passing NULL_PTR as NextTcdImage ends the chain.
+ *          Linking the last image back to the first one builds a ring that the eDMA
+ *          runs without any reconfiguration of the channel.
+ *          Only the RAM image is updated, the hardware TCD is not accessed.
+ *
+ * @param[in]  LogicCh           Selection value of the Logic Channel.
+ * @param[in]  TcdImage          Pointer to the TCD image to be updated.
+ * @param[in]  NextTcdImage      Pointer to the next TCD image (32 bytes aligned) or NULL_PTR.
+ *
+ * @return     Dma_Ip_ReturnType DMA_IP_STATUS_SUCCESS is returned if the image was updated.
+ *
+ * */
+Dma_Ip_ReturnType Dma_Ip_LinkTcdImage(const uint32 LogicCh, Dma_Ip_SwTcdRegType * const TcdImage, const Dma_Ip_SwTcdRegType * const NextTcdImage);
+
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
 
@@ -183,6 +183,8 @@ void HwAccDmaCh_GetParam(const uint32 Parameter, const uint32 LocHwVers, const u
 ==================================================================================================*/
 void HwAccDmaCh_LoadConfigIntoSoftwareTcd(uint32 HwVersId, const Dma_Ip_ScatterGatherConfigType * const pxLocScatterGather, const uint32 ElementId, const boolean NotLastElement);
 void HwAccDmaCh_LoadSoftwareTcdIntoHardwareTcd(const Dma_Ip_LogicChannelIdType * const pxLocLogicCh, const Dma_Ip_ScatterGatherConfigType * const pxLocScatterGather);
+void HwAccDmaCh_LoadTcdImageIntoHardwareTcd(const Dma_Ip_LogicChannelIdType * const pxLocLogicCh, const Dma_Ip_SwTcdRegType * const pxLocTcdImage);
+void HwAccDmaCh_RearmHardwareTcd(const Dma_Ip_LogicChannelIdType * const pxLocLogicCh, const uint32 LocSrcAddr, const uint32 LocDstAddr, const uint32 LocMajorCount);
 
 /*==================================================================================================
  *  IP INTERNAL FUNCTIONS
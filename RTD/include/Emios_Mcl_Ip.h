@@ -255,6 +255,20 @@ uint32 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel);
 uint16 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel);
 #endif
 
+/**
+ * @brief  Get the current count of a counter bus channel
+ * @details Reads the UC CNT register, e.g. to measure the counter bus clock against the core clock.
+ *
+ * @param Instance  Instance of EMIOS used.
+ * @param Channel   EMIOS hardware channel used.
+ * @return The counter value of the channel
+ */
+#if (STD_ON == EMIOS_MCL_IP_24BITS_TIMER_WIDTH)
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel);
+#else
+uint16 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel);
+#endif
+
 #if (STD_ON == EMIOS_IP_MULTICORE_IS_AVAILABLE)
 /**
  * @brief
@@ -43,6 +43,7 @@ extern "C"{
 * 3) internal and external interfaces from this unit
 ==================================================================================================*/
 #include "Std_Types.h"
+#include "Mcal.h"
 #include "Emios_Pwm_Ip_Cfg.h"
 #include "Emios_Pwm_Ip_Types.h"
 
@@ -114,6 +115,34 @@ extern "C"{
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+/* Counter bus dimming: one duty cycle multiplier per counter bus, see Emios_Pwm_Ip_SetBusBrightness */
+#ifndef EMIOS_PWM_IP_BUS_DIMMING
+    #define EMIOS_PWM_IP_BUS_DIMMING                (STD_OFF)
+#endif
+
+/* Size and alignment of a channel state record, a cache line of the Cortex-M7 data cache */
+#define EMIOS_PWM_IP_CH_STATE_SIZE                  (32U)
+
+/* Bytes of the channel state fields: notification pointer, two modes, three counter values and
+   four flags; the rest of the line is padding */
+#if (CPU_TYPE == CPU_TYPE_64)
+    #define EMIOS_PWM_IP_CH_STATE_PTR_SIZE          (8U)
+#else
+    #define EMIOS_PWM_IP_CH_STATE_PTR_SIZE          (4U)
+#endif
+#ifdef EMIOS_PWM_IP_TIMER_WIDTH_24BITS
+    #define EMIOS_PWM_IP_CH_STATE_CNT_SIZE          (4U)
+#else
+    #define EMIOS_PWM_IP_CH_STATE_CNT_SIZE          (2U)
+#endif
+#define EMIOS_PWM_IP_CH_STATE_FIELDS                (EMIOS_PWM_IP_CH_STATE_PTR_SIZE + 8U + \
+                                                     (3U * EMIOS_PWM_IP_CH_STATE_CNT_SIZE) + 4U)
+#if (EMIOS_PWM_IP_CH_STATE_FIELDS < EMIOS_PWM_IP_CH_STATE_SIZE)
+    #define EMIOS_PWM_IP_CH_STATE_PAD               (EMIOS_PWM_IP_CH_STATE_SIZE - EMIOS_PWM_IP_CH_STATE_FIELDS)
+#endif
+
+/* Brightness of an undimmed counter bus, same scale as the Pwm duty cycle */
+#define EMIOS_PWM_IP_BRIGHTNESS_FULL                (0x8000U)
 
 /*==================================================================================================
 *                                              ENUMS
@@ -122,51 +151,46 @@ extern "C"{
 /*==================================================================================================
 *                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+/**
+* @brief        Run time state of one configured channel
+* @details      Everything a duty cycle update or a channel interrupt reads or writes, kept in
+*               one record per channel, so the channel index is looked up once per call instead
+*               of once per field. Reserved pads the record to a whole cache line and the array
+*               is aligned to one, so no record straddles two lines.
+*/
+typedef struct
+{
+    /** @brief Notification handler of the channel */
+    Emios_Pwm_Ip_NotificationType const *NotificationPtr;
+    /** @brief Mode the channel was initialized in */
+    Emios_Pwm_Ip_PwmModeType             InitialMode;
+    /** @brief Current mode, GPO while the output is forced */
+    Emios_Pwm_Ip_PwmModeType             CurrentMode;
+    /** @brief Period in ticks */
+    Emios_Pwm_Ip_PeriodType              Period;
+    /** @brief Duty cycle in ticks */
+    Emios_Pwm_Ip_DutyType                DutyCycle;
+    /** @brief Register A value (leading edge) in OPWM, OPWMB and OPWMT modes */
+    Emios_Pwm_Ip_PeriodType              RegA;
+    /** @brief Initial, uninitialized or idle state; for bus channels the number of users */
+    uint8                                CheckState;
+    /** @brief Notification enabled */
+    uint8                                CheckEnableNotif;
+    /** @brief Interrupt held off because the duty cycle is 0% or 100% */
+    uint8                                Notif;
+    /** @brief Output polarity in OPWFM and DAOC modes */
+    uint8                                Polarity;
+#ifdef EMIOS_PWM_IP_CH_STATE_PAD
+    /** @brief Fills the record to EMIOS_PWM_IP_CH_STATE_SIZE bytes */
+    uint8                                Reserved[EMIOS_PWM_IP_CH_STATE_PAD];
+#endif
+} Emios_Pwm_Ip_ChStateType;
 
 /*==================================================================================================
 *                                  GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
 #if (EMIOS_PWM_IP_USED == STD_ON)
 
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_CLEARED_8_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_CLEARED_8
-#endif
-#include "Pwm_MemMap.h"
-
-/** @brief Arrays to check the state of Channel is initial state or uninitialized state or idle state */
-extern uint8 Emios_Pwm_Ip_aCheckState[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-/** @brief Arrays to check the state of Channel in the notification or not */
-extern uint8 Emios_Pwm_Ip_aCheckEnableNotif[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_CLEARED_8_NO_CACHEABLE
-#else
-    #define PWM_STOP_SEC_VAR_CLEARED_8
-#endif
-#include "Pwm_MemMap.h"
-
-
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_INIT_UNSPECIFIED_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_INIT_UNSPECIFIED
-#endif
-#include "Pwm_MemMap.h"
-
-/* Array with current pwm modes for each Emios Channel */
-extern Emios_Pwm_Ip_PwmModeType Emios_Pwm_Ip_aCurrentModes[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_INIT_UNSPECIFIED_NO_CACHEABLE
-#else
-    #define PWM_STOP_SEC_VAR_INIT_UNSPECIFIED
-#endif
-#include "Pwm_MemMap.h"
-
-
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
 #else
@@ -174,8 +198,8 @@ extern Emios_Pwm_Ip_PwmModeType Emios_Pwm_Ip_aCurrentModes[EMIOS_PWM_IP_NUM_OF_C
 #endif
 #include "Pwm_MemMap.h"
 
-/** @brief Array with notification handlers for all configurable channels */
-extern Emios_Pwm_Ip_NotificationType const *Emios_Pwm_Ip_aNotificationPtr[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
+/** @brief State of all configurable channels, indexed through eMios_Pwm_Ip_IndexInChState */
+extern Emios_Pwm_Ip_ChStateType Emios_Pwm_Ip_aChState[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
 
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
@@ -185,43 +209,6 @@ extern Emios_Pwm_Ip_NotificationType const *Emios_Pwm_Ip_aNotificationPtr[EMIOS_
 #include "Pwm_MemMap.h"
 
 
-#ifdef EMIOS_PWM_IP_TIMER_WIDTH_24BITS
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_CLEARED_32_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_CLEARED_32
-#endif
-#else
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_CLEARED_16_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_CLEARED_16
-#endif
-#endif
-#include "Pwm_MemMap.h"
-
-/** @brief Array with period for all channels */
-extern Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_aPeriod[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-/** @brief Array with duty cycle for all channels */
-extern Emios_Pwm_Ip_DutyType Emios_Pwm_Ip_aDutyCycle[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-#ifdef EMIOS_PWM_IP_TIMER_WIDTH_24BITS
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_CLEARED_32_NO_CACHEABLE
-#else
-    #define PWM_STOP_SEC_VAR_CLEARED_32
-#endif
-#else
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_CLEARED_16_NO_CACHEABLE
-#else
-    #define PWM_STOP_SEC_VAR_CLEARED_16
-#endif
-#endif
-#include "Pwm_MemMap.h"
-
-
 #define PWM_START_SEC_CONST_UNSPECIFIED
 #include "Pwm_MemMap.h"
 
@@ -618,6 +605,30 @@ void Emios_Pwm_Ip_UpdateUCRegA(uint8 Instance, uint8 Channel, Emios_Pwm_Ip_Perio
 */
 void Emios_Pwm_Ip_UpdateUCRegB(uint8 Instance, uint8 Channel, Emios_Pwm_Ip_PeriodType Value);
 
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+/**
+* @brief        This function sets the brightness of all channels driven by the counter bus of
+*               Channel, keeping their relative duty cycles.
+* @details      Brightness is a multiplier on the duty cycle of every OPWM, OPWMB, OPWMCB and
+*               OPWMT channel of the bus, of any bus mode. Only the multiplier is stored here;
+*               each channel applies it with one multiply on its next duty cycle write, so the
+*               cost does not grow with the channels of the bus. For all channels to change in
+*               the same period, write their duty cycles with Pwm_SetDutyCycle_NoUpdate and
+*               release them with Pwm_SyncUpdate; the comparator transfer mask is not touched
+*               here. The bus period, and so the PWM frequency, is left as it is. The
+*               brightness is dropped when the last channel of the bus is deinitialized.
+*
+* @param        Instance          eMIOS hardware module index
+* @param        Channel           Any channel driven by the counter bus
+* @param        Brightness        0 ... EMIOS_PWM_IP_BRIGHTNESS_FULL
+*
+* @return       EMIOS_PWM_IP_STATUS_ERROR if Channel uses no counter bus or Brightness is out
+*               of range
+*
+*/
+Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetBusBrightness(uint8 Instance, uint8 Channel, uint16 Brightness);
+#endif
+
 
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
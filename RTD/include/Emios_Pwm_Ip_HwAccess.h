@@ -742,6 +742,19 @@ static inline boolean Emios_Pwm_Ip_GetOverFlagEvent(const Emios_Pwm_Ip_HwAddrTyp
     return (((Base->CH.UC[Channel].S & eMIOS_S_FLAG_MASK) >> eMIOS_S_FLAG_SHIFT) == 0U)? FALSE : TRUE;
 }
 
+/*!
+ * brief Get OVR, OVFL and FLAG bits with a single register read
+ * param[in] Base     The Emios Base address pointer
+ * param[in] Channel  The Channel id for the given instance
+ * return The S register masked to the three event bits, 0 when no event is pending
+ */
+static inline uint32 Emios_Pwm_Ip_GetStatusFlags(const Emios_Pwm_Ip_HwAddrType *const Base,
+                                                 uint8 Channel
+                                                )
+{
+    return Base->CH.UC[Channel].S & (eMIOS_S_OVR_MASK | eMIOS_S_OVFL_MASK | eMIOS_S_FLAG_MASK);
+}
+
 /*-----------------------UC register ALTA-----------------------------*/
 /*!
  * brief Set A2 Channel registers Value
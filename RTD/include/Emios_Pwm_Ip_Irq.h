@@ -74,6 +74,27 @@ extern "C"{
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+/* Deferred notification: the IRQ handler queues the event and Emios_Pwm_Ip_DispatchNotifications
+   calls the user callback later, outside interrupt context */
+#ifndef EMIOS_PWM_IP_DEFERRED_NOTIFICATION
+    #define EMIOS_PWM_IP_DEFERRED_NOTIFICATION      (STD_OFF)
+#endif
+
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+/* Number of queued events, must be a power of two */
+#ifndef EMIOS_PWM_IP_NOTIF_QUEUE_SIZE
+    #define EMIOS_PWM_IP_NOTIF_QUEUE_SIZE           (32U)
+#endif
+
+/* OsIf counter used to timestamp the queued events */
+#ifndef EMIOS_PWM_IP_NOTIF_COUNTER_TYPE
+    #define EMIOS_PWM_IP_NOTIF_COUNTER_TYPE         (OSIF_COUNTER_SYSTEM)
+#endif
+
+#if ((EMIOS_PWM_IP_NOTIF_QUEUE_SIZE & (EMIOS_PWM_IP_NOTIF_QUEUE_SIZE - 1U)) != 0U)
+    #error "EMIOS_PWM_IP_NOTIF_QUEUE_SIZE must be a power of two"
+#endif
+#endif
 
 /*==================================================================================================
 *                                              ENUMS
@@ -82,6 +103,23 @@ extern "C"{
 /*==================================================================================================
 *                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+/** @brief Channel event captured by the IRQ handler */
+typedef struct
+{
+    uint8  ChannelIdx;     /**< Index of the channel in the notification table */
+    uint32 Flags;          /**< OVR, OVFL and FLAG bits of the UC S register */
+    uint32 Timestamp;      /**< OsIf counter value when the event was queued */
+} Emios_Pwm_Ip_NotifEventType;
+
+/** @brief Deferred notification queue statistics */
+typedef struct
+{
+    uint32 Dispatched;     /**< Callbacks called by Emios_Pwm_Ip_DispatchNotifications */
+    uint32 Overflows;      /**< Events dropped because the queue was full */
+    uint32 PeakLevel;      /**< Highest number of queued events seen by the IRQ handler */
+} Emios_Pwm_Ip_NotifStatsType;
+#endif
 
 /*==================================================================================================
 *                                  GLOBAL VARIABLE DECLARATIONS
@@ -101,6 +139,35 @@ extern "C"{
  *END*************************************************************************/
 void Emios_Pwm_Ip_IrqHandler(uint8 Instance, uint8 Channel);
 
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+/*FUNCTION*********************************************************************
+ *
+ * Function Name : Emios_Pwm_Ip_DispatchNotifications
+ * Description   : Calls the user notification of every queued event, oldest first.
+ * The queue has a single consumer: call from one context only, the main loop or a
+ * low priority software interrupt. Returns the number of callbacks called.
+ *
+ *END*************************************************************************/
+uint32 Emios_Pwm_Ip_DispatchNotifications(void);
+
+/*FUNCTION*********************************************************************
+ *
+ * Function Name : Emios_Pwm_Ip_GetNotifStats
+ * Description   : Copies the deferred notification queue statistics.
+ *
+ *END*************************************************************************/
+void Emios_Pwm_Ip_GetNotifStats(Emios_Pwm_Ip_NotifStatsType * Stats);
+
+/*FUNCTION*********************************************************************
+ *
+ * Function Name : Emios_Pwm_Ip_GetDispatchedEvent
+ * Description   : Event whose callback the dispatcher is running, with its flags and
+ * timestamp. Only valid inside a deferred callback.
+ *
+ *END*************************************************************************/
+const Emios_Pwm_Ip_NotifEventType *Emios_Pwm_Ip_GetDispatchedEvent(void);
+#endif
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
 
@@ -350,6 +350,92 @@ void Flexio_Mcl_Ip_ClearPinStatus(FLEXIO_Type *baseAddr, uint8 pin);
 uint32 Flexio_Mcl_Ip_GetAllPinsInterrupt(const FLEXIO_Type *baseAddr);
 #endif
 
+/**
+ * @brief   Set the mode, pin and clock timer of a shifter (SHIFTCTL)
+ * @details Writing FLEXIO_SHIFTER_MODE_DISABLED stops the shifter. The timer polarity
+ *          selects the shift clock edge the output changes on.
+ * @param[in] baseAddr  FlexIO instance
+ * @param[in] shifter   Shifter index, below FLEXIO_SHIFTCTL_COUNT
+ * @param[in] pin       FlexIO pin the shifter drives or samples
+ * @param[in] timer     Timer clocking the shifter, below FLEXIO_TIMCTL_COUNT
+ */
+void Flexio_Mcl_Ip_SetShifterControl(FLEXIO_Type *baseAddr,
+                                     uint8 shifter,
+                                     Flexio_Mcl_Ip_ShifterModeType mode,
+                                     uint8 pin,
+                                     Flexio_Mcl_Ip_PinPolarityType pinPolarity,
+                                     Flexio_Mcl_Ip_PinConfigType pinConfig,
+                                     uint8 timer,
+                                     Flexio_Mcl_Ip_TimerPolarityType timerPolarity);
+
+/**
+ * @brief   Set the start bit, stop bit and input source of a shifter (SHIFTCFG)
+ * @param[in] baseAddr  FlexIO instance
+ * @param[in] shifter   Shifter index, below FLEXIO_SHIFTCFG_COUNT
+ */
+void Flexio_Mcl_Ip_SetShifterConfig(FLEXIO_Type *baseAddr,
+                                    uint8 shifter,
+                                    Flexio_Mcl_Ip_ShifterStartType start,
+                                    Flexio_Mcl_Ip_ShifterStopType stop,
+                                    Flexio_Mcl_Ip_ShifterSourceType source);
+
+/**
+ * @brief   Address of the buffer of a shifter, for use as a DMA source or destination
+ * @details In bit swap mode the buffer is reached through SHIFTBUFBIS, so a transmit
+ *          shifter sends bit 31 of the written word first.
+ * @param[in] baseAddr  FlexIO instance
+ * @param[in] shifter   Shifter index, below FLEXIO_SHIFTBUF_COUNT
+ * @return  Bus address of SHIFTBUF or SHIFTBUFBIS of the shifter
+ */
+uint32 Flexio_Mcl_Ip_GetShifterBufferAddress(const FLEXIO_Type *baseAddr,
+                                             uint8 shifter,
+                                             Flexio_Mcl_Ip_ShifterBufferModeType mode);
+
+/**
+ * @brief   Set the trigger, pin and mode of a timer (TIMCTL)
+ * @details Writing FLEXIO_TIMER_MODE_DISABLED stops the timer. An internal trigger of
+ *          4 * n + 1 is the status flag of shifter n.
+ * @param[in] baseAddr  FlexIO instance
+ * @param[in] timer     Timer index, below FLEXIO_TIMCTL_COUNT
+ * @param[in] trigger   Trigger selection, TRGSEL
+ * @param[in] pin       FlexIO pin of the timer output or input
+ */
+void Flexio_Mcl_Ip_SetTimerControl(FLEXIO_Type *baseAddr,
+                                   uint8 timer,
+                                   uint8 trigger,
+                                   Flexio_Mcl_Ip_TriggerPolarityType triggerPolarity,
+                                   Flexio_Mcl_Ip_TriggerSourceType triggerSource,
+                                   uint8 pin,
+                                   Flexio_Mcl_Ip_PinPolarityType pinPolarity,
+                                   Flexio_Mcl_Ip_PinConfigType pinConfig,
+                                   Flexio_Mcl_Ip_TimerModeType mode);
+
+/**
+ * @brief   Set when a timer is enabled, decremented, reset and disabled (TIMCFG)
+ * @details Also sets its start bit, stop bit and the output level when enabled.
+ * @param[in] baseAddr  FlexIO instance
+ * @param[in] timer     Timer index, below FLEXIO_TIMCFG_COUNT
+ */
+void Flexio_Mcl_Ip_SetTimerConfig(FLEXIO_Type *baseAddr,
+                                  uint8 timer,
+                                  Flexio_Mcl_Ip_TimerStartType start,
+                                  Flexio_Mcl_Ip_TimerStopType stop,
+                                  Flexio_Mcl_Ip_TimerEnableType enable,
+                                  Flexio_Mcl_Ip_TimerDisableType disable,
+                                  Flexio_Mcl_Ip_TimerResetType reset,
+                                  Flexio_Mcl_Ip_TimerDecrementType decrement,
+                                  Flexio_Mcl_Ip_TimerOutputType output);
+
+/**
+ * @brief   Set the compare value of a timer (TIMCMP)
+ * @details In the dual 8-bit modes the upper byte holds twice the number of bits minus one,
+ *          or the high period, and the lower byte half the baud divider minus one, or the
+ *          low period.
+ * @param[in] baseAddr  FlexIO instance
+ * @param[in] timer     Timer index, below FLEXIO_TIMCMP_COUNT
+ */
+void Flexio_Mcl_Ip_SetTimerCompare(FLEXIO_Type *baseAddr, uint8 timer, uint16 value);
+
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
 
@@ -210,6 +210,22 @@ typedef struct{
     uint16 Value;
 }Lcu_Ip_AsyncOutputValueType;
 
+/**
+ * @brief This type contains the Lcu Ip Logic Cell register image.
+ * @details The Lcu Ip Logic Cell image holds the complete input and output configuration of one
+ *          Logic Cell, so it can be committed with a single call.
+ *          MuxSel, LutCtrl, RiseFilt and FallFilt are indexed by the LC input/output number.
+ *          OutPol and OutEn hold one bit per LC output (bit 0 for output 0).
+ * */
+typedef struct{
+    uint8 MuxSel[LCU_NUM_OUTPUT_PER_LC];         /**< @brief [MUXSEL] Input MUX Select of each LC input. */
+    uint16 LutCtrl[LCU_NUM_OUTPUT_PER_LC];       /**< @brief [LUTCTRL] LUT control of each LC output. */
+    uint16 RiseFilt[LCU_NUM_OUTPUT_PER_LC];      /**< @brief [LUT_RISE_FILT] LUT Rise Filter of each LC output. */
+    uint16 FallFilt[LCU_NUM_OUTPUT_PER_LC];      /**< @brief [LUT_FALL_FILT] LUT Fall Filter of each LC output. */
+    uint8 OutPol;                                /**< @brief [OUTPOL] Output Polarity mask. */
+    uint8 OutEn;                                 /**< @brief [OUTEN] Output Enable mask. */
+}Lcu_Ip_LogicCellImageType;
+
 /*==================================================================================================
 *                                  GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
@@ -898,6 +914,29 @@ Lcu_Ip_ReturnType Lcu_Ip_GetAsyncLogicInputInfo(const uint8 LogicInput, const Lc
  * */
 Lcu_Ip_ReturnType Lcu_Ip_GetAsyncLogicOutputInfo(const uint8 LogicOutput, const Lcu_Ip_LogicOutputInfoParamType Param, uint8 * const Value);
 
+/**
+ * @brief This function commits a complete register image to one Logic Cell
+ * @details This service is a reentrant function that shall write the input MUX selections,
+ *          LUTs, filters, polarity and output enables of one Logic Cell in one pass.
+ *          The outputs of the Logic Cell are disabled while the image is written and the OutEn
+ *          mask of the image is applied last, so no intermediate LUT combination reaches the pins.
+ *
+ *          How to use this interface:
+ *          [in] LogicInstance -> The Logic Instance generated by the configurator.
+ *          [in] HwLogicCell -> Hardware Logic Cell number inside the instance.
+ *          [in] pxImage -> Image built by the application (see Lcu_Ip_LogicCellImageType)
+ *
+ * @param[in]  LogicInstance  Specifies the Logic Instance
+ * @param[in]  HwLogicCell    Hardware Logic Cell number
+ * @param[in]  pxImage        Logic Cell register image
+ *
+ * @return Lcu_Ip_ReturnType LCU_IP_STATUS_WRONG_CORE is returned if enable the multi-cores feature and the Logic Cell has the incorrect partition.
+ *                           LCU_IP_STATUS_PROTECTED is returned if the write protect of the instance is enabled.
+ *                           LCU_IP_STATUS_SUCCESS is returned in the remaining cases
+ *
+ * */
+Lcu_Ip_ReturnType Lcu_Ip_SetLogicCellImage(const uint8 LogicInstance, const uint8 HwLogicCell, const Lcu_Ip_LogicCellImageType * const pxImage);
+
 #endif /* #if (STD_ON == LCU_IP_ASYNC_FUNC_IS_AVAILABLE) */
 
 #define MCL_STOP_SEC_CODE
@@ -214,6 +214,8 @@ void HwAcc_Lcu_SetInstanceOperationMode(const uint8 LucId, const uint8 Operation
 
 /* Set FCTRL value */
 void HwAcc_Lcu_SetLcForceControl(const uint8 LcuId, const uint8 HwLcOutputId, const Lcu_Ip_LogicOutputConfigType * const pConfig);
+/* Write a complete Logic Cell image */
+void HwAcc_Lcu_SetLogicCellImage(const uint8 LcuId, const uint8 LcId, const Lcu_Ip_LogicCellImageType * const pImage);
 
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
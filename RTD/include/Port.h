@@ -272,6 +272,11 @@ extern "C" {
 /*=================================================================================================
 *                                      DEFINES AND MACROS
 =================================================================================================*/
+/* Latency statistics of the run time services, reported through the
+   Port_ApiStatsStartHook/Port_ApiStatsStopHook callouts */
+#ifndef PORT_API_STATS
+    #define PORT_API_STATS                  (STD_OFF)
+#endif
 
 /*=================================================================================================
 *                                              ENUMS
@@ -430,6 +435,29 @@ void Port_ResetPinMode(Port_PinType Pin);
 #define PORT_STOP_SEC_CODE
 #include "Port_MemMap.h"
 
+#if (STD_ON == PORT_API_STATS)
+/**
+* @brief        Callout opening a latency measurement, implemented by the application.
+* @details      Called on entry of each measured service when PORT_API_STATS is STD_ON.
+*
+* @return       uint32          Time stamp handed back to Port_ApiStatsStopHook
+*
+*/
+uint32 Port_ApiStatsStartHook(void);
+
+/**
+* @brief        Callout closing a latency measurement, implemented by the application.
+* @details      Called on exit of each measured service when PORT_API_STATS is STD_ON.
+*
+* @param[in]    ServiceId       Service ID of the measured API
+* @param[in]    Start           Value returned by Port_ApiStatsStartHook on entry
+*
+* @return       void
+*
+*/
+void Port_ApiStatsStopHook(uint8 ServiceId, uint32 Start);
+#endif /* PORT_API_STATS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -175,7 +175,7 @@ extern "C"{
 #define PWM_E_ALREADY_INITIALIZED                   (0x14U)
 
 /**
-* @brief            Generated when a NULL_PTR pointer is passed to Pwm_GetVersionInfo function
+* @brief            Generated when a NULL_PTR pointer is passed to Pwm_GetVersionInfo or Pwm_TraceRead
 * @details          Errors and exceptions that will be detected by the PWM driver
 */
 #define PWM_E_PARAM_POINTER                         (0x15U)
@@ -505,6 +505,18 @@ extern "C"{
 * @details          Parameters used when raising an error/exception
 */
 #define PWM_ENABLEOU_ID                             (0x41U)
+
+/**
+* @brief            API service ID of Pwm_EnableNotificationDecimated function
+* @details          Parameters used when raising an error/exception
+*/
+#define PWM_ENABLENOTIFICATIONDECIMATED_ID          (0x42U)
+
+/**
+* @brief            API service ID of Pwm_TraceRead function
+* @details          Parameters used when raising an error/exception
+*/
+#define PWM_TRACEREAD_ID                            (0x43U)
 /*==================================================================================================
 *                                              ENUMS
 ==================================================================================================*/
@@ -605,6 +617,35 @@ typedef enum
     PWM_ALTERNATIVE_PRESCALER   = 0x01U
 } Pwm_PrescalerType;
 
+#if (PWM_TRACE == STD_ON)
+/**
+* @brief        Trace event type
+* @details      Event of a Pwm_TraceRecordType. The channel field holds the logical channel, the
+*               module id for PWM_TRACE_SYNC_UPDATE.
+*
+*/
+typedef enum
+{
+    /** @brief  Duty cycle applied, value 0x0000 ... 0x8000 */
+    PWM_TRACE_SET_DUTY              = 0x01U,
+    /** @brief  Period applied, value in ticks; the duty cycle of the same call follows */
+    PWM_TRACE_SET_PERIOD            = 0x02U,
+    /** @brief  Duty cycle buffered until Pwm_SyncUpdate, value 0x0000 ... 0x8000 */
+    PWM_TRACE_SET_DUTY_NO_UPDATE    = 0x03U,
+    /** @brief  Period buffered until Pwm_SyncUpdate, value in ticks */
+    PWM_TRACE_SET_PERIOD_NO_UPDATE  = 0x04U,
+    /** @brief  Buffered values of the module applied, value 0 */
+    PWM_TRACE_SYNC_UPDATE           = 0x05U,
+    /** @brief  Output set to its idle state, value PWM_LOW or PWM_HIGH */
+    PWM_TRACE_OUTPUT_TO_IDLE        = 0x06U,
+    /** @brief  Edge notification received, value 0 */
+    PWM_TRACE_NOTIFICATION          = 0x07U,
+    /** @brief  Phase shift applied or buffered, value in ticks; the duty cycle of the same call
+                follows */
+    PWM_TRACE_SET_PHASE             = 0x08U
+} Pwm_TraceEventType;
+#endif /* PWM_TRACE */
+
 /*==================================================================================================
 *                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
@@ -690,6 +731,27 @@ typedef struct
 #endif
 } Pwm_ConfigType;
 
+#if (PWM_TRACE == STD_ON)
+/**
+* @brief        Trace record
+* @details      8 bytes in the byte order of the core, for decoders reading a dump of the ring:
+*               time stamp at offset 0, event at 4, channel at 5, value at 6. Periods and phase
+*               shifts fit the value whole on the 16-bit eMIOS counters of the S32K344.
+*
+*/
+typedef struct
+{
+    /** @brief  PWM_TRACE_TIMESTAMP() value when the event was recorded */
+    uint32                          Timestamp;
+    /** @brief  Pwm_TraceEventType */
+    uint8                           Event;
+    /** @brief  Logical channel, or module id */
+    uint8                           Channel;
+    /** @brief  Event value, see Pwm_TraceEventType */
+    uint16                          Value;
+} Pwm_TraceRecordType;
+#endif /* PWM_TRACE */
+
 /*==================================================================================================
 *                                  GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
@@ -1027,6 +1089,31 @@ void Pwm_EnableNotification(Pwm_ChannelType           ChannelNumber,
                            );
 #endif /* PWM_NOTIFICATION_SUPPORTED */
 
+/*===============================================================================================*/
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/**
+* @brief        This function enables the user notifications for every Interval-th edge.
+* @details      Same as Pwm_EnableNotification, but the notification function is only called
+*               once per Interval edges, e.g. to pace an animation from a fast PWM. The eMIOS
+*               channel flag cannot be divided in hardware (UCRELDEL only delays the counter bus
+*               reload of the A/B registers), so the edges are still counted in interrupt
+*               context; the saving is the notification function itself.
+*               Interval 0 or 1 notifies every edge. Pwm_EnableNotification and
+*               Pwm_DisableNotification clear the interval.
+*
+* @param[in]    ChannelNumber   Pwm Channel Id in the configuration
+* @param[in]    Notification    Notification type to be enabled
+* @param[in]    Interval        Number of edges per notification
+*
+* @return       void
+*
+*/
+void Pwm_EnableNotificationDecimated(Pwm_ChannelType           ChannelNumber,
+                                     Pwm_EdgeNotificationType  Notification,
+                                     uint16                    Interval
+                                    );
+#endif /* PWM_NOTIFICATION_SUPPORTED */
+
 /*===============================================================================================*/
 #if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
 /**
@@ -1586,9 +1673,72 @@ Std_ReturnType Pwm_PreparePowerState(Pwm_PowerStateType                PowerStat
                                     );
 #endif /* PWM_POWER_STATE_SUPPORTED */
 
+/*===============================================================================================*/
+#if (PWM_TRACE == STD_ON)
+/**
+* @brief        Start or freeze the event trace.
+* @details      The trace runs from reset. Freezing it keeps the ring unchanged while it is read
+*               with Pwm_TraceRead or dumped by a debugger.
+*
+* @param[in]    Enable          TRUE to record events, FALSE to freeze the ring
+*
+* @return       void
+*
+*/
+void Pwm_TraceEnable(boolean Enable);
+
+/**
+* @brief        Copy the most recent trace records.
+* @details      Records are copied oldest first. Events recorded during the copy may overwrite
+*               the oldest records being read, so freeze the trace first for a consistent dump.
+*               A NULL_PTR buffer copies nothing and is reported as PWM_E_PARAM_POINTER.
+*
+* @param[out]   Records         Buffer receiving the records
+* @param[in]    MaxRecords      Size of Records
+*
+* @return       uint32          Number of records copied, at most PWM_TRACE_SIZE
+*
+*/
+uint32 Pwm_TraceRead(Pwm_TraceRecordType * Records,
+                     uint32                MaxRecords
+                    );
+
+/**
+* @brief        Number of events recorded since reset.
+* @details      Events older than the last PWM_TRACE_SIZE ones have been overwritten.
+*
+* @return       uint32          Events recorded, modulo 2^32
+*
+*/
+uint32 Pwm_TraceGetTotal(void);
+#endif /* PWM_TRACE */
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
 
+#if (PWM_API_STATS == STD_ON)
+/**
+* @brief        Callout opening a latency measurement, implemented by the application.
+* @details      Called on entry of each measured service when PWM_API_STATS is STD_ON.
+*
+* @return       uint32          Time stamp handed back to Pwm_ApiStatsStopHook
+*
+*/
+uint32 Pwm_ApiStatsStartHook(void);
+
+/**
+* @brief        Callout closing a latency measurement, implemented by the application.
+* @details      Called on exit of each measured service when PWM_API_STATS is STD_ON.
+*
+* @param[in]    ServiceId       Service ID of the measured API
+* @param[in]    Start           Value returned by Pwm_ApiStatsStartHook on entry
+*
+* @return       void
+*
+*/
+void Pwm_ApiStatsStopHook(uint8 ServiceId, uint32 Start);
+#endif /* PWM_API_STATS */
+
 
 #ifdef __cplusplus
 }
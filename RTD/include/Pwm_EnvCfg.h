@@ -111,6 +111,48 @@ extern "C"{
     #define PWM_VALIDATE_CHANNEL_CONFIG_CALL    (PWM_DEV_ERROR_DETECT)
 #endif
 
+/* Trusted configuration: Pwm_Init checks every channel configuration once and refuses an
+   inconsistent one. The channel mode is then fixed, so the services skip the per-call checks
+   of the channel against its mode (phase shift, synchronous update, trigger delay, dead time
+   and output state support) and keep the argument range and mode-dependent argument checks */
+#ifndef PWM_TRUSTED_CONFIG
+    #define PWM_TRUSTED_CONFIG                  (STD_OFF)
+#endif
+
+/* Event trace: duty, period, phase, idle, synchronous update and notification events are
+   written as 8-byte records to a RAM ring of PWM_TRACE_SIZE records, read back with
+   Pwm_TraceRead and turned into CSV or VCD by test/PwmTraceDecode */
+#ifndef PWM_TRACE
+    #define PWM_TRACE                           (STD_OFF)
+#endif
+
+#if (PWM_TRACE == STD_ON)
+#ifndef PWM_TRACE_SIZE
+    #define PWM_TRACE_SIZE                      (256U)
+#endif
+
+/* Time stamp of a record, from the OsIf counter PWM_TRACE_COUNTER_TYPE. The system counter by
+   default; OSIF_COUNTER_CUSTOM gives the core cycles of the DWT started by the custom OsIf
+   timer of the application (OsIf_Timer_Custom.c) */
+#ifndef PWM_TRACE_COUNTER_TYPE
+    #define PWM_TRACE_COUNTER_TYPE              (OSIF_COUNTER_SYSTEM)
+#endif
+
+#ifndef PWM_TRACE_TIMESTAMP
+    #define PWM_TRACE_TIMESTAMP()               OsIf_GetCounter(PWM_TRACE_COUNTER_TYPE)
+#endif
+
+#if ((PWM_TRACE_SIZE & (PWM_TRACE_SIZE - 1U)) != 0U)
+    #error "PWM_TRACE_SIZE must be a power of two"
+#endif
+#endif /* PWM_TRACE */
+
+/* Latency statistics: the duty, period, idle, output state and synchronous update services
+   report their duration through the Pwm_ApiStatsStartHook/Pwm_ApiStatsStopHook callouts */
+#ifndef PWM_API_STATS
+    #define PWM_API_STATS                       (STD_OFF)
+#endif
+
 /*==================================================================================================
 *                                              ENUMS
 ==================================================================================================*/
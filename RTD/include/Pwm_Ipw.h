@@ -563,6 +563,28 @@ void Pwm_Ipw_SetPeriodAndDuty_NoUpdate(Pwm_Ipw_PeriodType             Period,
 */
 Std_ReturnType Pwm_Ipw_ValidateGetOutputState(const Pwm_IpwChannelConfigType * const IpConfig);
 #endif /* (PWM_GET_OUTPUT_STATE_API == STD_ON) && (PWM_DEV_ERROR_DETECT == STD_ON) */
+
+#if ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON))
+/**
+* @brief        Pwm_Ipw_ValidateChannelConfig
+* @details      Check one channel configuration for consistency before it is trusted: the channel
+*               class against the mode, the counter bus against the mode and the channel, the
+*               notification against the mode and interrupt selection, the dead time against the
+*               duty cycle.
+*
+* @param[in]    ChannelClass        Class of the logical channel
+* @param[in]    NotificationUsed    A notification handler is configured for the channel
+* @param[in]    IpConfig            Pointer to PWM top configuration structure
+*
+* @return       Std_ReturnType
+*               E_NOT_OK        The channel configuration is inconsistent
+*               E_OK            The channel configuration is consistent
+*
+*/
+Std_ReturnType Pwm_Ipw_ValidateChannelConfig(Pwm_ChannelClassType                   ChannelClass,
+                                             boolean                                NotificationUsed,
+                                             const Pwm_IpwChannelConfigType * const IpConfig);
+#endif /* (PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON) */
 #if ((PWM_DEV_ERROR_DETECT == STD_ON) && ((PWM_SYNC_UPDATE_API == STD_ON) || (PWM_FAST_UPDATE_API == STD_ON) || (PWM_ENABLE_MASKING_OPERATIONS == STD_ON)))
 /**
 * @brief        Pwm_Ipw_ValidateModuleId
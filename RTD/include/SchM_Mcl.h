@@ -251,6 +251,9 @@ extern void SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_46(void);
 extern void SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_47(void);
 extern void SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_47(void);
 
+extern void SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_48(void);
+extern void SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_48(void);
+
 
 
 #define RTE_STOP_SEC_CODE
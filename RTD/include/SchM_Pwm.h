@@ -188,6 +188,12 @@ extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_27(void);
 extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_28(void);
 extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_28(void);
 
+extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_29(void);
+extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_29(void);
+
+extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_30(void);
+extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_30(void);
+
 extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_31(void);
 extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_31(void);
 
@@ -233,6 +239,9 @@ extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_44(void);
 extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_45(void);
 extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_45(void);
 
+extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_47(void);
+extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_47(void);
+
 extern void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_50(void);
 extern void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_50(void);
 
@@ -0,0 +1,72 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+/*
+* Memory mapping of the TCM hot-path placement profile.
+*
+* Used like the generated <Module>_MemMap.h files, but only from code built with
+* TCM_HOT_PATH defined: interrupt handlers and duty cycle update functions go to ITCM and
+* their state arrays to DTCM, both served without flash wait states or cache misses.
+* The linker script collects the sections into .itcm_text, .data_tcm_data and
+* .bss_tcm_data; the start-up code copies them from flash and then moves VTOR to the vector
+* table copy in DTCM (__RAM_INTERRUPT_START). HotPath.h has the probes to measure the
+* difference on the target.
+*
+* No include guard: the file is included once per section switch.
+*/
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+#define MEMMAP_ERROR
+
+#ifdef TCM_START_SEC_CODE
+    #undef TCM_START_SEC_CODE
+    #undef MEMMAP_ERROR
+    #pragma GCC section text ".itcm_text"
+#endif
+
+#ifdef TCM_STOP_SEC_CODE
+    #undef TCM_STOP_SEC_CODE
+    #undef MEMMAP_ERROR
+    #pragma GCC section text
+#endif
+
+#ifdef TCM_START_SEC_VAR_CLEARED
+    #undef TCM_START_SEC_VAR_CLEARED
+    #undef MEMMAP_ERROR
+    #pragma GCC section bss ".dtcm_bss"
+#endif
+
+#ifdef TCM_STOP_SEC_VAR_CLEARED
+    #undef TCM_STOP_SEC_VAR_CLEARED
+    #undef MEMMAP_ERROR
+    #pragma GCC section bss
+#endif
+
+#ifdef TCM_START_SEC_VAR_INIT
+    #undef TCM_START_SEC_VAR_INIT
+    #undef MEMMAP_ERROR
+    #pragma GCC section data ".dtcm_data"
+#endif
+
+#ifdef TCM_STOP_SEC_VAR_INIT
+    #undef TCM_STOP_SEC_VAR_INIT
+    #undef MEMMAP_ERROR
+    #pragma GCC section data
+#endif
+
+#ifdef MEMMAP_ERROR
+    #error "Tcm_MemMap.h, no valid section define found"
+#endif
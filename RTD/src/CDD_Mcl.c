@@ -600,6 +600,9 @@ void Mcl_GetDmaInstanceStatus(const uint32 Instance, Mcl_DmaInstanceStatusType *
 
 void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
 {
+#if (STD_ON == MCL_API_STATS)
+    uint32 StatsStart = Mcl_ApiStatsStartHook();
+#endif
     Dma_Ip_ReturnType RetStatus;
     boolean ChannelValidation = TRUE;
     boolean CommandValidation = TRUE;
@@ -635,10 +638,17 @@ void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType
     {
         /* Do nothing */
     }
+
+#if (STD_ON == MCL_API_STATS)
+    Mcl_ApiStatsStopHook(MCL_DET_DMA_CHANNEL_COMMAND, StatsStart);
+#endif
 }
 
 void Mcl_GetDmaChannelStatus(const uint32 Channel, Mcl_DmaChannelStatusType * const Status)
 {
+#if (STD_ON == MCL_API_STATS)
+    uint32 StatsStart = Mcl_ApiStatsStartHook();
+#endif
     Dma_Ip_ReturnType RetStatus;
     Dma_Ip_LogicChannelStatusType LocChStatus = {DMA_IP_CH_RESET_STATE, 0U, FALSE, FALSE};
     boolean ChannelValidation = TRUE;
@@ -679,6 +689,10 @@ void Mcl_GetDmaChannelStatus(const uint32 Channel, Mcl_DmaChannelStatusType * co
     {
         /* Do nothing */
     }
+
+#if (STD_ON == MCL_API_STATS)
+    Mcl_ApiStatsStopHook(MCL_DET_DMA_CHANNEL_STATUS, StatsStart);
+#endif
 }
 
 void Mcl_SetDmaChannelGlobalList(const uint32 Channel, const Mcl_DmaChannelGlobalListType List[], const uint32 ListDimension)
@@ -739,6 +753,9 @@ void Mcl_SetDmaChannelGlobalList(const uint32 Channel, const Mcl_DmaChannelGloba
 
 void Mcl_SetDmaChannelTransferList(const uint32 Channel, const Mcl_DmaChannelTransferListType List[], const uint32 ListDimension)
 {
+#if (STD_ON == MCL_API_STATS)
+    uint32 StatsStart = Mcl_ApiStatsStartHook();
+#endif
     Dma_Ip_ReturnType RetStatus;
     uint32 Idx;
     boolean ChannelValidation = TRUE;
@@ -793,6 +810,10 @@ void Mcl_SetDmaChannelTransferList(const uint32 Channel, const Mcl_DmaChannelTra
     {
         /* Do nothing */
     }
+
+#if (STD_ON == MCL_API_STATS)
+    Mcl_ApiStatsStopHook(MCL_DET_DMA_TRANSFER, StatsStart);
+#endif
 }
 
 void Mcl_SetDmaChannelScatterGatherList(const uint32 Channel, const uint32 Element, const Mcl_DmaChannelScatterGatherListType List[], const uint32 ListDimension)
@@ -1073,6 +1094,9 @@ void Mcl_CacheClean(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean E
 
 void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
 {
+#if (STD_ON == MCL_API_STATS)
+    uint32 StatsStart = Mcl_ApiStatsStartHook();
+#endif
 #if (STD_ON == MCL_DEM_IS_AVAILABLE)
     Std_ReturnType Status = E_OK;
 #endif /* #if (STD_ON == MCL_DEM_IS_AVAILABLE) */
@@ -1103,10 +1127,17 @@ void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType
     {
         /* Do nothing */
     }
+
+#if (STD_ON == MCL_API_STATS)
+    Mcl_ApiStatsStopHook(MCL_DET_CACHE_INVALIDATE_BY_ADDRESS, StatsStart);
+#endif
 }
 
 void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
 {
+#if (STD_ON == MCL_API_STATS)
+    uint32 StatsStart = Mcl_ApiStatsStartHook();
+#endif
 #if (STD_ON == MCL_DEM_IS_AVAILABLE)
     Std_ReturnType Status = E_OK;
 #endif /* #if (STD_ON == MCL_DEM_IS_AVAILABLE) */
@@ -1137,6 +1168,10 @@ void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boo
     {
         /* Do nothing */
     }
+
+#if (STD_ON == MCL_API_STATS)
+    Mcl_ApiStatsStopHook(MCL_DET_CACHE_CLEAN_BY_ADDRESS, StatsStart);
+#endif
 }
 
 #endif /* #if (STD_ON == MCL_CACHE_IS_AVAILABLE) */
@@ -1289,6 +1324,9 @@ void Mcl_Emios_SetReloadInterval(uint16 Channel, uint8 Interval)
 /** @implements Mcl_Emios_SetCounterBusPeriod_Activity */
 void Mcl_Emios_SetCounterBusPeriod(uint16 logicalChannel, uint32 period, boolean syncUpdate)
 {
+#if (STD_ON == MCL_API_STATS)
+    uint32 StatsStart = Mcl_ApiStatsStartHook();
+#endif
     uint8  HwChannel   = (uint8)(255U & logicalChannel);
     uint8  HwInstance  = (uint8)(logicalChannel >> 8U);
     uint32 ChannelMask = (uint32)((uint32)1U << (uint32)HwChannel);
@@ -1342,6 +1380,9 @@ void Mcl_Emios_SetCounterBusPeriod(uint16 logicalChannel, uint32 period, boolean
     (void)Emios_Mcl_Ip_SetCounterBusPeriod(HwInstance, HwChannel, period);
 #endif /* MCL_DET_IS_AVAILABLE */
 
+#if (STD_ON == MCL_API_STATS)
+    Mcl_ApiStatsStopHook(MCL_DET_EMIOS_SET_COUNTER_BUS_PERIOD, StatsStart);
+#endif
 }
 
 /** @implements Mcl_EmiosConfigureGlobalTimebase_Activity */
@@ -1445,6 +1445,252 @@ static void Static_Dma_Ip_SetLogicChannelTransferList(const uint32 LogicCh, Dma_
 
 
 
+Dma_Ip_ReturnType Dma_Ip_CompileLogicChannelTransferList(const uint32 LogicCh, const Dma_Ip_LogicChannelTransferListType List[], const uint32 ListDimension, Dma_Ip_SwTcdRegType * const TcdImage)
+{
+    Dma_Ip_ReturnType LocStatus = DMA_IP_STATUS_SUCCESS;
+    uint32 LocParamIdx;
+    uint32 LocHwVers;
+
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit);
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]);
+    DMA_IP_DEV_ASSERT(DMA_IP_NOF_CFG_LOGIC_CHANNELS > LogicCh);
+    DMA_IP_DEV_ASSERT((DMA_IP_CH_SET_CONTROL_BANDWIDTH + 1U) > ListDimension);
+    DMA_IP_DEV_ASSERT(NULL_PTR != TcdImage);
+
+    LocHwVers = Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]->LogicChId.HwVersId;
+
+    /* Start from an empty TCD so the image only holds what the list describes */
+    TcdImage->reg_SADDR = 0U;
+    TcdImage->reg_SOFF = 0U;
+    TcdImage->reg_ATTR = 0U;
+    TcdImage->reg_NBYTES.reg_MLOFFYES = 0U;
+    TcdImage->reg_SLAST_SDA = 0U;
+    TcdImage->reg_DADDR = 0U;
+    TcdImage->reg_DOFF = 0U;
+    TcdImage->reg_CITER.reg_ELINKYES = 0U;
+    TcdImage->reg_DLAST_SGA = 0U;
+    TcdImage->reg_CSR = 0U;
+    TcdImage->reg_BITER.reg_ELINKYES = 0U;
+
+    /* The image lives in RAM, no user mode access rights are needed */
+    for(LocParamIdx = 0U; LocParamIdx < ListDimension; LocParamIdx++)
+    {
+    #if (STD_ON == DMA_IP_TRANSFER_MODE_CONTROL_IS_AVAILABLE)
+        DMA_IP_DEV_ASSERT(DMA_IP_CH_SET_CONTROL_TRANSFER_MODE >= List[LocParamIdx].Param);
+    #else
+        DMA_IP_DEV_ASSERT(DMA_IP_CH_SET_CONTROL_BANDWIDTH >= List[LocParamIdx].Param);
+    #endif
+        HwAccDmaCh_SetTransferParam((uint32)List[LocParamIdx].Param, LocHwVers, TcdImage, List[LocParamIdx].Value);
+    }
+
+    return LocStatus;
+}
+
+Dma_Ip_ReturnType Dma_Ip_LoadLogicChannelTcdImage(const uint32 LogicCh, const Dma_Ip_SwTcdRegType * const TcdImage)
+{
+    Dma_Ip_ReturnType LocStatus = DMA_IP_STATUS_SUCCESS;
+    const Dma_Ip_LogicChannelIdType * LocLogicChId;
+    Dma_Ip_HwChannelStateType * LocChState;
+    uint32 LocHwVers;
+    uint32 LocHwInst;
+    uint32 LocHwCh;
+#ifdef MCAL_ENABLE_USER_MODE_SUPPORT
+#if (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE)
+#if (STD_ON == DMA_IP_REG_PROT_AVAILABLE)
+#if (STD_ON == DMA_IP_TCD_REG_PROT_AVAILABLE)
+    uint32 LocHwTcdChAddr = 0U;
+#endif /* DMA_IP_TCD_REG_PROT_AVAILABLE */
+#endif /* DMA_IP_REG_PROT_AVAILABLE */
+#endif /* (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE) */
+#endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit);
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]);
+    DMA_IP_DEV_ASSERT(DMA_IP_NOF_CFG_LOGIC_CHANNELS > LogicCh);
+    DMA_IP_DEV_ASSERT(NULL_PTR != TcdImage);
+
+#if (STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE)
+    LocStatus = Dma_Ip_ValidateMultiCoreChannelCall(LogicCh);
+    if(LocStatus == DMA_IP_STATUS_SUCCESS)
+    {
+#endif /* STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE */
+        LocLogicChId = (const Dma_Ip_LogicChannelIdType *)&(Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]->LogicChId);
+        LocHwVers = LocLogicChId->HwVersId;
+        LocHwInst = LocLogicChId->HwInstId;
+        LocHwCh = LocLogicChId->HwChId;
+    #ifdef MCAL_ENABLE_USER_MODE_SUPPORT
+    #if (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE)
+    #if (STD_ON == DMA_IP_REG_PROT_AVAILABLE)
+    #if (STD_ON == DMA_IP_TCD_REG_PROT_AVAILABLE)
+    #if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE)
+        if(DMA_IP_HARDWARE_VERSION_3 == LocHwVers)
+        {
+            LocHwTcdChAddr = (uint32)(&DMA_IP_HWV3_TCD_CH_VALUE(LocHwInst,LocHwCh));
+            OsIf_Trusted_Call1param(Mcl_Dma_SetUserAccessAllowed, LocHwTcdChAddr);
+        }
+    #endif /* #if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE) */
+    #endif /* DMA_IP_TCD_REG_PROT_AVAILABLE */
+    #endif /* DMA_IP_REG_PROT_AVAILABLE */
+    #endif /* (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE) */
+    #endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+
+        /* Enter exclusive area to protect all TCDx_WORDs) */
+        SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_08();
+        LocChState = Dma_Ip_GetHwChannelStatePointer(LocHwVers, LocHwInst, LocHwCh);
+        if(NULL_PTR != LocChState)
+        {
+            Static_Dma_Ip_GetLogicChannelError(LocHwVers, LocHwInst, LocHwCh, &LocChState->LogicChErrors);
+            if(DMA_IP_CH_NO_HW_ERROR != LocChState->LogicChErrors)
+            {
+                Dma_Ip_SetHwChannelState(LocHwVers, LocHwInst, LocHwCh, DMA_IP_CH_ERROR_EVENT);
+                LocStatus = DMA_IP_STATUS_ERROR;
+            }
+            else
+            {
+                if((DMA_IP_CH_SCATTERGATHER_STATE == LocChState->StateValue) ||
+                   (DMA_IP_CH_READY_STATE == LocChState->StateValue))
+                {
+                    Dma_Ip_SetHwChannelState(LocHwVers, LocHwInst, LocHwCh, DMA_IP_CH_TRANSFER_EVENT);
+                }
+                else if(DMA_IP_CH_TRANSFER_STATE != LocChState->StateValue)
+                {
+                    LocStatus = DMA_IP_STATUS_WRONG_STATE;
+                }
+                else
+                {
+                    /* Already in transfer state */
+                }
+
+                if(DMA_IP_STATUS_SUCCESS == LocStatus)
+                {
+                    /* Interrupt status flag shall be cleared before enable the interrupt. */
+                    HwAccDmaCh_SetCommand((uint32)DMA_IP_CH_CLEAR_INTERRUPT_STATUS, LocHwVers, LocHwInst, LocHwCh);
+                    /* The image replaces the whole TCD, DONE is cleared on the way */
+                    HwAccDmaCh_LoadTcdImageIntoHardwareTcd(LocLogicChId, TcdImage);
+                }
+            }
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+        /* Exit exclusive area to protect all TCDx_WORDs) */
+        SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_08();
+#if (STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE)
+    }
+#endif /* STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE */
+
+    return LocStatus;
+}
+
+Dma_Ip_ReturnType Dma_Ip_RearmLogicChannel(const uint32 LogicCh, const uint32 SrcAddr, const uint32 DstAddr, const uint32 MajorCount)
+{
+    Dma_Ip_ReturnType LocStatus = DMA_IP_STATUS_SUCCESS;
+    const Dma_Ip_LogicChannelIdType * LocLogicChId;
+    Dma_Ip_HwChannelStateType * LocChState;
+    uint32 LocHwVers;
+    uint32 LocHwInst;
+    uint32 LocHwCh;
+#ifdef MCAL_ENABLE_USER_MODE_SUPPORT
+#if (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE)
+#if (STD_ON == DMA_IP_REG_PROT_AVAILABLE)
+#if (STD_ON == DMA_IP_TCD_REG_PROT_AVAILABLE)
+    uint32 LocHwTcdChAddr = 0U;
+#endif /* DMA_IP_TCD_REG_PROT_AVAILABLE */
+#endif /* DMA_IP_REG_PROT_AVAILABLE */
+#endif /* (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE) */
+#endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit);
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]);
+    DMA_IP_DEV_ASSERT(DMA_IP_NOF_CFG_LOGIC_CHANNELS > LogicCh);
+
+#if (STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE)
+    LocStatus = Dma_Ip_ValidateMultiCoreChannelCall(LogicCh);
+    if(LocStatus == DMA_IP_STATUS_SUCCESS)
+    {
+#endif /* STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE */
+        LocLogicChId = (const Dma_Ip_LogicChannelIdType *)&(Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]->LogicChId);
+        LocHwVers = LocLogicChId->HwVersId;
+        LocHwInst = LocLogicChId->HwInstId;
+        LocHwCh = LocLogicChId->HwChId;
+    #ifdef MCAL_ENABLE_USER_MODE_SUPPORT
+    #if (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE)
+    #if (STD_ON == DMA_IP_REG_PROT_AVAILABLE)
+    #if (STD_ON == DMA_IP_TCD_REG_PROT_AVAILABLE)
+    #if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE)
+        if(DMA_IP_HARDWARE_VERSION_3 == LocHwVers)
+        {
+            LocHwTcdChAddr = (uint32)(&DMA_IP_HWV3_TCD_CH_VALUE(LocHwInst,LocHwCh));
+            OsIf_Trusted_Call1param(Mcl_Dma_SetUserAccessAllowed, LocHwTcdChAddr);
+        }
+    #endif /* #if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE) */
+    #endif /* DMA_IP_TCD_REG_PROT_AVAILABLE */
+    #endif /* DMA_IP_REG_PROT_AVAILABLE */
+    #endif /* (STD_ON == DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE) */
+    #endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+
+        /* Enter exclusive area to protect all TCDx_WORDs) */
+        SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_08();
+        LocChState = Dma_Ip_GetHwChannelStatePointer(LocHwVers, LocHwInst, LocHwCh);
+        if(NULL_PTR != LocChState)
+        {
+            Static_Dma_Ip_GetLogicChannelError(LocHwVers, LocHwInst, LocHwCh, &LocChState->LogicChErrors);
+            if(DMA_IP_CH_NO_HW_ERROR != LocChState->LogicChErrors)
+            {
+                Dma_Ip_SetHwChannelState(LocHwVers, LocHwInst, LocHwCh, DMA_IP_CH_ERROR_EVENT);
+                LocStatus = DMA_IP_STATUS_ERROR;
+            }
+            else if(DMA_IP_CH_TRANSFER_STATE == LocChState->StateValue)
+            {
+                /* Only the addresses and the major loop count change, the rest of the TCD is kept */
+                HwAccDmaCh_RearmHardwareTcd(LocLogicChId, SrcAddr, DstAddr, MajorCount);
+            }
+            else
+            {
+                LocStatus = DMA_IP_STATUS_WRONG_STATE;
+            }
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+        /* Exit exclusive area to protect all TCDx_WORDs) */
+        SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_08();
+#if (STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE)
+    }
+#endif /* STD_ON == DMA_IP_MULTICORE_IS_AVAILABLE */
+
+    return LocStatus;
+}
+
+Dma_Ip_ReturnType Dma_Ip_LinkTcdImage(const uint32 LogicCh, Dma_Ip_SwTcdRegType * const TcdImage, const Dma_Ip_SwTcdRegType * const NextTcdImage)
+{
+    Dma_Ip_ReturnType LocStatus = DMA_IP_STATUS_SUCCESS;
+    uint32 LocHwVers;
+
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit);
+    DMA_IP_DEV_ASSERT(NULL_PTR != Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]);
+    DMA_IP_DEV_ASSERT(DMA_IP_NOF_CFG_LOGIC_CHANNELS > LogicCh);
+    DMA_IP_DEV_ASSERT(NULL_PTR != TcdImage);
+
+    LocHwVers = Dma_Ip_pxInit->ppxLogicChannelConfigArray[LogicCh]->LogicChId.HwVersId;
+
+    if(NULL_PTR != NextTcdImage)
+    {
+        /* The next TCD is fetched by the eDMA, it shall be 32 bytes aligned */
+        HwAccDmaCh_SetControl_ScatterGatherAddress(LocHwVers, TcdImage, (Dma_Ip_uintPtrType)NextTcdImage);
+        HwAccDmaCh_SetControl_EnScatterGatherProcessing(LocHwVers, TcdImage, TRUE);
+    }
+    else
+    {
+        HwAccDmaCh_SetControl_ScatterGatherAddress(LocHwVers, TcdImage, 0U);
+        HwAccDmaCh_SetControl_EnScatterGatherProcessing(LocHwVers, TcdImage, FALSE);
+    }
+
+    return LocStatus;
+}
+
 Dma_Ip_ReturnType Dma_Ip_SetLogicChannelScatterGatherList(const uint32 LogicCh, const uint32 Element, const Dma_Ip_LogicChannelScatterGatherListType List[], const uint32 ListDimension)
 {
     Dma_Ip_ReturnType LocStatus = DMA_IP_STATUS_SUCCESS;
@@ -1697,6 +1697,63 @@ void HwAccDmaCh_LoadSoftwareTcdIntoHardwareTcd(const Dma_Ip_LogicChannelIdType *
 
 }
 
+void HwAccDmaCh_LoadTcdImageIntoHardwareTcd(const Dma_Ip_LogicChannelIdType * const pxLocLogicCh, const Dma_Ip_SwTcdRegType * const pxLocTcdImage)
+{
+    uint32 LocHwVers = pxLocLogicCh->HwVersId;
+    uint32 LocHwInst = pxLocLogicCh->HwInstId;
+    uint32 LocHwCh   = pxLocLogicCh->HwChId;
+
+#if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE)
+    if(DMA_IP_HARDWARE_VERSION_3 == LocHwVers)
+    {
+        /* Done shall be cleared before a new transfer is configured */
+        hwv3AccInlineDmaCh_CmdClearDone(&DMA_IP_HWV3_TCD_CH_VALUE(LocHwInst, LocHwCh));
+        /* Update Hardware TCD */
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_SADDR = pxLocTcdImage->reg_SADDR;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_SOFF = pxLocTcdImage->reg_SOFF;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_ATTR = pxLocTcdImage->reg_ATTR;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_NBYTES.reg_MLOFFYES = pxLocTcdImage->reg_NBYTES.reg_MLOFFYES;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_SLAST_SDA = pxLocTcdImage->reg_SLAST_SDA;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_DADDR = pxLocTcdImage->reg_DADDR;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_DOFF = pxLocTcdImage->reg_DOFF;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_CITER.reg_ELINKYES = pxLocTcdImage->reg_CITER.reg_ELINKYES;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_DLAST_SGA = pxLocTcdImage->reg_DLAST_SGA;
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_BITER.reg_ELINKYES = pxLocTcdImage->reg_BITER.reg_ELINKYES;
+        /* CSR shall be loaded last due to Start bit */
+        DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh).reg_CSR = pxLocTcdImage->reg_CSR;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif /* #if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE) */
+
+}
+
+void HwAccDmaCh_RearmHardwareTcd(const Dma_Ip_LogicChannelIdType * const pxLocLogicCh, const uint32 LocSrcAddr, const uint32 LocDstAddr, const uint32 LocMajorCount)
+{
+    uint32 LocHwVers = pxLocLogicCh->HwVersId;
+    uint32 LocHwInst = pxLocLogicCh->HwInstId;
+    uint32 LocHwCh   = pxLocLogicCh->HwChId;
+
+#if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE)
+    if(DMA_IP_HARDWARE_VERSION_3 == LocHwVers)
+    {
+        /* Done shall be cleared before a new transfer is configured */
+        hwv3AccInlineDmaCh_CmdClearDone(&DMA_IP_HWV3_TCD_CH_VALUE(LocHwInst, LocHwCh));
+        hwv3AccInlineDmaCh_SetSource_Address(&DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh), LocSrcAddr);
+        hwv3AccInlineDmaCh_SetDestination_Address(&DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh), LocDstAddr);
+        /* Keeps the minor loop channel link settings of CITER/BITER */
+        hwv3AccInlineDmaCh_SetMajorLoop_Count(&DMA_IP_HWV3_TCD_TCD_VALUE(LocHwInst, LocHwCh), LocMajorCount);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif /* #if (STD_ON == DMA_IP_HWV3_IS_AVAILABLE) */
+
+}
+
 /*==================================================================================================
  *  IP INTERNAL FUNCTIONS
 ==================================================================================================*/
@@ -464,6 +464,27 @@ uint16 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel)
     return PeriodCounterBus;
 }
 
+/** @implements Emios_Mcl_Ip_GetCounterValue_Activity */
+#if (STD_ON == EMIOS_MCL_IP_24BITS_TIMER_WIDTH)
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel)
+#else
+uint16 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel)
+#endif
+{
+#if (EMIOS_MCL_IP_DEV_ERROR_DETECT == STD_ON)
+    DevAssert(Instance < eMIOS_INSTANCE_COUNT);
+    DevAssert(Channel < eMIOS_CH_UC_UC_COUNT);
+#endif
+    /* Get the running count of the channel. */
+#if (STD_ON == EMIOS_MCL_IP_24BITS_TIMER_WIDTH)
+    uint32 CounterValue = Emios_Ip_paxBase[Instance]->CH.UC[Channel].CNT;
+#else
+    uint16 CounterValue = (uint16)Emios_Ip_paxBase[Instance]->CH.UC[Channel].CNT;
+#endif
+
+    return CounterValue;
+}
+
 #if (STD_ON == EMIOS_IP_MULTICORE_IS_AVAILABLE)
 /** @implements Emios_Mcl_Ip_ValidateMultiCoreInit_Activity */
 boolean Emios_Mcl_Ip_ValidateMultiCoreInit(uint8 HwInstance)
@@ -525,8 +525,13 @@ extern eMIOS_Type* Emios_Ip_paxBase[eMIOS_INSTANCE_COUNT];
 /*==================================================================================================
 *                                         LOCAL FUNCTIONS
 ==================================================================================================*/
+#if defined(TCM_HOT_PATH)
+#define TCM_START_SEC_CODE
+#include "Tcm_MemMap.h"
+#else
 #define MCL_START_SEC_CODE
 #include "Mcl_MemMap.h"
+#endif
 
 #if (\
         (defined GPT_EMIOS_0_CH_0_ISR_USED) ||\
@@ -2817,8 +2822,13 @@ ISR(EMIOS2_0_IRQ)
 #endif
 
 
+#if defined(TCM_HOT_PATH)
+#define TCM_STOP_SEC_CODE
+#include "Tcm_MemMap.h"
+#else
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
+#endif
 
 #ifdef __cplusplus
 }
@@ -120,6 +120,8 @@ extern "C"{
 /*==================================================================================================
 *                           LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+/* Fails to compile when a new field pushes the channel state past one cache line */
+typedef uint8 Emios_Pwm_Ip_ChStateSizeCheckType[(sizeof(Emios_Pwm_Ip_ChStateType) == EMIOS_PWM_IP_CH_STATE_SIZE) ? 1 : -1];
 
 /*==================================================================================================
 *                                          LOCAL MACROS
@@ -170,110 +172,61 @@ static uint32 Emios_Pwm_Ip_aChannelModes[EMIOS_PWM_IP_INSTANCE_COUNT][EMIOS_PWM_
 #include "Pwm_MemMap.h"
 #endif
 
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_INIT_UNSPECIFIED_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_INIT_UNSPECIFIED
-#endif
-#include "Pwm_MemMap.h"
-
-/* Array with initial pwm modes for each Emios Channel */
-static Emios_Pwm_Ip_PwmModeType Emios_Pwm_Ip_aInitialModes[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8] = EMIOS_PWM_IP_INITIAL_MODES;
-
-/* Array with current pwm modes for each Emios Channel */
-Emios_Pwm_Ip_PwmModeType Emios_Pwm_Ip_aCurrentModes[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8] = EMIOS_PWM_IP_INITIAL_MODES;
-
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_INIT_UNSPECIFIED_NO_CACHEABLE
+#if defined(TCM_HOT_PATH)
+    #define TCM_START_SEC_VAR_CLEARED
+    #include "Tcm_MemMap.h"
 #else
-    #define PWM_STOP_SEC_VAR_INIT_UNSPECIFIED
-#endif
-#include "Pwm_MemMap.h"
-
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
 #else
     #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED
 #endif
 #include "Pwm_MemMap.h"
+#endif
 
-/** @brief Array with notification handlers for all configurable channels */
-Emios_Pwm_Ip_NotificationType const *Emios_Pwm_Ip_aNotificationPtr[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
+/** @brief State of all configurable channels, one record each, indexed through eMios_Pwm_Ip_IndexInChState */
+VAR_ALIGN(Emios_Pwm_Ip_ChStateType Emios_Pwm_Ip_aChState[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8], EMIOS_PWM_IP_CH_STATE_SIZE)
 
+#if defined(TCM_HOT_PATH)
+    #define TCM_STOP_SEC_VAR_CLEARED
+    #include "Tcm_MemMap.h"
+#else
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
 #else
     #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED
 #endif
 #include "Pwm_MemMap.h"
-
-#ifdef EMIOS_PWM_IP_TIMER_WIDTH_24BITS
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_CLEARED_32_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_CLEARED_32
 #endif
+
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+#if defined(TCM_HOT_PATH)
+    #define TCM_START_SEC_VAR_CLEARED
+    #include "Tcm_MemMap.h"
 #else
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_START_SEC_VAR_CLEARED_16_NO_CACHEABLE
 #else
     #define PWM_START_SEC_VAR_CLEARED_16
 #endif
-#endif
 #include "Pwm_MemMap.h"
-/** @brief Array with period for each channels */
-Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_aPeriod[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-#if (defined(EMIOS_PWM_IP_MODE_OPWM_USED) || defined(EMIOS_PWM_IP_MODE_OPWMB_USED) || defined(EMIOS_PWM_IP_MODE_OPWMT_USED))
-/** @brief Array to store register A value for each channels */
-static Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_aRegA[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
 #endif
+/** @brief EMIOS_PWM_IP_BRIGHTNESS_FULL less the brightness of each counter bus, indexed by bus channel, 0 if not dimmed */
+static uint16 Emios_Pwm_Ip_aBusDimming[EMIOS_PWM_IP_INSTANCE_COUNT][EMIOS_PWM_IP_CHANNEL_COUNT];
 
-/** @brief Array with duty cycle for all channels */
-Emios_Pwm_Ip_DutyType Emios_Pwm_Ip_aDutyCycle[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-#ifdef EMIOS_PWM_IP_TIMER_WIDTH_24BITS
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_CLEARED_32_NO_CACHEABLE
-#else
-    #define PWM_STOP_SEC_VAR_CLEARED_32
-#endif
+#if defined(TCM_HOT_PATH)
+    #define TCM_STOP_SEC_VAR_CLEARED
+    #include "Tcm_MemMap.h"
 #else
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_STOP_SEC_VAR_CLEARED_16_NO_CACHEABLE
 #else
     #define PWM_STOP_SEC_VAR_CLEARED_16
 #endif
-#endif
 #include "Pwm_MemMap.h"
-
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_START_SEC_VAR_CLEARED_8_NO_CACHEABLE
-#else
-    #define PWM_START_SEC_VAR_CLEARED_8
 #endif
-#include "Pwm_MemMap.h"
-
-/** @brief Arrays to check the condition whether Channel can be enale notification or not */
-static uint8 Emios_Pwm_Ip_aNotif[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-/** @brief Arrays to check the state of Channel in the notification or not */
-uint8 Emios_Pwm_Ip_aCheckEnableNotif[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-#if (defined(EMIOS_PWM_IP_MODE_OPWFM_USED) || defined(EMIOS_PWM_IP_MODE_DAOC_USED))
-/** @brief Arrays with the polarity of channels */
-static uint8 Emios_Pwm_Ip_aPolarity[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
 #endif
 
-/** @brief Arrays to check the state of Channel is initial state or uninitialized state or idle state */
-uint8 Emios_Pwm_Ip_aCheckState[EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8];
-
-#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
-    #define PWM_STOP_SEC_VAR_CLEARED_8_NO_CACHEABLE
-#else
-    #define PWM_STOP_SEC_VAR_CLEARED_8
-#endif
-#include "Pwm_MemMap.h"
-
 #if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
     #define PWM_START_SEC_VAR_INIT_8_NO_CACHEABLE
 #else
@@ -449,6 +402,34 @@ static inline Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_GetCounterBusPeriod(uint8 Ins
     return ChPeriod;
 }
 
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : Emios_Pwm_Ip_DimDutyCycle
+ * Description   : Return the duty cycle put on the output of a channel driven by
+ * CounterBus: DutyCycle times the brightness of the bus, DutyCycle if undimmed.
+ *
+ *END**************************************************************************/
+static inline Emios_Pwm_Ip_DutyType Emios_Pwm_Ip_DimDutyCycle(uint8 Instance,
+                                                              uint8 Channel,
+                                                              Emios_Pwm_Ip_CounterBusSourceType CounterBus,
+                                                              Emios_Pwm_Ip_DutyType DutyCycle
+                                                             )
+{
+    uint8 MasterBusCh = Emios_Pwm_Ip_GetTimebaseChannel(Channel, CounterBus);
+    Emios_Pwm_Ip_DutyType OutDutyCycle = DutyCycle;
+    /* One halfword read, written under PWM_EXCLUSIVE_AREA_47 */
+    uint16 Dimming = (MasterBusCh < EMIOS_PWM_IP_CHANNEL_COUNT) ? Emios_Pwm_Ip_aBusDimming[Instance][MasterBusCh] : 0U;
+
+    if (0U != Dimming)
+    {
+        OutDutyCycle = (Emios_Pwm_Ip_DutyType)(((uint64)DutyCycle * (EMIOS_PWM_IP_BRIGHTNESS_FULL - Dimming)) >> 15U);
+    }
+
+    return OutDutyCycle;
+}
+#endif
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : Emios_Pwm_Ip_GetCounterBusMode
@@ -508,6 +489,7 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmbMode(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_MIN_CNT_VAL < UserChCfg->PeriodCount);
     DevAssert(UserChCfg->DutyCycle <= UserChCfg->PeriodCount);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 
@@ -519,11 +501,11 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmbMode(uint8 Instance,
     /* Configure Period in reg B */
     Emios_Pwm_Ip_SetUCRegB(Base, UserChCfg->ChannelId, UserChCfg->PeriodCount);
 
-    Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->PeriodCount;
+    ChState->Period = UserChCfg->PeriodCount;
 
     if (UserChCfg->PeriodCount == UserChCfg->DutyCycle)
     {   /* 100% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* To avoid spike pulse
         If duty cycle = 100%, when enter Mode, EDPOL bit get complement of polarity
         after that, EDPOL bit is restored valid value */
@@ -532,20 +514,20 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmbMode(uint8 Instance,
     else if(0U == UserChCfg->DutyCycle)
     {
         /* 0% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* Configure output pin polarity */
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
     }
     else
     {
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)0U;
+        ChState->Notif = (uint8)0U;
     }
     /* Transition from GPIO Mode to OPWFMB Mode */
     Emios_Pwm_Ip_SetPwmMode(Base, UserChCfg->ChannelId, UserChCfg->Mode);
     /* Configure output pin polarity */
     Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
     /* Stores the inital duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->DutyCycle;
+    ChState->DutyCycle = UserChCfg->DutyCycle;
 }
 #endif /* EMIOS_PWM_IP_MODE_OPWFMB_USED */
 
@@ -576,6 +558,7 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmMode(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_MIN_CNT_VAL < UserChCfg->PeriodCount);
     DevAssert(UserChCfg->DutyCycle <= UserChCfg->PeriodCount);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 
@@ -587,11 +570,11 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmMode(uint8 Instance,
     /* Configure Period in reg B */
     Emios_Pwm_Ip_SetUCRegB(Base, UserChCfg->ChannelId, UserChCfg->PeriodCount);
 
-    Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->PeriodCount;
+    ChState->Period = UserChCfg->PeriodCount;
 
     if (UserChCfg->PeriodCount == UserChCfg->DutyCycle)
     {   /* 100% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* To avoid spike pulse
         If duty cycle = 100%, when enter Mode, EDPOL bit get complement of polarity
         after that, EDPOL bit is restored valid value */
@@ -600,13 +583,13 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmMode(uint8 Instance,
     else if(0U == UserChCfg->DutyCycle)
     {
         /* 0% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* Configure output pin polarity */
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
     }
     else
     {
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)0U;
+        ChState->Notif = (uint8)0U;
         /* Configure output pin polarity */
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
     }
@@ -621,8 +604,8 @@ static void Emios_Pwm_Ip_InitPeriodDutyCycleOpwfmMode(uint8 Instance,
     }
 
     /* Stores the inital duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->DutyCycle;
-    Emios_Pwm_Ip_aPolarity[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH)? 1U : 0U;
+    ChState->DutyCycle = UserChCfg->DutyCycle;
+    ChState->Polarity = (UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH)? 1U : 0U;
 }
 #endif /* EMIOS_PWM_IP_MODE_OPWFM_USED */
 
@@ -644,22 +627,23 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwfmb(uint8  Ins
     DevAssert(EMIOS_PWM_IP_INSTANCE_COUNT > Instance);
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
 
     /* OPWFMB Mode */
-    if ((NewDutyCycle > Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) && ((Emios_Pwm_Ip_PeriodType)0U != Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]))
+    if ((NewDutyCycle > ChState->Period) && ((Emios_Pwm_Ip_PeriodType)0U != ChState->Period))
     {   /* Duty cycle value should not be greater than the Channel Period. */
         Ret = EMIOS_PWM_IP_STATUS_ERROR;
     }
-    else if ((Emios_Pwm_Ip_PeriodType)0U == Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+    else if ((Emios_Pwm_Ip_PeriodType)0U == ChState->Period)
     {
         /* Disable and clear interrupt flag */
         Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
         Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
         /* If new period is 0, set duty cycle to 0 */
         Emios_Pwm_Ip_SetUCRegA(Base, Channel, (Emios_Pwm_Ip_PeriodType)0U);
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
     }
     else
     {
@@ -668,26 +652,26 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwfmb(uint8  Ins
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
-        else if (NewDutyCycle == Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+        else if (NewDutyCycle == ChState->Period)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
         else
         {
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)0U;
-            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == 0U)? FALSE : TRUE);
+            ChState->Notif = (uint8)0U;
+            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (ChState->CheckEnableNotif == 0U)? FALSE : TRUE);
         }
 
         Emios_Pwm_Ip_SetUCRegA(Base, Channel, NewDutyCycle);
     }
 
     /* Stores the new duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = NewDutyCycle;
+    ChState->DutyCycle = NewDutyCycle;
 
     return Ret;
 }
@@ -711,27 +695,28 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwfm(uint8  Inst
     DevAssert(EMIOS_PWM_IP_INSTANCE_COUNT > Instance);
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
 
     /* OPWFM Mode */
-    if ((NewDutyCycle > Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) && ((Emios_Pwm_Ip_PeriodType)0U != Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]))
+    if ((NewDutyCycle > ChState->Period) && ((Emios_Pwm_Ip_PeriodType)0U != ChState->Period))
     {   /* Duty cycle value should not be greater than the Channel Period. */
         Ret = EMIOS_PWM_IP_STATUS_ERROR;
     }
-    else if ((Emios_Pwm_Ip_PeriodType)0U == Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+    else if ((Emios_Pwm_Ip_PeriodType)0U == ChState->Period)
     {
         /* Disable and clear interrupt flag */
         Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
         Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
         /* If new period is 0, set duty cycle to 0 */
         Emios_Pwm_Ip_SetUCRegA(Base, Channel, (Emios_Pwm_Ip_PeriodType)0U);
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* Set polarity when channels is in active state */
-        if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+        if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
         {
             /* Reverse output pin polarity */
-            Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(Emios_Pwm_Ip_aPolarity[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
+            Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(ChState->Polarity == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
         }
     }
     else
@@ -741,36 +726,36 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwfm(uint8  Inst
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
             /* Set polarity when channels is in active state */
-            if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+            if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
             {
                 /* Reverse output pin polarity */
-                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(Emios_Pwm_Ip_aPolarity[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
+                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(ChState->Polarity == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
             }
         }
-        else if (NewDutyCycle == Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+        else if (NewDutyCycle == ChState->Period)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
             /* Set polarity when channels is in active state */
-            if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+            if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
             {
                 /* Reverse output pin polarity */
-                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(Emios_Pwm_Ip_aPolarity[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
+                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(ChState->Polarity == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
             }
         }
         else
         {
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)0U;
-            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == 0U)? FALSE : TRUE);
+            ChState->Notif = (uint8)0U;
+            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (ChState->CheckEnableNotif == 0U)? FALSE : TRUE);
             /* Set polarity when channels is in active state */
-            if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+            if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
             {
                 /* Configure output pin polarity */
-                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(Emios_Pwm_Ip_aPolarity[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
+                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(ChState->Polarity == (uint16)1U) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
             }
         }
 
@@ -778,7 +763,7 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwfm(uint8  Inst
     }
 
     /* Stores the new duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = NewDutyCycle;
+    ChState->DutyCycle = NewDutyCycle;
 
     return Ret;
 }
@@ -822,11 +807,17 @@ static void Emios_Pwm_Ip_InitDeadTimeMode(uint8 Instance,
     /* Validate OPWMCB or OPWMC parametter */
     DevAssert(((2U * Emios_Pwm_Ip_GetCounterBusPeriod(Instance, UserChCfg->ChannelId, UserChCfg->Timebase)) - 2U) >= UserChCfg->DutyCycle);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_PeriodType DutyCycle = 0U;
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = UserChCfg->DutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, UserChCfg->ChannelId, UserChCfg->Timebase, UserChCfg->DutyCycle);
+#endif
 
-    if (UserChCfg->PeriodCount == UserChCfg->DutyCycle)
+    if (UserChCfg->PeriodCount == OutDutyCycle)
     {   /* 100% DutyCycle is desired. */
         if((UserChCfg->Mode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
            (UserChCfg->Mode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH) ||
@@ -843,20 +834,20 @@ static void Emios_Pwm_Ip_InitDeadTimeMode(uint8 Instance,
         If duty cycle = 100%, when enter Mode, EDPOL bit get complement of polarity
         after that, EDPOL bit is restored valid value */
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
     }
-    else if((0U == UserChCfg->DutyCycle) || (1U == UserChCfg->DutyCycle))
+    else if((0U == OutDutyCycle) || (1U == OutDutyCycle))
     {
         /* 0% DutyCycle is desired. */
         DutyCycle = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, UserChCfg->ChannelId, UserChCfg->Timebase) + (uint8)1U;
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     }
     else
     {
-        DutyCycle = (UserChCfg->DutyCycle) >> (uint8)1U;
+        DutyCycle = OutDutyCycle >> (uint8)1U;
         DutyCycle = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, UserChCfg->ChannelId, UserChCfg->Timebase) - DutyCycle;
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)0U;
+        ChState->Notif = (uint8)0U;
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     }
 
@@ -872,7 +863,7 @@ static void Emios_Pwm_Ip_InitDeadTimeMode(uint8 Instance,
     /* Configure output pin polarity */
     Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     /* Stores the inital duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->DutyCycle;
+    ChState->DutyCycle = UserChCfg->DutyCycle;
 }
 #endif
 
@@ -899,27 +890,34 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwmcb(uint8  Ins
     Emios_Pwm_Ip_PeriodType ChPeriod = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel));
     /* Get the value of channel Index */
     uint8 ChannelIdx = Emios_Pwm_Ip_GetChannelIndex(Instance, Channel);
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = NewDutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel), NewDutyCycle);
+#endif
 
     if (ChannelIdx < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8)
     {
+        Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[ChannelIdx];
+
         /* OPWMCB Mode */
         if(NewDutyCycle > ((ChPeriod * 2U) - 2U))
         { /* Duty cycle value should not be greater than the Channel Period. */
             Ret = EMIOS_PWM_IP_STATUS_ERROR;
         }
-        else if(0U == NewDutyCycle)
+        else if(0U == OutDutyCycle)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
 
             Emios_Pwm_Ip_SetUCRegA(Base, Channel, ChPeriod + 1U);
-            Emios_Pwm_Ip_aNotif[ChannelIdx] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
             /* This statement is required to avoid limitation of 0% duty cycle (if call 100% to 0%) */
             if(1U == Emios_Pwm_Ip_GetUCRegA(Base, Channel))
             {
-                if((Emios_Pwm_Ip_aInitialModes[ChannelIdx] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
-                   (Emios_Pwm_Ip_aInitialModes[ChannelIdx] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH))
+                if((ChState->InitialMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
+                   (ChState->InitialMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH))
                 {
                     Emios_Pwm_Ip_SetForceMatchB(Base, Channel, TRUE);
                 }
@@ -929,24 +927,24 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwmcb(uint8  Ins
                 }
             }
         }
-        else if(NewDutyCycle == ((ChPeriod * 2U) - 2U))
+        else if(OutDutyCycle == ((ChPeriod * 2U) - 2U))
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
 
             Emios_Pwm_Ip_SetUCRegA(Base, Channel, 1U);
-            Emios_Pwm_Ip_aNotif[ChannelIdx] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
         else
         {
-            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (Emios_Pwm_Ip_PeriodType)(ChPeriod - (NewDutyCycle >> 1U)));
-            Emios_Pwm_Ip_aNotif[ChannelIdx] = (uint8)0U;
-            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (Emios_Pwm_Ip_aCheckEnableNotif[ChannelIdx] == 0U)? FALSE : TRUE);
+            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (Emios_Pwm_Ip_PeriodType)(ChPeriod - (OutDutyCycle >> 1U)));
+            ChState->Notif = (uint8)0U;
+            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (ChState->CheckEnableNotif == 0U)? FALSE : TRUE);
         }
 
         /* Stores the new duty cycle in ticks */
-        Emios_Pwm_Ip_aDutyCycle[ChannelIdx] = NewDutyCycle;
+        ChState->DutyCycle = NewDutyCycle;
     }
     else
     {
@@ -992,40 +990,46 @@ static void Emios_Pwm_Ip_InitEdgePlacementOpwmMode(uint8 Instance,
     DevAssert((Emios_Pwm_Ip_GetCounterBusPeriod(Instance, UserChCfg->ChannelId, UserChCfg->Timebase)) >= (UserChCfg->PhaseShift + UserChCfg->DutyCycle));
     DevAssert(EMIOS_PWM_IP_MAX_CNT_VAL >= (uint32)((uint32)UserChCfg->PhaseShift + (uint32)UserChCfg->DutyCycle));
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = UserChCfg->DutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, UserChCfg->ChannelId, UserChCfg->Timebase, UserChCfg->DutyCycle);
+#endif
 
-    Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->PhaseShift;
+    ChState->RegA = UserChCfg->PhaseShift;
 
     /* Configure Counter Bus used by this Channel */
     Emios_Pwm_Ip_SetCounterBus(Base, UserChCfg->ChannelId, UserChCfg->Timebase);
     /* Configure Phase Shift in reg A */
     Emios_Pwm_Ip_SetUCRegA(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + (Emios_Pwm_Ip_PeriodType)1U);
     /* Configure Trailing edge in reg B */
-    Emios_Pwm_Ip_SetUCRegB(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + UserChCfg->DutyCycle);
+    Emios_Pwm_Ip_SetUCRegB(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + OutDutyCycle);
 
-    if (UserChCfg->PeriodCount == UserChCfg->DutyCycle)
+    if (UserChCfg->PeriodCount == OutDutyCycle)
     {   /* 100% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* Write the same nonzero value to AS1 and BS1 */
-        Emios_Pwm_Ip_SetUCRegA(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + UserChCfg->DutyCycle);
+        Emios_Pwm_Ip_SetUCRegA(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + OutDutyCycle);
 
         /* To avoid spike pulse
         If duty cycle = 100%, when enter Mode, EDPOL bit get complement of polarity
         after that, EDPOL bit is restored valid value */
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH );
     }
-    else if((0U == UserChCfg->DutyCycle) || (1U == UserChCfg->DutyCycle))
+    else if((0U == OutDutyCycle) || (1U == OutDutyCycle))
     {
         /* 0% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* Write 0 to AS1 */
         Emios_Pwm_Ip_SetUCRegA(Base, UserChCfg->ChannelId, (Emios_Pwm_Ip_PeriodType)0U);
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW );
     }
     else
     {
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)0U;
+        ChState->Notif = (uint8)0U;
         /* Configure output pin polarity */
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     }
@@ -1037,7 +1041,7 @@ static void Emios_Pwm_Ip_InitEdgePlacementOpwmMode(uint8 Instance,
     Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
 
     /* Stores the inital duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->DutyCycle;
+    ChState->DutyCycle = UserChCfg->DutyCycle;
 }
 #endif
 
@@ -1072,27 +1076,33 @@ static void Emios_Pwm_Ip_InitEdgePlacementOpwmbMode(uint8 Instance,
     DevAssert((Emios_Pwm_Ip_GetCounterBusPeriod(Instance, UserChCfg->ChannelId, UserChCfg->Timebase)) >= (UserChCfg->PhaseShift + UserChCfg->DutyCycle));
     DevAssert(EMIOS_PWM_IP_MAX_CNT_VAL >= (uint32)((uint32)UserChCfg->PhaseShift + (uint32)UserChCfg->DutyCycle));
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = UserChCfg->DutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, UserChCfg->ChannelId, UserChCfg->Timebase, UserChCfg->DutyCycle);
+#endif
 
-    Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->PhaseShift;
+    ChState->RegA = UserChCfg->PhaseShift;
 
     /* Configure Counter Bus used by this Channel */
     Emios_Pwm_Ip_SetCounterBus(Base, UserChCfg->ChannelId, UserChCfg->Timebase);
     /* Configure Phase Shift in reg A */
     Emios_Pwm_Ip_SetUCRegA(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift);
     /* Configure Trailing edge in reg B */
-    Emios_Pwm_Ip_SetUCRegB(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + UserChCfg->DutyCycle);
+    Emios_Pwm_Ip_SetUCRegB(Base, UserChCfg->ChannelId, UserChCfg->PhaseShift + OutDutyCycle);
 
-    if (UserChCfg->PeriodCount == UserChCfg->DutyCycle)
+    if (UserChCfg->PeriodCount == OutDutyCycle)
     {   /* 100% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     }
-    else if((0U == UserChCfg->DutyCycle) || (1U == UserChCfg->DutyCycle))
+    else if((0U == OutDutyCycle) || (1U == OutDutyCycle))
     {
         /* 0% DutyCycle is desired. */
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
         /* To avoid spike pulse
         If duty cycle = 0%, when enter Mode, EDPOL bit get complement of polarity
         after that, EDPOL bit is restored valid value */
@@ -1100,14 +1110,14 @@ static void Emios_Pwm_Ip_InitEdgePlacementOpwmbMode(uint8 Instance,
     }
     else
     {
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)0U;
+        ChState->Notif = (uint8)0U;
     }
     /* Transition from GPIO Mode to OPWMB Mode */
     Emios_Pwm_Ip_SetPwmMode(Base, UserChCfg->ChannelId, UserChCfg->Mode);
     /* Configure output pin polarity */
     Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     /* Stores the inital duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->DutyCycle;
+    ChState->DutyCycle = UserChCfg->DutyCycle;
 }
 #endif
 
@@ -1129,41 +1139,47 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwmb(uint8  Inst
     DevAssert(EMIOS_PWM_IP_INSTANCE_COUNT > Instance);
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
     Emios_Pwm_Ip_PeriodType ChPeriod = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel));
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = NewDutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel), NewDutyCycle);
+#endif
 
     /* OPWMB Mode */
-    if ((NewDutyCycle + Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) > ChPeriod)
+    if ((NewDutyCycle + ChState->RegA) > ChPeriod)
     { /* New duty cycle puts trailing edge outside of counter bus period. */
         Ret = EMIOS_PWM_IP_STATUS_ERROR;
     }
     else
     {
-        if(NewDutyCycle == 0U)
+        if(OutDutyCycle == 0U)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
-        else if (NewDutyCycle == ChPeriod)
+        else if (OutDutyCycle == ChPeriod)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
         else
         {
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)0U;
-            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == 0U)? FALSE : TRUE);
+            ChState->Notif = (uint8)0U;
+            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (ChState->CheckEnableNotif == 0U)? FALSE : TRUE);
         }
-        Emios_Pwm_Ip_SetUCRegB(Base, Channel, (NewDutyCycle + Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+        Emios_Pwm_Ip_SetUCRegB(Base, Channel, (OutDutyCycle + ChState->RegA));
     }
 
     /* Stores the new duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = NewDutyCycle;
+    ChState->DutyCycle = NewDutyCycle;
 
     return Ret;
 }
@@ -1187,44 +1203,50 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwm(uint8  Insta
     DevAssert(EMIOS_PWM_IP_INSTANCE_COUNT > Instance);
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
     Emios_Pwm_Ip_PeriodType ChPeriod = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel));
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = NewDutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel), NewDutyCycle);
+#endif
 
     /* OPWM Mode */
-    if ((NewDutyCycle + Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) > ChPeriod)
+    if ((NewDutyCycle + ChState->RegA) > ChPeriod)
     { /* New duty cycle puts trailing edge outside of counter bus period. */
         Ret = EMIOS_PWM_IP_STATUS_ERROR;
     }
     else
     {
-        if(NewDutyCycle == 0U)
+        if(OutDutyCycle == 0U)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
-            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (NewDutyCycle + Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+            ChState->Notif = (uint8)1U;
+            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (OutDutyCycle + ChState->RegA));
         }
-        else if (NewDutyCycle == ChPeriod)
+        else if (OutDutyCycle == ChPeriod)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
-            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (NewDutyCycle + Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+            ChState->Notif = (uint8)1U;
+            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (OutDutyCycle + ChState->RegA));
         }
         else
         {
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)0U;
-            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == 0U)? FALSE : TRUE);
-            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) + (Emios_Pwm_Ip_PeriodType)1U);
+            ChState->Notif = (uint8)0U;
+            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (ChState->CheckEnableNotif == 0U)? FALSE : TRUE);
+            Emios_Pwm_Ip_SetUCRegA(Base, Channel, (ChState->RegA) + (Emios_Pwm_Ip_PeriodType)1U);
         }
-        Emios_Pwm_Ip_SetUCRegB(Base, Channel, (NewDutyCycle + Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+        Emios_Pwm_Ip_SetUCRegB(Base, Channel, (OutDutyCycle + ChState->RegA));
     }
 
     /* Stores the new duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = NewDutyCycle;
+    ChState->DutyCycle = NewDutyCycle;
 
     return Ret;
 }
@@ -1266,11 +1288,17 @@ static void Emios_Pwm_Ip_InitTriggerMode(uint8 Instance,
               (EMIOS_PWM_IP_MC_UP_COUNTER_START == Emios_Pwm_Ip_GetCounterBusMode(Instance, UserChCfg->ChannelId, UserChCfg->Timebase)) ||
               (EMIOS_PWM_IP_MC_UP_COUNTER_END == Emios_Pwm_Ip_GetCounterBusMode(Instance, UserChCfg->ChannelId, UserChCfg->Timebase)));
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_PeriodType CounterBusPeriod = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, UserChCfg->ChannelId, UserChCfg->Timebase);
     Emios_Pwm_Ip_DutyType TrailingEdge = 0x0000U;
     uint8 CounterStart = 0U;
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = UserChCfg->DutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, UserChCfg->ChannelId, UserChCfg->Timebase, UserChCfg->DutyCycle);
+#endif
 
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
     /* Validate OPWMT parameters */
@@ -1293,23 +1321,23 @@ static void Emios_Pwm_Ip_InitTriggerMode(uint8 Instance,
         CounterStart = 0U;
     }
 
-    if (CounterBusPeriod == UserChCfg->DutyCycle)
+    if (CounterBusPeriod == OutDutyCycle)
     {   /* 100% DutyCycle is desired. Trailing edge must be placed outside counter bus period. */
-        TrailingEdge = UserChCfg->DutyCycle + 1U;
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        TrailingEdge = OutDutyCycle + 1U;
+        ChState->Notif = (uint8)1U;
     }
-    else if ((0U == UserChCfg->DutyCycle) || (0U == CounterBusPeriod))
+    else if ((0U == OutDutyCycle) || (0U == CounterBusPeriod))
     {
         TrailingEdge = UserChCfg->PhaseShift;
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)1U;
+        ChState->Notif = (uint8)1U;
     }
     else
     { /* Calculate trailing edge postion. Wrap-around if DutyCycle extends the signal past the counterbus period. */
-        TrailingEdge = (UserChCfg->PhaseShift + UserChCfg->DutyCycle) % CounterBusPeriod;
-        Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (uint8)0U;
+        TrailingEdge = (UserChCfg->PhaseShift + OutDutyCycle) % CounterBusPeriod;
+        ChState->Notif = (uint8)0U;
     }
 
-    Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->PhaseShift + CounterStart;
+    ChState->RegA = UserChCfg->PhaseShift + CounterStart;
 
     /* Configure Counter Bus used by this Channel */
     Emios_Pwm_Ip_SetCounterBus(Base, UserChCfg->ChannelId, UserChCfg->Timebase);
@@ -1322,7 +1350,7 @@ static void Emios_Pwm_Ip_InitTriggerMode(uint8 Instance,
     /* To avoid spike pulse
     If duty cycle = 100%, when enter Mode, EDPOL bit get complement of polarity
     after that, EDPOL bit is restored valid value */
-    if (CounterBusPeriod == UserChCfg->DutyCycle)
+    if (CounterBusPeriod == OutDutyCycle)
     {
         /* Configure polarity and desired mode at the same time to prevent a spike in case multi-variants used or the initialization occurs more than once */
         Emios_Pwm_Ip_SetPwmModePol(Base, UserChCfg->ChannelId, UserChCfg->Mode, (UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH);
@@ -1337,7 +1365,7 @@ static void Emios_Pwm_Ip_InitTriggerMode(uint8 Instance,
     /* Configure output pin polarity */
     Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
     /* Stores the inital duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->DutyCycle;
+    ChState->DutyCycle = UserChCfg->DutyCycle;
 }
 
 /*FUNCTION**********************************************************************
@@ -1357,9 +1385,15 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwmt(uint8  Inst
     DevAssert(EMIOS_PWM_IP_INSTANCE_COUNT > Instance);
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
     Emios_Pwm_Ip_PeriodType ChPeriod = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel));
+    /* Duty cycle put on the output */
+    Emios_Pwm_Ip_DutyType OutDutyCycle = NewDutyCycle;
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+    OutDutyCycle = Emios_Pwm_Ip_DimDutyCycle(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel), NewDutyCycle);
+#endif
 
     /* OPWMT Mode */
     if (NewDutyCycle > ChPeriod)
@@ -1368,35 +1402,35 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleOpwmt(uint8  Inst
     }
     else
     {
-        if (ChPeriod == NewDutyCycle)
+        if (ChPeriod == OutDutyCycle)
         {   /* 100% DutyCycle is desired. Trailing edge must be placed outside counter bus period. */
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
 
-            Emios_Pwm_Ip_SetUCRegB(Base, Channel, (NewDutyCycle + 1U));
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            Emios_Pwm_Ip_SetUCRegB(Base, Channel, (OutDutyCycle + 1U));
+            ChState->Notif = (uint8)1U;
         }
-        else if(0U == NewDutyCycle)
+        else if(0U == OutDutyCycle)
         {
             /* 0% DutyCycle is desired. */
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
 
-            Emios_Pwm_Ip_SetUCRegB(Base, Channel, Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            Emios_Pwm_Ip_SetUCRegB(Base, Channel, ChState->RegA);
+            ChState->Notif = (uint8)1U;
         }
         else
         { /* Calculate trailing edge postion. Wrap-around if DutyCycle extends the signal past the counterbus period. */
-            Emios_Pwm_Ip_SetUCRegB(Base, Channel, (Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] + NewDutyCycle) % ChPeriod);
-            Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)0U;
-            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == 0U)? FALSE : TRUE);
+            Emios_Pwm_Ip_SetUCRegB(Base, Channel, (ChState->RegA + OutDutyCycle) % ChPeriod);
+            ChState->Notif = (uint8)0U;
+            Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, (ChState->CheckEnableNotif == 0U)? FALSE : TRUE);
         }
     }
 
     /* Stores the new duty cycle in ticks */
-    Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = NewDutyCycle;
+    ChState->DutyCycle = NewDutyCycle;
 
     return Ret;
 }
@@ -1417,10 +1451,12 @@ static inline void Emios_Pwm_Ip_InitDCModeWithDuty(uint8 Instance,
 
     if (ChannelIndex < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8)
     {
+        Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[ChannelIndex];
+
         if(0U == UserChCfg->DutyCycle)
         {
             DaocRegA = 1U;
-            Emios_Pwm_Ip_aDutyCycle[ChannelIndex] = 0U;
+            ChState->DutyCycle = 0U;
 
             Emios_Pwm_Ip_SetForceMatchB(Base, UserChCfg->ChannelId, TRUE);
             /* Configure Leading Edge in reg A */
@@ -1430,14 +1466,14 @@ static inline void Emios_Pwm_Ip_InitDCModeWithDuty(uint8 Instance,
 
             Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
 
-            Emios_Pwm_Ip_aNotif[ChannelIndex] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
 
         }
         else if(UserChCfg->DutyCycle == UserChCfg->PeriodCount)
         {
-            DaocRegA = (Emios_Pwm_Ip_aPeriod[ChannelIndex] + Emios_Pwm_Ip_GetUCRegA(Base, UserChCfg->ChannelId)) % CounterMax;
+            DaocRegA = (ChState->Period + Emios_Pwm_Ip_GetUCRegA(Base, UserChCfg->ChannelId)) % CounterMax;
 
-            Emios_Pwm_Ip_aDutyCycle[ChannelIndex] = 0U;
+            ChState->DutyCycle = 0U;
 
             Emios_Pwm_Ip_SetForceMatchA(Base, UserChCfg->ChannelId, TRUE);
             /* Configure Leading Edge in reg A */
@@ -1447,12 +1483,12 @@ static inline void Emios_Pwm_Ip_InitDCModeWithDuty(uint8 Instance,
             /* Invert the EDGE POLARITY in control register */
             Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId,(UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH) ? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH);
 
-            Emios_Pwm_Ip_aNotif[ChannelIndex] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
         else
         {
             DaocRegA = 1U;
-            Emios_Pwm_Ip_aDutyCycle[ChannelIndex] = UserChCfg->DutyCycle;
+            ChState->DutyCycle = UserChCfg->DutyCycle;
 
             /* Configure Leading Edge in reg A */
             Emios_Pwm_Ip_SetUCRegA(Base, UserChCfg->ChannelId, DaocRegA);
@@ -1461,7 +1497,7 @@ static inline void Emios_Pwm_Ip_InitDCModeWithDuty(uint8 Instance,
 
             Emios_Pwm_Ip_SetEdgePolarity(Base, UserChCfg->ChannelId, UserChCfg->OutputPolarity);
 
-            Emios_Pwm_Ip_aNotif[ChannelIndex] = (uint8)0U;
+            ChState->Notif = (uint8)0U;
         }
     }
     else
@@ -1499,10 +1535,11 @@ static void Emios_Pwm_Ip_InitDoubleCompareMode(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_MIN_CNT_VAL < UserChCfg->PeriodCount);
     DevAssert(UserChCfg->DutyCycle <= UserChCfg->PeriodCount);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     Emios_Pwm_Ip_HwAddrType *const base = Emios_Pwm_Ip_aBasePtr[Instance];
-    Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = UserChCfg->PeriodCount;
-    Emios_Pwm_Ip_aPolarity[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = (UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH)? 1U : 0U;
+    ChState->Period = UserChCfg->PeriodCount;
+    ChState->Polarity = (UserChCfg->OutputPolarity == EMIOS_PWM_IP_ACTIVE_HIGH)? 1U : 0U;
 
     /* FLAG event enabled */
     Emios_Pwm_Ip_SetInterruptRequest(base, UserChCfg->ChannelId, TRUE);
@@ -1552,19 +1589,21 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleDaoc(uint8  Insta
 
     if (ChannelIdx < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8)
     {
+        Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[ChannelIdx];
+
         /* DAOC Mode */
-        if ((NewDutyCycle > Emios_Pwm_Ip_aPeriod[ChannelIdx]) && ((Emios_Pwm_Ip_PeriodType)0U != Emios_Pwm_Ip_aPeriod[ChannelIdx]))
+        if ((NewDutyCycle > ChState->Period) && ((Emios_Pwm_Ip_PeriodType)0U != ChState->Period))
         {   /* Duty cycle value should not be greater than the Channel Period. */
             Ret = EMIOS_PWM_IP_STATUS_ERROR;
         }
-        else if (((Emios_Pwm_Ip_PeriodType)0U == Emios_Pwm_Ip_aPeriod[ChannelIdx]) || ((Emios_Pwm_Ip_DutyType)0U == NewDutyCycle))
+        else if (((Emios_Pwm_Ip_PeriodType)0U == ChState->Period) || ((Emios_Pwm_Ip_DutyType)0U == NewDutyCycle))
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
 
             /* If new period is 0, set duty cycle to 0 */
-            Emios_Pwm_Ip_aDutyCycle[ChannelIdx] = 0U;
+            ChState->DutyCycle = 0U;
 
             Emios_Pwm_Ip_SetForceMatchB(Base, Channel, TRUE);
             /* Configure Leading Edge in reg A */
@@ -1572,21 +1611,21 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleDaoc(uint8  Insta
             /* Configure Trailing Edge in reg B */
             Emios_Pwm_Ip_SetUCRegB(Base, Channel, (NewDutyCycle + 1U));
             /* Set polarity when channels is in active state */
-            if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[ChannelIdx])
+            if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
             {
-                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel, (Emios_Pwm_Ip_aPolarity[ChannelIdx] == 1U)? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW);
+                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel, (ChState->Polarity == 1U)? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW);
             }
 
-            Emios_Pwm_Ip_aNotif[ChannelIdx] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
-        else if(NewDutyCycle == Emios_Pwm_Ip_aPeriod[ChannelIdx])
+        else if(NewDutyCycle == ChState->Period)
         {
             /* Disable and clear interrupt flag */
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
             Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
 
-            Emios_Pwm_Ip_aDutyCycle[ChannelIdx] = 0U;
-            DaocRegA = (Emios_Pwm_Ip_aPeriod[ChannelIdx] + Emios_Pwm_Ip_GetUCRegA(Base, Channel)) % CounterMax;
+            ChState->DutyCycle = 0U;
+            DaocRegA = (ChState->Period + Emios_Pwm_Ip_GetUCRegA(Base, Channel)) % CounterMax;
 
             Emios_Pwm_Ip_SetForceMatchA(Base, Channel, TRUE);
             /* Configure Leading Edge in reg A */
@@ -1595,30 +1634,30 @@ static inline Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycleDaoc(uint8  Insta
             Emios_Pwm_Ip_SetUCRegB(Base, Channel, (DaocRegA == 0U)? CounterMax : DaocRegA);
             /* Set polarity when channels is in active state */
             /* Invert the EDGE POLARITY in control register */
-            if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[ChannelIdx])
+            if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
             {
-                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(Emios_Pwm_Ip_aPolarity[ChannelIdx] == 1U)? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH);
+                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel,(ChState->Polarity == 1U)? EMIOS_PWM_IP_ACTIVE_LOW : EMIOS_PWM_IP_ACTIVE_HIGH);
             }
 
-            Emios_Pwm_Ip_aNotif[ChannelIdx] = (uint8)1U;
+            ChState->Notif = (uint8)1U;
         }
         else
         {
             /* FLAG event enabled. The Daoc Mode requires interrupt to calculate the next match value*/
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, TRUE);
 
-            Emios_Pwm_Ip_aDutyCycle[ChannelIdx] = NewDutyCycle;
+            ChState->DutyCycle = NewDutyCycle;
             /* Configure Leading Edge in reg A */
             Emios_Pwm_Ip_SetUCRegA(Base, Channel, 1U);
             /* Configure Trailing Edge in reg B */
             Emios_Pwm_Ip_SetUCRegB(Base, Channel, NewDutyCycle + 1U);
             /* Set polarity when channels is in active state */
-            if (EMIOS_PWM_IP_MODE_GPO != Emios_Pwm_Ip_aCurrentModes[ChannelIdx])
+            if (EMIOS_PWM_IP_MODE_GPO != ChState->CurrentMode)
             {
-                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel, (Emios_Pwm_Ip_aPolarity[ChannelIdx] == 1U)? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW);
+                Emios_Pwm_Ip_SetEdgePolarity(Base, Channel, (ChState->Polarity == 1U)? EMIOS_PWM_IP_ACTIVE_HIGH : EMIOS_PWM_IP_ACTIVE_LOW);
             }
 
-            Emios_Pwm_Ip_aNotif[ChannelIdx] = (uint8)0U;
+            ChState->Notif = (uint8)0U;
 
         }
     }
@@ -1632,6 +1671,7 @@ static inline void Emios_Pwm_Ip_InitOutputIrqAndMode(uint8
                                                     )
 {
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
 
     if (EMIOS_PWM_IP_OUTPUT_DISABLE_NONE != UserChCfg->OutputDisableSource)
     {
@@ -1645,7 +1685,7 @@ static inline void Emios_Pwm_Ip_InitOutputIrqAndMode(uint8
         if (EMIOS_PWM_IP_INTERRUPT_REQUEST == UserChCfg->IrqMode)
         {
             /* Register the notification structure */
-            Emios_Pwm_Ip_aNotificationPtr[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]] = &(UserChCfg->UserCallback);
+            ChState->NotificationPtr = &(UserChCfg->UserCallback);
         }
         else
         {
@@ -1771,7 +1811,7 @@ void Emios_Pwm_Ip_InitChannel(uint8 Instance,
     }
 #endif
 
-    uint8 ChannelIndex = UserChCfg->ChannelId;
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][UserChCfg->ChannelId]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     /* Get timbase channel */
     uint8 TimbaseCh = Emios_Pwm_Ip_GetTimebaseChannel(UserChCfg->ChannelId, UserChCfg->Timebase);
@@ -1818,17 +1858,19 @@ void Emios_Pwm_Ip_InitChannel(uint8 Instance,
     Emios_Pwm_Ip_SetExtendedPrescaler(Base, UserChCfg->ChannelId, UserChCfg->InternalPs);
     Emios_Pwm_Ip_SetPrescalerEnable(Base, UserChCfg->ChannelId, TRUE);
     /* Stores the inital modes of Channel. */
-    Emios_Pwm_Ip_aInitialModes[eMios_Pwm_Ip_IndexInChState[Instance][ChannelIndex]] = UserChCfg->Mode;
+    ChState->InitialMode = UserChCfg->Mode;
     /* Stores the current modes of Channel. */
-    Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][ChannelIndex]] = UserChCfg->Mode;
+    ChState->CurrentMode = UserChCfg->Mode;
     /* Confirm the Channel is active*/
-    Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][ChannelIndex]] = (uint8)1U;
+    ChState->CheckState = (uint8)1U;
     /* If the counter buses to be used by the Unified Channel. */
     if (TimbaseCh < EMIOS_PWM_IP_CHANNEL_COUNT)
     {
+        Emios_Pwm_Ip_ChStateType *const BusState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][TimbaseCh]];
+
         /* Confirm the timebase channel is active */
-        /* Each channel that uses the master bus the Emios_Pwm_Ip_aCheckState variable will increment. */
-        Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][TimbaseCh]] += (uint8)1U;
+        /* Each channel that uses the master bus the CheckState of the bus channel will increment. */
+        BusState->CheckState += (uint8)1U;
     }
     else
     {
@@ -1875,28 +1917,40 @@ void Emios_Pwm_Ip_DeInitChannel(uint8 Instance,
 
     if (ChannelIdx < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8)
     {
+        Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[ChannelIdx];
         /* Clear ALTAn if in PWM Trigger Mode */
 #ifdef EMIOS_PWM_IP_MODE_OPWMT_USED
-        if (Emios_Pwm_Ip_aCurrentModes[ChannelIdx] == EMIOS_PWM_IP_MODE_OPWMT)
+        if (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMT)
         {
             Emios_Pwm_Ip_SetTrigger(Base, Channel, 0U);
         }
 #endif
-        Emios_Pwm_Ip_aCheckEnableNotif[ChannelIdx] = (uint8)0U;
+        ChState->CheckEnableNotif = (uint8)0U;
 
         /* Confirm the Channel is inactive*/
-        Emios_Pwm_Ip_aCheckState[ChannelIdx] = (uint8)0U;
+        ChState->CheckState = (uint8)0U;
     }
 
     /* If the counter buses to be used by the Unified Channel. */
     if ((EMIOS_PWM_IP_BUS_INTERNAL != CounterBus) && (TimbaseCh < EMIOS_PWM_IP_CHANNEL_COUNT))
     {
-        if((uint8)0U != Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][TimbaseCh]])
+        Emios_Pwm_Ip_ChStateType *const BusState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][TimbaseCh]];
+
+        if((uint8)0U != BusState->CheckState)
+        {
+            /* Confirm the timebase channel is inactive if its CheckState is 0U*/
+            /* Decrement the CheckState of the bus channel for each channel that uses the master bus, make sure the master bus is not marked inactive when there are still active channels. */
+            BusState->CheckState = BusState->CheckState - (uint8)1U;
+        }
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+        if ((uint8)0U == BusState->CheckState)
         {
-            /* Confirm the timebase channel is inactive if Emios_Pwm_Ip_aCheckState is 0U*/
-            /* Decrement Emios_Pwm_Ip_aCheckState variable for each channel that uses the master bus, make sure the master bus is not marked inactive when there are still active channels. */
-            Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][TimbaseCh]] = Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][TimbaseCh]] - (uint8)1U;
+            /* The last channel of the bus is gone, the next ones start undimmed */
+            SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_47();
+            Emios_Pwm_Ip_aBusDimming[Instance][TimbaseCh] = 0U;
+            SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_47();
         }
+#endif
     }
     else
     {
@@ -1980,17 +2034,18 @@ Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_GetPeriod(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     const Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     Emios_Pwm_Ip_PwmModeType ChMode;
     Emios_Pwm_Ip_PeriodType ChPeriod = 0x00U;
     /* Channels shall be reactivated from idle state. */
-    if ((uint8)2U == Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+    if ((uint8)2U == ChState->CheckState)
     {
-        ChMode = Emios_Pwm_Ip_aInitialModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+        ChMode = ChState->InitialMode;
     }
     else
     {
-        ChMode =  Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+        ChMode =  ChState->CurrentMode;
     }
 
     switch (ChMode)
@@ -2011,7 +2066,7 @@ Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_GetPeriod(uint8 Instance,
         case EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH:
         #endif
         /* Channel Mode is OPWFMB, OPWFM or DAOC Mode */
-        ChPeriod = Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+        ChPeriod = ChState->Period;
 
         /* Prevent compiler warning */
         (void)Base;
@@ -2079,6 +2134,7 @@ void Emios_Pwm_Ip_SetPeriod(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 
@@ -2086,16 +2142,16 @@ void Emios_Pwm_Ip_SetPeriod(uint8 Instance,
     /* Check Channel Mode is OPWFMB, OPWFM, DAOC or GPO Mode */
     DevAssert(
 #if ((defined EMIOS_PWM_IP_MODE_OPWFMB_USED) || (defined EMIOS_PWM_IP_MODE_OPWFM_USED) || (defined EMIOS_PWM_IP_MODE_DAOC_USED))
-              (EMIOS_PWM_IP_MODE_OPWFMB_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWFMB_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_DAOC_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
+              (EMIOS_PWM_IP_MODE_OPWFMB_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWFMB_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_DAOC_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH == ChState->CurrentMode) ||
 #endif
-              (EMIOS_PWM_IP_MODE_GPO == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+              (EMIOS_PWM_IP_MODE_GPO == ChState->CurrentMode));
 
 #endif
 
@@ -2110,7 +2166,7 @@ void Emios_Pwm_Ip_SetPeriod(uint8 Instance,
         Emios_Pwm_Ip_SetUCRegB(Base, Channel, NewPeriod);
     }
     /* Store new period */
-    Emios_Pwm_Ip_aPeriod[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = NewPeriod;
+    ChState->Period = NewPeriod;
 }
 
 /**
@@ -2130,11 +2186,18 @@ Emios_Pwm_Ip_DutyType Emios_Pwm_Ip_GetDutyCycle(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
 
-    Emios_Pwm_Ip_DutyType DutyCycle = Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
-    return DutyCycle;
+    return ChState->DutyCycle;
 }
 
+#if defined(TCM_HOT_PATH)
+#define PWM_STOP_SEC_CODE
+#include "Pwm_MemMap.h"
+#define TCM_START_SEC_CODE
+#include "Tcm_MemMap.h"
+#endif
+
 /**
  *
  * Function Name : Emios_Pwm_Ip_SetDutyCycle
@@ -2154,12 +2217,12 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycle(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
     Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
     Emios_Pwm_Ip_PwmModeType ChMode;
     /* Channels shall be reactivated from idle state. */
-    ChMode = ((uint8)2U == Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ? Emios_Pwm_Ip_aInitialModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] : \
-                                                                                                       Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+    ChMode = ((uint8)2U == ChState->CheckState) ? ChState->InitialMode : ChState->CurrentMode;
 
     SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_16();
 
@@ -2230,6 +2293,13 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetDutyCycle(uint8 Instance,
     return Ret;
 }
 
+#if defined(TCM_HOT_PATH)
+#define TCM_STOP_SEC_CODE
+#include "Tcm_MemMap.h"
+#define PWM_START_SEC_CODE
+#include "Pwm_MemMap.h"
+#endif
+
 /**
  *
  * Function Name : Emios_Pwm_Ip_GetPhaseShift
@@ -2246,17 +2316,18 @@ Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_GetPhaseShift(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
     const Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
 #if ((defined EMIOS_PWM_IP_MODE_OPWM_USED) || (defined EMIOS_PWM_IP_MODE_OPWMB_USED) || (defined EMIOS_PWM_IP_MODE_OPWMT_USED))
-    DevAssert((EMIOS_PWM_IP_MODE_OPWMB_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWMB_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWMT == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+    DevAssert((EMIOS_PWM_IP_MODE_OPWMB_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWMB_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWMT == ChState->CurrentMode));
 #endif
 #endif
 
@@ -2281,6 +2352,7 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetPhaseShift(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
     Emios_Pwm_Ip_StatusType Status = EMIOS_PWM_IP_STATUS_SUCCESS;
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
@@ -2293,21 +2365,21 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetPhaseShift(uint8 Instance,
 
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
 #if ((defined EMIOS_PWM_IP_MODE_OPWM_USED) || (defined EMIOS_PWM_IP_MODE_OPWMB_USED) || (defined EMIOS_PWM_IP_MODE_OPWMT_USED))
-    DevAssert((EMIOS_PWM_IP_MODE_OPWMB_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWMB_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]) ||
-              (EMIOS_PWM_IP_MODE_OPWMT == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]));
+    DevAssert((EMIOS_PWM_IP_MODE_OPWMB_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWMB_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH == ChState->CurrentMode) ||
+              (EMIOS_PWM_IP_MODE_OPWMT == ChState->CurrentMode));
 #endif
 #endif
 
     ChPeriod = Emios_Pwm_Ip_GetCounterBusPeriod(Instance, Channel, CounterBus);
-    DutyCycle = Emios_Pwm_Ip_aDutyCycle[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+    DutyCycle = ChState->DutyCycle;
 #if ((defined EMIOS_PWM_IP_MODE_OPWM_USED) || (defined EMIOS_PWM_IP_MODE_OPWMB_USED) || (defined EMIOS_PWM_IP_MODE_OPWMT_USED))
     /* Check that phase shift can be applied to the selected Channel */
-    switch (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+    switch (ChState->CurrentMode)
     {
 #if ((defined EMIOS_PWM_IP_MODE_OPWM_USED) || (defined EMIOS_PWM_IP_MODE_OPWMB_USED))
 #ifdef EMIOS_PWM_IP_MODE_OPWMB_USED
@@ -2320,7 +2392,7 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetPhaseShift(uint8 Instance,
         case EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG:
         case EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH:
 #endif
-            Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = PhaseShift;
+            ChState->RegA = PhaseShift;
             if ((PhaseShift + DutyCycle) > ChPeriod)
             {
                 Status = EMIOS_PWM_IP_STATUS_ERROR;
@@ -2328,9 +2400,9 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetPhaseShift(uint8 Instance,
             else
             {
                 /* Set the new phase shift */
-                Emios_Pwm_Ip_SetUCRegA(Base, Channel, Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]);
+                Emios_Pwm_Ip_SetUCRegA(Base, Channel, ChState->RegA);
                 /* Move trailing edge to keep the same duty cycle */
-                Emios_Pwm_Ip_SetUCRegB(Base, Channel, (Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] + DutyCycle));
+                Emios_Pwm_Ip_SetUCRegB(Base, Channel, (ChState->RegA + DutyCycle));
             }
             break;
 #endif
@@ -2338,7 +2410,7 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetPhaseShift(uint8 Instance,
         case EMIOS_PWM_IP_MODE_OPWMT:
             CounterStart = (EMIOS_PWM_IP_MCB_UP_COUNTER == Emios_Pwm_Ip_GetCounterBusMode(Instance, Channel, CounterBus)) ? 0x01U : 0x00U;
 
-            Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = PhaseShift + CounterStart;
+            ChState->RegA = PhaseShift + CounterStart;
             if (PhaseShift > ChPeriod)
             {
                 Status = EMIOS_PWM_IP_STATUS_ERROR;
@@ -2346,9 +2418,9 @@ Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetPhaseShift(uint8 Instance,
             else
             {
                 /* Set the new phase shift */
-                Emios_Pwm_Ip_SetUCRegA(Base, Channel, Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]]);
+                Emios_Pwm_Ip_SetUCRegA(Base, Channel, ChState->RegA);
                 /* Move trailing edge to keep the same duty cycle */
-                Emios_Pwm_Ip_SetUCRegB(Base, Channel, (Emios_Pwm_Ip_aRegA[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] + DutyCycle));
+                Emios_Pwm_Ip_SetUCRegB(Base, Channel, (ChState->RegA + DutyCycle));
             }
             break;
 #endif
@@ -2382,14 +2454,15 @@ Emios_Pwm_Ip_PeriodType Emios_Pwm_Ip_GetDeadTime(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
     const Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
 #ifdef EMIOS_PWM_IP_MODE_OPWMCB_USED
-    DevAssert((Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
-              (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH) ||
-              (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG) ||
-              (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH));
+    DevAssert((ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
+              (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH) ||
+              (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG) ||
+              (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH));
 #endif
 #endif
     /* Get the configured dead time */
@@ -2414,13 +2487,14 @@ void Emios_Pwm_Ip_SetDeadTime(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
 #if (defined EMIOS_PWM_IP_MODE_OPWMCB_USED)
-    DevAssert((Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
-              (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH) ||
-              (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG) ||
-              (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH));
+    DevAssert((ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
+              (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH) ||
+              (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG) ||
+              (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH));
 #endif
 #endif
 
@@ -2449,7 +2523,7 @@ uint32 Emios_Pwm_Ip_GetTriggerPlacement(uint8 Instance,
 
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
 #ifdef EMIOS_PWM_IP_MODE_OPWMT_USED
-    DevAssert(Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMT);
+    DevAssert(Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]].CurrentMode == EMIOS_PWM_IP_MODE_OPWMT);
 #endif
 #endif
 
@@ -2490,7 +2564,7 @@ void Emios_Pwm_Ip_SetTriggerPlacement(uint8 Instance,
 
 #if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
 #ifdef EMIOS_PWM_IP_MODE_OPWMT_USED
-    DevAssert(Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] == EMIOS_PWM_IP_MODE_OPWMT);
+    DevAssert(Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]].CurrentMode == EMIOS_PWM_IP_MODE_OPWMT);
 #endif
     /* Check selected counter bus is configured in MCB Up Mode or MC Up Mode */
     DevAssert((EMIOS_PWM_IP_MCB_UP_COUNTER == Emios_Pwm_Ip_GetCounterBusMode(Instance, Channel, Emios_Pwm_Ip_GetCounterBus(Base, Channel))) ||
@@ -2620,6 +2694,7 @@ void Emios_Pwm_Ip_SetFlagRequest(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 
     SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_20();
@@ -2629,22 +2704,22 @@ void Emios_Pwm_Ip_SetFlagRequest(uint8 Instance,
     switch (Event)
     {
     case EMIOS_PWM_IP_INTERRUPT_REQUEST:
-        if ((uint8)0U == Emios_Pwm_Ip_aNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+        if ((uint8)0U == ChState->Notif)
         {
             Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, TRUE);
             Emios_Pwm_Ip_SetDMARequest(Base, Channel, FALSE);
-            Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+            ChState->CheckEnableNotif = (uint8)1U;
         }
         break;
     case EMIOS_PWM_IP_DMA_REQUEST:
         Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, TRUE);
         Emios_Pwm_Ip_SetDMARequest(Base, Channel, TRUE);
-        Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)1U;
+        ChState->CheckEnableNotif = (uint8)1U;
         break;
     case EMIOS_PWM_IP_NOTIFICATION_DISABLED:
         Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
         Emios_Pwm_Ip_SetDMARequest(Base, Channel, FALSE);
-        Emios_Pwm_Ip_aCheckEnableNotif[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)0U;
+        ChState->CheckEnableNotif = (uint8)0U;
         break;
     default:
         /* Nothig to do. All cases are treated.*/
@@ -2690,6 +2765,7 @@ void Emios_Pwm_Ip_SetOutputState(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
     SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_21();
     /* Set output pin polarity */
@@ -2705,7 +2781,7 @@ void Emios_Pwm_Ip_SetOutputState(uint8 Instance,
     Emios_Pwm_Ip_SetPwmMode(Base, Channel, (Emios_Pwm_Ip_PwmModeType)EMIOS_PWM_IP_MODE_GPO);
 
 #if (defined(EMIOS_PWM_IP_AUTOSAR_MODE_IS_USED) && (STD_ON == EMIOS_PWM_IP_AUTOSAR_MODE_IS_USED))
-    if (0U == Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+    if (0U == ChState->CheckState)
     {
         /* Clear An and Bn registers */
         Emios_Pwm_Ip_SetUCRegA(Base, Channel, 0U);
@@ -2714,13 +2790,13 @@ void Emios_Pwm_Ip_SetOutputState(uint8 Instance,
 #endif
 
     /* Stored the current Mode */
-    Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (Emios_Pwm_Ip_PwmModeType)EMIOS_PWM_IP_MODE_GPO;
+    ChState->CurrentMode = (Emios_Pwm_Ip_PwmModeType)EMIOS_PWM_IP_MODE_GPO;
     /* Disable Channel interrupts */
     Emios_Pwm_Ip_SetInterruptRequest(Base, Channel, FALSE);
     /* Clear pending interrupt flag for the Channel */
     Emios_Pwm_Ip_ClearFlagEvent(Base, Channel);
     /* Confirm the Channel is idle state */
-    Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = (uint8)2U;
+    ChState->CheckState = (uint8)2U;
     SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_21();
 }
 
@@ -2743,10 +2819,11 @@ void Emios_Pwm_Ip_SetOutputToNormal(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
+    Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
     Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
 
     SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_22();
-    if (EMIOS_PWM_IP_MODE_GPO == Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]])
+    if (EMIOS_PWM_IP_MODE_GPO == ChState->CurrentMode)
     {
 #if ((defined EMIOS_PWM_IP_MODE_OPWFMB_USED) || (defined EMIOS_PWM_IP_MODE_OPWFM_USED) || \
      (defined EMIOS_PWM_IP_MODE_OPWMB_USED) || (defined EMIOS_PWM_IP_MODE_OPWM_USED) || \
@@ -2795,7 +2872,7 @@ void Emios_Pwm_Ip_SetOutputToNormal(uint8 Instance,
                     Emios_Pwm_Ip_SetPwmModePol(Base, Channel, Mode, Polarity);
                 }
                 Emios_Pwm_Ip_SetPwmMode(Base, Channel, Mode);
-                Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]] = Mode;
+                ChState->CurrentMode = Mode;
                 break;
 #endif
             default:
@@ -2847,9 +2924,9 @@ Emios_Pwm_Ip_PwmModeType Emios_Pwm_Ip_GetChannelMode(uint8 Instance,
     DevAssert(EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8 > eMios_Pwm_Ip_IndexInChState[Instance][Channel]);
 #endif
 
-    Emios_Pwm_Ip_PwmModeType ChannelMode = Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+    const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
 
-    return ChannelMode;
+    return ChState->CurrentMode;
 }
 
 /**
@@ -3030,6 +3107,7 @@ void Emios_Pwm_Ip_SyncUpdate(uint8 Instance)
 
     uint8  OudisDisable = 0U;
     uint8  ChannelId;
+    const Emios_Pwm_Ip_ChStateType *ChState;
 
     SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_28();
 
@@ -3037,23 +3115,24 @@ void Emios_Pwm_Ip_SyncUpdate(uint8 Instance)
     for (ChannelId = 0U; ChannelId < EMIOS_PWM_IP_CHANNEL_COUNT; ChannelId++)
     {
         OudisDisable = (uint8)((OudisRegVal & (uint32)((uint32)1U << ChannelId)) >> ChannelId);
+        ChState = &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][ChannelId]];
 
-        if (((uint8)0U != Emios_Pwm_Ip_aCheckState[eMios_Pwm_Ip_IndexInChState[Instance][ChannelId]]) && ((uint8)1U == OudisDisable))
+        if (((uint8)0U != ChState->CheckState) && ((uint8)1U == OudisDisable))
         {
 #ifdef EMIOS_PWM_IP_MODE_OPWMCB_USED
             /* This statement is required to avoid limitation of 0% duty cycle (if call 100% to 0%) */
             if(1U == Emios_Pwm_Ip_GetUCRegA(Base, ChannelId))
             {
-                if((Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][ChannelId]] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
-                   (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][ChannelId]] == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH))
+                if((ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG) ||
+                   (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH))
                 {
                     /* Enable the output update for the corresponding Channel.*/
                     Emios_Mcl_Ip_ComparatorTransferEnable(Instance, (uint32)((uint32)1U << ChannelId));
 
                     Emios_Pwm_Ip_SetForceMatchB(Base, ChannelId, TRUE);
                 }
-                else if ((Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][ChannelId]] == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG) ||
-                         (Emios_Pwm_Ip_aCurrentModes[eMios_Pwm_Ip_IndexInChState[Instance][ChannelId]] == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH))
+                else if ((ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG) ||
+                         (ChState->CurrentMode == EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH))
                 {
                     /* Enable the output update for the corresponding Channel.*/
                     Emios_Mcl_Ip_ComparatorTransferEnable(Instance, (uint32)((uint32)1U << ChannelId));
@@ -3115,6 +3194,53 @@ void Emios_Pwm_Ip_UpdateUCRegB(uint8 Instance, uint8 Channel, Emios_Pwm_Ip_Perio
     Emios_Pwm_Ip_SetUCRegB(Base, Channel, Value);
 }
 
+#if (EMIOS_PWM_IP_BUS_DIMMING == STD_ON)
+/**
+*
+* Function Name : Emios_Pwm_Ip_SetBusBrightness
+* Description   : This function sets the brightness of all channels driven by the
+*                 counter bus of Channel. Only the multiplier of the bus is stored;
+*                 every OPWM, OPWMB, OPWMCB and OPWMT channel of the bus applies it
+*                 on its next duty cycle write. No channel register is touched and
+*                 the bus period is left as it is.
+*
+**/
+Emios_Pwm_Ip_StatusType Emios_Pwm_Ip_SetBusBrightness(uint8 Instance, uint8 Channel, uint16 Brightness)
+{
+#if (EMIOS_PWM_IP_DEV_ERROR_DETECT == STD_ON)
+    DevAssert(EMIOS_PWM_IP_INSTANCE_COUNT > Instance);
+    DevAssert(EMIOS_PWM_IP_CHANNEL_COUNT > Channel);
+#endif
+
+    const Emios_Pwm_Ip_HwAddrType *const Base = Emios_Pwm_Ip_aBasePtr[Instance];
+    Emios_Pwm_Ip_CounterBusSourceType CounterBus = Emios_Pwm_Ip_GetCounterBus(Base, Channel);
+    uint8 MasterBusCh = Emios_Pwm_Ip_GetTimebaseChannel(Channel, CounterBus);
+    Emios_Pwm_Ip_StatusType Ret = EMIOS_PWM_IP_STATUS_ERROR;
+
+    if ((MasterBusCh < EMIOS_PWM_IP_CHANNEL_COUNT) && (EMIOS_PWM_IP_BRIGHTNESS_FULL >= Brightness))
+    {
+        switch (Emios_Pwm_Ip_GetCounterBusMode(Instance, Channel, CounterBus))
+        {
+            case EMIOS_PWM_IP_MC_UP_COUNTER_START:
+            case EMIOS_PWM_IP_MC_UP_COUNTER_END:
+            case EMIOS_PWM_IP_MCB_UP_COUNTER:
+            case EMIOS_PWM_IP_MC_UP_DOWN_COUNTER:
+            case EMIOS_PWM_IP_MCB_UP_DOWN_COUNTER:
+                SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_47();
+                Emios_Pwm_Ip_aBusDimming[Instance][MasterBusCh] = (uint16)(EMIOS_PWM_IP_BRIGHTNESS_FULL - Brightness);
+                SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_47();
+                Ret = EMIOS_PWM_IP_STATUS_SUCCESS;
+                break;
+            default:
+                /* Undefined bus mode */
+                break;
+        }
+    }
+
+    return Ret;
+}
+#endif
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
 
@@ -42,6 +42,10 @@ extern "C"{
 #include "Emios_Pwm_Ip.h"
 #include "Emios_Pwm_Ip_HwAccess.h"
 #include "Emios_Pwm_Ip_Irq.h"
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+#include "OsIf.h"
+#include "SchM_Pwm.h"
+#endif
 
 /*==================================================================================================
 *                                 SOURCE FILE VERSION INFORMATION
@@ -121,6 +125,9 @@ extern "C"{
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+#define EMIOS_PWM_IP_NOTIF_QUEUE_MASK           (EMIOS_PWM_IP_NOTIF_QUEUE_SIZE - 1U)
+#endif
 
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
@@ -129,6 +136,49 @@ extern "C"{
 /*==================================================================================================
 *                                      LOCAL VARIABLES
 ==================================================================================================*/
+#if (EMIOS_PWM_IP_USED == STD_ON)
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+#if defined(TCM_HOT_PATH)
+    #define TCM_START_SEC_VAR_CLEARED
+    #include "Tcm_MemMap.h"
+#else
+#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
+#else
+    #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED
+#endif
+#include "Pwm_MemMap.h"
+#endif
+
+/** @brief Events queued by the IRQ handler for Emios_Pwm_Ip_DispatchNotifications.
+ *  Any number of producers, one consumer: the IRQ handlers of all eMIOS vectors push under
+ *  PWM_EXCLUSIVE_AREA_29, whatever their priorities, and the head is only written there. The
+ *  tail is only written by the dispatcher, which needs no lock. Both indexes run freely and
+ *  are masked on access. */
+static volatile Emios_Pwm_Ip_NotifEventType Emios_Pwm_Ip_aNotifQueue[EMIOS_PWM_IP_NOTIF_QUEUE_SIZE];
+static volatile uint32 Emios_Pwm_Ip_u32NotifHead;
+static volatile uint32 Emios_Pwm_Ip_u32NotifTail;
+
+/** @brief Queue statistics, PeakLevel and Overflows written under the area, Dispatched by the
+ *  dispatcher */
+static Emios_Pwm_Ip_NotifStatsType Emios_Pwm_Ip_NotifStats;
+
+/** @brief Copy of the event whose callback the dispatcher is running */
+static Emios_Pwm_Ip_NotifEventType Emios_Pwm_Ip_DispatchedEvent;
+
+#if defined(TCM_HOT_PATH)
+    #define TCM_STOP_SEC_VAR_CLEARED
+    #include "Tcm_MemMap.h"
+#else
+#if (EMIOS_PWM_IP_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
+#else
+    #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#endif
+#include "Pwm_MemMap.h"
+#endif
+#endif /* EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON */
+#endif /* EMIOS_PWM_IP_USED == STD_ON */
 
 /*==================================================================================================
 *                                      GLOBAL CONSTANTS
@@ -152,8 +202,13 @@ extern "C"{
 
 #if (EMIOS_PWM_IP_USED == STD_ON)
 
+#if defined(TCM_HOT_PATH)
+#define TCM_START_SEC_CODE
+#include "Tcm_MemMap.h"
+#else
 #define PWM_START_SEC_CODE
 #include "Pwm_MemMap.h"
+#endif
 #ifdef EMIOS_PWM_IP_MODE_DAOC_USED
 static void Emios_Pwm_Ip_IrqDaocHandler(uint8 Instance, uint8 Channel)
 {
@@ -168,28 +223,30 @@ static void Emios_Pwm_Ip_IrqDaocHandler(uint8 Instance, uint8 Channel)
 
     if (ChannelIdx < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8)
     {
-        if (EMIOS_PWM_IP_MODE_DAOC_FLAG == Emios_Pwm_Ip_aCurrentModes[ChannelIdx])
+        const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[ChannelIdx];
+
+        if (EMIOS_PWM_IP_MODE_DAOC_FLAG == ChState->CurrentMode)
         {
-            DaocDuty = Emios_Pwm_Ip_aPeriod[ChannelIdx] - Emios_Pwm_Ip_aDutyCycle[ChannelIdx];
+            DaocDuty = ChState->Period - ChState->DutyCycle;
             DaocRegA = ((DaocDuty + Emios_Pwm_Ip_GetUCRegB(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax);
 
             Emios_Pwm_Ip_SetUCRegA(Emios_Pwm_Ip_aBasePtr[Instance], Channel, (DaocRegA == 0U)? CounterMax : DaocRegA);
 
-            DaocRegB = (Emios_Pwm_Ip_aPeriod[ChannelIdx] + Emios_Pwm_Ip_GetUCRegB(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax;
+            DaocRegB = (ChState->Period + Emios_Pwm_Ip_GetUCRegB(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax;
             Emios_Pwm_Ip_SetUCRegB(Emios_Pwm_Ip_aBasePtr[Instance], Channel, (DaocRegB == 0U)? CounterMax : DaocRegB);
 
         }
-        else if (EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH == Emios_Pwm_Ip_aCurrentModes[ChannelIdx])
+        else if (EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH == ChState->CurrentMode)
         {
             if (((EMIOS_PWM_IP_ACTIVE_HIGH == Polarity) && (FALSE == OutputPin)) ||
                 ((EMIOS_PWM_IP_ACTIVE_LOW == Polarity) && (TRUE == OutputPin)))
             {
-                DaocRegA = (Emios_Pwm_Ip_aPeriod[ChannelIdx] + Emios_Pwm_Ip_GetUCRegA(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax;
+                DaocRegA = (ChState->Period + Emios_Pwm_Ip_GetUCRegA(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax;
                 Emios_Pwm_Ip_SetUCRegA(Emios_Pwm_Ip_aBasePtr[Instance], Channel, (DaocRegA == 0U)? CounterMax : DaocRegA);      
             }
             else
             {
-                DaocRegB = (Emios_Pwm_Ip_aDutyCycle[ChannelIdx] + Emios_Pwm_Ip_GetUCRegA(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax;
+                DaocRegB = (ChState->DutyCycle + Emios_Pwm_Ip_GetUCRegA(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) % CounterMax;
                 Emios_Pwm_Ip_SetUCRegB(Emios_Pwm_Ip_aBasePtr[Instance], Channel, (DaocRegB == 0U)? CounterMax : DaocRegB);
             }
         }
@@ -210,6 +267,49 @@ static void Emios_Pwm_Ip_IrqDaocHandler(uint8 Instance, uint8 Channel)
 }
 #endif
 
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief          Queue a channel event for Emios_Pwm_Ip_DispatchNotifications.
+* @details        Called from the IRQ handler only, of any eMIOS vector and priority. The push
+*                 runs under PWM_EXCLUSIVE_AREA_29 so that a handler preempting another one
+*                 cannot take the same slot. The event is dropped and counted when the queue is
+*                 full.
+*
+* @param[in]      ChannelIdx  Index of the channel in the notification table.
+* @param[in]      Flags       OVR, OVFL and FLAG bits read by the IRQ handler.
+*/
+static inline void Emios_Pwm_Ip_QueueNotification(uint8 ChannelIdx, uint32 Flags)
+{
+    uint32 Head;
+    uint32 Level;
+    volatile Emios_Pwm_Ip_NotifEventType *Event;
+
+    SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_29();
+    Head = Emios_Pwm_Ip_u32NotifHead;
+    Level = Head - Emios_Pwm_Ip_u32NotifTail;
+    if (Level < EMIOS_PWM_IP_NOTIF_QUEUE_SIZE)
+    {
+        Event = &Emios_Pwm_Ip_aNotifQueue[Head & EMIOS_PWM_IP_NOTIF_QUEUE_MASK];
+        Event->ChannelIdx = ChannelIdx;
+        Event->Flags = Flags;
+        Event->Timestamp = OsIf_GetCounter(EMIOS_PWM_IP_NOTIF_COUNTER_TYPE);
+
+        /* Publish the event only once it is complete */
+        Emios_Pwm_Ip_u32NotifHead = Head + 1U;
+
+        if (Level >= Emios_Pwm_Ip_NotifStats.PeakLevel)
+        {
+            Emios_Pwm_Ip_NotifStats.PeakLevel = Level + 1U;
+        }
+    }
+    else
+    {
+        Emios_Pwm_Ip_NotifStats.Overflows++;
+    }
+    SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_29();
+}
+#endif
+
 /**
 * @brief          Interrupt handler for Emios Pwm channels.
 * @details        Interrupt handler that clears the flags and calls the user notification function.
@@ -222,14 +322,17 @@ void Emios_Pwm_Ip_IrqHandler(uint8 Instance, uint8 Channel)
 {
     /* Get the value of channel Index */
     uint8 ChannelIdx = Emios_Pwm_Ip_GetChannelIndex(Instance, Channel);
+    uint32 StatusFlags;
 
     if (ChannelIdx < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8)
     {
+        const Emios_Pwm_Ip_ChStateType *const ChState = &Emios_Pwm_Ip_aChState[ChannelIdx];
+
+        /* Read the OVR, OVFL and FLAG bits once */
+        StatusFlags = Emios_Pwm_Ip_GetStatusFlags(Emios_Pwm_Ip_aBasePtr[Instance], Channel);
+
         /* Check the state of Channel is uninitialized state */
-        if ((0U == Emios_Pwm_Ip_aCheckState[ChannelIdx]) &&
-            ((TRUE == Emios_Pwm_Ip_GetOverRunFlag(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) ||
-            (TRUE == Emios_Pwm_Ip_GetOverFlagEvent(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) ||
-            (TRUE == Emios_Pwm_Ip_GetOverFlowFlag(Emios_Pwm_Ip_aBasePtr[Instance], Channel))))
+        if ((0U == ChState->CheckState) && (0U != StatusFlags))
         {
             /* Clear Interrupt flag */
             Emios_Pwm_Ip_ClearFlagEvent(Emios_Pwm_Ip_aBasePtr[Instance], Channel);
@@ -238,9 +341,7 @@ void Emios_Pwm_Ip_IrqHandler(uint8 Instance, uint8 Channel)
         {
             /*Interrupt Flag and Interrupt Enable is set*/
             if ((TRUE == Emios_Pwm_Ip_GetInterruptRequest(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) &&
-                ((TRUE == Emios_Pwm_Ip_GetOverRunFlag(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) ||
-                (TRUE == Emios_Pwm_Ip_GetOverFlagEvent(Emios_Pwm_Ip_aBasePtr[Instance], Channel)) ||
-                (TRUE == Emios_Pwm_Ip_GetOverFlowFlag(Emios_Pwm_Ip_aBasePtr[Instance], Channel))))
+                (0U != StatusFlags))
             {
     #ifdef EMIOS_PWM_IP_MODE_DAOC_USED
                 Emios_Pwm_Ip_IrqDaocHandler(Instance, Channel);
@@ -248,11 +349,16 @@ void Emios_Pwm_Ip_IrqHandler(uint8 Instance, uint8 Channel)
                 /* Clear Interrupt flag */
                 Emios_Pwm_Ip_ClearFlagEvent(Emios_Pwm_Ip_aBasePtr[Instance], Channel);
 
-                if ((NULL_PTR != Emios_Pwm_Ip_aNotificationPtr[ChannelIdx]->CbFunction) &&
-                    (1U == Emios_Pwm_Ip_aCheckEnableNotif[ChannelIdx]))
+                if ((NULL_PTR != ChState->NotificationPtr->CbFunction) &&
+                    (1U == ChState->CheckEnableNotif))
                 {
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+                    /* Leave the callback to Emios_Pwm_Ip_DispatchNotifications */
+                    Emios_Pwm_Ip_QueueNotification(ChannelIdx, StatusFlags);
+#else
                     /* Call the user notification callback with the provided parameter */
-                    (Emios_Pwm_Ip_aNotificationPtr[ChannelIdx]->CbFunction)(Emios_Pwm_Ip_aNotificationPtr[ChannelIdx]->CbParameter);
+                    (ChState->NotificationPtr->CbFunction)(ChState->NotificationPtr->CbParameter);
+#endif
                 }
             }
         }
@@ -263,8 +369,72 @@ void Emios_Pwm_Ip_IrqHandler(uint8 Instance, uint8 Channel)
     }
 }
 
+#if defined(TCM_HOT_PATH)
+#define TCM_STOP_SEC_CODE
+#include "Tcm_MemMap.h"
+#else
+#define PWM_STOP_SEC_CODE
+#include "Pwm_MemMap.h"
+#endif
+
+#if (EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON)
+#define PWM_START_SEC_CODE
+#include "Pwm_MemMap.h"
+
+/**
+* @brief          Call the user notification of every queued event.
+* @details        Runs the callbacks in the order the interrupts occurred. A slot is released
+*                 before its callback runs, so a slow callback does not make the IRQ handler
+*                 drop events. Notifications disabled after the event was queued are skipped.
+*
+* @return         Number of callbacks called.
+*/
+uint32 Emios_Pwm_Ip_DispatchNotifications(void)
+{
+    uint32 Tail = Emios_Pwm_Ip_u32NotifTail;
+    uint32 Count = 0U;
+    const Emios_Pwm_Ip_ChStateType *ChState;
+
+    while (Tail != Emios_Pwm_Ip_u32NotifHead)
+    {
+        Emios_Pwm_Ip_DispatchedEvent = Emios_Pwm_Ip_aNotifQueue[Tail & EMIOS_PWM_IP_NOTIF_QUEUE_MASK];
+        Tail++;
+        Emios_Pwm_Ip_u32NotifTail = Tail;
+
+        ChState = &Emios_Pwm_Ip_aChState[Emios_Pwm_Ip_DispatchedEvent.ChannelIdx];
+        if ((NULL_PTR != ChState->NotificationPtr->CbFunction) &&
+            (1U == ChState->CheckEnableNotif))
+        {
+            (ChState->NotificationPtr->CbFunction)(ChState->NotificationPtr->CbParameter);
+            Count++;
+        }
+    }
+    Emios_Pwm_Ip_NotifStats.Dispatched += Count;
+
+    return Count;
+}
+
+/**
+* @brief          Event whose callback Emios_Pwm_Ip_DispatchNotifications is running.
+* @details        Lets a callback read the flags and the interrupt timestamp, e.g. to measure
+*                 the dispatch latency. Only valid inside a deferred callback.
+*/
+const Emios_Pwm_Ip_NotifEventType *Emios_Pwm_Ip_GetDispatchedEvent(void)
+{
+    return &Emios_Pwm_Ip_DispatchedEvent;
+}
+
+/**
+* @brief          Copy the deferred notification queue statistics.
+*/
+void Emios_Pwm_Ip_GetNotifStats(Emios_Pwm_Ip_NotifStatsType * Stats)
+{
+    *Stats = Emios_Pwm_Ip_NotifStats;
+}
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
+#endif /* EMIOS_PWM_IP_DEFERRED_NOTIFICATION == STD_ON */
 
 #endif /* EMIOS_PWM_IP_USED == STD_ON */
 #ifdef __cplusplus
@@ -45,7 +45,11 @@ extern "C"{
 * 3) internal and external interfaces from this unit
 ==================================================================================================*/
 #include "Flexio_Mcl_Ip_HwAccess.h"
+#include "Flexio_Mcl_Ip_Cfg.h"
 #include "SchM_Mcl.h"
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+#include "Devassert.h"
+#endif
 
 /*==================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -104,7 +108,36 @@ extern "C"{
     #error "Software Version Numbers of Flexio_Mcl_Ip_HwAccess.c and Flexio_Mcl_Ip_Cfg_Defines.h are different"
 #endif
 
+/* Check if Flexio_Mcl_Ip_HwAccess.c file and Flexio_Mcl_Ip_Cfg.h file are of the same vendor */
+#if (FLEXIO_MCL_IP_HWACCESS_VENDOR_ID_C != FLEXIO_MCL_IP_CFG_VENDOR_ID)
+    #error "Flexio_Mcl_Ip_HwAccess.c and Flexio_Mcl_Ip_Cfg.h have different vendor ids"
+#endif
+
+/* Check if Flexio_Mcl_Ip_HwAccess.c file and Flexio_Mcl_Ip_Cfg.h file are of the same Autosar version */
+#if ((FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_MAJOR_VERSION_C != FLEXIO_MCL_IP_CFG_AR_RELEASE_MAJOR_VERSION) || \
+     (FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_MINOR_VERSION_C != FLEXIO_MCL_IP_CFG_AR_RELEASE_MINOR_VERSION) || \
+     (FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_REVISION_VERSION_C != FLEXIO_MCL_IP_CFG_AR_RELEASE_REVISION_VERSION) \
+    )
+    #error "AutoSar Version Numbers of Flexio_Mcl_Ip_HwAccess.c and Flexio_Mcl_Ip_Cfg.h are different"
+#endif
+
+/* Check if Flexio_Mcl_Ip_HwAccess.c file and Flexio_Mcl_Ip_Cfg.h file are of the same Software version */
+#if ((FLEXIO_MCL_IP_HWACCESS_SW_MAJOR_VERSION_C != FLEXIO_MCL_IP_CFG_SW_MAJOR_VERSION) || \
+     (FLEXIO_MCL_IP_HWACCESS_SW_MINOR_VERSION_C != FLEXIO_MCL_IP_CFG_SW_MINOR_VERSION) || \
+     (FLEXIO_MCL_IP_HWACCESS_SW_PATCH_VERSION_C != FLEXIO_MCL_IP_CFG_SW_PATCH_VERSION) \
+    )
+    #error "Software Version Numbers of Flexio_Mcl_Ip_HwAccess.c and Flexio_Mcl_Ip_Cfg.h are different"
+#endif
+
 #ifndef DISABLE_MCAL_INTERMODULE_ASR_CHECK
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+/* Check if Flexio_Mcl_Ip_HwAccess.c file and Devassert header file are of the same Autosar version */
+#if ((FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_MAJOR_VERSION_C != DEVASSERT_AR_RELEASE_MAJOR_VERSION) || \
+     (FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_MINOR_VERSION_C != DEVASSERT_AR_RELEASE_MINOR_VERSION))
+    #error "AutoSar Version Numbers of Flexio_Mcl_Ip_HwAccess.c and Devassert.h are different"
+#endif
+#endif /* (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT) */
+
 /* Check if Flexio_Mcl_Ip_HwAccess.c file and SchM_Mcl header file are of the same Autosar version */
 #if ((FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_MAJOR_VERSION_C != SCHM_MCL_AR_RELEASE_MAJOR_VERSION) || \
      (FLEXIO_MCL_IP_HWACCESS_AR_RELEASE_MINOR_VERSION_C != SCHM_MCL_AR_RELEASE_MINOR_VERSION))
@@ -509,6 +542,149 @@ void Flexio_Mcl_Ip_ClearPinStatus(FLEXIO_Type *baseAddr, uint8 pin)
 }
 #endif
 
+/*
+ * This function configures the control settings of the specified shifter: mode, pin
+ * and timer selection. The register is written whole, so the shifter must not be in
+ * use by another driver.
+ */
+void Flexio_Mcl_Ip_SetShifterControl(FLEXIO_Type *baseAddr,
+                                     uint8 shifter,
+                                     Flexio_Mcl_Ip_ShifterModeType mode,
+                                     uint8 pin,
+                                     Flexio_Mcl_Ip_PinPolarityType pinPolarity,
+                                     Flexio_Mcl_Ip_PinConfigType pinConfig,
+                                     uint8 timer,
+                                     Flexio_Mcl_Ip_TimerPolarityType timerPolarity)
+{
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+    DevAssert(NULL_PTR != baseAddr);
+    DevAssert(FLEXIO_SHIFTCTL_COUNT > shifter);
+    DevAssert(FLEXIO_TIMCTL_COUNT > timer);
+    DevAssert((FLEXIO_SHIFTCTL_PINSEL_MASK >> FLEXIO_SHIFTCTL_PINSEL_SHIFT) >= (uint32)pin);
+#endif
+    baseAddr->SHIFTCTL[shifter] = FLEXIO_SHIFTCTL_SMOD((uint32)mode)
+                                | FLEXIO_SHIFTCTL_PINPOL((uint32)pinPolarity)
+                                | FLEXIO_SHIFTCTL_PINSEL((uint32)pin)
+                                | FLEXIO_SHIFTCTL_PINCFG((uint32)pinConfig)
+                                | FLEXIO_SHIFTCTL_TIMPOL((uint32)timerPolarity)
+                                | FLEXIO_SHIFTCTL_TIMSEL((uint32)timer);
+}
+
+/*
+ * This function configures the start bit, stop bit and input source of the specified
+ * shifter.
+ */
+void Flexio_Mcl_Ip_SetShifterConfig(FLEXIO_Type *baseAddr,
+                                    uint8 shifter,
+                                    Flexio_Mcl_Ip_ShifterStartType start,
+                                    Flexio_Mcl_Ip_ShifterStopType stop,
+                                    Flexio_Mcl_Ip_ShifterSourceType source)
+{
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+    DevAssert(NULL_PTR != baseAddr);
+    DevAssert(FLEXIO_SHIFTCFG_COUNT > shifter);
+#endif
+    baseAddr->SHIFTCFG[shifter] = FLEXIO_SHIFTCFG_SSTART((uint32)start)
+                                | FLEXIO_SHIFTCFG_SSTOP((uint32)stop)
+                                | FLEXIO_SHIFTCFG_INSRC((uint32)source);
+}
+
+/*
+ * This function returns the address of the buffer of the specified shifter, for use as
+ * a DMA source or destination. In bit swap mode the buffer is accessed through SHIFTBUFBIS,
+ * so a transmit shifter sends the most significant bit first.
+ */
+uint32 Flexio_Mcl_Ip_GetShifterBufferAddress(const FLEXIO_Type *baseAddr,
+                                             uint8 shifter,
+                                             Flexio_Mcl_Ip_ShifterBufferModeType mode)
+{
+    uint32 Addr;
+
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+    DevAssert(NULL_PTR != baseAddr);
+    DevAssert(FLEXIO_SHIFTBUF_COUNT > shifter);
+#endif
+    if (FLEXIO_SHIFTER_RW_MODE_BIT_SWAP == mode)
+    {
+        Addr = (uint32)&(baseAddr->SHIFTBUFBIS[shifter]);
+    }
+    else
+    {
+        Addr = (uint32)&(baseAddr->SHIFTBUF[shifter]);
+    }
+    return Addr;
+}
+
+/*
+ * This function configures the control settings of the specified timer: trigger, pin
+ * and mode. Writing FLEXIO_TIMER_MODE_DISABLED stops the timer.
+ */
+void Flexio_Mcl_Ip_SetTimerControl(FLEXIO_Type *baseAddr,
+                                   uint8 timer,
+                                   uint8 trigger,
+                                   Flexio_Mcl_Ip_TriggerPolarityType triggerPolarity,
+                                   Flexio_Mcl_Ip_TriggerSourceType triggerSource,
+                                   uint8 pin,
+                                   Flexio_Mcl_Ip_PinPolarityType pinPolarity,
+                                   Flexio_Mcl_Ip_PinConfigType pinConfig,
+                                   Flexio_Mcl_Ip_TimerModeType mode)
+{
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+    DevAssert(NULL_PTR != baseAddr);
+    DevAssert(FLEXIO_TIMCTL_COUNT > timer);
+    DevAssert((FLEXIO_TIMCTL_TRGSEL_MASK >> FLEXIO_TIMCTL_TRGSEL_SHIFT) >= (uint32)trigger);
+    DevAssert((FLEXIO_TIMCTL_PINSEL_MASK >> FLEXIO_TIMCTL_PINSEL_SHIFT) >= (uint32)pin);
+#endif
+    baseAddr->TIMCTL[timer] = FLEXIO_TIMCTL_TIMOD((uint32)mode)
+                            | FLEXIO_TIMCTL_PINPOL((uint32)pinPolarity)
+                            | FLEXIO_TIMCTL_PINSEL((uint32)pin)
+                            | FLEXIO_TIMCTL_PINCFG((uint32)pinConfig)
+                            | FLEXIO_TIMCTL_TRGSRC((uint32)triggerSource)
+                            | FLEXIO_TIMCTL_TRGPOL((uint32)triggerPolarity)
+                            | FLEXIO_TIMCTL_TRGSEL((uint32)trigger);
+}
+
+/*
+ * This function configures when the specified timer is enabled, decremented, reset and
+ * disabled, and its start bit, stop bit and initial output.
+ */
+void Flexio_Mcl_Ip_SetTimerConfig(FLEXIO_Type *baseAddr,
+                                  uint8 timer,
+                                  Flexio_Mcl_Ip_TimerStartType start,
+                                  Flexio_Mcl_Ip_TimerStopType stop,
+                                  Flexio_Mcl_Ip_TimerEnableType enable,
+                                  Flexio_Mcl_Ip_TimerDisableType disable,
+                                  Flexio_Mcl_Ip_TimerResetType reset,
+                                  Flexio_Mcl_Ip_TimerDecrementType decrement,
+                                  Flexio_Mcl_Ip_TimerOutputType output)
+{
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+    DevAssert(NULL_PTR != baseAddr);
+    DevAssert(FLEXIO_TIMCFG_COUNT > timer);
+#endif
+    baseAddr->TIMCFG[timer] = FLEXIO_TIMCFG_TSTART((uint32)start)
+                            | FLEXIO_TIMCFG_TSTOP((uint32)stop)
+                            | FLEXIO_TIMCFG_TIMENA((uint32)enable)
+                            | FLEXIO_TIMCFG_TIMDIS((uint32)disable)
+                            | FLEXIO_TIMCFG_TIMRST((uint32)reset)
+                            | FLEXIO_TIMCFG_TIMDEC((uint32)decrement)
+                            | FLEXIO_TIMCFG_TIMOUT((uint32)output);
+}
+
+/*
+ * This function sets the compare value of the specified timer. In the dual 8-bit modes
+ * the upper byte holds the number of bits or the high period, the lower byte the baud
+ * rate divider or the low period.
+ */
+void Flexio_Mcl_Ip_SetTimerCompare(FLEXIO_Type *baseAddr, uint8 timer, uint16 value)
+{
+#if (STD_ON == FLEXIO_MCL_IP_DEV_ERROR_DETECT)
+    DevAssert(NULL_PTR != baseAddr);
+    DevAssert(FLEXIO_TIMCMP_COUNT > timer);
+#endif
+    baseAddr->TIMCMP[timer] = FLEXIO_TIMCMP_CMP((uint32)value);
+}
+
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
 
@@ -2298,6 +2298,42 @@ Lcu_Ip_ReturnType Lcu_Ip_GetAsyncLogicOutputInfo(const uint8 LogicOutput, const
 
     return LocStatus;
 }
+
+Lcu_Ip_ReturnType Lcu_Ip_SetLogicCellImage(const uint8 LogicInstance, const uint8 HwLogicCell, const Lcu_Ip_LogicCellImageType * const pxImage)
+{
+    uint8 LocHwLcu;
+    Lcu_Ip_ReturnType LocStatus;
+
+    LCU_IP_DEV_ASSERT(NULL_PTR != Lcu_Ip_pxInit);
+    LCU_IP_DEV_ASSERT(LCU_IP_NOF_CFG_LOGIC_INSTANCES > LogicInstance);
+    LCU_IP_DEV_ASSERT(NULL_PTR != pxImage);
+    LCU_IP_DEV_ASSERT(LCU_LC_COUNT > HwLogicCell);
+
+    LocHwLcu = Lcu_Ip_pxInit->ppxLogicInstanceConfigArray[LogicInstance]->HwInstId;
+
+    /* Writes are ignored by the hardware while the instance is write protected */
+    LocStatus = HwAcc_Lcu_GetWriteProtect(LocHwLcu);
+
+#if (STD_ON == LCU_IP_MULTICORE_IS_AVAILABLE)
+    if (LocStatus == LCU_IP_STATUS_SUCCESS)
+    {
+        LocStatus = Lcu_Ip_OutputValidateCore(LocHwLcu, (uint8)(HwLogicCell * LCU_NUM_OUTPUT_PER_LC));
+    }
+#endif /* STD_ON == LCU_IP_MULTICORE_IS_AVAILABLE */
+
+    if (LocStatus == LCU_IP_STATUS_SUCCESS)
+    {
+        SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_48();
+        HwAcc_Lcu_SetLogicCellImage(LocHwLcu, HwLogicCell, pxImage);
+        SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_48();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return LocStatus;
+}
 #endif /* #if (STD_ON == LCU_IP_ASYNC_FUNC_IS_AVAILABLE) */
 
 #define MCL_STOP_SEC_CODE
@@ -688,6 +688,32 @@ void HwAcc_Lcu_SetLcForceControl(const uint8 LcuId, const uint8 HwLcOutputId, co
     PtBase->LC[LcId].FCTRL = Reg;
 }
 
+void HwAcc_Lcu_SetLogicCellImage(const uint8 LcuId, const uint8 LcId, const Lcu_Ip_LogicCellImageType * const pImage)
+{
+    LCU_Type * PtBase = Lcu_Ip_paxBaseInst[LcuId];
+    uint32 Shift = (uint32)LcId * LCU_NUM_OUTPUT_PER_LC;
+    uint32 OutEnMask = (uint32)(((uint32)1U << LCU_NUM_OUTPUT_PER_LC) - 1U) << Shift;
+    uint32 Reg = PtBase->OUTEN;
+    uint8 Index;
+
+    /* Register access */
+    /* Disable the LC outputs while the LUTs are inconsistent */
+    PtBase->OUTEN = Reg & ~OutEnMask;
+
+    for (Index = 0U; Index < LCU_NUM_OUTPUT_PER_LC; Index++)
+    {
+        /* Each LC has as many inputs as outputs */
+        PtBase->MUXSEL[Shift + Index] = LCU_MUXSEL_MUXSEL(pImage->MuxSel[Index]);
+        PtBase->LC[LcId].LUTCTRL[Index] = LCU_LUTCTRL_LUTCTRL(pImage->LutCtrl[Index]);
+        PtBase->LC[LcId].FILT[Index] = LCU_FILT_LUT_RISE_FILT(pImage->RiseFilt[Index]) | LCU_FILT_LUT_FALL_FILT(pImage->FallFilt[Index]);
+    }
+    PtBase->LC[LcId].OUTPOL = LCU_OUTPOL_OUTPOL(pImage->OutPol);
+
+    Reg &= ~OutEnMask;
+    Reg |= ((uint32)pImage->OutEn << Shift) & OutEnMask;
+    PtBase->OUTEN = Reg;
+}
+
 #define MCL_STOP_SEC_CODE
 #include "Mcl_MemMap.h"
 
@@ -240,6 +240,9 @@ void Port_SetPinDirection(Port_PinType Pin,
                           Port_PinDirectionType Direction
                          )
 {
+#if (STD_ON == PORT_API_STATS)
+    uint32 StatsStart = Port_ApiStatsStartHook();
+#endif
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     /* Variable used to store current error status */
     Std_ReturnType ErrStatus;
@@ -265,6 +268,10 @@ void Port_SetPinDirection(Port_PinType Pin,
         }
 #endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
     }
+
+#if (STD_ON == PORT_API_STATS)
+    Port_ApiStatsStopHook(PORT_SETPINDIRECTION_ID, StatsStart);
+#endif
 }
 #endif /* (STD_ON == PORT_SET_PIN_DIRECTION_API) */
 
@@ -286,6 +293,9 @@ void Port_SetPinMode(Port_PinType Pin,
                      Port_PinModeType Mode
                     )
 {
+#if (STD_ON == PORT_API_STATS)
+    uint32 StatsStart = Port_ApiStatsStartHook();
+#endif
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     uint8 u8PinModeError = (uint8)0U;
 
@@ -311,6 +321,10 @@ void Port_SetPinMode(Port_PinType Pin,
         }
 #endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
     }
+
+#if (STD_ON == PORT_API_STATS)
+    Port_ApiStatsStopHook(PORT_SETPINMODE_ID, StatsStart);
+#endif
 }
 #endif /* (STD_ON == PORT_SET_PIN_MODE_API) && (STD_OFF == PORT_CODE_SIZE_OPTIMIZATION) */
 #endif /* PORT_CODE_SIZE_OPTIMIZATION */
@@ -326,6 +340,9 @@ void Port_SetPinMode(Port_PinType Pin,
 */
 void Port_RefreshPortDirection(void)
 {
+#if (STD_ON == PORT_API_STATS)
+    uint32 StatsStart = Port_ApiStatsStartHook();
+#endif
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     uint8 PartitionId;
 
@@ -344,6 +361,10 @@ void Port_RefreshPortDirection(void)
     {
         Port_Ipw_RefreshPortDirection(Port_pConfigPtr);
     }
+
+#if (STD_ON == PORT_API_STATS)
+    Port_ApiStatsStopHook(PORT_REFRESHPINDIRECTION_ID, StatsStart);
+#endif
 }
 
 #if  (STD_ON == PORT_VERSION_INFO_API)
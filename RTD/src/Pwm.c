@@ -51,7 +51,7 @@ extern "C"{
     #include "Det.h"
 #endif
 
-#if (PWM_MULTIPARTITION_ENABLED == STD_ON)
+#if ((PWM_MULTIPARTITION_ENABLED == STD_ON) || (PWM_TRACE == STD_ON))
     #include "OsIf.h"
 #endif
 
@@ -263,6 +263,100 @@ static Pwm_PowerStateType Pwm_eTargetPowerState[PWM_MAX_PARTITION_NO];
 
 #endif /* PWM_POWER_STATE_SUPPORTED */
 
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_START_SEC_VAR_CLEARED_16_NO_CACHEABLE
+#else
+    #define PWM_START_SEC_VAR_CLEARED_16
+#endif
+#include "Pwm_MemMap.h"
+
+/**
+* @brief        Edges per notification set by Pwm_EnableNotificationDecimated, 0 for every edge
+*
+*/
+static uint16 Pwm_au16NotifInterval[PWM_MAX_PARTITION_NO][PWM_CONFIG_LOGIC_CHANNELS];
+
+/**
+* @brief        Edges counted since the last decimated notification
+*
+*/
+static uint16 Pwm_au16NotifCount[PWM_MAX_PARTITION_NO][PWM_CONFIG_LOGIC_CHANNELS];
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_STOP_SEC_VAR_CLEARED_16_NO_CACHEABLE
+#else
+    #define PWM_STOP_SEC_VAR_CLEARED_16
+#endif
+#include "Pwm_MemMap.h"
+
+#endif /* PWM_NOTIFICATION_SUPPORTED */
+
+#if (PWM_TRACE == STD_ON)
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
+#else
+    #define PWM_START_SEC_VAR_CLEARED_UNSPECIFIED
+#endif
+#include "Pwm_MemMap.h"
+
+/**
+* @brief        Trace ring, record n is at index n modulo PWM_TRACE_SIZE
+*
+*/
+static Pwm_TraceRecordType Pwm_aTraceRing[PWM_TRACE_SIZE];
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
+#else
+    #define PWM_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#endif
+#include "Pwm_MemMap.h"
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_START_SEC_VAR_CLEARED_32_NO_CACHEABLE
+#else
+    #define PWM_START_SEC_VAR_CLEARED_32
+#endif
+#include "Pwm_MemMap.h"
+
+/**
+* @brief        Number of events recorded, the next record goes to its slot
+*
+*/
+static volatile uint32 Pwm_u32TraceHead;
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_STOP_SEC_VAR_CLEARED_32_NO_CACHEABLE
+#else
+    #define PWM_STOP_SEC_VAR_CLEARED_32
+#endif
+#include "Pwm_MemMap.h"
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_START_SEC_VAR_CLEARED_8_NO_CACHEABLE
+#else
+    #define PWM_START_SEC_VAR_CLEARED_8
+#endif
+#include "Pwm_MemMap.h"
+
+/**
+* @brief        Set by Pwm_TraceEnable(FALSE) to keep the ring unchanged
+*
+*/
+static boolean Pwm_bTraceFrozen;
+
+#if (PWM_NO_CACHE_NEEDED == STD_ON)
+    #define PWM_STOP_SEC_VAR_CLEARED_8_NO_CACHEABLE
+#else
+    #define PWM_STOP_SEC_VAR_CLEARED_8
+#endif
+#include "Pwm_MemMap.h"
+
+#endif /* PWM_TRACE */
+
 /*==================================================================================================
 *                                        GLOBAL CONSTANTS
 ==================================================================================================*/
@@ -474,8 +568,29 @@ static inline Std_ReturnType Pwm_ValidateGetOutputState(uint32            Partit
                                                        );
 #endif /* (PWM_GET_OUTPUT_STATE_API == STD_ON) */
 
+/*=============================================================================================*/
+#if (PWM_TRUSTED_CONFIG == STD_ON)
+static Std_ReturnType Pwm_ValidateConfig(const Pwm_ConfigType * ConfigPtr);
+#endif /* (PWM_TRUSTED_CONFIG == STD_ON) */
+
 #endif /* PWM_PARAM_CHECK */
 
+/*=============================================================================================*/
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+static inline void Pwm_SetNotifInterval(uint32            PartitionId,
+                                        Pwm_ChannelType   PartitionChannelIdx,
+                                        uint16            Interval
+                                       );
+#endif /* PWM_NOTIFICATION_SUPPORTED */
+
+/*=============================================================================================*/
+#if (PWM_TRACE == STD_ON)
+static inline void Pwm_TraceEvent(Pwm_TraceEventType   Event,
+                                  uint8                Channel,
+                                  uint16               Value
+                                 );
+#endif /* PWM_TRACE */
+
 /*==================================================================================================
 *                                         LOCAL FUNCTIONS
 ==================================================================================================*/
@@ -709,6 +824,7 @@ static inline Std_ReturnType Pwm_ValidateChannelConfigCall(uint32          Parti
             }
             else
             {
+#if (PWM_TRUSTED_CONFIG == STD_OFF)
 #if (PWM_SET_DUTY_PHASE_SHIFT_API == STD_ON)
                 if (PWM_SETDUTYPHASESHIFT_ID == ServiceId)
                 {
@@ -744,6 +860,7 @@ static inline Std_ReturnType Pwm_ValidateChannelConfigCall(uint32          Parti
                     }
                 }
 #endif
+#endif /* PWM_TRUSTED_CONFIG */
             /* Do nothing */
             }
         }
@@ -1165,6 +1282,7 @@ static inline Std_ReturnType Pwm_ValidateTriggerDelay(uint32           Partition
     /** @brief  Variable to store the value returned by the function */
     Std_ReturnType                      RetVal = (Std_ReturnType)E_OK;
 
+#if (PWM_TRUSTED_CONFIG == STD_OFF)
     RetVal = Pwm_Ipw_ValidateTriggerMode(&((*Pwm_aState[PartitionId].PwmChannelConfigs)[ChannelNumber].IpwChannelCfg));
 
     if ((Std_ReturnType)E_OK != RetVal)
@@ -1177,6 +1295,11 @@ static inline Std_ReturnType Pwm_ValidateTriggerDelay(uint32           Partition
             (uint8)  PWM_E_PARAM_CHANNEL
         );
     }
+#else
+    /* Trusted configuration: the mode is fixed by the configuration Pwm_Init checked */
+    (void)PartitionId;
+    (void)ChannelNumber;
+#endif
 
     return RetVal;
 }
@@ -1205,6 +1328,7 @@ static inline Std_ReturnType Pwm_ValidateDeadTime(uint32           PartitionId,
     /** @brief  Variable to store the value returned by the function */
     Std_ReturnType                      RetVal = (Std_ReturnType)E_OK;
 
+#if (PWM_TRUSTED_CONFIG == STD_OFF)
     RetVal = Pwm_Ipw_ValidateDeadTime(&((*Pwm_aState[PartitionId].PwmChannelConfigs)[ChannelNumber].IpwChannelCfg));
 
     if ((Std_ReturnType)E_OK != RetVal)
@@ -1217,6 +1341,11 @@ static inline Std_ReturnType Pwm_ValidateDeadTime(uint32           PartitionId,
             (uint8)  PWM_E_PARAM_CHANNEL
         );
     }
+#else
+    /* Trusted configuration: the mode is fixed by the configuration Pwm_Init checked */
+    (void)PartitionId;
+    (void)ChannelNumber;
+#endif
 
     return RetVal;
 }
@@ -1459,6 +1588,7 @@ static inline Std_ReturnType Pwm_ValidateGetOutputState(uint32            Partit
     /** @brief  Variable to store the value returned by the function */
     Std_ReturnType                      RetVal = (Std_ReturnType)E_OK;
 
+#if (PWM_TRUSTED_CONFIG == STD_OFF)
     RetVal = Pwm_Ipw_ValidateGetOutputState(&((*Pwm_aState[PartitionId].PwmChannelConfigs)[ChannelNumber].IpwChannelCfg));
 
     if((Std_ReturnType)E_OK != RetVal)
@@ -1471,13 +1601,139 @@ static inline Std_ReturnType Pwm_ValidateGetOutputState(uint32            Partit
             (uint8)  PWM_E_GETOUTPUTSTATE_NOT_SUPPORTED
         );
     }
+#else
+    /* Trusted configuration: the mode is fixed by the configuration Pwm_Init checked */
+    (void)PartitionId;
+    (void)ChannelNumber;
+#endif
 
     return RetVal;
 }
 #endif /* (PWM_GET_OUTPUT_STATE_API == STD_ON) */
 
+/*=============================================================================================*/
+#if (PWM_TRUSTED_CONFIG == STD_ON)
+/**
+* @brief        Validate the whole configuration before it is trusted.
+* @details      Called once by Pwm_Init, before the configuration is taken. Each channel
+*               configuration is checked for consistency (channel class, counter bus, notification
+*               and dead time against the mode), so an inconsistent one is refused at start-up
+*               instead of surfacing in the first service call that trips over it. The channel
+*               modes do not change afterwards, so the services leave out the per-call checks of
+*               a channel against its mode.
+*               In case an error is detected, the function will report PWM_E_INIT_FAILED to Det.
+*
+* @param[in]    ConfigPtr       Configuration Pwm_Init is about to take
+*
+* @return       Std_ReturnType  Consistency of the configuration
+* @retval       E_OK            Every channel configuration is consistent
+* @retval       E_NOT_OK        At least one channel configuration is inconsistent
+*
+*/
+static Std_ReturnType Pwm_ValidateConfig(const Pwm_ConfigType * ConfigPtr)
+{
+    /** @brief  Variable to store the value returned by the function */
+    Std_ReturnType                      RetVal = (Std_ReturnType)E_OK;
+    const Pwm_ChannelConfigType *       ChannelCfg;
+    boolean                             NotificationUsed = FALSE;
+    uint8                               Index;
+
+    if (PWM_CONFIG_LOGIC_CHANNELS < ConfigPtr->NumChannels)
+    {
+        RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+
+    for (Index = 0U; (Index < ConfigPtr->NumChannels) && ((Std_ReturnType)E_OK == RetVal); Index++)
+    {
+        ChannelCfg = &((*ConfigPtr->PwmChannelsConfig)[Index]);
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+        NotificationUsed = (NULL_PTR != ChannelCfg->PwmChannelNotification) ? TRUE : FALSE;
+#endif
+        RetVal = Pwm_Ipw_ValidateChannelConfig(ChannelCfg->PwmChannelClass, NotificationUsed, &(ChannelCfg->IpwChannelCfg));
+    }
+
+    if ((Std_ReturnType)E_OK != RetVal)
+    {
+        (void)Det_ReportError
+        (
+            (uint16) PWM_MODULE_ID,
+            (uint8)  PWM_INDEX,
+            (uint8)  PWM_INIT_ID,
+            (uint8)  PWM_E_INIT_FAILED
+        );
+    }
+
+    return RetVal;
+}
+#endif /* (PWM_TRUSTED_CONFIG == STD_ON) */
+
 #endif /* PWM_PARAM_CHECK */
 
+/*=============================================================================================*/
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/**
+* @brief        Set the decimation interval of a channel and restart its edge count.
+* @details      Pwm_Notification updates the count from the channel interrupt, so both words are
+*               written under PWM_EXCLUSIVE_AREA_30: an edge cannot see the new interval with
+*               the old count, or have its count update lost behind the reset.
+*
+* @param[in]    PartitionId             Partition of the channel
+* @param[in]    PartitionChannelIdx     Channel index in the partition
+* @param[in]    Interval                Edges per notification, 0 for every edge
+*
+* @return       void
+*
+*/
+static inline void Pwm_SetNotifInterval(uint32            PartitionId,
+                                        Pwm_ChannelType   PartitionChannelIdx,
+                                        uint16            Interval
+                                       )
+{
+    SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_30();
+    Pwm_au16NotifCount[PartitionId][PartitionChannelIdx] = 0U;
+    Pwm_au16NotifInterval[PartitionId][PartitionChannelIdx] = Interval;
+    SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_30();
+}
+#endif /* PWM_NOTIFICATION_SUPPORTED */
+
+/*=============================================================================================*/
+#if (PWM_TRACE == STD_ON)
+/**
+* @brief        Record one event in the trace ring.
+* @details      Callable from any context without a lock: the slot is reserved by a single
+*               atomic increment of the head (LDREX/STREX on the core), so a record interrupted
+*               by another one keeps its own slot, and the record is then written in one go.
+*               An event interrupted between the two may carry a later time stamp than the
+*               record after it. When the ring is full the oldest record is overwritten.
+*
+* @param[in]    Event           Event to record
+* @param[in]    Channel         Logical channel, or module id for PWM_TRACE_SYNC_UPDATE
+* @param[in]    Value           Event value
+*
+* @return       void
+*
+*/
+static inline void Pwm_TraceEvent(Pwm_TraceEventType   Event,
+                                  uint8                Channel,
+                                  uint16               Value
+                                 )
+{
+    Pwm_TraceRecordType Record;
+    uint32              Slot;
+
+    if (TRUE != Pwm_bTraceFrozen)
+    {
+        Slot = __atomic_fetch_add(&Pwm_u32TraceHead, 1U, __ATOMIC_RELAXED);
+
+        Record.Timestamp = PWM_TRACE_TIMESTAMP();
+        Record.Event = (uint8)Event;
+        Record.Channel = Channel;
+        Record.Value = Value;
+        Pwm_aTraceRing[Slot & (PWM_TRACE_SIZE - 1U)] = Record;
+    }
+}
+#endif /* PWM_TRACE */
+
 #if (PWM_POWER_STATE_SUPPORTED == STD_ON)
 static inline Std_ReturnType Pwm_ProcessPowerState(Pwm_PowerStateRequestResultType * Result, uint32 PartitionId)
 {
@@ -1637,6 +1893,7 @@ void Pwm_Init(const Pwm_ConfigType * ConfigPtr)
 #endif
     uint32                      PartitionId;
     uint8                       Index;
+    const Pwm_ConfigType *      InitConfig;
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -1656,17 +1913,26 @@ void Pwm_Init(const Pwm_ConfigType * ConfigPtr)
 #endif
 
 #if (PWM_PRECOMPILE_SUPPORT == STD_ON)
-            /* Save configuration pointer in global variable */
 #if (PWM_MULTIPARTITION_ENABLED == STD_ON)
-            Pwm_aState[PartitionId].PwmConfig = Pwm_Config[PartitionId];
+            InitConfig = Pwm_Config[PartitionId];
 #else
-            Pwm_aState[PartitionId].PwmConfig = &Pwm_Config;
+            InitConfig = &Pwm_Config;
 #endif
             (void)ConfigPtr;
 #else
-            Pwm_aState[PartitionId].PwmConfig = ConfigPtr;
+            InitConfig = ConfigPtr;
 #endif
 
+#if ((PWM_PARAM_CHECK == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON))
+            /* Check the configuration once, before the driver takes it */
+            CallIsValid = Pwm_ValidateConfig(InitConfig);
+
+            if ((Std_ReturnType)E_OK == CallIsValid)
+            {
+#endif
+            /* Save configuration pointer in global variable */
+            Pwm_aState[PartitionId].PwmConfig = InitConfig;
+
 #if (PWM_HW_INSTANCE_USED == STD_ON)
             /* IPW call to hw instance initialization when PWM controls the entire hw instance */
             for (Index = 0; Index < Pwm_aState[PartitionId].PwmConfig->NumInstances; Index++)
@@ -1688,6 +1954,10 @@ void Pwm_Init(const Pwm_ConfigType * ConfigPtr)
             Pwm_aState[PartitionId].PwmTargetPowerState = PWM_NODEFINE_POWER;
 #endif
 
+#if ((PWM_PARAM_CHECK == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON))
+            }
+#endif
+
 #if (PWM_PARAM_CHECK == STD_ON)
         }
 #endif
@@ -1793,6 +2063,13 @@ void Pwm_DeInit(void)
 
 /*===============================================================================================*/
 #if (PWM_SET_DUTY_CYCLE_API == STD_ON)
+#if defined(TCM_HOT_PATH)
+#define PWM_STOP_SEC_CODE
+#include "Pwm_MemMap.h"
+#define TCM_START_SEC_CODE
+#include "Tcm_MemMap.h"
+#endif
+
 /**
 * @brief        This function sets the dutycycle for the specified Pwm channel.
 * @details      The function Pwm_SetDutyCycle shall set the duty cycle of the PWM channel.
@@ -1841,6 +2118,9 @@ void Pwm_SetDutyCycle(Pwm_ChannelType   ChannelNumber,
     uint32          PartitionId;
     Pwm_ChannelType PartitionChannelIdx;
     Std_ReturnType  RetVal = (Std_ReturnType)E_OK;
+#if (PWM_API_STATS == STD_ON)
+    uint32          StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -1857,6 +2137,9 @@ void Pwm_SetDutyCycle(Pwm_ChannelType   ChannelNumber,
 #endif
             /* All validations passed. Here starts the actual functional code of the function */
             RetVal = Pwm_Ipw_SetDutyCycle(DutyCycle, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
+#if (PWM_TRACE == STD_ON)
+            Pwm_TraceEvent(PWM_TRACE_SET_DUTY, (uint8)ChannelNumber, (uint16)DutyCycle);
+#endif
 
             /* Avoid compiler warning */
             (void)RetVal;
@@ -1881,7 +2164,17 @@ void Pwm_SetDutyCycle(Pwm_ChannelType   ChannelNumber,
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SETDUTYCYCLE_ID, StatsStart);
+#endif
 }
+
+#if defined(TCM_HOT_PATH)
+#define TCM_STOP_SEC_CODE
+#include "Tcm_MemMap.h"
+#define PWM_START_SEC_CODE
+#include "Pwm_MemMap.h"
+#endif
 #endif /* PWM_SET_DUTY_CYCLE_API */
 
 
@@ -1939,6 +2232,9 @@ void Pwm_SetPeriodAndDuty(Pwm_ChannelType   ChannelNumber,
 {
     uint32          PartitionId;
     Pwm_ChannelType PartitionChannelIdx;
+#if (PWM_API_STATS == STD_ON)
+    uint32          StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -1958,6 +2254,10 @@ void Pwm_SetPeriodAndDuty(Pwm_ChannelType   ChannelNumber,
 
                 /* All validations passed. Here starts the actual functional code of the function */
                 (void)Pwm_Ipw_SetPeriodAndDuty(Period, DutyCycle, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
+#if (PWM_TRACE == STD_ON)
+                Pwm_TraceEvent(PWM_TRACE_SET_PERIOD, (uint8)ChannelNumber, (uint16)Period);
+                Pwm_TraceEvent(PWM_TRACE_SET_DUTY, (uint8)ChannelNumber, (uint16)DutyCycle);
+#endif
 
 #if (PWM_PARAM_CHECK == STD_ON)
             }
@@ -1970,6 +2270,9 @@ void Pwm_SetPeriodAndDuty(Pwm_ChannelType   ChannelNumber,
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SETPERIODANDDUTY_ID, StatsStart);
+#endif
 }
 #endif /* PWM_SET_PERIOD_AND_DUTY_API */
 
@@ -2020,6 +2323,9 @@ void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
 {
     uint32          PartitionId;
     Pwm_ChannelType PartitionChannelIdx;
+#if (PWM_API_STATS == STD_ON)
+    uint32          StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -2036,12 +2342,18 @@ void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
             /* Mark the channel in idle output mode */
 
             Pwm_aState[PartitionId].PwmChannelIdleState[PartitionChannelIdx] = TRUE;
+#if (PWM_TRACE == STD_ON)
+            Pwm_TraceEvent(PWM_TRACE_OUTPUT_TO_IDLE, (uint8)ChannelNumber, (uint16)(*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].ChannelIdleState);
+#endif
 #if (PWM_VALIDATE_CHANNEL_CONFIG_CALL == STD_ON)
     }
 
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SETOUTPUTTOIDLE_ID, StatsStart);
+#endif
 }
 #endif /* PWM_SET_OUTPUT_TO_IDLE_API */
 
@@ -2092,6 +2404,9 @@ Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber)
     Pwm_ChannelType         PartitionChannelIdx;
     /** @brief  Variable to store the value returned by the function */
     Pwm_OutputStateType     RetVal = PWM_LOW;
+#if (PWM_API_STATS == STD_ON)
+    uint32                  StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -2121,6 +2436,10 @@ Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber)
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_GETOUTPUTSTATE_ID, StatsStart);
+#endif
+
     return RetVal;
 }
 #endif /* PWM_GET_OUTPUT_STATE_API */
@@ -2179,6 +2498,8 @@ void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber)
 
         /* All validations passed. Here starts the actual functional code of the function */
         Pwm_Ipw_DisableNotification(&((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
+        /* Forget a decimation interval, the channel notifies every edge once enabled again */
+        Pwm_SetNotifInterval(PartitionId, PartitionChannelIdx, 0U);
 
 #if (PWM_VALIDATE_CHANNEL_CONFIG_CALL == STD_ON)
     }
@@ -2247,6 +2568,63 @@ void Pwm_EnableNotification(Pwm_ChannelType           ChannelNumber,
 #endif
 
             /* All validations passed. Here starts the actual functional code of the function */
+            Pwm_SetNotifInterval(PartitionId, PartitionChannelIdx, 0U);
+            Pwm_Ipw_EnableNotification(Notification, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
+
+#if (PWM_PARAM_CHECK == STD_ON)
+        }
+#endif
+
+#if (PWM_VALIDATE_CHANNEL_CONFIG_CALL == STD_ON)
+    }
+
+    Pwm_EndValidateChannelConfigCall(ChannelNumber);
+#endif
+
+}
+#endif /* PWM_NOTIFICATION_SUPPORTED */
+
+
+
+/*===============================================================================================*/
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/**
+* @brief        This function enables the user notifications for every Interval-th edge.
+* @details      Validation is the same as for Pwm_EnableNotification. The edge counter is
+*               restarted, so the first notification comes Interval edges after the call.
+*               The counting itself is done by Pwm_Notification.
+*
+* @param[in]    ChannelNumber   Pwm channel id
+* @param[in]    Notification    Notification type to be enabled
+* @param[in]    Interval        Number of edges per notification, 0 or 1 for every edge
+*
+* @return       void
+*
+*/
+void Pwm_EnableNotificationDecimated(Pwm_ChannelType           ChannelNumber,
+                                     Pwm_EdgeNotificationType  Notification,
+                                     uint16                    Interval
+                                    )
+{
+    uint32          PartitionId;
+    Pwm_ChannelType PartitionChannelIdx;
+
+    /* Get partition Id of current processor */
+    PartitionId = Pwm_GetPartitionId();
+
+#if (PWM_VALIDATE_CHANNEL_CONFIG_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Pwm_ValidateChannelConfigCall(PartitionId, ChannelNumber, PWM_ENABLENOTIFICATIONDECIMATED_ID))
+    {
+#endif
+        PartitionChannelIdx = Pwm_GetPartitionChannelIdx(PartitionId, ChannelNumber);
+
+#if (PWM_PARAM_CHECK == STD_ON)
+        if ((Std_ReturnType)E_OK == Pwm_ValidateParamNotification(PartitionId, PartitionChannelIdx, Notification))
+        {
+#endif
+
+            /* Set the interval before the interrupt can run with the new notification */
+            Pwm_SetNotifInterval(PartitionId, PartitionChannelIdx, Interval);
             Pwm_Ipw_EnableNotification(Notification, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
 
 #if (PWM_PARAM_CHECK == STD_ON)
@@ -2378,6 +2756,7 @@ void Pwm_Notification(uint8 Channel)
     uint32           PartitionId;
     Pwm_ChannelType  PartitionChannelIdx;
     Pwm_NotifyType   Notify;
+    uint16           EdgeCount;
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -2398,7 +2777,24 @@ void Pwm_Notification(uint8 Channel)
         could not have been enabled */
         if (NULL_PTR != Notify)
         {
-            Notify();
+#if (PWM_TRACE == STD_ON)
+            Pwm_TraceEvent(PWM_TRACE_NOTIFICATION, LogicChannel, 0U);
+#endif
+            /* Decimated notification: only every Interval-th edge reaches the user */
+            if (Pwm_au16NotifInterval[PartitionId][PartitionChannelIdx] > 1U)
+            {
+                EdgeCount = (uint16)(Pwm_au16NotifCount[PartitionId][PartitionChannelIdx] + 1U);
+                if (EdgeCount >= Pwm_au16NotifInterval[PartitionId][PartitionChannelIdx])
+                {
+                    EdgeCount = 0U;
+                    Notify();
+                }
+                Pwm_au16NotifCount[PartitionId][PartitionChannelIdx] = EdgeCount;
+            }
+            else
+            {
+                Notify();
+            }
         }
     }
 }
@@ -2735,6 +3131,9 @@ void Pwm_SetDutyCycle_NoUpdate(Pwm_ChannelType  ChannelNumber,
     uint32          PartitionId;
     Pwm_ChannelType PartitionChannelIdx;
     Std_ReturnType  RetVal = (Std_ReturnType)E_OK;
+#if (PWM_API_STATS == STD_ON)
+    uint32          StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -2751,6 +3150,9 @@ void Pwm_SetDutyCycle_NoUpdate(Pwm_ChannelType  ChannelNumber,
 #endif
             /* All validations passed. Here starts the actual functional code of the function */
             RetVal = Pwm_Ipw_SetDutyCycle_NoUpdate(DutyCycle, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
+#if (PWM_TRACE == STD_ON)
+            Pwm_TraceEvent(PWM_TRACE_SET_DUTY_NO_UPDATE, (uint8)ChannelNumber, (uint16)DutyCycle);
+#endif
 
             /* Avoid compiler warning */
             (void)RetVal;
@@ -2775,6 +3177,9 @@ void Pwm_SetDutyCycle_NoUpdate(Pwm_ChannelType  ChannelNumber,
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SETDUTYCYCLE_NO_UPDATE_ID, StatsStart);
+#endif
 }
 #endif /* PWM_SET_DUTY_CYCLE_NO_UPDATE_API */
 
@@ -2837,6 +3242,9 @@ void Pwm_SetPeriodAndDuty_NoUpdate(Pwm_ChannelType  ChannelNumber,
 {
     uint32          PartitionId;
     Pwm_ChannelType PartitionChannelIdx;
+#if (PWM_API_STATS == STD_ON)
+    uint32          StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -2856,6 +3264,10 @@ void Pwm_SetPeriodAndDuty_NoUpdate(Pwm_ChannelType  ChannelNumber,
 
                 /* All validations passed. Here starts the actual functional code of the function */
                 Pwm_Ipw_SetPeriodAndDuty_NoUpdate(Period, DutyCycle, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg));
+#if (PWM_TRACE == STD_ON)
+                Pwm_TraceEvent(PWM_TRACE_SET_PERIOD_NO_UPDATE, (uint8)ChannelNumber, (uint16)Period);
+                Pwm_TraceEvent(PWM_TRACE_SET_DUTY_NO_UPDATE, (uint8)ChannelNumber, (uint16)DutyCycle);
+#endif
 
 #if (PWM_PARAM_CHECK == STD_ON)
             }
@@ -2868,6 +3280,9 @@ void Pwm_SetPeriodAndDuty_NoUpdate(Pwm_ChannelType  ChannelNumber,
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SETPERIODANDDUTY_NO_UPDATE_ID, StatsStart);
+#endif
 }
 #endif /* PWM_SET_PERIOD_AND_DUTY_NO_UPDATE_API */
 
@@ -2898,6 +3313,9 @@ void Pwm_SetPeriodAndDuty_NoUpdate(Pwm_ChannelType  ChannelNumber,
 void Pwm_SyncUpdate(uint8 ModuleId)
 {
 
+#if (PWM_API_STATS == STD_ON)
+    uint32                              StatsStart = Pwm_ApiStatsStartHook();
+#endif
 #if (PWM_VALIDATE_GLOBAL_CONFIG_CALL == STD_ON)
     Std_ReturnType                      CallIsValid;
     uint32                              PartitionId;
@@ -2917,6 +3335,9 @@ void Pwm_SyncUpdate(uint8 ModuleId)
         {
 #endif
             Pwm_Ipw_SyncUpdate(ModuleId);
+#if (PWM_TRACE == STD_ON)
+            Pwm_TraceEvent(PWM_TRACE_SYNC_UPDATE, ModuleId, 0U);
+#endif
 
 #if (PWM_PARAM_CHECK == STD_ON)
         }
@@ -2927,6 +3348,9 @@ void Pwm_SyncUpdate(uint8 ModuleId)
     Pwm_EndValidateGlobalConfigCall(PartitionId, CallIsValid, PWM_SYNCUPDATE_ID);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SYNCUPDATE_ID, StatsStart);
+#endif
 }
 #endif /* PWM_SYNC_UPDATE_API */
 
@@ -2962,6 +3386,9 @@ void Pwm_SetDutyPhaseShift(Pwm_ChannelType  ChannelNumber,
 {
     uint32          PartitionId;
     Pwm_ChannelType PartitionChannelIdx;
+#if (PWM_API_STATS == STD_ON)
+    uint32          StatsStart = Pwm_ApiStatsStartHook();
+#endif
 
     /* Get partition Id of current processor */
     PartitionId = Pwm_GetPartitionId();
@@ -2980,6 +3407,10 @@ void Pwm_SetDutyPhaseShift(Pwm_ChannelType  ChannelNumber,
 #endif
                 /* All validations passed. Here starts the actual functional code of the function */
                 Pwm_Ipw_SetDutyPhaseShift(DutyCycle, PhaseShift, &((*Pwm_aState[PartitionId].PwmChannelConfigs)[PartitionChannelIdx].IpwChannelCfg), SyncUpdate);
+#if (PWM_TRACE == STD_ON)
+                Pwm_TraceEvent(PWM_TRACE_SET_PHASE, (uint8)ChannelNumber, (uint16)PhaseShift);
+                Pwm_TraceEvent((TRUE == SyncUpdate) ? PWM_TRACE_SET_DUTY_NO_UPDATE : PWM_TRACE_SET_DUTY, (uint8)ChannelNumber, (uint16)DutyCycle);
+#endif
 
 #if (PWM_PARAM_CHECK == STD_ON)
             }
@@ -2992,6 +3423,9 @@ void Pwm_SetDutyPhaseShift(Pwm_ChannelType  ChannelNumber,
     Pwm_EndValidateChannelConfigCall(ChannelNumber);
 #endif
 
+#if (PWM_API_STATS == STD_ON)
+    Pwm_ApiStatsStopHook(PWM_SETDUTYPHASESHIFT_ID, StatsStart);
+#endif
 }
 #endif /* PWM_SET_DUTY_PHASE_SHIFT_API */
 
@@ -3637,6 +4071,86 @@ Std_ReturnType Pwm_PreparePowerState(Pwm_PowerStateType                PowerStat
 }
 #endif /* PWM_POWER_STATE_SUPPORTED */
 
+/*===============================================================================================*/
+#if (PWM_TRACE == STD_ON)
+/**
+* @brief        Start or freeze the event trace.
+* @details      The trace runs from reset. Freezing it keeps the ring unchanged while it is read
+*               with Pwm_TraceRead or dumped by a debugger.
+*
+* @param[in]    Enable          TRUE to record events, FALSE to freeze the ring
+*
+* @return       void
+*
+*/
+void Pwm_TraceEnable(boolean Enable)
+{
+    Pwm_bTraceFrozen = (TRUE == Enable) ? FALSE : TRUE;
+}
+
+/**
+* @brief        Copy the most recent trace records.
+* @details      Records are copied oldest first.
+*
+* @param[out]   Records         Buffer receiving the records
+* @param[in]    MaxRecords      Size of Records
+*
+* @return       uint32          Number of records copied, at most PWM_TRACE_SIZE
+*
+*/
+uint32 Pwm_TraceRead(Pwm_TraceRecordType * Records,
+                     uint32                MaxRecords
+                    )
+{
+    /* A single word read, the head only moves by atomic increments */
+    uint32 Head = Pwm_u32TraceHead;
+    uint32 Count = (Head < PWM_TRACE_SIZE) ? Head : PWM_TRACE_SIZE;
+    uint32 First;
+    uint32 Index;
+
+    if (NULL_PTR == Records)
+    {
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+        (void)Det_ReportError
+        (
+            (uint16) PWM_MODULE_ID,
+            (uint8)  PWM_INDEX,
+            (uint8)  PWM_TRACEREAD_ID,
+            (uint8)  PWM_E_PARAM_POINTER
+        );
+#endif
+        Count = 0U;
+    }
+    else if (Count > MaxRecords)
+    {
+        Count = MaxRecords;
+    }
+    else
+    {
+        /* Every record written so far fits */
+    }
+
+    First = Head - Count;
+    for (Index = 0U; Index < Count; Index++)
+    {
+        Records[Index] = Pwm_aTraceRing[(First + Index) & (PWM_TRACE_SIZE - 1U)];
+    }
+
+    return Count;
+}
+
+/**
+* @brief        Number of events recorded since reset.
+*
+* @return       uint32          Events recorded, modulo 2^32
+*
+*/
+uint32 Pwm_TraceGetTotal(void)
+{
+    return Pwm_u32TraceHead;
+}
+#endif /* PWM_TRACE */
+
 #define PWM_STOP_SEC_CODE
 #include "Pwm_MemMap.h"
 
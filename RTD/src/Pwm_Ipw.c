@@ -325,6 +325,14 @@ static Std_ReturnType Pwm_Ipw_EmiosValidateNotification(Pwm_EdgeNotificationType
 #endif /* (PWM_EMIOS_USED == STD_ON) */
 #endif /* ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_NOTIFICATION_SUPPORTED == STD_ON)) */
 
+#if ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON))
+#if (PWM_EMIOS_USED == STD_ON)
+static Std_ReturnType Pwm_Ipw_EmiosValidateChannelConfig(Pwm_ChannelClassType                   ChannelClass,
+                                                         boolean                                NotificationUsed,
+                                                         const Emios_Pwm_Ip_ChannelConfigType * const ChConfig);
+#endif /* (PWM_EMIOS_USED == STD_ON) */
+#endif /* ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON)) */
+
 #if (PWM_SET_DUTY_CYCLE_API == STD_ON)
 #if (PWM_ETPU_USED == STD_ON)
 static void Pwm_Ipw_Etpu_SetDutyCycle(uint8  Channel, 
@@ -394,6 +402,102 @@ static Std_ReturnType Pwm_Ipw_EmiosValidateNotification(Pwm_EdgeNotificationType
 #endif /* (PWM_EMIOS_USED == STD_ON) */
 #endif /* ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_NOTIFICATION_SUPPORTED == STD_ON)) */
 
+#if ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON))
+#if (PWM_EMIOS_USED == STD_ON)
+static Std_ReturnType Pwm_Ipw_EmiosValidateChannelConfig(Pwm_ChannelClassType                   ChannelClass,
+                                                         boolean                                NotificationUsed,
+                                                         const Emios_Pwm_Ip_ChannelConfigType * const ChConfig)
+{
+    /** @brief  Variable to store the value returned by the function */
+    Std_ReturnType RetVal = (Std_ReturnType)E_OK;
+    /** @brief  Channel running the counter bus the channel is configured on */
+    uint8          MasterChannel;
+
+    switch(ChConfig->Mode)
+    {
+        case EMIOS_PWM_IP_MODE_OPWFMB_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWFMB_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG_BOTH:
+            /* Internal counter: the duty cycle must fit in the channel's own period */
+            if (ChConfig->DutyCycle > ChConfig->PeriodCount)
+            {
+                RetVal = (Std_ReturnType)E_NOT_OK;
+            }
+            break;
+        case EMIOS_PWM_IP_MODE_GPO:
+        case EMIOS_PWM_IP_MODE_DAOC_FLAG:
+        case EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH:
+            /* Period owned by the channel, no counter bus constraint */
+            break;
+        case EMIOS_PWM_IP_MODE_OPWMT:
+        case EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWMB_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWMB_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH:
+            /* The period belongs to the counter bus, so it cannot be changed per channel */
+            if (PWM_VARIABLE_PERIOD == ChannelClass)
+            {
+                RetVal = (Std_ReturnType)E_NOT_OK;
+            }
+
+            /* A bus is needed and the channel cannot be the one running it */
+            switch(ChConfig->Timebase)
+            {
+                case EMIOS_PWM_IP_BUS_A:
+                    MasterChannel = 23U;
+                    break;
+                case EMIOS_PWM_IP_BUS_F:
+                    MasterChannel = 22U;
+                    break;
+                case EMIOS_PWM_IP_BUS_BCDE:
+                    MasterChannel = ChConfig->ChannelId & 0xF8U;
+                    break;
+                default:
+                    MasterChannel = ChConfig->ChannelId;
+                    break;
+            }
+            if (MasterChannel == ChConfig->ChannelId)
+            {
+                RetVal = (Std_ReturnType)E_NOT_OK;
+            }
+
+            /* Trail edge dead time is taken from both halves of the pulse, which a 0% output
+               does not have; the lead edge limit depends on the bus period, which belongs to
+               the Mcl configuration */
+            if (((EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG == ChConfig->Mode) ||
+                 (EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH == ChConfig->Mode)) &&
+                (0U != ChConfig->DeadTime) && (0U != ChConfig->DutyCycle) &&
+                (ChConfig->DeadTime >= (ChConfig->DutyCycle >> 1U)))
+            {
+                RetVal = (Std_ReturnType)E_NOT_OK;
+            }
+            break;
+        default:
+            RetVal = (Std_ReturnType)E_NOT_OK;
+            break;
+    }
+
+    /* Notifications need flags raised as interrupts */
+    if ((TRUE == NotificationUsed) &&
+        ((EMIOS_PWM_IP_MODE_GPO == ChConfig->Mode) || (EMIOS_PWM_IP_DMA_REQUEST == ChConfig->IrqMode)))
+    {
+        RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+
+    return RetVal;
+}
+#endif /* (PWM_EMIOS_USED == STD_ON) */
+#endif /* ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON)) */
+
 #if (PWM_SET_DUTY_CYCLE_API == STD_ON)
 #if (PWM_ETPU_USED == STD_ON)
 static void Pwm_Ipw_Etpu_SetDutyCycle(uint8  Channel, 
@@ -808,6 +912,13 @@ void Pwm_Ipw_DeInitInstance(const Pwm_IpwInstanceConfigType * const IpConfig)
 
 /*===============================================================================================*/
 #if (PWM_SET_DUTY_CYCLE_API == STD_ON)
+#if defined(TCM_HOT_PATH)
+#define PWM_STOP_SEC_CODE
+#include "Pwm_MemMap.h"
+#define TCM_START_SEC_CODE
+#include "Tcm_MemMap.h"
+#endif
+
 /**
 * @brief        Pwm_Ipw_SetDutyCycle
 * @details      This function will call SetDutyCycle function for the corresponding IP of PwmChannel
@@ -920,6 +1031,13 @@ Std_ReturnType Pwm_Ipw_SetDutyCycle(uint16                         DutyCycle,
 
     return RetVal;
 }
+
+#if defined(TCM_HOT_PATH)
+#define TCM_STOP_SEC_CODE
+#include "Tcm_MemMap.h"
+#define PWM_START_SEC_CODE
+#include "Pwm_MemMap.h"
+#endif
 #endif /* PWM_SET_DUTY_CYCLE_API */
 
 /*===============================================================================================*/
@@ -3038,6 +3156,66 @@ Std_ReturnType Pwm_Ipw_ValidateGetOutputState(const Pwm_IpwChannelConfigType * c
 }
 #endif /* (PWM_GET_OUTPUT_STATE_API == STD_ON) && (PWM_DEV_ERROR_DETECT == STD_ON) */
 
+/*===============================================================================================*/
+#if ((PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON))
+/**
+* @brief        Pwm_Ipw_ValidateChannelConfig
+* @details      This function will check one channel configuration for consistency, once, from
+*               Pwm_Init before the configuration is taken.
+*
+* @param[in]    ChannelClass        Class of the logical channel
+* @param[in]    NotificationUsed    A notification handler is configured for the channel
+* @param[in]    IpConfig            Pointer to PWM top configuration structure
+*
+* @return       Std_ReturnType
+*               E_NOT_OK        The channel configuration is inconsistent
+*               E_OK            The channel configuration is consistent
+*
+*/
+Std_ReturnType Pwm_Ipw_ValidateChannelConfig(Pwm_ChannelClassType                   ChannelClass,
+                                             boolean                                NotificationUsed,
+                                             const Pwm_IpwChannelConfigType * const IpConfig)
+{
+    /** @brief  Variable to store the value returned by the function */
+    Std_ReturnType      RetVal = (Std_ReturnType)E_NOT_OK;
+
+    if ((PWM_VARIABLE_PERIOD == ChannelClass) ||
+        (PWM_FIXED_PERIOD == ChannelClass) ||
+        (PWM_FIXED_PERIOD_SHIFTED == ChannelClass))
+    {
+        switch(IpConfig->ChannelType)
+        {
+#if (PWM_EMIOS_USED == STD_ON)
+            case PWM_CHANNEL_EMIOS:
+                if ((NULL_PTR != IpConfig->EmiosChConfig) &&
+                    (EMIOS_PWM_IP_INSTANCE_COUNT > IpConfig->ChannelInstanceId) &&
+                    (EMIOS_PWM_IP_CHANNEL_COUNT > ((const Emios_Pwm_Ip_ChannelConfigType *)IpConfig->EmiosChConfig)->ChannelId))
+                {
+                    RetVal = Pwm_Ipw_EmiosValidateChannelConfig(ChannelClass,
+                                                                NotificationUsed,
+                                                                (const Emios_Pwm_Ip_ChannelConfigType *)IpConfig->EmiosChConfig);
+                }
+                break;
+#endif
+#if (PWM_FLEXIO_USED == STD_ON)
+            case PWM_CHANNEL_FLEXIO:
+                if (NULL_PTR != IpConfig->FlexioChConfig)
+                {
+                    RetVal = (Std_ReturnType)E_OK;
+                }
+                break;
+#endif
+            default:
+                /* Channel of an IP not used by this configuration */
+                (void)NotificationUsed;
+                break;
+        }
+    }
+
+    return RetVal;
+}
+#endif /* (PWM_DEV_ERROR_DETECT == STD_ON) && (PWM_TRUSTED_CONFIG == STD_ON) */
+
 /*===============================================================================================*/
 #if (PWM_POWER_STATE_SUPPORTED == STD_ON)
 /**
@@ -212,6 +212,8 @@ static volatile uint32 msr_MCL_EXCLUSIVE_AREA_46[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_MCL_EXCLUSIVE_AREA_46[NUMBER_OF_CORES];
 static volatile uint32 msr_MCL_EXCLUSIVE_AREA_47[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_MCL_EXCLUSIVE_AREA_47[NUMBER_OF_CORES];
+static volatile uint32 msr_MCL_EXCLUSIVE_AREA_48[NUMBER_OF_CORES];
+static volatile uint32 reentry_guard_MCL_EXCLUSIVE_AREA_48[NUMBER_OF_CORES];
 
 #define RTE_STOP_SEC_VAR_CLEARED_32_NO_CACHEABLE
 #include "Rte_MemMap.h"
@@ -2298,6 +2300,44 @@ void SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_47(void)
     }
 }
 
+void SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_48(void)
+{
+    uint32 msr;
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    if(0UL == reentry_guard_MCL_EXCLUSIVE_AREA_48[u32CoreId])
+    {
+#if (defined MCAL_ENABLE_USER_MODE_SUPPORT)
+        msr = OsIf_Trusted_Call_Return(Mcl_schm_read_msr);
+#else
+        msr = Mcl_schm_read_msr();  /*read MSR (to store interrupts state)*/
+#endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+        if (ISR_ON(msr)) /*if MSR[EE] = 0, skip calling Suspend/Resume AllInterrupts*/
+        {
+            OsIf_SuspendAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+            ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+        }
+        msr_MCL_EXCLUSIVE_AREA_48[u32CoreId] = msr;
+    }
+    reentry_guard_MCL_EXCLUSIVE_AREA_48[u32CoreId]++;
+}
+
+void SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_48(void)
+{
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    reentry_guard_MCL_EXCLUSIVE_AREA_48[u32CoreId]--;
+    if ((ISR_ON(msr_MCL_EXCLUSIVE_AREA_48[u32CoreId]))&&(0UL == reentry_guard_MCL_EXCLUSIVE_AREA_48[u32CoreId]))         /*if interrupts were enabled*/
+    {
+        OsIf_ResumeAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+        ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+    }
+}
+
 
 #ifdef MCAL_TESTING_ENVIRONMENT
 /** 
@@ -2463,6 +2503,9 @@ void SchM_Check_mcl(void)
     EU_ASSERT(0UL == reentry_guard_MCL_EXCLUSIVE_AREA_47[u32CoreId]);
     reentry_guard_MCL_EXCLUSIVE_AREA_47[u32CoreId] = 0UL; /*reset reentry_guard_MCL_EXCLUSIVE_AREA_47 for the next test in the suite*/
 
+    EU_ASSERT(0UL == reentry_guard_MCL_EXCLUSIVE_AREA_48[u32CoreId]);
+    reentry_guard_MCL_EXCLUSIVE_AREA_48[u32CoreId] = 0UL; /*reset reentry_guard_MCL_EXCLUSIVE_AREA_48 for the next test in the suite*/
+
 
 }
 #endif /*MCAL_TESTING_ENVIRONMENT*/
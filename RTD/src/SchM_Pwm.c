@@ -170,6 +170,10 @@ static volatile uint32 msr_PWM_EXCLUSIVE_AREA_27[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_27[NUMBER_OF_CORES];
 static volatile uint32 msr_PWM_EXCLUSIVE_AREA_28[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_28[NUMBER_OF_CORES];
+static volatile uint32 msr_PWM_EXCLUSIVE_AREA_29[NUMBER_OF_CORES];
+static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_29[NUMBER_OF_CORES];
+static volatile uint32 msr_PWM_EXCLUSIVE_AREA_30[NUMBER_OF_CORES];
+static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_30[NUMBER_OF_CORES];
 static volatile uint32 msr_PWM_EXCLUSIVE_AREA_31[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_31[NUMBER_OF_CORES];
 static volatile uint32 msr_PWM_EXCLUSIVE_AREA_32[NUMBER_OF_CORES];
@@ -200,6 +204,8 @@ static volatile uint32 msr_PWM_EXCLUSIVE_AREA_44[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_44[NUMBER_OF_CORES];
 static volatile uint32 msr_PWM_EXCLUSIVE_AREA_45[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_45[NUMBER_OF_CORES];
+static volatile uint32 msr_PWM_EXCLUSIVE_AREA_47[NUMBER_OF_CORES];
+static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_47[NUMBER_OF_CORES];
 static volatile uint32 msr_PWM_EXCLUSIVE_AREA_50[NUMBER_OF_CORES];
 static volatile uint32 reentry_guard_PWM_EXCLUSIVE_AREA_50[NUMBER_OF_CORES];
 static volatile uint32 msr_PWM_EXCLUSIVE_AREA_51[NUMBER_OF_CORES];
@@ -1520,6 +1526,82 @@ void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_28(void)
     }
 }
 
+void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_29(void)
+{
+    uint32 msr;
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    if(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_29[u32CoreId])
+    {
+#if (defined MCAL_ENABLE_USER_MODE_SUPPORT)
+        msr = OsIf_Trusted_Call_Return(Pwm_schm_read_msr);
+#else
+        msr = Pwm_schm_read_msr();  /*read MSR (to store interrupts state)*/
+#endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+        if (ISR_ON(msr)) /*if MSR[EE] = 0, skip calling Suspend/Resume AllInterrupts*/
+        {
+            OsIf_SuspendAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+            ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+        }
+        msr_PWM_EXCLUSIVE_AREA_29[u32CoreId] = msr;
+    }
+    reentry_guard_PWM_EXCLUSIVE_AREA_29[u32CoreId]++;
+}
+
+void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_29(void)
+{
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    reentry_guard_PWM_EXCLUSIVE_AREA_29[u32CoreId]--;
+    if ((ISR_ON(msr_PWM_EXCLUSIVE_AREA_29[u32CoreId]))&&(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_29[u32CoreId]))         /*if interrupts were enabled*/
+    {
+        OsIf_ResumeAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+        ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+    }
+}
+
+void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_30(void)
+{
+    uint32 msr;
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    if(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_30[u32CoreId])
+    {
+#if (defined MCAL_ENABLE_USER_MODE_SUPPORT)
+        msr = OsIf_Trusted_Call_Return(Pwm_schm_read_msr);
+#else
+        msr = Pwm_schm_read_msr();  /*read MSR (to store interrupts state)*/
+#endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+        if (ISR_ON(msr)) /*if MSR[EE] = 0, skip calling Suspend/Resume AllInterrupts*/
+        {
+            OsIf_SuspendAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+            ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+        }
+        msr_PWM_EXCLUSIVE_AREA_30[u32CoreId] = msr;
+    }
+    reentry_guard_PWM_EXCLUSIVE_AREA_30[u32CoreId]++;
+}
+
+void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_30(void)
+{
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    reentry_guard_PWM_EXCLUSIVE_AREA_30[u32CoreId]--;
+    if ((ISR_ON(msr_PWM_EXCLUSIVE_AREA_30[u32CoreId]))&&(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_30[u32CoreId]))         /*if interrupts were enabled*/
+    {
+        OsIf_ResumeAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+        ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+    }
+}
+
 void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_31(void)
 {
     uint32 msr;
@@ -2090,6 +2172,44 @@ void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_45(void)
     }
 }
 
+void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_47(void)
+{
+    uint32 msr;
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    if(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_47[u32CoreId])
+    {
+#if (defined MCAL_ENABLE_USER_MODE_SUPPORT)
+        msr = OsIf_Trusted_Call_Return(Pwm_schm_read_msr);
+#else
+        msr = Pwm_schm_read_msr();  /*read MSR (to store interrupts state)*/
+#endif /* MCAL_ENABLE_USER_MODE_SUPPORT */
+        if (ISR_ON(msr)) /*if MSR[EE] = 0, skip calling Suspend/Resume AllInterrupts*/
+        {
+            OsIf_SuspendAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+            ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+        }
+        msr_PWM_EXCLUSIVE_AREA_47[u32CoreId] = msr;
+    }
+    reentry_guard_PWM_EXCLUSIVE_AREA_47[u32CoreId]++;
+}
+
+void SchM_Exit_Pwm_PWM_EXCLUSIVE_AREA_47(void)
+{
+    uint32 u32CoreId = (uint32)OsIf_GetCoreID();
+
+    reentry_guard_PWM_EXCLUSIVE_AREA_47[u32CoreId]--;
+    if ((ISR_ON(msr_PWM_EXCLUSIVE_AREA_47[u32CoreId]))&&(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_47[u32CoreId]))         /*if interrupts were enabled*/
+    {
+        OsIf_ResumeAllInterrupts();
+#ifdef _ARM_DS5_C_S32K3XX_
+        ASM_KEYWORD(" nop ");/* Compiler fix - forces the CSPID instruction to be generated with -02, -Ospace are selected*/
+#endif
+    }
+}
+
 void SchM_Enter_Pwm_PWM_EXCLUSIVE_AREA_50(void)
 {
     uint32 msr;
@@ -2800,6 +2920,12 @@ void SchM_Check_pwm(void)
     EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_28[u32CoreId]);
     reentry_guard_PWM_EXCLUSIVE_AREA_28[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_28 for the next test in the suite*/
 
+    EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_29[u32CoreId]);
+    reentry_guard_PWM_EXCLUSIVE_AREA_29[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_29 for the next test in the suite*/
+
+    EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_30[u32CoreId]);
+    reentry_guard_PWM_EXCLUSIVE_AREA_30[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_30 for the next test in the suite*/
+
     EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_31[u32CoreId]);
     reentry_guard_PWM_EXCLUSIVE_AREA_31[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_31 for the next test in the suite*/
 
@@ -2845,6 +2971,9 @@ void SchM_Check_pwm(void)
     EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_45[u32CoreId]);
     reentry_guard_PWM_EXCLUSIVE_AREA_45[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_45 for the next test in the suite*/
 
+    EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_47[u32CoreId]);
+    reentry_guard_PWM_EXCLUSIVE_AREA_47[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_47 for the next test in the suite*/
+
     EU_ASSERT(0UL == reentry_guard_PWM_EXCLUSIVE_AREA_50[u32CoreId]);
     reentry_guard_PWM_EXCLUSIVE_AREA_50[u32CoreId] = 0UL; /*reset reentry_guard_PWM_EXCLUSIVE_AREA_50 for the next test in the suite*/
 
@@ -0,0 +1,140 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifndef APISTATS_H
+#define APISTATS_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Services tracked at the same time, over all drivers */
+#define APISTATS_MAX_SERVICES       (16U)
+
+/* Service IDs of the Pwm, Mcl and Port drivers all fit in seven bits */
+#define APISTATS_SERVICE_IDS        (128U)
+
+/* Histogram bin n counts calls of 2^n to 2^(n+1) - 1 ticks; bin 0 also counts zero */
+#define APISTATS_BINS               (32U)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Driver a service belongs to
+*/
+typedef enum
+{
+    APISTATS_PWM                = 0x00U,
+    APISTATS_MCL                = 0x01U,
+    APISTATS_PORT               = 0x02U,
+    APISTATS_MODULES            = 0x03U     /* Number of drivers, not a driver */
+} ApiStats_ModuleType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Free running 32-bit tick source
+* @details      Only differences are used, so the counter may wrap.
+*/
+typedef uint32 (*ApiStats_ClockType)(void);
+
+/**
+* @brief        One service to track, e.g. { APISTATS_PWM, PWM_SETDUTYCYCLE_ID }
+*/
+typedef struct
+{
+    ApiStats_ModuleType Module;
+    uint8               ServiceId;
+} ApiStats_ServiceType;
+
+/**
+* @brief        Snapshot of the statistics of one service
+* @details      Min, Max and Mean are 0 while Count is 0.
+*/
+typedef struct
+{
+    uint32              Count;                      /* Completed calls */
+    uint32              Min;                        /* Ticks of the shortest call */
+    uint32              Max;                        /* Ticks of the longest call */
+    uint32              Mean;                       /* Sum / Count, rounded down */
+    uint64              Sum;                        /* Ticks of all calls */
+    uint32              Histogram[APISTATS_BINS];   /* Calls per log2 bin */
+} ApiStats_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Select the services to track and the tick source
+* @details      Services not in the list cost one table lookup per call. Entries beyond
+*               APISTATS_MAX_SERVICES and duplicates are ignored. Call before the drivers run.
+* @param[in]    Clock   Tick source, NULL_PTR for the default: the DWT cycle counter on target,
+*                       CLOCK_MONOTONIC in nanoseconds in a host build (APISTATS_HOST defined)
+*/
+void ApiStats_Init(const ApiStats_ServiceType Services[],
+                   uint8 NumServices,
+                   ApiStats_ClockType Clock);
+
+/**
+* @brief        Tick count at the start of a service call
+* @details      Pass the value to ApiStats_Stop at the end of the same call.
+*/
+uint32 ApiStats_Start(void);
+
+/**
+* @brief        Record one call of a service
+* @details      Callable from any context, with the interrupts masked or not; the statistics
+*               are updated with the interrupts masked for a few dozen cycles and PRIMASK is then
+*               restored. A call preempted by an interrupt is measured including the interrupt.
+*/
+void ApiStats_Stop(ApiStats_ModuleType Module, uint8 ServiceId, uint32 Start);
+
+/**
+* @brief        Statistics of one service
+* @details      Copied with the interrupts masked, so Count, Sum and the histogram are of
+*               the same calls.
+* @return       E_NOT_OK if the service is not tracked
+*/
+Std_ReturnType ApiStats_Get(ApiStats_ModuleType Module,
+                            uint8 ServiceId,
+                            ApiStats_StatsType * Stats);
+
+/**
+* @brief        Clear the statistics of every tracked service
+* @details      Each service is cleared as a whole; a call completing during the reset is
+*               counted either before or after it.
+*/
+void ApiStats_Reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APISTATS_H */
+
+/** @} */
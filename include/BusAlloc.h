@@ -0,0 +1,169 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef BUSALLOC_H
+#define BUSALLOC_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* eMIOS layout of the S32K344 */
+#define BUSALLOC_INSTANCES          (3U)
+#define BUSALLOC_CHANNELS           (24U)
+
+/* Problem size limits: every channel of every instance, five counter buses per instance */
+#define BUSALLOC_MAX_REQUESTS       (BUSALLOC_INSTANCES * BUSALLOC_CHANNELS)
+#define BUSALLOC_MAX_BUSES          (BUSALLOC_INSTANCES * 5U)
+
+/* SyncGroup of a channel that is not updated together with others */
+#define BUSALLOC_NO_GROUP           (0xFFU)
+
+/* Request index reported when no particular request is at fault */
+#define BUSALLOC_NO_REQUEST         (0xFFU)
+
+/* MasterChannel of a channel running on its internal counter */
+#define BUSALLOC_NO_MASTER          (0xFFU)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Time base a channel needs
+*/
+typedef enum
+{
+    BUSALLOC_EDGE_ALIGNED       = 0x00U,    /* OPWMB/OPWMT on an up counter bus (MC/MCB up) */
+    BUSALLOC_CENTER_ALIGNED     = 0x01U,    /* OPWMCB on an up/down counter bus (MCB up/down) */
+    BUSALLOC_INTERNAL           = 0x02U     /* OPWFMB on the channel's own counter, no bus */
+} BusAlloc_CountType;
+
+/**
+* @brief        Counter bus selected by a channel
+* @details      Same encoding as the BSL field and Emios_Pwm_Ip_CounterBusSourceType
+*/
+typedef enum
+{
+    BUSALLOC_BUS_A              = 0x00U,    /* Channel 23, reaches every channel */
+    BUSALLOC_BUS_BCDE           = 0x01U,    /* Channel 0 / 8 / 16, reaches its block of eight */
+    BUSALLOC_BUS_F              = 0x02U,    /* Channel 22, reaches every channel */
+    BUSALLOC_BUS_INTERNAL       = 0x03U     /* Internal counter */
+} BusAlloc_BusType;
+
+/**
+* @brief        Result of an allocation
+*/
+typedef enum
+{
+    BUSALLOC_OK                 = 0x00U,    /* Every request placed */
+    BUSALLOC_BAD_REQUEST        = 0x01U,    /* Request out of range or inconsistent */
+    BUSALLOC_TOO_MANY_PERIODS   = 0x02U,    /* More distinct bus periods on an instance than buses */
+    BUSALLOC_NO_CHANNEL         = 0x03U,    /* Channel masks and bus reach cannot all be met */
+    BUSALLOC_PHASE_SPLIT        = 0x04U     /* A sync group with phase offsets cannot share a bus */
+} BusAlloc_ResultType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Requirements of one PWM output
+* @details      ChannelMask lists the channels the pin can be muxed to, usually a single one.
+*               Outputs with the same Period and Count can share a bus; a bus channel cannot
+*               drive an output itself. Phase is counted from the start of the bus period, so
+*               the members of a sync group whose phases differ are kept on one bus: on two
+*               buses their offsets would only hold as long as the buses stay in step.
+*/
+typedef struct
+{
+    uint8               Instance;       /* eMIOS instance */
+    uint32              ChannelMask;    /* Bit n set: channel n is usable */
+    uint16              Period;         /* Counter bus period register value in ticks */
+    uint16              Phase;          /* Leading edge offset, edge aligned only, below Period */
+    BusAlloc_CountType  Count;          /* Time base */
+    uint8               SyncGroup;      /* Outputs updated together, BUSALLOC_NO_GROUP if none */
+} BusAlloc_RequestType;
+
+/**
+* @brief        Placement of one request
+*/
+typedef struct
+{
+    uint8               Channel;        /* eMIOS channel driving the output */
+    BusAlloc_BusType    Bus;            /* BSL value of the channel */
+    uint8               MasterChannel;  /* Channel running the bus, BUSALLOC_NO_MASTER if none */
+    uint16              PhaseShift;     /* Leading edge register value, PhaseShift of the Pwm channel */
+    uint16              MaxDuty;        /* Largest duty cycle in ticks the phase leaves room for */
+} BusAlloc_AssignType;
+
+/**
+* @brief        One counter bus to configure in the Mcl eMIOS channel table
+*/
+typedef struct
+{
+    uint8               Instance;       /* eMIOS instance */
+    uint8               MasterChannel;  /* Channel in MC/MCB mode */
+    BusAlloc_BusType    Bus;            /* Bus it drives */
+    BusAlloc_CountType  Count;          /* Up or up/down counting */
+    uint16              Period;         /* Period register value */
+} BusAlloc_BusCfgType;
+
+/**
+* @brief        Complete allocation
+*/
+typedef struct
+{
+    BusAlloc_AssignType Assign[BUSALLOC_MAX_REQUESTS];  /* Indexed like the requests */
+    BusAlloc_BusCfgType Buses[BUSALLOC_MAX_BUSES];      /* Buses in use */
+    uint8               NumBuses;                       /* Entries in Buses */
+    uint8               SplitGroups;                    /* Sync groups spread over several time bases */
+    uint32              Candidates;                     /* Bus layouts tried, a measure of the work done */
+} BusAlloc_SolutionType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Place every request on a channel and a counter bus
+* @details      Instances are solved independently. For each one the bus layouts are tried
+*               from the fewest buses up; the first bus count that fits every request wins and,
+*               among its layouts, the one splitting the fewest sync groups. Layouts that split
+*               a sync group with phase offsets are not taken. Does not touch the hardware, so
+*               it can run at configuration time or off target; test/BusAllocTool turns the
+*               solution into the Mcl and Pwm configuration tables.
+* @param[out]   FailedRequest   Request at fault, BUSALLOC_NO_REQUEST if none
+*/
+BusAlloc_ResultType BusAlloc_Solve(const BusAlloc_RequestType Requests[],
+                                   uint8 NumRequests,
+                                   BusAlloc_SolutionType * Solution,
+                                   uint8 * FailedRequest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUSALLOC_H */
+
+/** @} */
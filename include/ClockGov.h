@@ -0,0 +1,158 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifndef CLOCKGOV_H
+#define CLOCKGOV_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Mcl.h"
+#include "Clock_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* eMIOS clock domains of one configuration at most */
+#define CLOCKGOV_MAX_DOMAINS        (4U)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Core clock operating point selected by the governor
+*/
+typedef enum
+{
+    CLOCKGOV_MODE_RUN   = 0x00U,    /* Full speed clock setting, eMIOS on its main prescalers */
+    CLOCKGOV_MODE_IDLE  = 0x01U     /* Reduced clock setting, eMIOS on its alternate prescalers */
+} ClockGov_ModeType;
+
+/**
+* @brief        How an eMIOS clock domain is kept stable across a core clock switch
+*/
+typedef enum
+{
+    CLOCKGOV_DOMAIN_FIXED       = 0x00U,    /* Domain clock is not affected by the switch */
+    CLOCKGOV_DOMAIN_COMPENSATED = 0x01U     /* Domain clock scales, counter buses swap prescaler */
+} ClockGov_DomainPolicyType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        eMIOS clock domain feeding active PWM channels
+* @details      BusChannel is a master bus of the domain counting up (MCB up mode). A switch
+*               lengthens its period once to make up for the ticks the PCFS ramp adds, so the
+*               buses of a compensated domain should share its period. Its count is sampled
+*               against the core cycle counter to measure the counter bus clock, so the period
+*               error covers the actual prescaler and clock tree state.
+*/
+typedef struct
+{
+    Clock_Ip_NameType           EmiosClock;         /* eMIOS instance clock */
+    ClockGov_DomainPolicyType   Policy;             /* Stabilisation policy */
+    uint8                       EmiosInstance;      /* eMIOS instance of BusChannel */
+    uint8                       BusChannel;         /* Up counting master bus used for the measurement */
+    uint32                      NominalCounterHz;   /* Counter bus clock the PWM periods are designed for */
+} ClockGov_DomainType;
+
+/**
+* @brief        Governor configuration
+* @details      Both clock settings must ramp the core with progressive frequency switching (a
+*               non-empty Pcfs list), so a switch never steps the supply current.
+*/
+typedef struct
+{
+    const Clock_Ip_ClockConfigType * RunClock;          /* Clock_Ip setting used while computing frames */
+    const Clock_Ip_ClockConfigType * IdleClock;         /* Clock_Ip setting used between frames */
+    const Mcl_EmiosInitConfigType *  EmiosConfig;       /* Master buses swapped to alternate prescalers */
+    const ClockGov_DomainType *      Domains;           /* Domains feeding active PWM channels */
+    uint8                            NumDomains;        /* Entries in Domains, at most CLOCKGOV_MAX_DOMAINS */
+    uint32                           MaxPeriodErrorPpm; /* Allowed PWM period error after a switch */
+    uint32                           MeasureTicks;      /* Counter bus ticks sampled after each switch, 0 for none */
+} ClockGov_ConfigType;
+
+/**
+* @brief        Governor statistics
+*/
+typedef struct
+{
+    uint32  Transitions;        /* Completed run <-> idle switches */
+    uint32  MaxPeriodErrorPpm;  /* Worst PWM period error measured after a switch */
+    uint32  BoundViolations;    /* Switches whose error exceeded MaxPeriodErrorPpm */
+    boolean IdleInhibited;      /* Idle mode disabled after a violation */
+} ClockGov_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Initialize the governor in run mode
+* @details      Must be called after the clock tree has been set to RunClock, after Mcl_Init and
+*               after Timestamp_Init.
+* @return       E_NOT_OK if the configuration is incomplete or out of range; idle mode then
+*               stays inhibited
+*/
+Std_ReturnType ClockGov_Init(const ClockGov_ConfigType * Config);
+
+/**
+* @brief        Downclock the core once the frame computation is finished
+* @details      Busy-waits up to two counter bus periods to align the switch with a period
+*               boundary, then MeasureTicks counter bus ticks per domain to measure the result
+*               unless MeasureTicks is 0.
+* @return       E_OK when the idle clock is active, E_NOT_OK when the switch was refused or reverted
+*/
+Std_ReturnType ClockGov_EnterIdle(void);
+
+/**
+* @brief        Ramp the core back to full speed before the next frame
+* @return       E_NOT_OK when the measured period error after the switch is out of bound
+*/
+Std_ReturnType ClockGov_EnterRun(void);
+
+/**
+* @brief        Measure the period error of every domain now
+* @details      Busy-waits MeasureTicks counter bus ticks per domain, for configurations that
+*               leave the measurement out of the switches. Out of bound in idle mode, the run
+*               clock is restored and idle mode stays inhibited.
+* @return       E_NOT_OK when a domain is out of bound or the governor is not initialized
+*/
+Std_ReturnType ClockGov_CheckPeriods(uint32 MeasureTicks);
+
+/**
+* @brief        Return the active operating point
+*/
+ClockGov_ModeType ClockGov_GetMode(void);
+
+/**
+* @brief        Copy the governor statistics
+*/
+void ClockGov_GetStatistics(ClockGov_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOCKGOV_H */
+
+/** @} */
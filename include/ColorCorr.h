@@ -0,0 +1,102 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef COLORCORR_H
+#define COLORCORR_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Q15 coefficient from a constant fraction, e.g. COLORCORR_Q15(0.85) */
+#define COLORCORR_Q15(x)            ((sint16)((x) * 32768.0))
+
+/* Largest channel value produced, one below the 100% duty cycle of 0x8000 */
+#define COLORCORR_MAX_VALUE         (0x7FFFU)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        One pixel, channel values 0 ... COLORCORR_MAX_VALUE
+* @details      Padded to 8 bytes so R and G load as one 32-bit word for the dual multiplies
+*/
+typedef struct
+{
+    uint16  R;
+    uint16  G;
+    uint16  B;
+    uint16  Pad;
+} ColorCorr_PixelType;
+
+/**
+* @brief        Per-device correction: out = Coeff * in + Offset, saturated to the channel range
+* @details      Coefficients are Q15, so every entry lies in [-1, 1). Normalize the matrix to
+*               the weakest emitter; the brightest channels then get gains below one.
+*/
+typedef struct
+{
+    sint16  Coeff[3][3];    /* Rows R, G, B out; columns R, G, B in */
+    sint16  Offset[3];      /* Added to R, G, B out, in channel units */
+} ColorCorr_MatrixType;
+
+/**
+* @brief        Matrix in the packed form used by ColorCorr_Apply
+*/
+typedef struct
+{
+    uint32  RowRG[3];       /* R and G coefficients of each row, packed as two halfwords */
+    sint32  RowB[3];        /* B coefficient of each row */
+    sint32  Offset[3];      /* Offsets in Q15 */
+} ColorCorr_CompiledType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Pack a matrix for ColorCorr_Apply
+*/
+void ColorCorr_Compile(const ColorCorr_MatrixType * Matrix, ColorCorr_CompiledType * Compiled);
+
+/**
+* @brief        Correct a batch of pixels
+* @details      Uses the dual 16-bit multiply-accumulate instructions of the Cortex-M7 when
+*               the compiler targets the DSP extension, plain C otherwise. In and Out may be
+*               the same array. The sums are kept in 64 bits, so any matrix and offset are
+*               safe; inputs above COLORCORR_MAX_VALUE are not.
+*/
+void ColorCorr_Apply(const ColorCorr_CompiledType * Compiled,
+                     const ColorCorr_PixelType In[],
+                     ColorCorr_PixelType Out[],
+                     uint32 Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COLORCORR_H */
+
+/** @} */
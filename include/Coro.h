@@ -0,0 +1,185 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef CORO_H
+#define CORO_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/*
+* Stackless task bodies.
+*
+* A task is a function that is re-entered from the top on every step and jumps back to the
+* line it last suspended at. Locals do not survive a suspension; keep state in the context.
+* Do not use switch statements around a suspension point, and put at most one suspension
+* point on a source line.
+*
+*   static Coro_StatusType Fade(Coro_TaskType *Task, void *Context)
+*   {
+*       FadeState_t *fade = (FadeState_t *)Context;
+*       CORO_BEGIN(Task);
+*       for (fade->step = 0U; fade->step < 256U; fade->step++) {
+*           Pwm_SetDutyCycle(fade->channel, fade->step << 7U);
+*           CORO_SLEEP(Task, 15U);
+*       }
+*       CORO_WAIT_EVENT(Task, EVENT_BUTTON);
+*       CORO_END(Task);
+*   }
+*/
+#define CORO_BEGIN(task)                switch ((task)->Resume) { case 0U:
+
+#define CORO_END(task)                  } (task)->Resume = 0U; return CORO_ENDED
+
+/* Let the other ready tasks run once */
+#define CORO_YIELD(task)                do { (task)->Resume = (uint16)__LINE__; return CORO_YIELDED; \
+                                             case __LINE__: ; } while (0)
+
+/* Suspend for a number of timer wheel ticks */
+#define CORO_SLEEP(task, ticks)         do { Coro_Sleep((task), (ticks)); \
+                                             (task)->Resume = (uint16)__LINE__; return CORO_WAITING; \
+                                             case __LINE__: ; } while (0)
+
+/* Suspend until Coro_Signal raises one of the events in mask; Events then holds the raised ones */
+#define CORO_WAIT_EVENT(task, mask)     do { Coro_Wait((task), (mask)); \
+                                             (task)->Resume = (uint16)__LINE__; return CORO_WAITING; \
+                                             case __LINE__: ; } while (0)
+
+/* Yield until a condition holds */
+#define CORO_WAIT_UNTIL(task, cond)     do { (task)->Resume = (uint16)__LINE__; case __LINE__: \
+                                             if (!(cond)) { return CORO_YIELDED; } } while (0)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Result of one task step
+*/
+typedef enum
+{
+    CORO_YIELDED    = 0x00U,    /* Ready again on the next pass */
+    CORO_WAITING    = 0x01U,    /* Suspended on a timer or an event */
+    CORO_ENDED      = 0x02U     /* Task finished */
+} Coro_StatusType;
+
+/**
+* @brief        Scheduling state of a task
+*/
+typedef enum
+{
+    CORO_STATE_READY    = 0x00U,
+    CORO_STATE_SLEEPING = 0x01U,
+    CORO_STATE_WAITING  = 0x02U,
+    CORO_STATE_DONE     = 0x03U
+} Coro_StateType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+struct Coro_Task;
+
+/**
+* @brief        Task body, see CORO_BEGIN
+*/
+typedef Coro_StatusType (*Coro_FunctionType)(struct Coro_Task * Task, void * Context);
+
+/**
+* @brief        Task control block, owned by the application
+*/
+typedef struct Coro_Task
+{
+    Coro_FunctionType   Function;
+    void *              Context;
+    struct Coro_Task *  Next;       /* Ready queue or event wait list */
+    uint32              Events;     /* Events waited for, then events received */
+    uint32              Cycles;     /* Core cycles spent in the task */
+    uint32              Steps;      /* Times the task was run */
+    uint16              Resume;     /* Line to resume at, 0 before the first step */
+    uint8               State;      /* Coro_StateType */
+} Coro_TaskType;
+
+/**
+* @brief        Scheduler statistics
+*/
+typedef struct
+{
+    uint32  Switches;           /* Task steps run */
+    uint32  SchedulerCycles;    /* Core cycles spent outside the tasks */
+} Coro_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Empty the run queue
+* @details      Sleeping uses the timer wheel and accounting the timestamp service; both
+*               have to be initialized by the application.
+*/
+void Coro_Init(void);
+
+/**
+* @brief        Put a task on the run queue
+*/
+void Coro_Start(Coro_TaskType * Task, Coro_FunctionType Function, void * Context);
+
+/**
+* @brief        One scheduler pass
+* @details      Advances the timer wheel, wakes the tasks waiting for raised events and runs
+*               each task that was ready at the start of the pass once. Call from the main loop.
+* @return       Number of task steps run
+*/
+uint32 Coro_Schedule(void);
+
+/**
+* @brief        Raise events
+* @details      Callable from interrupt context, e.g. from a Pwm period notification. Events
+*               are delivered on the next pass; events no task waits for are dropped.
+*/
+void Coro_Signal(uint32 Events);
+
+/**
+* @brief        Arm the wake-up timer of a task, used by CORO_SLEEP
+*/
+void Coro_Sleep(Coro_TaskType * Task, uint32 Ticks);
+
+/**
+* @brief        Park a task on the event wait list, used by CORO_WAIT_EVENT
+*/
+void Coro_Wait(Coro_TaskType * Task, uint32 Events);
+
+/**
+* @brief        Copy the scheduler statistics
+*/
+void Coro_GetStatistics(Coro_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CORO_H */
+
+/** @} */
@@ -0,0 +1,130 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef DMACHAIN_H
+#define DMACHAIN_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Number of software TCDs in the arena, at most 255 */
+#define DMACHAIN_MAX_DESCRIPTORS    (32U)
+
+/* Descriptor handle that refers to no descriptor */
+#define DMACHAIN_NO_DESCRIPTOR      (0xFFU)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Descriptor sequence run by one DMA logic channel
+* @details      Filled by DmaChain_Create, the fields are managed by the module.
+*/
+typedef struct
+{
+    uint32  LogicCh;    /* Dma_Ip logic channel running the chain */
+    uint8   Head;       /* First descriptor, loaded into the channel by DmaChain_Start */
+    uint8   Tail;       /* Last appended descriptor */
+    uint8   Count;      /* Number of descriptors in the chain */
+    boolean Ring;       /* Tail links back to Head */
+} DmaChain_ChainType;
+
+/**
+* @brief        Arena statistics
+*/
+typedef struct
+{
+    uint32  Allocs;         /* Descriptors handed out */
+    uint32  Frees;          /* Descriptors returned */
+    uint32  Failures;       /* Appends refused because the arena was empty */
+    uint8   InUse;          /* Descriptors currently owned by chains */
+    uint8   PeakInUse;      /* Highest InUse seen */
+} DmaChain_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Put every descriptor of the arena on the free list
+* @details      Must be called after Dma_Ip_Init (or Mcl_Init) and DmaPool_Init. The first call
+*               takes the arena from the DmaPool SRAM region.
+* @return       E_NOT_OK if the pool had no room for the arena
+*/
+Std_ReturnType DmaChain_Init(void);
+
+/**
+* @brief        Prepare an empty chain for a logic channel
+*/
+void DmaChain_Create(DmaChain_ChainType * Chain, uint32 LogicCh);
+
+/**
+* @brief        Compile a transfer list into a new descriptor at the end of the chain
+* @return       Descriptor index within the chain, DMACHAIN_NO_DESCRIPTOR if the arena is empty
+*               or the chain is closed
+*/
+uint8 DmaChain_Append(DmaChain_ChainType * Chain,
+                      const Dma_Ip_LogicChannelTransferListType List[],
+                      uint32 ListDimension);
+
+/**
+* @brief        Link the last descriptor back to the first one
+* @details      A closed chain of two descriptors is a ping-pong, of one descriptor a
+*               continuous ring over the same buffer.
+*/
+Std_ReturnType DmaChain_Close(DmaChain_ChainType * Chain);
+
+/**
+* @brief        Change the buffers of one descriptor of the chain
+* @details      Only the addresses are changed. The descriptor must not be the one the
+*               channel is currently running (use the half/major interrupts to track it).
+*/
+Std_ReturnType DmaChain_Rearm(const DmaChain_ChainType * Chain, uint8 Index, uint32 SrcAddr, uint32 DstAddr);
+
+/**
+* @brief        Load the first descriptor into the channel
+* @details      The transfer starts on the next hardware or software request of the channel.
+*/
+Dma_Ip_ReturnType DmaChain_Start(const DmaChain_ChainType * Chain);
+
+/**
+* @brief        Return the descriptors of a chain to the arena
+* @details      The channel must be stopped, the eDMA may still fetch linked descriptors otherwise.
+*/
+void DmaChain_Release(DmaChain_ChainType * Chain);
+
+/**
+* @brief        Copy the arena statistics
+*/
+void DmaChain_GetStatistics(DmaChain_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMACHAIN_H */
+
+/** @} */
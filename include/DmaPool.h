@@ -0,0 +1,135 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifndef DMAPOOL_H
+#define DMAPOOL_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Mcl.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Cortex-M7 data cache line size, also the pool granule */
+#define DMAPOOL_CACHE_LINE          (32U)
+
+/* Arena sizes in bytes, multiples of DMAPOOL_CACHE_LINE. The SRAM arena also holds the frame
+   buffers of the display engines (FrameBuf.h); an application may size it on the command line. */
+#ifndef DMAPOOL_SRAM_SIZE
+#define DMAPOOL_SRAM_SIZE           (32768U)
+#endif
+#define DMAPOOL_DTCM_SIZE           (2048U)
+
+/* Offset from the CM7_0 DTCM address to its backdoor seen by the eDMA */
+#define DMAPOOL_DTCM_BACKDOOR_OFFSET (0x01000000U)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Memory region a buffer is allocated from
+*/
+typedef enum
+{
+    DMAPOOL_REGION_SRAM = 0x00U,    /* Cacheable SRAM, maintained by address range */
+    DMAPOOL_REGION_DTCM = 0x01U     /* DTCM, never cached, no maintenance */
+} DmaPool_RegionType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Cache maintenance counters
+*/
+typedef struct
+{
+    uint32  CleanOps;       /* Clean by address operations issued */
+    uint32  InvalidateOps;  /* Invalidate by address operations issued */
+    uint32  SkippedOps;     /* Operations skipped for non-cacheable buffers */
+    uint32  CleanBytes;     /* Bytes covered by clean operations */
+    uint32  InvalidateBytes;/* Bytes covered by invalidate operations */
+} DmaPool_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Reset both arenas and the maintenance counters
+*/
+void DmaPool_Init(void);
+
+/**
+* @brief        Allocate a cache-line aligned and padded DMA buffer
+* @return       Buffer address or NULL_PTR if the region has no room
+*/
+void * DmaPool_Alloc(uint32 Size, DmaPool_RegionType Region);
+
+/**
+* @brief        Return a buffer obtained from DmaPool_Alloc
+*/
+void DmaPool_Free(void * Buffer);
+
+/**
+* @brief        Address to program into a TCD for a pool buffer
+* @details      Translates DTCM addresses to the eDMA backdoor, other addresses are unchanged.
+*/
+uint32 DmaPool_GetDmaAddress(const void * Buffer);
+
+/**
+* @brief        Make CPU writes to a source buffer visible to the eDMA
+*/
+void DmaPool_PrepareTx(const void * Buffer, uint32 Length);
+
+/**
+* @brief        Drop cached copies of a destination buffer before the eDMA writes it
+*/
+void DmaPool_PrepareRx(void * Buffer, uint32 Length);
+
+/**
+* @brief        Drop lines speculatively refilled during the transfer, call after DONE
+*/
+void DmaPool_CompleteRx(void * Buffer, uint32 Length);
+
+/**
+* @brief        Coherent variant of Mcl_SetDmaChannelCommand
+* @details      Performs PrepareTx/PrepareRx on the given ranges (either may be NULL_PTR)
+*               and then issues Command on Channel.
+*/
+void DmaPool_SetDmaChannelCommand(uint32 Channel,
+                                  Mcl_DmaChannelCmdType Command,
+                                  const void * TxBuffer, uint32 TxLength,
+                                  void * RxBuffer, uint32 RxLength);
+
+/**
+* @brief        Copy the cache maintenance counters
+*/
+void DmaPool_GetStatistics(DmaPool_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMAPOOL_H */
+
+/** @} */
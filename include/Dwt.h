@@ -0,0 +1,63 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Cortex-M7 data watchpoint and trace unit, not part of the device header. Timestamp and
+* ApiStats both read its cycle counter; it is started, never written, since the other may be
+* measuring across the start.
+*/
+
+#ifndef DWT_H
+#define DWT_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+#define DEMCR             (*(volatile uint32 *)0xE000EDFCUL)
+#define DWT_CTRL          (*(volatile uint32 *)0xE0001000UL)
+#define DWT_CYCCNT        (*(volatile uint32 *)0xE0001004UL)
+#define DWT_LAR           (*(volatile uint32 *)0xE0001FB0UL)
+
+#define DEMCR_TRCENA      (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA (1UL << 0U)
+#define DWT_LAR_UNLOCK    (0xC5ACCE55UL)
+
+/* Let the cycle counter run from its current value; a no-op once it runs */
+#define DWT_START_CYCCNT() \
+    do { \
+        DEMCR |= DEMCR_TRCENA; \
+        DWT_LAR = DWT_LAR_UNLOCK; \
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA; \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DWT_H */
+
+/** @} */
@@ -0,0 +1,100 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+#ifndef FLEXIOTX_H
+#define FLEXIOTX_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Flexio_Mcl_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/*
+* FlexIO transmit shifter fed word by word by the eDMA, shared by the serial display engines
+* (ShiftOut, LedStrip).
+*
+* The clock timer starts whenever the shifter buffer holds data, shifts WordBits bits and
+* stops, so consecutive DMA writes go out back to back. The buffer is written through
+* SHIFTBUFBIS, which puts bit 31 of a word on the pin first; a word of fewer bits sends its
+* upper WordBits bits.
+*/
+
+/* Width of the shifter buffer */
+#define FLEXIOTX_WORD_BITS          (32U)
+
+/* Status flag of shifter n as internal timer trigger */
+#define FLEXIOTX_SHIFTER_TRIGGER(n) ((uint8)(((n) * 4U) + 1U))
+
+/* ClockPin value when the shift clock stays inside FlexIO */
+#define FLEXIOTX_NO_PIN             (0xFFU)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        One transmit shifter and the timer clocking it
+*/
+typedef struct
+{
+    uint8                           FlexioInstance;
+    uint8                           Shifter;
+    uint8                           Timer;
+    uint8                           DataPin;
+    uint8                           ClockPin;   /* FlexIO pin of the shift clock or FLEXIOTX_NO_PIN */
+    uint8                           WordBits;   /* Bits shifted per buffer word, 1 ... 32 */
+    Flexio_Mcl_Ip_TimerPolarityType ShiftEdge;  /* Clock edge the data changes on */
+    uint16                          ClockDiv;   /* FlexIO clocks per bit, see FlexioTx_IsValidDivider */
+} FlexioTx_ConfigType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        TRUE for a divider the 8-bit baud counter can make
+* @details      The period is split into two equal halves of at most 256 FlexIO clocks, so
+*               the divider is even, 2 ... 512.
+*/
+boolean FlexioTx_IsValidDivider(uint16 Div);
+
+/**
+* @brief        Initialise a FlexIO instance unless Mcl_Init did
+*/
+void FlexioTx_InitInstance(uint8 Instance);
+
+/**
+* @brief        Program the shifter and its clock timer and enable the shifter DMA request
+* @details      The divider and the word width must be valid.
+* @return       Address of the shifter buffer for the DMA destination, SHIFTBUFBIS
+*/
+uint32 FlexioTx_Configure(const FlexioTx_ConfigType * Config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLEXIOTX_H */
+
+/** @} */
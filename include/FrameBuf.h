@@ -0,0 +1,114 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+#ifndef FRAMEBUF_H
+#define FRAMEBUF_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/*
+* Double buffer shared by the DMA-driven display engines (LedMatrix, ShiftOut, LedStrip).
+*
+* The eDMA reads the front buffer while the application draws into the back one. Present
+* cleans the back buffer to memory and marks it pending; the engine swaps on its own frame
+* boundary, so the eDMA never sees a frame that mixes the two. Both buffers come from the
+* DmaPool SRAM region: cache-line aligned and padded, cleaned on present instead of being
+* placed in a non-cacheable section.
+*/
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        One double buffer, owned by a display engine
+* @details      Zero-initialise before the first FrameBuf_Init. The fields are private to
+*               FrameBuf, the engines use the functions below.
+*/
+typedef struct
+{
+    uint32 *            Buffer[2];
+    uint32              Bytes;          /* Size of each buffer */
+    uint8               Front;          /* Index of the buffer the eDMA reads */
+    volatile boolean    PresentPending; /* The back buffer waits for the frame boundary */
+} FrameBuf_Type;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Allocate both buffers from the DmaPool SRAM region and fill them
+* @details      Buffers of a previous initialisation are returned to the pool first.
+*               DmaPool_Init must have been called. Every word of both buffers is set to
+*               Fill, the blank frame of the engine.
+* @return       E_NOT_OK if the pool has no room for both buffers
+*/
+Std_ReturnType FrameBuf_Init(FrameBuf_Type * Frame, uint32 Bytes, uint32 Fill);
+
+/**
+* @brief        Buffer the application draws into
+*/
+uint32 * FrameBuf_Back(const FrameBuf_Type * Frame);
+
+/**
+* @brief        Buffer the eDMA reads
+*/
+const uint32 * FrameBuf_Front(const FrameBuf_Type * Frame);
+
+/**
+* @brief        Address of the front buffer to program into a TCD
+*/
+uint32 FrameBuf_FrontDmaAddress(const FrameBuf_Type * Frame);
+
+/**
+* @brief        Clean the back buffer to memory and mark it pending
+* @details      The new back buffer, after the swap, holds the frame before the one presented.
+*/
+void FrameBuf_Present(FrameBuf_Type * Frame);
+
+/**
+* @brief        TRUE while a presented buffer waits for the frame boundary
+* @details      Do not draw into the back buffer while this is set, it is still being shown
+*/
+boolean FrameBuf_IsPresentPending(const FrameBuf_Type * Frame);
+
+/**
+* @brief        Frame boundary: make a pending back buffer the front one
+* @details      Call from the engine's frame interrupt, then re-arm the eDMA on
+*               FrameBuf_FrontDmaAddress when it returns TRUE.
+* @return       TRUE if the buffers were swapped
+*/
+boolean FrameBuf_Swap(FrameBuf_Type * Frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAMEBUF_H */
+
+/** @} */
@@ -0,0 +1,109 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef HOTPATH_H
+#define HOTPATH_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+#include "Pwm.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/*
+* Cycle probes for the TCM hot-path placement (Tcm_MemMap.h).
+*
+* Build the image once with and once without TCM_HOT_PATH and compare the statistics of the
+* same probes. The figures only mean something on the target: flash wait states, the caches
+* and the TCM ports are not modelled by the host build, which checks the bookkeeping only.
+*/
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        What a probe measures
+*/
+typedef enum
+{
+    HOTPATH_DUTY_UPDATE = 0x00U,    /* Pwm_SetDutyCycle call, in core cycles */
+    HOTPATH_ISR_LATENCY = 0x01U,    /* Counter event to the first line of the notification */
+    HOTPATH_PROBES      = 0x02U
+} HotPath_ProbeType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Statistics of one probe, in core cycles
+*/
+typedef struct
+{
+    uint32  Samples;
+    uint32  First;          /* First sample, taken with cold caches right after start-up */
+    uint32  Min;
+    uint32  Max;
+    uint32  Mean;
+} HotPath_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Clear the statistics and calibrate the cost of an empty measurement
+* @details      The timestamp service has to be initialized.
+* @param[in]    CyclesPerBusTick    Core cycles per tick of the eMIOS counter bus the
+*                                   latency probe reads, i.e. core clock / bus clock
+*                                   times the bus prescaler
+*/
+void HotPath_Init(uint32 CyclesPerBusTick);
+
+/**
+* @brief        Time Pwm_SetDutyCycle, alternating between two duty cycles
+* @details      The empty-measurement cost is taken off each sample. Call before the
+*               channel's notifications are enabled, they would land in the samples.
+*/
+void HotPath_MeasureDutyUpdate(Pwm_ChannelType Channel, uint16 DutyA, uint16 DutyB, uint32 Calls);
+
+/**
+* @brief        Record the latency of an interrupt raised by a counter bus event
+* @details      Call as the first statement of the Pwm notification. EventCount is the bus
+*               counter value the event fires on, i.e. the period end or the match value.
+*               Latencies longer than one bus period cannot be told apart from short ones.
+*/
+void HotPath_SampleIsrLatency(uint8 Instance, uint8 BusChannel, uint32 EventCount);
+
+/**
+* @brief        Copy the statistics of one probe
+*/
+void HotPath_GetStatistics(HotPath_ProbeType Probe, HotPath_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOTPATH_H */
+
+/** @} */
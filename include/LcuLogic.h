@@ -0,0 +1,120 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef LCULOGIC_H
+#define LCULOGIC_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Lcu_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/*
+* Boolean expressions over the four inputs of a logic cell.
+*
+* Each input is its own 16-entry truth table (bit n of the LUT is the output for the combined
+* input value n = I3:I2:I1:I0), so combining them with the operators below yields the LUTCTRL
+* value of the expression directly. Constant expressions are folded by the compiler.
+*
+* Example, complementary PWM on I0 with dead-time blanking on I1 and fault on I2:
+*   high side: LCULOGIC_AND(LCULOGIC_I0, LCULOGIC_NOT(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2)))
+*   low side:  LCULOGIC_AND(LCULOGIC_NOT(LCULOGIC_I0), LCULOGIC_NOT(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2)))
+*/
+#define LCULOGIC_I0                 ((uint16)0xAAAAU)
+#define LCULOGIC_I1                 ((uint16)0xCCCCU)
+#define LCULOGIC_I2                 ((uint16)0xF0F0U)
+#define LCULOGIC_I3                 ((uint16)0xFF00U)
+#define LCULOGIC_TRUE               ((uint16)0xFFFFU)
+#define LCULOGIC_FALSE              ((uint16)0x0000U)
+
+#define LCULOGIC_NOT(a)             ((uint16)(~(uint32)(a) & 0xFFFFU))
+#define LCULOGIC_AND(a, b)          ((uint16)((uint32)(a) & (uint32)(b)))
+#define LCULOGIC_OR(a, b)           ((uint16)((uint32)(a) | (uint32)(b)))
+#define LCULOGIC_XOR(a, b)          ((uint16)((uint32)(a) ^ (uint32)(b)))
+#define LCULOGIC_MUX(s, a, b)       LCULOGIC_OR(LCULOGIC_AND((s), (a)), LCULOGIC_AND(LCULOGIC_NOT(s), (b)))
+
+/* Inputs and outputs of one logic cell */
+#define LCULOGIC_CELL_IO            (4U)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        One output of a logic cell
+*/
+typedef struct
+{
+    uint16  Lut;            /* Expression built with the LCULOGIC_ macros */
+    uint16  RiseFilter;     /* Rise filter in LCU clock cycles */
+    uint16  FallFilter;     /* Fall filter in LCU clock cycles */
+    boolean Invert;         /* Invert the output polarity */
+    boolean Enable;         /* Drive the output */
+} LcuLogic_OutputType;
+
+/**
+* @brief        Declarative description of one logic cell
+*/
+typedef struct
+{
+    uint8               LogicInstance;              /* Logic instance generated by the configurator */
+    uint8               HwLogicCell;                /* Hardware logic cell inside the instance */
+    uint8               InputMux[LCULOGIC_CELL_IO]; /* Input MUX select of I0..I3 */
+    LcuLogic_OutputType Outputs[LCULOGIC_CELL_IO];  /* Outputs 0..3 */
+} LcuLogic_CellType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Compile a cell description into its register image
+*/
+void LcuLogic_Compile(const LcuLogic_CellType * Cell, Lcu_Ip_LogicCellImageType * Image);
+
+/**
+* @brief        Compile and commit a set of cells
+* @details      Each cell is written in one pass with its outputs disabled until the image is complete.
+* @return       LCU_IP_STATUS_SUCCESS, or the status of the first cell that could not be committed
+*/
+Lcu_Ip_ReturnType LcuLogic_Commit(const LcuLogic_CellType Cells[], uint8 NumCells);
+
+/**
+* @brief        Output of a compiled LUT for a combined input value (I3:I2:I1:I0)
+*/
+boolean LcuLogic_Evaluate(uint16 Lut, uint8 Inputs);
+
+/**
+* @brief        Outputs of a compiled cell for a combined input value (I3:I2:I1:I0)
+* @details      Applies the LUT, polarity and enable of every output, as the pins see them.
+* @return       Bit n is the level of output n; disabled outputs read 0
+*/
+uint8 LcuLogic_EvaluateCell(const Lcu_Ip_LogicCellImageType * Image, uint8 Inputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCULOGIC_H */
+
+/** @} */
@@ -0,0 +1,136 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef LEDMATRIX_H
+#define LEDMATRIX_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "Emios_Pwm_Ip.h"
+#include "Siul2_Dio_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Frame buffer dimensions; rows beyond 16 need a row address decoder on the PGPDO pins */
+#define LEDMATRIX_MAX_ROWS          (32U)
+#define LEDMATRIX_MAX_COLUMNS       (24U)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Matrix wiring and scan resources
+* @details      Columns are OPWMB channels of one eMIOS instance on consecutive channel numbers,
+*               all on the counter bus whose period flag requests RowDmaCh. Rows are driven by
+*               the 16-bit parallel output (PGPDO) of one port half, which is written whole.
+*               RowDmaCh needs a 2-byte transfer configuration with the hardware request
+*               enabled, ColumnDmaCh a linked-only channel with its major loop callback calling
+*               LedMatrix_FrameIrq.
+*/
+typedef struct
+{
+    uint8                       EmiosInstance;  /* eMIOS instance of the column channels */
+    uint8                       FirstChannel;   /* Channel of column 0 */
+    uint8                       Columns;        /* Number of columns, at most LEDMATRIX_MAX_COLUMNS */
+    uint8                       Rows;           /* Number of rows, at most LEDMATRIX_MAX_ROWS */
+    uint32                      Period;         /* Counter bus period in ticks, one row time */
+    uint32                      BlankTicks;     /* Column leading edge; the row switches inside it */
+    Siul2_Dio_Ip_GpioType *     RowPort;        /* Port half driving the rows */
+    const uint16 *              RowPatterns;    /* PGPDO value selecting each row */
+    uint16                      RowsOff;        /* PGPDO value with every row off */
+    uint32                      RowDmaCh;       /* Dma_Ip logic channel requested by the bus flag */
+    uint32                      ColumnDmaCh;    /* Dma_Ip logic channel linked from RowDmaCh */
+} LedMatrix_ConfigType;
+
+/**
+* @brief        Scan statistics
+*/
+typedef struct
+{
+    uint32  Frames;         /* Frames scanned, counted by LedMatrix_FrameIrq */
+    uint32  Presents;       /* Back buffers shown */
+    uint32  RefreshMilliHz; /* Frame rate for the given bus clock, see LedMatrix_GetStatistics */
+} LedMatrix_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Prepare the frame buffers, the column leading edges and both DMA channels
+* @details      Must be called after Pwm_Init, Mcl_Init and DmaPool_Init with the column
+*               channels running. The frame buffers and the row patterns are taken from the
+*               DmaPool SRAM region. The scan does not start until LedMatrix_Start.
+* @return       E_NOT_OK if the matrix exceeds the limits above or the pool has no room
+*/
+Std_ReturnType LedMatrix_Init(const LedMatrix_ConfigType * Config);
+
+/**
+* @brief        Start scanning on the next counter bus period
+* @details      From then on rows are switched without CPU involvement; the only interrupt
+*               is LedMatrix_FrameIrq, once per frame.
+*/
+void LedMatrix_Start(void);
+
+/**
+* @brief        Stop scanning and switch every row off
+*/
+void LedMatrix_Stop(void);
+
+/**
+* @brief        Set one pixel of the back buffer
+* @details      Duty in counter bus ticks, clamped to Period - BlankTicks
+*/
+void LedMatrix_SetPixel(uint8 Row, uint8 Column, uint32 Duty);
+
+/**
+* @brief        Show the back buffer from the next frame on
+* @details      The buffers are swapped by LedMatrix_FrameIrq, so a frame never mixes the two.
+*               The new back buffer holds the frame before the one just presented.
+*/
+void LedMatrix_Present(void);
+
+/**
+* @brief        TRUE while a presented buffer waits for the frame boundary
+*/
+boolean LedMatrix_IsPresentPending(void);
+
+/**
+* @brief        Frame boundary, to be called from the ColumnDmaCh major loop callback
+*/
+void LedMatrix_FrameIrq(void);
+
+/**
+* @brief        Copy the scan statistics
+* @details      BusClockHz is the counter bus input clock, used to compute the refresh rate
+*/
+void LedMatrix_GetStatistics(uint32 BusClockHz, LedMatrix_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDMATRIX_H */
+
+/** @} */
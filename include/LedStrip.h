@@ -0,0 +1,150 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef LEDSTRIP_H
+#define LEDSTRIP_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "Flexio_Mcl_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Number of strips driven in parallel, each needs one shifter, one timer and one DMA channel */
+#define LEDSTRIP_MAX_STRIPS         (4U)
+
+/* Pixel bytes per strip, e.g. 170 GRB or 128 GRBW pixels */
+#define LEDSTRIP_MAX_BYTES          (512U)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Line protocol, selects the symbol time window and the reset time
+*/
+typedef enum
+{
+    LEDSTRIP_WS2812 = 0U,   /* T0H 0.40 us, T1H 0.80 us (+-0.15 us), reset 280 us (WS2812B-V5) */
+    LEDSTRIP_SK6812         /* T0H 0.30 us, T1H 0.60 us (+-0.15 us), reset 80 us */
+} LedStrip_ProtocolType;
+
+/**
+* @brief        One strip
+* @details      DmaCh must be requested by the Shifter status flag through the DMAMUX, with its
+*               major loop callback calling LedStrip_FrameIrq for this strip.
+*/
+typedef struct
+{
+    uint8   Shifter;        /* Transmit shifter driving Pin */
+    uint8   Timer;          /* Timer clocking the shifter, no pin output */
+    uint8   Pin;            /* FlexIO pin of the data line */
+    uint8   BytesPerPixel;  /* 3 for GRB, 4 for GRBW */
+    uint16  Pixels;         /* Strip length */
+    uint32  DmaCh;          /* Dma_Ip logic channel feeding the shifter */
+} LedStrip_StripConfigType;
+
+/**
+* @brief        Driver configuration
+* @details      Every data bit is sent as three symbols, 1 -> 110 and 0 -> 100, so one symbol
+*               is T0H and two are T1H; the shifter sends ten bits, 30 symbols, per word.
+*               SymbolClockDiv must put the symbol time inside the window of Protocol:
+*               325 ... 475 ns for WS2812, 225 ... 375 ns for SK6812.
+*/
+typedef struct
+{
+    uint8                               FlexioInstance; /* Initialised here unless Mcl_Init did */
+    LedStrip_ProtocolType               Protocol;
+    uint32                              FlexioClockHz;  /* FlexIO functional clock */
+    uint16                              SymbolClockDiv; /* FlexIO clocks per symbol, even, 2 ... 512 */
+    uint8                               Strips;         /* At most LEDSTRIP_MAX_STRIPS */
+    const LedStrip_StripConfigType *    StripConfig;    /* One entry per strip */
+} LedStrip_ConfigType;
+
+/**
+* @brief        Driver statistics
+*/
+typedef struct
+{
+    uint32  Frames;             /* Frames sent on all strips, counted by LedStrip_FrameIrq */
+    uint32  Encodes;            /* LedStrip_Encode calls */
+    uint32  EncodedPixels;      /* Pixels encoded by those calls */
+    uint64  EncodeCycles;       /* Core cycles spent encoding */
+    uint32  EncodePixelsPerMs;  /* Encoder throughput, see LedStrip_GetStatistics */
+    uint32  SymbolNs;           /* Symbol time from the configuration */
+} LedStrip_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Configure the shifters, timers and DMA chains of all strips
+* @details      Must be called after Mcl_Init, DmaPool_Init, DmaChain_Init and Timestamp_Init.
+*               Needs two DmaChain descriptors per strip and its two frame buffers from the
+*               DmaPool SRAM region.
+* @return       E_NOT_OK if the symbol time is outside the protocol window, a strip is longer
+*               than LEDSTRIP_MAX_BYTES, the pool has no room for its buffers or the descriptor
+*               arena is exhausted
+*/
+Std_ReturnType LedStrip_Init(const LedStrip_ConfigType * Config);
+
+/**
+* @brief        Encode a frame of one strip into its back buffer
+* @details      Pixels holds BytesPerPixel bytes per pixel in wire order (G, R, B[, W]). May run
+*               while the previous frame of the strip is being sent.
+* @return       E_NOT_OK while a frame already waits in the back buffer
+*/
+Std_ReturnType LedStrip_Encode(uint8 Strip, const uint8 Pixels[]);
+
+/**
+* @brief        Send the back buffer of one strip
+* @details      Starts at once if the strip is idle, else right after the frame being sent,
+*               without CPU involvement until then.
+*/
+void LedStrip_Show(uint8 Strip);
+
+/**
+* @brief        TRUE while a frame of the strip is being sent
+*/
+boolean LedStrip_IsBusy(uint8 Strip);
+
+/**
+* @brief        End of a frame including its reset time, to be called from the DmaCh major
+*               loop callback of the strip
+*/
+void LedStrip_FrameIrq(uint8 Strip);
+
+/**
+* @brief        Copy the driver statistics
+*/
+void LedStrip_GetStatistics(LedStrip_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEDSTRIP_H */
+
+/** @} */
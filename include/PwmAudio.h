@@ -0,0 +1,170 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef PWMAUDIO_H
+#define PWMAUDIO_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* PWM periods per half of the DMA double buffer; one refill interrupt per half */
+#define PWMAUDIO_BLOCK              (128U)
+
+/* PCM buffers queued at the same time */
+#define PWMAUDIO_QUEUE              (4U)
+
+/* Counter bus period limit in ticks, keeps the shaper arithmetic within 32 bits */
+#define PWMAUDIO_MAX_PERIOD         (16384U)
+
+/* Volume giving full scale output */
+#define PWMAUDIO_VOLUME_MAX         (256U)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Sample format of a PCM buffer
+*/
+typedef enum
+{
+    PWMAUDIO_U8     = 0U,   /* Unsigned 8-bit, 0x80 is silence (WAV 8-bit) */
+    PWMAUDIO_S16    = 1U    /* Signed 16-bit, native byte order */
+} PwmAudio_FormatType;
+
+/**
+* @brief        Output stage and DMA resources
+* @details      The output channels are OPWMB channels on a counter bus of Period ticks whose
+*               period flag requests DmaCh. With Channels = 2 the second channel, Channel + 1,
+*               gets the inverted duty so a speaker between both pins sees twice the swing and
+*               no DC. DmaCh needs the hardware request routed from the bus flag and its
+*               callback calling PwmAudio_DmaIrq on both the half and the major interrupt.
+*/
+typedef struct
+{
+    uint8   EmiosInstance;  /* eMIOS instance of the output channels */
+    uint8   Channel;        /* Channel of the (positive) output */
+    uint8   Channels;       /* 1 single ended, 2 bridged */
+    uint16  Period;         /* Counter bus period in ticks, at most PWMAUDIO_MAX_PERIOD */
+    uint16  LeadTicks;      /* Leading edge (A register), below Period */
+    uint32  UpdateRateHz;   /* Counter bus periods per second */
+    uint32  DmaCh;          /* Dma_Ip logic channel requested by the bus flag */
+} PwmAudio_ConfigType;
+
+/**
+* @brief        Playback statistics
+*/
+typedef struct
+{
+    uint32  Buffers;            /* PCM buffers played to the end */
+    uint32  Samples;            /* PCM samples consumed */
+    uint32  Periods;            /* Duty values rendered */
+    uint32  Blocks;             /* Half buffers rendered */
+    uint64  RenderCycles;       /* Core cycles spent rendering, 0 in a host build */
+    uint32  CyclesPerSample;    /* RenderCycles / Samples, see PwmAudio_GetStatistics */
+} PwmAudio_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Reset the playback state and program the output channels and the DMA channel
+* @details      Must be called after Pwm_Init, Mcl_Init, DmaPool_Init and Timestamp_Init with
+*               the output channels running. The DMA double buffer, 2 KiB, is taken from the
+*               DmaPool SRAM region on the first call. Output starts at silence once
+*               PwmAudio_Start is called. In a host build (PWMAUDIO_HOST defined) the hardware
+*               is left alone.
+* @return       E_NOT_OK if the configuration is out of range or the pool has no room
+*/
+Std_ReturnType PwmAudio_Init(const PwmAudio_ConfigType * Config);
+
+/**
+* @brief        Queue a PCM buffer
+* @details      Samples must stay valid until the buffer has been played; buffers play back
+*               to back in queue order. SampleRateHz must be below UpdateRateHz; material
+*               below half of it is upsampled through the halfband filter first, faster material
+*               only by the cubic interpolation and keeps its image at SampleRateHz - f.
+* @return       E_NOT_OK if the queue is full or the parameters are out of range
+*/
+Std_ReturnType PwmAudio_Play(const void * Samples,
+                             uint32 Count,
+                             PwmAudio_FormatType Format,
+                             uint32 SampleRateHz);
+
+/**
+* @brief        Drop every queued buffer
+* @details      Takes effect at the next sample; the output returns to silence once the
+*               filters have emptied, within about 40 sample periods.
+*/
+void PwmAudio_Flush(void);
+
+/**
+* @brief        TRUE while a buffer is queued or playing
+*/
+boolean PwmAudio_IsBusy(void);
+
+/**
+* @brief        Output scale, PWMAUDIO_VOLUME_MAX for full scale
+*/
+void PwmAudio_SetVolume(uint16 Volume);
+
+/**
+* @brief        Render duty values without the DMA
+* @details      Duty receives the duty of the positive output in ticks from LeadTicks,
+*               0 ... Period - LeadTicks. For host builds and tests; not to be used while the
+*               DMA runs.
+*/
+void PwmAudio_Render(uint16 Duty[], uint32 Periods);
+
+#if !defined(PWMAUDIO_HOST)
+/**
+* @brief        Fill both buffer halves and enable the DMA request
+*/
+void PwmAudio_Start(void);
+
+/**
+* @brief        Disable the DMA request and put the outputs at silence
+*/
+void PwmAudio_Stop(void);
+
+/**
+* @brief        Refill the buffer half the DMA has left, to be called from the DmaCh callback
+*/
+void PwmAudio_DmaIrq(void);
+#endif
+
+/**
+* @brief        Copy the playback statistics
+*/
+void PwmAudio_GetStatistics(PwmAudio_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWMAUDIO_H */
+
+/** @} */
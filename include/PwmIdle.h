@@ -0,0 +1,132 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifndef PWMIDLE_H
+#define PWMIDLE_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Pwm.h"
+#include "Clock_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Maximum number of Pwm channels supervised by the idle manager */
+#define PWMIDLE_MAX_CHANNELS        (8U)
+
+/* Duty cycle values treated as static output levels (AUTOSAR 0x0000 .. 0x8000 scale) */
+#define PWMIDLE_DUTY_0              (0x0000U)
+#define PWMIDLE_DUTY_100            (0x8000U)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Power state of the outputs supervised by the idle manager
+*/
+typedef enum
+{
+    PWMIDLE_STATE_RUN       = 0x00U,    /* eMIOS clocked, channels modulating */
+    PWMIDLE_STATE_PARKED    = 0x01U     /* outputs parked on static levels, eMIOS clock gated */
+} PwmIdle_StateType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Idle manager configuration
+*/
+typedef struct
+{
+    const Pwm_ChannelType * Channels;            /* Pwm logical channels handled by the manager */
+    uint8                   NumChannels;         /* Number of entries in Channels (<= PWMIDLE_MAX_CHANNELS) */
+    uint16                  StaticFrames;        /* Frames without duty change before parking */
+    boolean                 GateClock;           /* Gate EmiosClock while parked */
+    Clock_Ip_NameType       EmiosClock;          /* eMIOS instance clock feeding the channels */
+    const Pwm_ChannelType * InstanceChannels;    /* Every Pwm channel clocked by EmiosClock */
+    uint8                   NumInstanceChannels; /* Number of entries in InstanceChannels */
+    uint32                  ResumeBudgetTicks;   /* Resume latency bound in OsIf system ticks */
+} PwmIdle_ConfigType;
+
+/**
+* @brief        Idle manager statistics
+*/
+typedef struct
+{
+    uint32  ParkCount;              /* Number of transitions into the parked state */
+    uint32  ParkedFrames;           /* Frames spent in the parked state */
+    uint32  TotalFrames;            /* Frames processed since init or last reset */
+    uint32  ParkedTicks;            /* OsIf system ticks spent in the parked state */
+    uint32  LastResumeTicks;        /* Latency of the most recent resume */
+    uint32  MaxResumeTicks;         /* Worst resume latency observed */
+    uint32  ResumeBudgetMisses;     /* Resumes exceeding ResumeBudgetTicks */
+} PwmIdle_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Initialize the idle manager
+* @details      Must be called after Pwm_Init. All supervised channels start in run state with 0% duty.
+*               EmiosClock is only gated if every channel in InstanceChannels is supervised, so a
+*               channel of the same eMIOS instance outside the manager keeps running. The other
+*               services do nothing until a valid configuration has been passed.
+*/
+void PwmIdle_Init(const PwmIdle_ConfigType * Config);
+
+/**
+* @brief        Request a new duty cycle through the idle manager
+* @details      Resumes the eMIOS outputs first if they are parked.
+*/
+void PwmIdle_SetDutyCycle(uint8 Index, uint16 DutyCycle);
+
+/**
+* @brief        Frame tick of the idle manager
+* @details      Call once per animation frame. Parks the outputs when every channel is at
+*               0% or 100% and no duty changed during the last StaticFrames frames.
+*/
+void PwmIdle_MainFunction(void);
+
+/**
+* @brief        Return the current power state of the supervised outputs
+*/
+PwmIdle_StateType PwmIdle_GetState(void);
+
+/**
+* @brief        Copy the idle manager statistics
+*/
+void PwmIdle_GetStatistics(PwmIdle_StatsType * Stats);
+
+/**
+* @brief        Clear the idle manager statistics
+*/
+void PwmIdle_ResetStatistics(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWMIDLE_H */
+
+/** @} */
@@ -0,0 +1,139 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef SHIFTOUT_H
+#define SHIFTOUT_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "Flexio_Mcl_Ip.h"
+#include "Siul2_Dio_Ip.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Longest frame in 32-bit words, e.g. 42 daisy-chained TLC5940 (16 x 12 bit each) */
+#define SHIFTOUT_MAX_WORDS          (256U)
+
+/* GsclkTimer value when GSCLK comes from an eMIOS PWM channel instead of FlexIO */
+#define SHIFTOUT_NO_TIMER           (0xFFU)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Driver chain wiring and FlexIO resources
+* @details      The chain is clocked like an SPI master without chip select: data changes on
+*               the falling and is sampled on the rising SCLK edge. DmaCh must be requested by
+*               the Shifter status flag through the DMAMUX, with its major loop callback calling
+*               ShiftOut_FrameIrq. The latch is a plain GPIO (XLAT for the TLC5940, RCLK for
+*               the 74HC595).
+*/
+typedef struct
+{
+    uint8                           FlexioInstance; /* Initialised here unless Mcl_Init did */
+    uint8                           Shifter;        /* Transmit shifter driving DataPin */
+    uint8                           ClockTimer;     /* Timer generating SCLK on ClockPin */
+    uint8                           GsclkTimer;     /* PWM timer on GsclkPin or SHIFTOUT_NO_TIMER */
+    uint8                           DataPin;        /* FlexIO pin numbers */
+    uint8                           ClockPin;
+    uint8                           GsclkPin;
+    uint8                           BitsPerChannel; /* 12 for TLC5940 grayscale, 8 per 74HC595, 1 ... 16 */
+    uint16                          Channels;       /* Outputs in the whole chain */
+    uint16                          ShiftClockDiv;  /* FlexIO clocks per SCLK period, even, 2 ... 512 */
+    uint16                          GsclkDiv;       /* FlexIO clocks per GSCLK period, even, 2 ... 512 */
+    Siul2_Dio_Ip_GpioType *         LatchPort;
+    Siul2_Dio_Ip_PinsChannelType    LatchPin;
+    uint32                          DmaCh;          /* Dma_Ip logic channel feeding the shifter */
+} ShiftOut_ConfigType;
+
+/**
+* @brief        Transfer statistics
+*/
+typedef struct
+{
+    uint32  Frames;         /* Frames shifted out, counted by ShiftOut_FrameIrq */
+    uint32  Latches;        /* Frames latched to the outputs */
+    uint32  BitsPerFrame;   /* Including the leading pad to a whole word */
+    uint32  MaxFrameMilliHz; /* Frame rate the shift clock allows, see ShiftOut_GetStatistics */
+} ShiftOut_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Configure the shifter, the clock timers, the latch pin and the DMA channel
+* @details      Must be called after Mcl_Init and DmaPool_Init. GSCLK, if generated by FlexIO,
+*               runs from here on. Both frame buffers come from the DmaPool SRAM region and
+*               start with every output at zero.
+* @return       E_NOT_OK if the chain exceeds SHIFTOUT_MAX_WORDS, a divider is invalid or the
+*               pool has no room for the frame buffers
+*/
+Std_ReturnType ShiftOut_Init(const ShiftOut_ConfigType * Config);
+
+/**
+* @brief        Set one output of the back buffer
+* @details      Channel 0 is the output nearest to the MCU, i.e. the last bit shifted.
+*               Value is truncated to BitsPerChannel.
+*/
+void ShiftOut_SetChannel(uint16 Channel, uint16 Value);
+
+/**
+* @brief        Shift the back buffer out from the next frame boundary on
+* @details      The new back buffer holds the frame before the one just presented.
+*/
+void ShiftOut_Present(void);
+
+/**
+* @brief        TRUE while a presented buffer waits to be shifted out
+*/
+boolean ShiftOut_IsPresentPending(void);
+
+/**
+* @brief        Frame boundary: latch the frame shifted since the last call, start the next
+* @details      Call periodically, e.g. from the PWM notification ending a TLC5940 grayscale
+*               cycle, so XLAT falls inside BLANK. The period must exceed the shift time of a
+*               frame plus two words.
+*/
+void ShiftOut_FrameTick(void);
+
+/**
+* @brief        End of a frame transfer, to be called from the DmaCh major loop callback
+*/
+void ShiftOut_FrameIrq(void);
+
+/**
+* @brief        Copy the transfer statistics
+* @details      FlexioClockHz is the FlexIO functional clock, used to compute the frame rate
+*/
+void ShiftOut_GetStatistics(uint32 FlexioClockHz, ShiftOut_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHIFTOUT_H */
+
+/** @} */
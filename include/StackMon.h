@@ -0,0 +1,105 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef STACKMON_H
+#define STACKMON_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Interrupt nesting levels tracked by StackMon_Sample, deeper nesting counts as the last one */
+#define STACKMON_MAX_LEVELS         (4U)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Static RAM regions laid out by the linker script
+*/
+typedef enum
+{
+    STACKMON_REGION_SRAM_DATA       = 0x00U,    /* Cacheable initialized data */
+    STACKMON_REGION_SRAM_BSS        = 0x01U,    /* Cacheable zeroed data */
+    STACKMON_REGION_NOCACHE_DATA    = 0x02U,    /* Non-cacheable initialized data */
+    STACKMON_REGION_NOCACHE_BSS     = 0x03U,    /* Non-cacheable zeroed data */
+    STACKMON_REGION_SHARED_BSS      = 0x04U,    /* Shareable zeroed data */
+    STACKMON_REGION_DTCM_DATA       = 0x05U,    /* DTCM initialized data */
+    STACKMON_REGION_DTCM_BSS        = 0x06U,    /* DTCM zeroed data */
+    STACKMON_REGION_DTCM_FREE       = 0x07U,    /* DTCM left between the data and the stack */
+    STACKMON_REGION_STACK           = 0x08U,    /* Main stack */
+    STACKMON_REGION_COUNT           = 0x09U
+} StackMon_RegionType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Main stack usage measured from the startup paint
+*/
+typedef struct
+{
+    uint32  Size;           /* Stack size reserved by the linker script */
+    uint32  HighWater;      /* Deepest use so far; above Size the stack overflowed into free DTCM */
+    uint32  DtcmUntouched;  /* Free DTCM still holding the paint */
+} StackMon_UsageType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Measure the main stack high-water mark
+* @details      Needs the startup code built with STACK_PAINT; the scan is linear in the
+*               untouched DTCM, call it from a background task.
+*/
+void StackMon_GetStackUsage(StackMon_UsageType * Usage);
+
+/**
+* @brief        Record the current stack depth for the active interrupt nesting level
+* @details      Call at the deepest point of an ISR or notification, e.g. inside a Pwm
+*               notification before returning. Thread mode is level 0.
+*/
+void StackMon_Sample(void);
+
+/**
+* @brief        Deepest stack use recorded by StackMon_Sample at a nesting level
+*/
+uint32 StackMon_GetLevelMark(uint8 Level);
+
+/**
+* @brief        Size in bytes of a static RAM region
+* @details      The split of each region by module is the table make -C test footprint writes
+*               next to the map file (test/RamFootprint).
+*/
+uint32 StackMon_GetRamFootprint(StackMon_RegionType Region);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACKMON_H */
+
+/** @} */
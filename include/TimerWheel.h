@@ -0,0 +1,131 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "OsIf.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Timers in the static pool, at most 0x7FFF; the build may size it */
+#ifndef TIMERWHEEL_MAX_TIMERS
+#define TIMERWHEEL_MAX_TIMERS       (64U)
+#endif
+
+/* Slots per wheel level as a power of two, and levels. Level n holds the timers due in
+   2^(6n) to 2^(6n+6) - 1 ticks, so five levels reach 2^30 ticks; longer delays wait in the top
+   level and move down when they get closer. SLOT_BITS * LEVELS must stay below 32 */
+#define TIMERWHEEL_SLOT_BITS        (6U)
+#define TIMERWHEEL_SLOTS            (1UL << TIMERWHEEL_SLOT_BITS)
+#define TIMERWHEEL_LEVELS           (5U)
+
+/* Handle returned when no timer could be started */
+#define TIMERWHEEL_NO_TIMER         (0xFFFFU)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Timer handle
+* @details      Pool index plus a generation that changes each time the timer is released,
+*               so a handle kept after its timer expired no longer matches a reused entry.
+*/
+typedef uint16 TimerWheel_TimerType;
+
+/**
+* @brief        Expiry callback, run from TimerWheel_Process
+*/
+typedef void (*TimerWheel_CallbackType)(void * Context);
+
+/**
+* @brief        Wheel statistics
+*/
+typedef struct
+{
+    uint32  Expired;        /* Callbacks run */
+    uint32  Failures;       /* Starts refused, pool empty */
+    uint16  InUse;          /* Timers currently running */
+    uint16  PeakInUse;      /* Highest InUse seen */
+    uint16  MaxSlotScan;    /* Most timers handled in a single tick, due plus moved down a level */
+} TimerWheel_StatsType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Empty the wheel and start counting ticks on the OsIf system timer
+* @param[in]    TickPeriodUs    Wheel resolution in microseconds
+*/
+void TimerWheel_Init(uint32 TickPeriodUs);
+
+/**
+* @brief        Start a timer
+* @details      All timer functions must be called from the context running TimerWheel_Process.
+* @param[in]    Delay       Ticks until the first expiry, at least 1
+* @param[in]    Period      Ticks between later expiries, 0 for a one-shot timer
+* @return       Timer handle, TIMERWHEEL_NO_TIMER when the pool is empty
+*/
+TimerWheel_TimerType TimerWheel_Start(uint32 Delay,
+                                      uint32 Period,
+                                      TimerWheel_CallbackType Callback,
+                                      void * Context);
+
+/**
+* @brief        Stop a timer and return it to the pool
+* @return       E_NOT_OK if the handle is not running or is stale
+*/
+Std_ReturnType TimerWheel_Cancel(TimerWheel_TimerType Timer);
+
+/**
+* @brief        Move the next expiry of a running timer to Delay ticks from now
+* @return       E_NOT_OK if the handle is not running or is stale
+*/
+Std_ReturnType TimerWheel_Reschedule(TimerWheel_TimerType Timer, uint32 Delay);
+
+/**
+* @brief        Advance the wheel by the time elapsed since the last call and run due callbacks
+* @details      Call from the main loop or a low priority task. Each tick costs the timers
+*               expiring on it plus, once every TIMERWHEEL_SLOTS ticks or more, the timers of
+*               one higher-level slot moving down; not the number of timers running.
+*               One-shot timers are released before their callback runs; periodic timers are
+*               already re-armed, so the callback may cancel or reschedule its own timer.
+* @return       Number of callbacks run
+*/
+uint32 TimerWheel_Process(void);
+
+/**
+* @brief        Copy the wheel statistics
+*/
+void TimerWheel_GetStatistics(TimerWheel_StatsType * Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMERWHEEL_H */
+
+/** @} */
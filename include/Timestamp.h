@@ -0,0 +1,125 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Clock epochs kept for Timestamp_ToNs. Stamps taken more than TIMESTAMP_CLOCK_EPOCHS - 2
+   frequency changes ago are converted at the oldest kept frequency */
+#define TIMESTAMP_CLOCK_EPOCHS      (8U)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        Core clock cycles, the DWT count extended to 64 bits from Timestamp_Init on
+*/
+typedef uint64 Timestamp_CyclesType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Start the DWT cycle counter and cache the core clock frequency
+* @details      Call once after the clock tree is initialized. In a host build (TIMESTAMP_HOST
+*               defined) CLOCK_MONOTONIC scaled to the core clock frequency stands in for the
+*               DWT counter.
+*/
+void Timestamp_Init(void);
+
+/**
+* @brief        Reload the cached core clock frequency
+* @details      Call right after every core clock switch. It starts a new clock epoch, so
+*               stamps on both sides of the switch keep converting at their own frequency;
+*               stamps taken between the switch and this call convert at the old one.
+*/
+void Timestamp_UpdateFrequency(void);
+
+/**
+* @brief        Start a new clock epoch at the given core clock frequency
+* @details      Timestamp_UpdateFrequency with the frequency known to the caller. Called by one
+*               task at a time; readers on other contexts stay lock-free.
+*/
+void Timestamp_SetFrequency(uint32 Frequency);
+
+/**
+* @brief        Monotonic 64-bit cycle count
+* @details      Lock-free and callable from any context. The 32-bit hardware counter is
+*               extended in software, so some context has to call this function (or
+*               Timestamp_Poll) at least once per half counter period, about 13 s at 160 MHz.
+*/
+Timestamp_CyclesType Timestamp_Get(void);
+
+/**
+* @brief        Keep the software extension up to date
+* @details      Call from a periodic task when Timestamp_Get itself is used rarely.
+*/
+void Timestamp_Poll(void);
+
+/**
+* @brief        Nanoseconds since Timestamp_Init at a cycle count
+* @details      Converts each stretch of the count at the frequency it ran at.
+*/
+uint64 Timestamp_ToNs(Timestamp_CyclesType Stamp);
+
+/**
+* @brief        Nanoseconds since Timestamp_Init
+*/
+uint64 Timestamp_GetNs(void);
+
+/**
+* @brief        Nanoseconds between two cycle counts, across clock switches
+*/
+uint64 Timestamp_ElapsedNs(Timestamp_CyclesType Start, Timestamp_CyclesType End);
+
+/**
+* @brief        Convert cycles to nanoseconds at the current frequency
+* @details      For durations measured without a clock switch in between; use
+*               Timestamp_ElapsedNs otherwise.
+*/
+uint64 Timestamp_CyclesToNs(Timestamp_CyclesType Cycles);
+
+/**
+* @brief        Convert nanoseconds to cycles at the current frequency
+*/
+Timestamp_CyclesType Timestamp_NsToCycles(uint64 Ns);
+
+/**
+* @brief        Current core clock frequency in Hz
+*/
+uint32 Timestamp_GetFrequency(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMESTAMP_H */
+
+/** @} */
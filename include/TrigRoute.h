@@ -0,0 +1,119 @@
+/*
+*   (c) Copyright 2020 NXP
+*
+*   NXP Confidential. This software is owned or controlled by NXP and may only be used strictly
+*   in accordance with the applicable license terms.  By expressly accepting
+*   such terms or by downloading, installing, activating and/or otherwise using
+*   the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms.  If you do not agree to
+*   be bound by the applicable license terms, then you may not retain,
+*   install, activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+*/
+
+#ifndef TRIGROUTE_H
+#define TRIGROUTE_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Mcl.h"
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Graph size limits */
+#define TRIGROUTE_MAX_NODES         (32U)
+#define TRIGROUTE_MAX_EDGES         (32U)
+
+/* Edge index reported when no particular edge is at fault */
+#define TRIGROUTE_NO_EDGE           (0xFFU)
+
+/*==================================================================================================
+*                                              ENUMS
+==================================================================================================*/
+/**
+* @brief        Hardware resource an edge is routed through
+*/
+typedef enum
+{
+    TRIGROUTE_EDGE_TRGMUX       = 0x00U,    /* TRGMUX logic trigger Target selects input Value */
+    TRIGROUTE_EDGE_LCU_INPUT    = 0x01U,    /* LCU logic input Target selects mux input Value */
+    TRIGROUTE_EDGE_DMA_REQUEST  = 0x02U     /* DMA logic channel Target accepts hardware requests */
+} TrigRoute_EdgeKindType;
+
+/**
+* @brief        Result of validating or applying a graph
+*/
+typedef enum
+{
+    TRIGROUTE_OK            = 0x00U,    /* Graph is consistent / applied */
+    TRIGROUTE_BAD_NODE      = 0x01U,    /* Edge refers to a node outside the graph */
+    TRIGROUTE_CONFLICT      = 0x02U,    /* Two edges drive the same sink with different settings */
+    TRIGROUTE_CYCLE         = 0x03U,    /* Edges form a loop */
+    TRIGROUTE_LOCKED        = 0x04U     /* TRGMUX output is locked, routing refused */
+} TrigRoute_ResultType;
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief        One source -> sink connection
+* @details      From/To are application defined signal numbers below NumNodes, e.g. an eMIOS
+*               channel flag, a TRGMUX output, an LCU output or a DMA channel.
+*/
+typedef struct
+{
+    uint8                   From;       /* Upstream signal */
+    uint8                   To;         /* Downstream signal */
+    TrigRoute_EdgeKindType  Kind;       /* Routing resource */
+    uint32                  Target;     /* Logic trigger / logic input / logic channel */
+    uint32                  Value;      /* Input selection, unused for DMA requests */
+    boolean                 Lock;       /* Lock the TRGMUX output after routing */
+} TrigRoute_EdgeType;
+
+/**
+* @brief        Routing graph of one operating mode
+*/
+typedef struct
+{
+    const TrigRoute_EdgeType *  Edges;      /* Connections */
+    uint8                       NumEdges;   /* Number of entries in Edges */
+    uint8                       NumNodes;   /* Number of signals used by the edges */
+} TrigRoute_GraphType;
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief        Check a graph for bad nodes, conflicting sinks and loops
+* @details      Does not touch the hardware.
+* @param[out]   FailedEdge  Edge at fault, TRIGROUTE_NO_EDGE if none
+*/
+TrigRoute_ResultType TrigRoute_Validate(const TrigRoute_GraphType * Graph, uint8 * FailedEdge);
+
+/**
+* @brief        Validate and apply a graph in one pass
+* @details      Consumers are armed before the routes feeding them: DMA requests first, then
+*               all LCU input selections with a single list call, then TRGMUX edges from the sinks
+*               back to the sources, so no event can enter a partly routed chain.
+* @param[out]   FailedEdge  Edge at fault, TRIGROUTE_NO_EDGE if none
+*/
+TrigRoute_ResultType TrigRoute_Apply(const TrigRoute_GraphType * Graph, uint8 * FailedEdge);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRIGROUTE_H */
+
+/** @} */
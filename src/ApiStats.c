@@ -0,0 +1,373 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#if defined(APISTATS_HOST) && !defined(_POSIX_C_SOURCE)
+/* clock_gettime under -std=c99 */
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#if defined(APISTATS_HOST)
+#include <time.h>
+#include "OsIf.h"
+#else
+#include "Dwt.h"
+#endif
+#include "ApiStats.h"
+/* Drivers reporting through their callouts, only the Pwm driver is built on the host */
+#include "Pwm.h"
+#if !defined(APISTATS_HOST)
+#include "CDD_Mcl.h"
+#include "Port.h"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* Statistics of one tracked service, only touched with the interrupts masked */
+typedef struct {
+    uint32 count;
+    uint32 min;
+    uint32 max;
+    uint64 sum;
+    uint32 hist[APISTATS_BINS];
+} ApiStatsSlot_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+/* Map entry of a service that is not tracked; other entries are the slot index plus one, so
+   the zero-initialized map tracks nothing before ApiStats_Init */
+#define NO_SLOT           (0U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint8 apistats_map[APISTATS_MODULES][APISTATS_SERVICE_IDS];
+static ApiStatsSlot_t apistats_slots[APISTATS_MAX_SERVICES];
+static ApiStats_ClockType apistats_clock;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static uint32 DefaultClock(void);
+static uint32 EnterCritical(void);
+static void ExitCritical(uint32 Primask);
+static ApiStatsSlot_t *FindSlot(ApiStats_ModuleType module, uint8 service);
+static void ClearSlot(ApiStatsSlot_t *slot);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+#if defined(APISTATS_HOST)
+/**
+* @brief        Monotonic nanoseconds, truncated to 32 bits
+*/
+static uint32 DefaultClock(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint32)now.tv_sec * 1000000000UL) + (uint32)now.tv_nsec;
+}
+#else
+/**
+* @brief        Core clock cycles
+*/
+static uint32 DefaultClock(void)
+{
+    return DWT_CYCCNT;
+}
+#endif
+
+#if defined(APISTATS_HOST)
+/**
+* @brief        Host: the OsIf stand-in of the test, which nests
+*/
+static uint32 EnterCritical(void)
+{
+    OsIf_SuspendAllInterrupts();
+
+    return 0U;
+}
+
+static void ExitCritical(uint32 Primask)
+{
+    (void)Primask;
+    OsIf_ResumeAllInterrupts();
+}
+#else
+/**
+* @brief        Mask the interrupts, returning PRIMASK as it was
+* @details      OsIf_SuspendAllInterrupts is a bare cpsid i and its resume a cpsie i, which
+*               would unmask the interrupts of a caller that had them masked already
+*/
+static uint32 EnterCritical(void)
+{
+    uint32 primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory");
+
+    return primask;
+}
+
+/**
+* @brief        Put PRIMASK back as EnterCritical found it
+*/
+static void ExitCritical(uint32 Primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (Primask) : "memory");
+}
+#endif
+
+/**
+* @brief        Slot of a tracked service, NULL_PTR if the service is not tracked
+*/
+static ApiStatsSlot_t *FindSlot(ApiStats_ModuleType module, uint8 service)
+{
+    ApiStatsSlot_t *slot = NULL_PTR;
+    uint8 entry;
+
+    if (((uint32)module < (uint32)APISTATS_MODULES) && (service < APISTATS_SERVICE_IDS)) {
+        entry = apistats_map[module][service];
+        if (entry != NO_SLOT) {
+            slot = &apistats_slots[entry - 1U];
+        }
+    }
+
+    return slot;
+}
+
+/**
+* @brief        Back to no calls recorded
+*/
+static void ClearSlot(ApiStatsSlot_t *slot)
+{
+    uint32 bin;
+    uint32 primask;
+
+    primask = EnterCritical();
+    slot->count = 0U;
+    slot->min = 0xFFFFFFFFUL;
+    slot->max = 0U;
+    slot->sum = 0U;
+    for (bin = 0U; bin < APISTATS_BINS; bin++) {
+        slot->hist[bin] = 0U;
+    }
+    ExitCritical(primask);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Select the services to track and the tick source
+*/
+void ApiStats_Init(const ApiStats_ServiceType Services[],
+                   uint8 NumServices,
+                   ApiStats_ClockType Clock)
+{
+    uint32 used = 0U;
+    uint8 i;
+
+    for (i = 0U; i < (uint8)APISTATS_MODULES; i++) {
+        uint32 id;
+
+        for (id = 0U; id < APISTATS_SERVICE_IDS; id++) {
+            apistats_map[i][id] = NO_SLOT;
+        }
+    }
+
+    for (i = 0U; (i < NumServices) && (used < APISTATS_MAX_SERVICES); i++) {
+        ApiStats_ModuleType module = Services[i].Module;
+        uint8 service = Services[i].ServiceId;
+
+        if (((uint32)module < (uint32)APISTATS_MODULES) && (service < APISTATS_SERVICE_IDS) &&
+            (apistats_map[module][service] == NO_SLOT)) {
+            ClearSlot(&apistats_slots[used]);
+            used++;
+            apistats_map[module][service] = (uint8)used;
+        }
+    }
+
+#if !defined(APISTATS_HOST)
+    if (Clock == NULL_PTR) {
+        DWT_START_CYCCNT();
+    }
+#endif
+
+    apistats_clock = (Clock != NULL_PTR) ? Clock : DefaultClock;
+}
+
+/**
+* @brief        Tick count at the start of a service call
+*/
+uint32 ApiStats_Start(void)
+{
+    return (apistats_clock != NULL_PTR) ? apistats_clock() : 0U;
+}
+
+/**
+* @brief        Record one call of a service
+* @details      The tick count is taken first, then the slot is updated with the interrupts
+*               masked, a few dozen cycles: a call interrupting the update waits, so the 64-bit
+*               sum and the other fields always change together. PRIMASK is restored, not
+*               cleared, so a caller with the interrupts masked keeps them masked.
+*/
+void ApiStats_Stop(ApiStats_ModuleType Module, uint8 ServiceId, uint32 Start)
+{
+    ApiStatsSlot_t *slot = FindSlot(Module, ServiceId);
+    uint32 ticks;
+    uint32 bin;
+    uint32 primask;
+
+    if ((slot != NULL_PTR) && (apistats_clock != NULL_PTR)) {
+        ticks = apistats_clock() - Start;
+        bin = (ticks == 0U) ? 0U : (31U - (uint32)__builtin_clz(ticks));
+
+        primask = EnterCritical();
+        slot->count++;
+        slot->sum += ticks;
+        if (ticks < slot->min) {
+            slot->min = ticks;
+        }
+        if (ticks > slot->max) {
+            slot->max = ticks;
+        }
+        slot->hist[bin]++;
+        ExitCritical(primask);
+    }
+}
+
+/**
+* @brief        Statistics of one service
+*/
+Std_ReturnType ApiStats_Get(ApiStats_ModuleType Module,
+                            uint8 ServiceId,
+                            ApiStats_StatsType * Stats)
+{
+    const ApiStatsSlot_t *slot = FindSlot(Module, ServiceId);
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint32 bin;
+    uint32 primask;
+
+    if ((slot != NULL_PTR) && (Stats != NULL_PTR)) {
+        primask = EnterCritical();
+        Stats->Count = slot->count;
+        Stats->Sum = slot->sum;
+        Stats->Min = slot->min;
+        Stats->Max = slot->max;
+        for (bin = 0U; bin < APISTATS_BINS; bin++) {
+            Stats->Histogram[bin] = slot->hist[bin];
+        }
+        ExitCritical(primask);
+
+        if (Stats->Count == 0U) {
+            Stats->Min = 0U;
+            Stats->Max = 0U;
+            Stats->Mean = 0U;
+        } else {
+            Stats->Mean = (uint32)(Stats->Sum / Stats->Count);
+        }
+
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Clear the statistics of every tracked service
+*/
+void ApiStats_Reset(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < APISTATS_MAX_SERVICES; i++) {
+        ClearSlot(&apistats_slots[i]);
+    }
+}
+
+#if (PWM_API_STATS == STD_ON)
+/**
+* @brief        Pwm driver callout, opens a measurement
+*/
+uint32 Pwm_ApiStatsStartHook(void)
+{
+    return ApiStats_Start();
+}
+
+/**
+* @brief        Pwm driver callout, records the call
+*/
+void Pwm_ApiStatsStopHook(uint8 ServiceId, uint32 Start)
+{
+    ApiStats_Stop(APISTATS_PWM, ServiceId, Start);
+}
+#endif
+
+#if !defined(APISTATS_HOST) && (STD_ON == MCL_API_STATS)
+/**
+* @brief        Mcl driver callout, opens a measurement
+*/
+uint32 Mcl_ApiStatsStartHook(void)
+{
+    return ApiStats_Start();
+}
+
+/**
+* @brief        Mcl driver callout, records the call
+*/
+void Mcl_ApiStatsStopHook(uint8 ServiceId, uint32 Start)
+{
+    ApiStats_Stop(APISTATS_MCL, ServiceId, Start);
+}
+#endif
+
+#if !defined(APISTATS_HOST) && (STD_ON == PORT_API_STATS)
+/**
+* @brief        Port driver callout, opens a measurement
+*/
+uint32 Port_ApiStatsStartHook(void)
+{
+    return ApiStats_Start();
+}
+
+/**
+* @brief        Port driver callout, records the call
+*/
+void Port_ApiStatsStopHook(uint8 ServiceId, uint32 Start)
+{
+    ApiStats_Stop(APISTATS_PORT, ServiceId, Start);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
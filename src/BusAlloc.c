@@ -0,0 +1,559 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "BusAlloc.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+/* Bus slots of one instance: A, B, C, D, F */
+#define SLOTS               (5U)
+#define NO_SLOT             (0xFFU)
+#define NO_CLASS            (0xFFU)
+#define NO_OWNER            (0xFFU)
+
+#define ALL_CHANNELS        (0x00FFFFFFUL)
+
+/* Largest duty cycle register value */
+#define MAX_DUTY            (0xFFFFUL)
+
+/* Split key of a channel on its internal counter: never equal to another channel's */
+#define INTERNAL_KEY(r)     ((uint16)(0x8000U | (uint16)(r)))
+
+/*==================================================================================================
+*                                      Local constants
+==================================================================================================*/
+static const uint8 slot_master[SLOTS] = { 23U, 0U, 8U, 16U, 22U };
+static const BusAlloc_BusType slot_bus[SLOTS] = {
+    BUSALLOC_BUS_A, BUSALLOC_BUS_BCDE, BUSALLOC_BUS_BCDE, BUSALLOC_BUS_BCDE, BUSALLOC_BUS_F
+};
+static const uint32 slot_reach[SLOTS] = {
+    ALL_CHANNELS, 0x000000FFUL, 0x0000FF00UL, 0x00FF0000UL, ALL_CHANNELS
+};
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Instance being solved: requests and their period classes */
+static const BusAlloc_RequestType *requests;
+static uint8 request_total;
+static uint8 inst_req[BUSALLOC_CHANNELS];
+static uint8 inst_count;
+static uint8 req_class[BUSALLOC_CHANNELS];
+static uint16 class_period[SLOTS];
+static BusAlloc_CountType class_count[SLOTS];
+static uint8 class_total;
+
+/* Candidate layout and its matching */
+static uint8 slot_class[SLOTS];
+static uint32 allowed[BUSALLOC_CHANNELS];
+static uint8 owner[BUSALLOC_CHANNELS];
+static uint8 req_channel[BUSALLOC_CHANNELS];
+static uint8 req_slot[BUSALLOC_CHANNELS];
+
+/* Best layout so far */
+static boolean best_found;
+static uint8 best_split;
+static uint8 best_matched;
+static uint8 best_unmatched;
+static uint8 best_slot_class[SLOTS];
+static uint8 best_channel[BUSALLOC_CHANNELS];
+static uint8 best_slot[BUSALLOC_CHANNELS];
+
+/* Split counting */
+static uint8 split_group[BUSALLOC_MAX_REQUESTS];
+static uint16 split_key[BUSALLOC_MAX_REQUESTS];
+static uint32 candidates;
+
+/* Sync groups whose members have different phases, one bit per group */
+static uint32 phased_groups[8];
+static uint8 phase_failed;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static BusAlloc_ResultType CheckRequest(const BusAlloc_RequestType *req);
+static boolean IsPhased(uint8 group);
+static BusAlloc_ResultType CheckPhases(uint8 n, uint8 *failed);
+static boolean KeepsPhases(void);
+static uint8 CountSplits(uint8 n);
+static boolean Augment(uint8 r, uint32 *visited);
+static void PickSlots(void);
+static void Evaluate(void);
+static void Enumerate(uint8 slot, uint8 used, uint8 buses);
+static BusAlloc_ResultType SolveInstance(uint8 instance, BusAlloc_SolutionType *solution, uint8 *failed);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Range and consistency checks of one request
+*/
+static BusAlloc_ResultType CheckRequest(const BusAlloc_RequestType *req)
+{
+    BusAlloc_ResultType ret = BUSALLOC_OK;
+
+    if ((req->Instance >= BUSALLOC_INSTANCES) || (0UL == (req->ChannelMask & ALL_CHANNELS)) ||
+        (req->Count > BUSALLOC_INTERNAL) || (0U == req->Period) || (req->Phase >= req->Period) ||
+        ((req->Count != BUSALLOC_EDGE_ALIGNED) && (0U != req->Phase))) {
+        ret = BUSALLOC_BAD_REQUEST;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        TRUE if the members of the sync group do not all have the same phase
+*/
+static boolean IsPhased(uint8 group)
+{
+    return ((group != BUSALLOC_NO_GROUP) &&
+            (0UL != (phased_groups[group >> 5U] & (1UL << (group & 31U))))) ? TRUE : FALSE;
+}
+
+/**
+* @brief        Find the sync groups with phase offsets, which have to stay on one instance
+* @details      Each member is compared with the first member of its group
+*/
+static BusAlloc_ResultType CheckPhases(uint8 n, uint8 *failed)
+{
+    BusAlloc_ResultType ret = BUSALLOC_OK;
+    uint8 group;
+    uint8 i;
+    uint8 j;
+
+    for (i = 0U; i < 8U; i++) {
+        phased_groups[i] = 0UL;
+    }
+    for (i = 0U; i < n; i++) {
+        group = requests[i].SyncGroup;
+        for (j = 0U; (j < i) && (group != BUSALLOC_NO_GROUP); j++) {
+            if (requests[j].SyncGroup == group) {
+                break;
+            }
+        }
+        if ((group != BUSALLOC_NO_GROUP) && (j < i) && (requests[j].Phase != requests[i].Phase)) {
+            phased_groups[group >> 5U] |= (1UL << (group & 31U));
+        }
+    }
+    for (i = 0U; (i < n) && (ret == BUSALLOC_OK); i++) {
+        group = requests[i].SyncGroup;
+        for (j = 0U; (j < i) && (TRUE == IsPhased(group)); j++) {
+            if ((requests[j].SyncGroup == group) && (requests[j].Instance != requests[i].Instance)) {
+                ret = BUSALLOC_PHASE_SPLIT;
+                *failed = i;
+                break;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        TRUE if every sync group with phase offsets of the layout is on a single bus
+* @details      The split keys of the layout have to be set; the first member off the bus of
+*               its group is kept for the report
+*/
+static boolean KeepsPhases(void)
+{
+    boolean keeps = TRUE;
+    uint8 r;
+    uint8 m;
+
+    for (r = 0U; (r < inst_count) && (TRUE == keeps); r++) {
+        for (m = 0U; (m < r) && (TRUE == IsPhased(split_group[r])); m++) {
+            if ((split_group[m] == split_group[r]) && (split_key[m] != split_key[r])) {
+                keeps = FALSE;
+                phase_failed = (phase_failed == BUSALLOC_NO_REQUEST) ? inst_req[r] : phase_failed;
+                break;
+            }
+        }
+    }
+
+    return keeps;
+}
+
+/**
+* @brief        Number of sync groups whose members have different split keys
+* @details      Each member is compared with the first member of its group
+*/
+static uint8 CountSplits(uint8 n)
+{
+    static boolean split[BUSALLOC_MAX_REQUESTS];
+    uint8 splits = 0U;
+    uint8 i;
+    uint8 j;
+
+    for (i = 0U; i < n; i++) {
+        split[i] = FALSE;
+        if (split_group[i] != BUSALLOC_NO_GROUP) {
+            for (j = 0U; j < i; j++) {
+                if (split_group[j] == split_group[i]) {
+                    break;
+                }
+            }
+            if ((j < i) && (split_key[j] != split_key[i]) && (FALSE == split[j])) {
+                split[j] = TRUE;
+                splits++;
+            }
+        }
+    }
+
+    return splits;
+}
+
+/**
+* @brief        Try to give request r a channel, moving earlier requests if needed
+*/
+static boolean Augment(uint8 r, uint32 *visited)
+{
+    uint32 free = allowed[r] & ~(*visited);
+    boolean placed = FALSE;
+    uint8 c;
+
+    for (c = 0U; (c < BUSALLOC_CHANNELS) && (FALSE == placed); c++) {
+        if (0UL != (free & (1UL << c))) {
+            *visited |= (1UL << c);
+            if ((owner[c] == NO_OWNER) || (TRUE == Augment(owner[c], visited))) {
+                owner[c] = r;
+                req_channel[r] = c;
+                placed = TRUE;
+            }
+        }
+    }
+
+    return placed;
+}
+
+/**
+* @brief        Choose the bus of every matched request
+* @details      A grouped request takes the reachable bus of its class that most members of
+*               its group can reach, so a group stays on one bus whenever its channels allow it
+*/
+static void PickSlots(void)
+{
+    uint8 votes;
+    uint8 best_votes;
+    uint8 r;
+    uint8 m;
+    uint8 s;
+
+    for (r = 0U; r < inst_count; r++) {
+        req_slot[r] = NO_SLOT;
+        best_votes = 0U;
+        for (s = 0U; (s < SLOTS) && (req_class[r] != NO_CLASS); s++) {
+            if ((slot_class[s] == req_class[r]) && (0UL != (slot_reach[s] & (1UL << req_channel[r])))) {
+                votes = 1U;
+                for (m = 0U; m < inst_count; m++) {
+                    if ((m != r) && (requests[inst_req[m]].SyncGroup != BUSALLOC_NO_GROUP) &&
+                        (requests[inst_req[m]].SyncGroup == requests[inst_req[r]].SyncGroup) &&
+                        (req_class[m] == req_class[r]) &&
+                        (0UL != (slot_reach[s] & (1UL << req_channel[m])))) {
+                        votes++;
+                    }
+                }
+                if (votes > best_votes) {
+                    best_votes = votes;
+                    req_slot[r] = s;
+                }
+            }
+        }
+    }
+}
+
+/**
+* @brief        Match the requests against the current layout and keep it if it is the best
+*/
+static void Evaluate(void)
+{
+    uint32 masters = 0UL;
+    uint32 reach;
+    uint32 visited;
+    uint8 matched = 0U;
+    uint8 unmatched = BUSALLOC_NO_REQUEST;
+    uint8 split;
+    uint8 r;
+    uint8 s;
+
+    candidates++;
+    for (s = 0U; s < SLOTS; s++) {
+        if (slot_class[s] != NO_CLASS) {
+            masters |= (1UL << slot_master[s]);
+        }
+    }
+    for (r = 0U; r < inst_count; r++) {
+        reach = (req_class[r] == NO_CLASS) ? ALL_CHANNELS : 0UL;
+        for (s = 0U; s < SLOTS; s++) {
+            if ((slot_class[s] != NO_CLASS) && (slot_class[s] == req_class[r])) {
+                reach |= slot_reach[s];
+            }
+        }
+        allowed[r] = requests[inst_req[r]].ChannelMask & reach & ~masters;
+    }
+    for (r = 0U; r < BUSALLOC_CHANNELS; r++) {
+        owner[r] = NO_OWNER;
+    }
+    for (r = 0U; r < inst_count; r++) {
+        visited = 0UL;
+        if (TRUE == Augment(r, &visited)) {
+            matched++;
+        } else if (unmatched == BUSALLOC_NO_REQUEST) {
+            unmatched = inst_req[r];
+        } else {
+            /* Only the first failure is reported */
+        }
+    }
+
+    if (matched < inst_count) {
+        if ((FALSE == best_found) && (matched >= best_matched)) {
+            best_matched = matched;
+            best_unmatched = unmatched;
+        }
+    } else {
+        PickSlots();
+        for (r = 0U; r < inst_count; r++) {
+            split_group[r] = requests[inst_req[r]].SyncGroup;
+            split_key[r] = (req_slot[r] == NO_SLOT) ? INTERNAL_KEY(r) : (uint16)req_slot[r];
+        }
+        split = CountSplits(inst_count);
+        if (FALSE == KeepsPhases()) {
+            /* Not a layout for the phases */
+        } else if ((FALSE == best_found) || (split < best_split)) {
+            best_found = TRUE;
+            best_split = split;
+            for (s = 0U; s < SLOTS; s++) {
+                best_slot_class[s] = slot_class[s];
+            }
+            for (r = 0U; r < inst_count; r++) {
+                best_channel[r] = req_channel[r];
+                best_slot[r] = req_slot[r];
+            }
+        }
+    }
+}
+
+/**
+* @brief        Give each remaining slot a class or leave it unused, then evaluate the layout
+* @details      Only layouts with exactly buses slots in use and every class on a bus are tried
+*/
+static void Enumerate(uint8 slot, uint8 used, uint8 buses)
+{
+    boolean covered;
+    uint8 k;
+    uint8 s;
+
+    if ((TRUE == best_found) && (0U == best_split)) {
+        /* Nothing better to find */
+    } else if (slot == SLOTS) {
+        covered = (used == buses) ? TRUE : FALSE;
+        for (k = 0U; (k < class_total) && (TRUE == covered); k++) {
+            covered = FALSE;
+            for (s = 0U; s < SLOTS; s++) {
+                if (slot_class[s] == k) {
+                    covered = TRUE;
+                }
+            }
+        }
+        if (TRUE == covered) {
+            Evaluate();
+        }
+    } else {
+        if ((SLOTS - (uint32)slot) > ((uint32)buses - used)) {
+            slot_class[slot] = NO_CLASS;
+            Enumerate(slot + 1U, used, buses);
+        }
+        if (used < buses) {
+            for (k = 0U; k < class_total; k++) {
+                slot_class[slot] = k;
+                Enumerate(slot + 1U, used + 1U, buses);
+            }
+        }
+        slot_class[slot] = NO_CLASS;
+    }
+}
+
+/**
+* @brief        Allocate the requests of one instance
+*/
+static BusAlloc_ResultType SolveInstance(uint8 instance, BusAlloc_SolutionType *solution, uint8 *failed)
+{
+    BusAlloc_ResultType ret = BUSALLOC_OK;
+    const BusAlloc_RequestType *req;
+    uint8 buses;
+    uint8 r;
+    uint8 k;
+    uint8 s;
+
+    /* Collect the requests and their (period, count) classes */
+    inst_count = 0U;
+    class_total = 0U;
+    for (r = 0U; (r < request_total) && (ret == BUSALLOC_OK); r++) {
+        req = &requests[r];
+        if (req->Instance == instance) {
+            if (inst_count == BUSALLOC_CHANNELS) {
+                ret = BUSALLOC_NO_CHANNEL;
+                *failed = r;
+            } else {
+                inst_req[inst_count] = r;
+                req_class[inst_count] = NO_CLASS;
+                if (req->Count != BUSALLOC_INTERNAL) {
+                    for (k = 0U; k < class_total; k++) {
+                        if ((class_period[k] == req->Period) && (class_count[k] == req->Count)) {
+                            break;
+                        }
+                    }
+                    if (k == SLOTS) {
+                        ret = BUSALLOC_TOO_MANY_PERIODS;
+                        *failed = r;
+                    } else if (k == class_total) {
+                        class_period[k] = req->Period;
+                        class_count[k] = req->Count;
+                        class_total++;
+                    } else {
+                        /* Known class */
+                    }
+                    req_class[inst_count] = k;
+                }
+                inst_count++;
+            }
+        }
+    }
+
+    /* Fewest buses first */
+    best_found = FALSE;
+    best_matched = 0U;
+    best_unmatched = BUSALLOC_NO_REQUEST;
+    phase_failed = BUSALLOC_NO_REQUEST;
+    for (s = 0U; s < SLOTS; s++) {
+        slot_class[s] = NO_CLASS;
+    }
+    for (buses = class_total; (buses <= SLOTS) && (FALSE == best_found) && (ret == BUSALLOC_OK); buses++) {
+        Enumerate(0U, 0U, buses);
+    }
+
+    if (ret != BUSALLOC_OK) {
+        /* Reported while collecting */
+    } else if ((FALSE == best_found) && (phase_failed != BUSALLOC_NO_REQUEST)) {
+        /* Every request found a channel, but not with its group on one bus */
+        ret = BUSALLOC_PHASE_SPLIT;
+        *failed = phase_failed;
+    } else if (FALSE == best_found) {
+        ret = BUSALLOC_NO_CHANNEL;
+        *failed = best_unmatched;
+    } else {
+        for (s = 0U; s < SLOTS; s++) {
+            k = best_slot_class[s];
+            if (k != NO_CLASS) {
+                solution->Buses[solution->NumBuses].Instance = instance;
+                solution->Buses[solution->NumBuses].MasterChannel = slot_master[s];
+                solution->Buses[solution->NumBuses].Bus = slot_bus[s];
+                solution->Buses[solution->NumBuses].Count = class_count[k];
+                solution->Buses[solution->NumBuses].Period = class_period[k];
+                solution->NumBuses++;
+            }
+        }
+        for (r = 0U; r < inst_count; r++) {
+            s = best_slot[r];
+            req = &requests[inst_req[r]];
+            solution->Assign[inst_req[r]].Channel = best_channel[r];
+            solution->Assign[inst_req[r]].Bus = (s == NO_SLOT) ? BUSALLOC_BUS_INTERNAL : slot_bus[s];
+            solution->Assign[inst_req[r]].MasterChannel = (s == NO_SLOT) ? BUSALLOC_NO_MASTER : slot_master[s];
+            /* The trailing edge has to stay in the period: OPWMCB spans both halves of it */
+            solution->Assign[inst_req[r]].PhaseShift = req->Phase;
+            solution->Assign[inst_req[r]].MaxDuty = (req->Count == BUSALLOC_CENTER_ALIGNED) ?
+                (uint16)((((2UL * req->Period) - 2UL) > MAX_DUTY) ? MAX_DUTY : ((2UL * req->Period) - 2UL)) :
+                (uint16)(req->Period - req->Phase);
+        }
+    }
+
+    return ret;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Place every request on a channel and a counter bus
+* @details      Per instance at most five buses and a handful of period classes, so the layouts
+*               are enumerated outright; each layout costs one bipartite matching of at most 24
+*               requests on 24 channels. Sync groups are then counted over all instances, a
+*               group spanning instances always being split.
+*/
+BusAlloc_ResultType BusAlloc_Solve(const BusAlloc_RequestType Requests[],
+                                   uint8 NumRequests,
+                                   BusAlloc_SolutionType * Solution,
+                                   uint8 * FailedRequest)
+{
+    BusAlloc_ResultType ret = BUSALLOC_OK;
+    const BusAlloc_AssignType *assign;
+    uint8 instance;
+    uint8 r;
+
+    *FailedRequest = BUSALLOC_NO_REQUEST;
+    Solution->NumBuses = 0U;
+    Solution->SplitGroups = 0U;
+    candidates = 0UL;
+    requests = Requests;
+    request_total = NumRequests;
+
+    if (NumRequests > BUSALLOC_MAX_REQUESTS) {
+        ret = BUSALLOC_BAD_REQUEST;
+        *FailedRequest = BUSALLOC_MAX_REQUESTS;
+    }
+    for (r = 0U; (r < NumRequests) && (ret == BUSALLOC_OK); r++) {
+        ret = CheckRequest(&Requests[r]);
+        if (ret != BUSALLOC_OK) {
+            *FailedRequest = r;
+        }
+    }
+    if (ret == BUSALLOC_OK) {
+        ret = CheckPhases(NumRequests, FailedRequest);
+    }
+
+    for (instance = 0U; (instance < BUSALLOC_INSTANCES) && (ret == BUSALLOC_OK); instance++) {
+        ret = SolveInstance(instance, Solution, FailedRequest);
+    }
+    Solution->Candidates = candidates;
+
+    if (ret == BUSALLOC_OK) {
+        for (r = 0U; r < NumRequests; r++) {
+            assign = &Solution->Assign[r];
+            split_group[r] = Requests[r].SyncGroup;
+            split_key[r] = (assign->MasterChannel == BUSALLOC_NO_MASTER) ? INTERNAL_KEY(r) :
+                           (uint16)(((uint16)Requests[r].Instance << 8U) | assign->MasterChannel);
+        }
+        Solution->SplitGroups = CountSplits(NumRequests);
+    }
+
+    return ret;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,389 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Mcl.h"
+#include "Clock_Ip.h"
+#include "Emios_Mcl_Ip.h"
+#include "ClockGov.h"
+#include "Timestamp.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* Governor runtime state */
+typedef struct {
+    const ClockGov_ConfigType *config;  /* Active configuration */
+    ClockGov_ModeType mode;             /* Active operating point */
+    ClockGov_StatsType stats;           /* Accumulated statistics */
+} ClockGovState_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define PPM_SCALE         (1000000U)  /* Parts per million */
+
+/* The +-1 tick quantisation of a measurement may use at most a quarter of the error bound */
+#define QUANT_MARGIN      (4U)
+
+/* Upper limit of MeasureTicks, keeps one measurement below a few milliseconds */
+#define MAX_MEASURE_TICKS (0x100000U)
+
+/* Counter bus period limit (16-bit A register) */
+#define MAX_BUS_PERIOD    (0xFFFFU)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static ClockGovState_t gov_state;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static boolean ValidateConfig(const ClockGov_ConfigType *cfg);
+static uint32 MeasureErrorPpm(const ClockGov_DomainType *domain, uint32 measure_ticks);
+static boolean CheckDomains(uint32 measure_ticks);
+static boolean WaitWrap(const ClockGov_DomainType *domain);
+static void SwitchTo(ClockGov_ModeType mode);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Check a configuration before it is used
+* @details      Both clock settings must come with a PCFS ramp, every domain needs a nominal
+*               clock and compensated domains need the alternate prescaler configuration. A
+*               MeasureTicks of 0 leaves the measurement out of the switches.
+*/
+static boolean ValidateConfig(const ClockGov_ConfigType *cfg)
+{
+    boolean valid = FALSE;
+    uint8 i;
+
+    if ((cfg != NULL_PTR) && (cfg->RunClock != NULL_PTR) && (cfg->IdleClock != NULL_PTR) &&
+        (cfg->RunClock->PcfsCount != 0U) && (cfg->IdleClock->PcfsCount != 0U) &&
+        ((cfg->Domains != NULL_PTR) || (cfg->NumDomains == 0U)) &&
+        (cfg->NumDomains <= CLOCKGOV_MAX_DOMAINS) &&
+        (cfg->MaxPeriodErrorPpm != 0U) && (cfg->MeasureTicks <= MAX_MEASURE_TICKS) &&
+        ((cfg->MeasureTicks == 0U) ||
+         (((uint64)cfg->MeasureTicks * cfg->MaxPeriodErrorPpm) >= ((uint64)QUANT_MARGIN * PPM_SCALE)))) {
+        valid = TRUE;
+        for (i = 0U; i < cfg->NumDomains; i++) {
+            if ((cfg->Domains[i].NominalCounterHz == 0U) ||
+                ((cfg->Domains[i].Policy == CLOCKGOV_DOMAIN_COMPENSATED) && (cfg->EmiosConfig == NULL_PTR))) {
+                valid = FALSE;
+            }
+        }
+    }
+
+    return valid;
+}
+
+/**
+* @brief        Measured PWM period error of one domain
+* @details      Counts MeasureTicks ticks of the domain master bus, wrapping at the bus period, and
+*               times them with the core cycle counter. The core frequency is read back from the
+*               clock tree by Timestamp_UpdateFrequency after every switch. Period error equals
+*               frequency error for small deviations.
+*/
+static uint32 MeasureErrorPpm(const ClockGov_DomainType *domain, uint32 measure_ticks)
+{
+    uint32 period = (uint32)Emios_Mcl_Ip_GetCounterBusPeriod(domain->EmiosInstance, domain->BusChannel);
+    uint32 prev = (uint32)Emios_Mcl_Ip_GetCounterValue(domain->EmiosInstance, domain->BusChannel);
+    Timestamp_CyclesType start = Timestamp_Get();
+    Timestamp_CyclesType timeout;
+    Timestamp_CyclesType cycles = 0U;
+    uint32 ticks = 0U;
+    uint32 now;
+    uint64 counter_hz;
+    uint64 delta;
+    uint32 error_ppm = 0xFFFFFFFFUL;
+
+    /* A stopped or far too slow bus ends the measurement after twice the nominal time */
+    timeout = (((uint64)measure_ticks * Timestamp_GetFrequency()) / domain->NominalCounterHz) * 2U;
+
+    while ((ticks < measure_ticks) && (cycles <= timeout) && (period != 0U)) {
+        now = (uint32)Emios_Mcl_Ip_GetCounterValue(domain->EmiosInstance, domain->BusChannel);
+        /* MCB up counting runs 1 .. period, then restarts at 1 */
+        ticks += (now >= prev) ? (now - prev) : ((period - prev) + now);
+        prev = now;
+        cycles = Timestamp_Get() - start;
+    }
+
+    if ((ticks >= measure_ticks) && (cycles != 0U)) {
+        counter_hz = ((uint64)ticks * Timestamp_GetFrequency()) / cycles;
+        delta = (counter_hz > domain->NominalCounterHz) ? (counter_hz - domain->NominalCounterHz)
+                                                        : (domain->NominalCounterHz - counter_hz);
+        delta = (delta * PPM_SCALE) / domain->NominalCounterHz;
+        error_ppm = (delta < 0xFFFFFFFFUL) ? (uint32)delta : 0xFFFFFFFFUL;
+    }
+
+    return error_ppm;
+}
+
+/**
+* @brief        Measure every domain against the configured bound
+* @details      Updates worst-case error and violation statistics
+*/
+static boolean CheckDomains(uint32 measure_ticks)
+{
+    const ClockGov_ConfigType *cfg = gov_state.config;
+    boolean in_bound = TRUE;
+    uint32 error_ppm;
+    uint8 i;
+
+    for (i = 0U; i < cfg->NumDomains; i++) {
+        error_ppm = MeasureErrorPpm(&cfg->Domains[i], measure_ticks);
+        if (error_ppm > gov_state.stats.MaxPeriodErrorPpm) {
+            gov_state.stats.MaxPeriodErrorPpm = error_ppm;
+        }
+        if (error_ppm > cfg->MaxPeriodErrorPpm) {
+            in_bound = FALSE;
+        }
+    }
+
+    if (in_bound == FALSE) {
+        gov_state.stats.BoundViolations++;
+    }
+
+    return in_bound;
+}
+
+/**
+* @brief        Wait for the next period boundary of a domain master bus
+* @return       FALSE if the bus did not wrap within twice its nominal period
+*/
+static boolean WaitWrap(const ClockGov_DomainType *domain)
+{
+    uint32 period = (uint32)Emios_Mcl_Ip_GetCounterBusPeriod(domain->EmiosInstance, domain->BusChannel);
+    uint32 prev = (uint32)Emios_Mcl_Ip_GetCounterValue(domain->EmiosInstance, domain->BusChannel);
+    uint32 now = prev;
+    Timestamp_CyclesType start = Timestamp_Get();
+    Timestamp_CyclesType timeout = (((uint64)period * Timestamp_GetFrequency()) / domain->NominalCounterHz) * 2U;
+
+    /* MCB up counting runs 1 .. period, then restarts at 1 */
+    while ((now >= prev) && ((Timestamp_Get() - start) <= timeout)) {
+        prev = now;
+        now = (uint32)Emios_Mcl_Ip_GetCounterValue(domain->EmiosInstance, domain->BusChannel);
+    }
+
+    return (now < prev) ? TRUE : FALSE;
+}
+
+/**
+* @brief        Switch core clock and counter bus prescalers together
+* @details      The eMIOS counts on the core clock, so a PCFS ramp moves every counter bus with
+*               it. The switch starts right after a period boundary of the first compensated
+*               domain and keeps the alternate prescaler, the one of the slow clock, during the
+*               ramp in both directions: the buses then only run fast and the period in which
+*               the switch lands only gains ticks. The gain is the ticks counted in the switch,
+*               its core cycles over the alternate prescaler, less the nominal ticks of its
+*               duration, its core cycles over the mean of both core frequencies (PCFS moves the
+*               frequency evenly). That one period of every compensated bus is lengthened by
+*               the gain, so it ends on time, and restored after its boundary. Busy-waits up to
+*               two periods of the first compensated domain.
+*/
+static void SwitchTo(ClockGov_ModeType mode)
+{
+    const ClockGov_ConfigType *cfg = gov_state.config;
+    const ClockGov_DomainType *domain;
+    uint32 period[CLOCKGOV_MAX_DOMAINS];
+    uint32 from_hz = Timestamp_GetFrequency();
+    uint32 to_hz;
+    uint64 mean_hz;
+    uint64 counted;
+    uint64 nominal;
+    uint32 gain;
+    Timestamp_CyclesType start;
+    Timestamp_CyclesType cycles;
+    boolean aligned = FALSE;
+    uint8 i;
+
+    for (i = 0U; i < cfg->NumDomains; i++) {
+        domain = &cfg->Domains[i];
+        period[i] = (uint32)Emios_Mcl_Ip_GetCounterBusPeriod(domain->EmiosInstance, domain->BusChannel);
+        if ((domain->Policy == CLOCKGOV_DOMAIN_COMPENSATED) && (aligned == FALSE)) {
+            aligned = WaitWrap(domain);
+        }
+    }
+
+    start = Timestamp_Get();
+    if (mode == CLOCKGOV_MODE_IDLE) {
+        if (cfg->EmiosConfig != NULL_PTR) {
+            Mcl_Emios_SetClockMode(cfg->EmiosConfig, MCL_EMIOS_ALTERNATIVE_PRESCALER);
+        }
+        Clock_Ip_InitClock(cfg->IdleClock);
+        cycles = Timestamp_Get() - start;
+    } else {
+        Clock_Ip_InitClock(cfg->RunClock);
+        cycles = Timestamp_Get() - start;
+        if (cfg->EmiosConfig != NULL_PTR) {
+            Mcl_Emios_SetClockMode(cfg->EmiosConfig, MCL_EMIOS_PRESCALER);
+        }
+    }
+
+    Timestamp_UpdateFrequency();
+    to_hz = Timestamp_GetFrequency();
+
+    if (aligned == TRUE) {
+        mean_hz = ((uint64)from_hz + to_hz) / 2U;
+        for (i = 0U; i < cfg->NumDomains; i++) {
+            domain = &cfg->Domains[i];
+            if (domain->Policy == CLOCKGOV_DOMAIN_COMPENSATED) {
+                /* Both in ticks times the mean frequency, the gain rounded to the nearest tick */
+                counted = (cycles * mean_hz) / cfg->EmiosConfig->AltPrescaler;
+                nominal = cycles * domain->NominalCounterHz;
+                gain = (counted > nominal) ? (uint32)(((counted - nominal) + (mean_hz / 2U)) / mean_hz) : 0U;
+                if ((gain != 0U) && ((period[i] + gain) <= MAX_BUS_PERIOD)) {
+                    (void)Emios_Mcl_Ip_SetCounterBusPeriod(domain->EmiosInstance, domain->BusChannel,
+                                                           period[i] + gain);
+                }
+            }
+        }
+        for (i = 0U; i < cfg->NumDomains; i++) {
+            domain = &cfg->Domains[i];
+            if (domain->Policy == CLOCKGOV_DOMAIN_COMPENSATED) {
+                (void)WaitWrap(domain);
+                (void)Emios_Mcl_Ip_SetCounterBusPeriod(domain->EmiosInstance, domain->BusChannel, period[i]);
+            }
+        }
+    }
+
+    gov_state.mode = mode;
+    gov_state.stats.Transitions++;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Initialize the governor in run mode
+*/
+Std_ReturnType ClockGov_Init(const ClockGov_ConfigType * Config)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+
+    gov_state.config = NULL_PTR;
+    gov_state.mode = CLOCKGOV_MODE_RUN;
+    gov_state.stats.Transitions = 0U;
+    gov_state.stats.MaxPeriodErrorPpm = 0U;
+    gov_state.stats.BoundViolations = 0U;
+    gov_state.stats.IdleInhibited = TRUE;
+
+    if (ValidateConfig(Config) == TRUE) {
+        gov_state.config = Config;
+        gov_state.stats.IdleInhibited = FALSE;
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Downclock the core once the frame computation is finished
+* @details      If any domain leaves the configured period error bound the run clock is
+*               restored immediately and idle mode stays inhibited
+*/
+Std_ReturnType ClockGov_EnterIdle(void)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+
+    if ((gov_state.mode == CLOCKGOV_MODE_RUN) && (gov_state.stats.IdleInhibited == FALSE)) {
+        SwitchTo(CLOCKGOV_MODE_IDLE);
+        if ((gov_state.config->MeasureTicks == 0U) || (CheckDomains(gov_state.config->MeasureTicks) == TRUE)) {
+            ret = (Std_ReturnType)E_OK;
+        } else {
+            gov_state.stats.IdleInhibited = TRUE;
+            SwitchTo(CLOCKGOV_MODE_RUN);
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Ramp the core back to full speed before the next frame
+*/
+Std_ReturnType ClockGov_EnterRun(void)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_OK;
+
+    if (gov_state.mode == CLOCKGOV_MODE_IDLE) {
+        SwitchTo(CLOCKGOV_MODE_RUN);
+        if ((gov_state.config->MeasureTicks != 0U) && (CheckDomains(gov_state.config->MeasureTicks) == FALSE)) {
+            ret = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Measure the period error of every domain now
+* @details      For configurations with MeasureTicks 0, outside the switches. Out of bound in
+*               idle mode, the run clock is restored and idle mode stays inhibited, as after a
+*               switch.
+*/
+Std_ReturnType ClockGov_CheckPeriods(uint32 MeasureTicks)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+
+    if ((gov_state.config != NULL_PTR) && (MeasureTicks <= MAX_MEASURE_TICKS) &&
+        (((uint64)MeasureTicks * gov_state.config->MaxPeriodErrorPpm) >= ((uint64)QUANT_MARGIN * PPM_SCALE))) {
+        if (CheckDomains(MeasureTicks) == TRUE) {
+            ret = (Std_ReturnType)E_OK;
+        } else if (gov_state.mode == CLOCKGOV_MODE_IDLE) {
+            gov_state.stats.IdleInhibited = TRUE;
+            SwitchTo(CLOCKGOV_MODE_RUN);
+        } else {
+            /* Reported, run mode kept */
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Return the active operating point
+*/
+ClockGov_ModeType ClockGov_GetMode(void)
+{
+    return gov_state.mode;
+}
+
+/**
+* @brief        Copy the governor statistics
+*/
+void ClockGov_GetStatistics(ClockGov_StatsType * Stats)
+{
+    *Stats = gov_state.stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
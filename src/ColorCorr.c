@@ -0,0 +1,146 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+#include "ColorCorr.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define Q15_SHIFT         (15)
+#define Q15_HALF          (1L << (Q15_SHIFT - 1))   /* Rounds the result to nearest */
+
+/*
+* Three Q15 products of up to 2^30 each and the offset of up to 2^30 need 33 bits, so the
+* accumulator is 64-bit. Shifted down by 15 it fits 32 bits again for the saturation.
+*/
+#if defined(__ARM_FEATURE_DSP)
+/* SMLALD: acc + x.lo * y.lo + x.hi * y.hi in 64 bits, USAT: clamp to 0 ... 2^15 - 1 */
+#define DUAL_MAC(x, y, acc)     ((sint64)__smlald((sint32)(x), (sint32)(y), (acc)))
+#define SATURATE(acc)           ((uint16)__usat((sint32)((acc) >> Q15_SHIFT), Q15_SHIFT))
+#else
+#define DUAL_MAC(x, y, acc)     DualMac((x), (y), (acc))
+#define SATURATE(acc)           Saturate(acc)
+#endif
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+#if !defined(__ARM_FEATURE_DSP)
+static inline sint64 DualMac(uint32 x, uint32 y, sint64 acc);
+static inline uint16 Saturate(sint64 acc);
+#endif
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+#if !defined(__ARM_FEATURE_DSP)
+/**
+* @brief        Portable equivalent of SMLALD
+*/
+static inline sint64 DualMac(uint32 x, uint32 y, sint64 acc)
+{
+    sint32 lo = (sint32)(sint16)(x & 0xFFFFU) * (sint32)(sint16)(y & 0xFFFFU);
+    sint32 hi = (sint32)(sint16)(x >> 16U) * (sint32)(sint16)(y >> 16U);
+
+    return acc + (sint64)lo + (sint64)hi;
+}
+
+/**
+* @brief        Portable equivalent of USAT #15 on the Q15 result
+*/
+static inline uint16 Saturate(sint64 acc)
+{
+    sint64 value = acc / (1L << Q15_SHIFT);
+
+    if (acc < 0) {
+        value = 0;
+    } else if (value > (sint64)COLORCORR_MAX_VALUE) {
+        value = (sint64)COLORCORR_MAX_VALUE;
+    } else {
+        /* In range */
+    }
+
+    return (uint16)value;
+}
+#endif
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Pack a matrix for ColorCorr_Apply
+*/
+void ColorCorr_Compile(const ColorCorr_MatrixType * Matrix, ColorCorr_CompiledType * Compiled)
+{
+    uint8 i;
+
+    for (i = 0U; i < 3U; i++) {
+        Compiled->RowRG[i] = (uint32)(uint16)Matrix->Coeff[i][0] |
+                             ((uint32)(uint16)Matrix->Coeff[i][1] << 16U);
+        Compiled->RowB[i] = Matrix->Coeff[i][2];
+        Compiled->Offset[i] = ((sint32)Matrix->Offset[i] * (1L << Q15_SHIFT)) + Q15_HALF;
+    }
+}
+
+/**
+* @brief        Correct a batch of pixels
+* @details      Per output channel: one multiply for B, one dual multiply-accumulate for R and
+*               G, one saturation. R and G are combined into the halfword pair SMLALD expects.
+*/
+void ColorCorr_Apply(const ColorCorr_CompiledType * Compiled,
+                     const ColorCorr_PixelType In[],
+                     ColorCorr_PixelType Out[],
+                     uint32 Count)
+{
+    uint32 rg;
+    sint32 b;
+    sint64 acc_r;
+    sint64 acc_g;
+    sint64 acc_b;
+    uint32 i;
+
+    for (i = 0U; i < Count; i++) {
+        rg = (uint32)In[i].R | ((uint32)In[i].G << 16U);
+        b = (sint32)In[i].B;
+
+        acc_r = DUAL_MAC(rg, Compiled->RowRG[0], (sint64)Compiled->Offset[0] + (Compiled->RowB[0] * b));
+        acc_g = DUAL_MAC(rg, Compiled->RowRG[1], (sint64)Compiled->Offset[1] + (Compiled->RowB[1] * b));
+        acc_b = DUAL_MAC(rg, Compiled->RowRG[2], (sint64)Compiled->Offset[2] + (Compiled->RowB[2] * b));
+
+        Out[i].R = SATURATE(acc_r);
+        Out[i].G = SATURATE(acc_g);
+        Out[i].B = SATURATE(acc_b);
+        Out[i].Pad = 0U;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,242 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "TimerWheel.h"
+#include "Timestamp.h"
+#include "Coro.h"
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* FIFO of ready tasks */
+static Coro_TaskType *ready_head;
+static Coro_TaskType *ready_tail;
+static uint32 ready_count;
+
+/* Tasks suspended in CORO_WAIT_EVENT */
+static Coro_TaskType *wait_head;
+
+/* Raised from any context, consumed by the scheduler */
+static volatile uint32 pending_events;
+
+static Coro_StatsType coro_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static void Enqueue(Coro_TaskType *task);
+static Coro_TaskType *Dequeue(void);
+static void WakeTask(void *context);
+static void DispatchEvents(void);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Append a task to the ready queue
+*/
+static void Enqueue(Coro_TaskType *task)
+{
+    task->State = (uint8)CORO_STATE_READY;
+    task->Next = NULL_PTR;
+
+    if (ready_tail == NULL_PTR) {
+        ready_head = task;
+    } else {
+        ready_tail->Next = task;
+    }
+    ready_tail = task;
+    ready_count++;
+}
+
+/**
+* @brief        Take the first task of the ready queue
+*/
+static Coro_TaskType *Dequeue(void)
+{
+    Coro_TaskType *task = ready_head;
+
+    ready_head = task->Next;
+    if (ready_head == NULL_PTR) {
+        ready_tail = NULL_PTR;
+    }
+    ready_count--;
+
+    return task;
+}
+
+/**
+* @brief        Timer wheel callback ending a CORO_SLEEP
+*/
+static void WakeTask(void *context)
+{
+    Enqueue((Coro_TaskType *)context);
+}
+
+/**
+* @brief        Move the tasks waiting for a raised event to the ready queue
+*/
+static void DispatchEvents(void)
+{
+    uint32 events = __atomic_exchange_n(&pending_events, 0U, __ATOMIC_RELAXED);
+    Coro_TaskType **link = &wait_head;
+    Coro_TaskType *task;
+
+    while ((events != 0U) && (*link != NULL_PTR)) {
+        task = *link;
+        if ((task->Events & events) != 0U) {
+            *link = task->Next;
+            task->Events &= events;
+            Enqueue(task);
+        } else {
+            link = &task->Next;
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Empty the run queue
+*/
+void Coro_Init(void)
+{
+    ready_head = NULL_PTR;
+    ready_tail = NULL_PTR;
+    ready_count = 0U;
+    wait_head = NULL_PTR;
+    pending_events = 0U;
+
+    coro_stats.Switches = 0U;
+    coro_stats.SchedulerCycles = 0U;
+}
+
+/**
+* @brief        Put a task on the run queue
+*/
+void Coro_Start(Coro_TaskType * Task, Coro_FunctionType Function, void * Context)
+{
+    Task->Function = Function;
+    Task->Context = Context;
+    Task->Events = 0U;
+    Task->Cycles = 0U;
+    Task->Steps = 0U;
+    Task->Resume = 0U;
+    Enqueue(Task);
+}
+
+/**
+* @brief        One scheduler pass
+* @details      Tasks yielding during the pass are queued behind the ones already ready,
+*               so every ready task runs once per pass. Time spent in timer wheel callbacks
+*               is counted as scheduler time.
+*/
+uint32 Coro_Schedule(void)
+{
+    Timestamp_CyclesType pass_start = Timestamp_Get();
+    Timestamp_CyclesType step_start;
+    uint32 task_cycles = 0U;
+    uint32 step_cycles;
+    Coro_TaskType *task;
+    Coro_StatusType status;
+    uint32 steps;
+    uint32 i;
+
+    (void)TimerWheel_Process();
+    DispatchEvents();
+
+    steps = ready_count;
+    for (i = 0U; i < steps; i++) {
+        task = Dequeue();
+
+        step_start = Timestamp_Get();
+        status = task->Function(task, task->Context);
+        step_cycles = (uint32)(Timestamp_Get() - step_start);
+
+        task->Cycles += step_cycles;
+        task->Steps++;
+        task_cycles += step_cycles;
+
+        if (status == CORO_ENDED) {
+            task->State = (uint8)CORO_STATE_DONE;
+        } else if ((status == CORO_YIELDED) || (task->State == (uint8)CORO_STATE_READY)) {
+            /* Yielded, or a sleep whose timer could not be started */
+            Enqueue(task);
+        } else {
+            /* Held by the timer wheel or the wait list */
+        }
+    }
+
+    coro_stats.Switches += steps;
+    coro_stats.SchedulerCycles += (uint32)(Timestamp_Get() - pass_start) - task_cycles;
+
+    return steps;
+}
+
+/**
+* @brief        Raise events
+*/
+void Coro_Signal(uint32 Events)
+{
+    (void)__atomic_fetch_or(&pending_events, Events, __ATOMIC_RELAXED);
+}
+
+/**
+* @brief        Arm the wake-up timer of a task
+* @details      If the timer pool is empty the task stays ready and the sleep degrades to a yield
+*/
+void Coro_Sleep(Coro_TaskType * Task, uint32 Ticks)
+{
+    if (TimerWheel_Start(Ticks, 0U, WakeTask, Task) != TIMERWHEEL_NO_TIMER) {
+        Task->State = (uint8)CORO_STATE_SLEEPING;
+    }
+}
+
+/**
+* @brief        Park a task on the event wait list
+*/
+void Coro_Wait(Coro_TaskType * Task, uint32 Events)
+{
+    Task->Events = Events;
+    Task->State = (uint8)CORO_STATE_WAITING;
+    Task->Next = wait_head;
+    wait_head = Task;
+}
+
+/**
+* @brief        Copy the scheduler statistics
+*/
+void Coro_GetStatistics(Coro_StatsType * Stats)
+{
+    *Stats = coro_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,282 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "DmaPool.h"
+#include "DmaChain.h"
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Fetched by the eDMA: taken from the DmaPool SRAM arena, which gives the 32-byte alignment the
+   scatter/gather address needs, and cleaned to memory after every update */
+static Dma_Ip_SwTcdRegType *chain_tcds;
+
+/* Per descriptor: next free descriptor while free, next chain element while allocated */
+static uint8 chain_next[DMACHAIN_MAX_DESCRIPTORS];
+static uint8 free_head;
+
+static DmaChain_StatsType chain_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static uint8 AllocDescriptor(void);
+static void FreeDescriptor(uint8 desc);
+static uint8 DescriptorAt(const DmaChain_ChainType *chain, uint8 index);
+static void Publish(uint8 desc);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Take a descriptor from the free list
+*/
+static uint8 AllocDescriptor(void)
+{
+    uint8 desc = free_head;
+
+    if (desc != DMACHAIN_NO_DESCRIPTOR) {
+        free_head = chain_next[desc];
+        chain_next[desc] = DMACHAIN_NO_DESCRIPTOR;
+
+        chain_stats.Allocs++;
+        chain_stats.InUse++;
+        if (chain_stats.InUse > chain_stats.PeakInUse) {
+            chain_stats.PeakInUse = chain_stats.InUse;
+        }
+    } else {
+        chain_stats.Failures++;
+    }
+
+    return desc;
+}
+
+/**
+* @brief        Put a descriptor back on the free list
+*/
+static void FreeDescriptor(uint8 desc)
+{
+    chain_next[desc] = free_head;
+    free_head = desc;
+
+    chain_stats.Frees++;
+    chain_stats.InUse--;
+}
+
+/**
+* @brief        Arena descriptor at a position of the chain
+*/
+static uint8 DescriptorAt(const DmaChain_ChainType *chain, uint8 index)
+{
+    uint8 desc = DMACHAIN_NO_DESCRIPTOR;
+    uint8 i;
+
+    if (index < chain->Count) {
+        desc = chain->Head;
+        for (i = 0U; i < index; i++) {
+            desc = chain_next[desc];
+        }
+    }
+
+    return desc;
+}
+
+/**
+* @brief        Make a descriptor written by the CPU visible to the eDMA
+*/
+static void Publish(uint8 desc)
+{
+    DmaPool_PrepareTx(&chain_tcds[desc], (uint32)sizeof(Dma_Ip_SwTcdRegType));
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Put every descriptor of the arena on the free list
+*/
+Std_ReturnType DmaChain_Init(void)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint8 i;
+
+    /* The arena is allocated once and kept across re-initialisations */
+    if (chain_tcds == NULL_PTR) {
+        chain_tcds = (Dma_Ip_SwTcdRegType *)DmaPool_Alloc(DMACHAIN_MAX_DESCRIPTORS * (uint32)sizeof(Dma_Ip_SwTcdRegType),
+                                                          DMAPOOL_REGION_SRAM);
+    }
+
+    if (chain_tcds != NULL_PTR) {
+        for (i = 0U; i < (DMACHAIN_MAX_DESCRIPTORS - 1U); i++) {
+            chain_next[i] = i + 1U;
+        }
+        chain_next[DMACHAIN_MAX_DESCRIPTORS - 1U] = DMACHAIN_NO_DESCRIPTOR;
+        free_head = 0U;
+        ret = (Std_ReturnType)E_OK;
+    } else {
+        /* No descriptors: every append fails */
+        free_head = DMACHAIN_NO_DESCRIPTOR;
+    }
+
+    chain_stats.Allocs = 0U;
+    chain_stats.Frees = 0U;
+    chain_stats.Failures = 0U;
+    chain_stats.InUse = 0U;
+    chain_stats.PeakInUse = 0U;
+
+    return ret;
+}
+
+/**
+* @brief        Prepare an empty chain for a logic channel
+*/
+void DmaChain_Create(DmaChain_ChainType * Chain, uint32 LogicCh)
+{
+    Chain->LogicCh = LogicCh;
+    Chain->Head = DMACHAIN_NO_DESCRIPTOR;
+    Chain->Tail = DMACHAIN_NO_DESCRIPTOR;
+    Chain->Count = 0U;
+    Chain->Ring = FALSE;
+}
+
+/**
+* @brief        Compile a transfer list into a new descriptor at the end of the chain
+* @details      The previous tail gets linked to the new descriptor, which ends the chain
+*/
+uint8 DmaChain_Append(DmaChain_ChainType * Chain,
+                      const Dma_Ip_LogicChannelTransferListType List[],
+                      uint32 ListDimension)
+{
+    uint8 index = DMACHAIN_NO_DESCRIPTOR;
+    uint8 desc;
+
+    if (Chain->Ring == FALSE) {
+        desc = AllocDescriptor();
+        if (desc != DMACHAIN_NO_DESCRIPTOR) {
+            (void)Dma_Ip_CompileLogicChannelTransferList(Chain->LogicCh, List, ListDimension, &chain_tcds[desc]);
+            Publish(desc);
+
+            if (Chain->Count == 0U) {
+                Chain->Head = desc;
+            } else {
+                chain_next[Chain->Tail] = desc;
+                (void)Dma_Ip_LinkTcdImage(Chain->LogicCh, &chain_tcds[Chain->Tail], &chain_tcds[desc]);
+                Publish(Chain->Tail);
+            }
+
+            Chain->Tail = desc;
+            index = Chain->Count;
+            Chain->Count++;
+        }
+    }
+
+    return index;
+}
+
+/**
+* @brief        Link the last descriptor back to the first one
+*/
+Std_ReturnType DmaChain_Close(DmaChain_ChainType * Chain)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+
+    if ((Chain->Count > 0U) && (Chain->Ring == FALSE)) {
+        (void)Dma_Ip_LinkTcdImage(Chain->LogicCh, &chain_tcds[Chain->Tail], &chain_tcds[Chain->Head]);
+        Publish(Chain->Tail);
+        Chain->Ring = TRUE;
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Change the buffers of one descriptor of the chain
+* @details      SADDR/DADDR hold plain addresses, so the image is patched in place
+*               without recompiling the transfer list
+*/
+Std_ReturnType DmaChain_Rearm(const DmaChain_ChainType * Chain, uint8 Index, uint32 SrcAddr, uint32 DstAddr)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint8 desc = DescriptorAt(Chain, Index);
+
+    if (desc != DMACHAIN_NO_DESCRIPTOR) {
+        chain_tcds[desc].reg_SADDR = SrcAddr;
+        chain_tcds[desc].reg_DADDR = DstAddr;
+        Publish(desc);
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Load the first descriptor into the channel
+*/
+Dma_Ip_ReturnType DmaChain_Start(const DmaChain_ChainType * Chain)
+{
+    Dma_Ip_ReturnType ret = DMA_IP_STATUS_ERROR;
+
+    if (Chain->Count > 0U) {
+        ret = Dma_Ip_LoadLogicChannelTcdImage(Chain->LogicCh, &chain_tcds[Chain->Head]);
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Return the descriptors of a chain to the arena
+*/
+void DmaChain_Release(DmaChain_ChainType * Chain)
+{
+    uint8 desc = Chain->Head;
+    uint8 next;
+    uint8 i;
+
+    /* Walk by count, a ring has no terminating descriptor */
+    for (i = 0U; i < Chain->Count; i++) {
+        next = chain_next[desc];
+        FreeDescriptor(desc);
+        desc = next;
+    }
+
+    DmaChain_Create(Chain, Chain->LogicCh);
+}
+
+/**
+* @brief        Copy the arena statistics
+*/
+void DmaChain_GetStatistics(DmaChain_StatsType * Stats)
+{
+    *Stats = chain_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
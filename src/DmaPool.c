@@ -0,0 +1,306 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Mcl.h"
+#include "DmaPool.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* One arena of cache-line granules */
+typedef struct {
+    uint8 *base;        /* First granule */
+    uint8 *runs;        /* Per granule: run length at a run start, RUN_CONT inside a run, 0 if free */
+    uint16 granules;    /* Number of granules */
+} DmaArena_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define SRAM_GRANULES     (DMAPOOL_SRAM_SIZE / DMAPOOL_CACHE_LINE)
+#define DTCM_GRANULES     (DMAPOOL_DTCM_SIZE / DMAPOOL_CACHE_LINE)
+#define RUN_CONT          (0xFFU)     /* Granule belongs to a run started earlier */
+#define MAX_RUN           (0xFEU)     /* Longest run representable in one byte */
+
+/* Address windows that are never held in the data cache */
+#define DTCM_START        (0x20000000U)
+#define DTCM_END          (0x20020000U)
+#define NO_CACHE_START    (0x20430000U)
+#define NO_CACHE_END      (0x20440000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint8 sram_arena[DMAPOOL_SRAM_SIZE] __attribute__((aligned(DMAPOOL_CACHE_LINE)));
+static uint8 dtcm_arena[DMAPOOL_DTCM_SIZE] __attribute__((aligned(DMAPOOL_CACHE_LINE), section(".dtcm_bss")));
+static uint8 sram_runs[SRAM_GRANULES];
+static uint8 dtcm_runs[DTCM_GRANULES];
+
+static DmaArena_t arenas[2] = {
+    { sram_arena, sram_runs, (uint16)SRAM_GRANULES },   /* DMAPOOL_REGION_SRAM */
+    { dtcm_arena, dtcm_runs, (uint16)DTCM_GRANULES }    /* DMAPOOL_REGION_DTCM */
+};
+
+static DmaPool_StatsType pool_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static boolean IsCacheable(const void *buffer);
+static void CacheRange(uint32 addr, uint32 length, uint32 *start, uint32 *size);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Check whether a buffer may be held in the data cache
+* @details      The DTCM arena is checked by address of the array, so the decision does not
+*               depend on the linker placing it inside the DTCM window
+*/
+static boolean IsCacheable(const void *buffer)
+{
+    const uint8 *ptr = (const uint8 *)buffer;
+    uint32 addr = (uint32)buffer;
+    boolean cacheable = TRUE;
+
+    if ((ptr >= dtcm_arena) && (ptr < &dtcm_arena[DMAPOOL_DTCM_SIZE])) {
+        cacheable = FALSE;
+    } else if (((addr >= DTCM_START) && (addr < DTCM_END)) || ((addr >= NO_CACHE_START) && (addr < NO_CACHE_END))) {
+        cacheable = FALSE;
+    } else {
+        /* Cacheable SRAM or flash */
+    }
+
+    return cacheable;
+}
+
+/**
+* @brief        Widen a byte range to whole cache lines
+* @details      Pool buffers are already line aligned, foreign buffers get widened here
+*/
+static void CacheRange(uint32 addr, uint32 length, uint32 *start, uint32 *size)
+{
+    uint32 first = addr & ~(DMAPOOL_CACHE_LINE - 1U);
+    uint32 last = (addr + length + DMAPOOL_CACHE_LINE - 1U) & ~(DMAPOOL_CACHE_LINE - 1U);
+
+    *start = first;
+    *size = last - first;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Reset both arenas and the maintenance counters
+*/
+void DmaPool_Init(void)
+{
+    uint16 i;
+
+    for (i = 0U; i < SRAM_GRANULES; i++) {
+        sram_runs[i] = 0U;
+    }
+    for (i = 0U; i < DTCM_GRANULES; i++) {
+        dtcm_runs[i] = 0U;
+    }
+
+    pool_stats.CleanOps = 0U;
+    pool_stats.InvalidateOps = 0U;
+    pool_stats.SkippedOps = 0U;
+    pool_stats.CleanBytes = 0U;
+    pool_stats.InvalidateBytes = 0U;
+}
+
+/**
+* @brief        Allocate a cache-line aligned and padded DMA buffer
+* @details      First fit over the granule map; the size is rounded up to whole lines so
+*               no other data ever shares a cache line with a DMA buffer
+*/
+void * DmaPool_Alloc(uint32 Size, DmaPool_RegionType Region)
+{
+    const DmaArena_t *arena = &arenas[Region];
+    uint32 needed = (Size + DMAPOOL_CACHE_LINE - 1U) / DMAPOOL_CACHE_LINE;
+    void *buffer = NULL_PTR;
+    uint16 start = 0U;
+    uint16 free_run = 0U;
+    uint16 i;
+
+    if ((needed > 0U) && (needed <= MAX_RUN)) {
+        for (i = 0U; i < arena->granules; i++) {
+            if (arena->runs[i] == 0U) {
+                if (free_run == 0U) {
+                    start = i;
+                }
+                free_run++;
+                if (free_run == needed) {
+                    break;
+                }
+            } else {
+                free_run = 0U;
+            }
+        }
+
+        if (free_run == needed) {
+            arena->runs[start] = (uint8)needed;
+            for (i = start + 1U; i < (start + needed); i++) {
+                arena->runs[i] = RUN_CONT;
+            }
+            buffer = &arena->base[(uint32)start * DMAPOOL_CACHE_LINE];
+        }
+    }
+
+    return buffer;
+}
+
+/**
+* @brief        Return a buffer obtained from DmaPool_Alloc
+* @details      Pointers not owned by the pool or not at the start of a buffer are ignored
+*/
+void DmaPool_Free(void * Buffer)
+{
+    const uint8 *ptr = (const uint8 *)Buffer;
+    const DmaArena_t *arena;
+    uint32 granule;
+    uint32 length;
+    uint32 i;
+    uint8 region;
+
+    for (region = 0U; region < 2U; region++) {
+        arena = &arenas[region];
+        if ((ptr >= arena->base) && (ptr < &arena->base[(uint32)arena->granules * DMAPOOL_CACHE_LINE])) {
+            granule = (uint32)(ptr - arena->base) / DMAPOOL_CACHE_LINE;
+            length = arena->runs[granule];
+            if ((((uint32)(ptr - arena->base) % DMAPOOL_CACHE_LINE) == 0U) && (length != 0U) && (length != RUN_CONT)) {
+                for (i = granule; i < (granule + length); i++) {
+                    arena->runs[i] = 0U;
+                }
+            }
+        }
+    }
+}
+
+/**
+* @brief        Address to program into a TCD for a pool buffer
+*/
+uint32 DmaPool_GetDmaAddress(const void * Buffer)
+{
+    const uint8 *ptr = (const uint8 *)Buffer;
+    uint32 addr = (uint32)Buffer;
+
+    if (((ptr >= dtcm_arena) && (ptr < &dtcm_arena[DMAPOOL_DTCM_SIZE])) || ((addr >= DTCM_START) && (addr < DTCM_END))) {
+        addr += DMAPOOL_DTCM_BACKDOOR_OFFSET;
+    }
+
+    return addr;
+}
+
+/**
+* @brief        Make CPU writes to a source buffer visible to the eDMA
+*/
+void DmaPool_PrepareTx(const void * Buffer, uint32 Length)
+{
+    uint32 start;
+    uint32 size;
+
+    if (IsCacheable(Buffer) == TRUE) {
+        CacheRange((uint32)Buffer, Length, &start, &size);
+        Mcl_CacheCleanByAddr(MCL_CACHE_CORE, MCL_CACHE_DATA, FALSE, start, size);
+        pool_stats.CleanOps++;
+        pool_stats.CleanBytes += size;
+    } else {
+        pool_stats.SkippedOps++;
+    }
+}
+
+/**
+* @brief        Drop cached copies of a destination buffer before the eDMA writes it
+* @details      Clean with invalidate so a dirty line cannot be evicted over DMA data later
+*/
+void DmaPool_PrepareRx(void * Buffer, uint32 Length)
+{
+    uint32 start;
+    uint32 size;
+
+    if (IsCacheable(Buffer) == TRUE) {
+        CacheRange((uint32)Buffer, Length, &start, &size);
+        Mcl_CacheCleanByAddr(MCL_CACHE_CORE, MCL_CACHE_DATA, TRUE, start, size);
+        pool_stats.CleanOps++;
+        pool_stats.CleanBytes += size;
+    } else {
+        pool_stats.SkippedOps++;
+    }
+}
+
+/**
+* @brief        Drop lines speculatively refilled during the transfer, call after DONE
+*/
+void DmaPool_CompleteRx(void * Buffer, uint32 Length)
+{
+    uint32 start;
+    uint32 size;
+
+    if (IsCacheable(Buffer) == TRUE) {
+        CacheRange((uint32)Buffer, Length, &start, &size);
+        Mcl_CacheInvalidateByAddr(MCL_CACHE_CORE, MCL_CACHE_DATA, start, size);
+        pool_stats.InvalidateOps++;
+        pool_stats.InvalidateBytes += size;
+    } else {
+        pool_stats.SkippedOps++;
+    }
+}
+
+/**
+* @brief        Coherent variant of Mcl_SetDmaChannelCommand
+*/
+void DmaPool_SetDmaChannelCommand(uint32 Channel,
+                                  Mcl_DmaChannelCmdType Command,
+                                  const void * TxBuffer, uint32 TxLength,
+                                  void * RxBuffer, uint32 RxLength)
+{
+    if (TxBuffer != NULL_PTR) {
+        DmaPool_PrepareTx(TxBuffer, TxLength);
+    }
+    if (RxBuffer != NULL_PTR) {
+        DmaPool_PrepareRx(RxBuffer, RxLength);
+    }
+
+    Mcl_SetDmaChannelCommand(Channel, Command);
+}
+
+/**
+* @brief        Copy the cache maintenance counters
+*/
+void DmaPool_GetStatistics(DmaPool_StatsType * Stats)
+{
+    *Stats = pool_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
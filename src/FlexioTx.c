@@ -0,0 +1,97 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Flexio_Mcl_Ip.h"
+#include "FlexioTx.h"
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Dividers are split into two equal 8-bit half periods
+*/
+boolean FlexioTx_IsValidDivider(uint16 Div)
+{
+    return ((Div >= 2U) && (Div <= 512U) && ((Div & 1U) == 0U)) ? TRUE : FALSE;
+}
+
+/**
+* @brief        Initialise a FlexIO instance unless Mcl_Init did
+*/
+void FlexioTx_InitInstance(uint8 Instance)
+{
+    if (Flexio_Ip_baIpIsInitialized[Instance] == FALSE) {
+        const Flexio_Ip_InstanceConfigType flexio_init = { Instance, FALSE };
+
+        (void)Flexio_Mcl_Ip_InitDevice(&flexio_init);
+    }
+}
+
+/**
+* @brief        Program the shifter and its clock timer and enable the shifter DMA request
+* @details      The baud timer counts 2 * WordBits edges and disables on compare; the next
+*               buffer write restarts it through the shifter status trigger.
+*/
+uint32 FlexioTx_Configure(const FlexioTx_ConfigType * Config)
+{
+    FLEXIO_Type *base = Flexio_Ip_paxBase[Config->FlexioInstance];
+    uint16 half = (uint16)(Config->ClockDiv / 2U);
+    uint8 clock_pin = (Config->ClockPin == FLEXIOTX_NO_PIN) ? 0U : Config->ClockPin;
+    Flexio_Mcl_Ip_PinConfigType clock_cfg = (Config->ClockPin == FLEXIOTX_NO_PIN) ?
+                                            FLEXIO_PIN_CONFIG_DISABLED : FLEXIO_PIN_CONFIG_OUTPUT;
+
+    Flexio_Mcl_Ip_SetShifterConfig(base, Config->Shifter,
+                                   FLEXIO_SHIFTER_START_BIT_DISABLED,
+                                   FLEXIO_SHIFTER_STOP_BIT_DISABLED,
+                                   FLEXIO_SHIFTER_SOURCE_PIN);
+    Flexio_Mcl_Ip_SetShifterControl(base, Config->Shifter, FLEXIO_SHIFTER_MODE_TRANSMIT,
+                                    Config->DataPin, FLEXIO_PIN_POLARITY_HIGH, FLEXIO_PIN_CONFIG_OUTPUT,
+                                    Config->Timer, Config->ShiftEdge);
+
+    Flexio_Mcl_Ip_SetTimerCompare(base, Config->Timer,
+                                  (uint16)(((((uint32)Config->WordBits * 2U) - 1U) << 8U) | (half - 1U)));
+    Flexio_Mcl_Ip_SetTimerConfig(base, Config->Timer,
+                                 FLEXIO_TIMER_START_BIT_DISABLED,
+                                 FLEXIO_TIMER_STOP_BIT_DISABLED,
+                                 FLEXIO_TIMER_ENABLE_TRG_HIGH,
+                                 FLEXIO_TIMER_DISABLE_TIM_CMP,
+                                 FLEXIO_TIMER_RESET_NEVER,
+                                 FLEXIO_TIMER_DECREMENT_CLK_SHIFT_TMR,
+                                 FLEXIO_TIMER_INITOUT_ZERO);
+    Flexio_Mcl_Ip_SetTimerControl(base, Config->Timer, FLEXIOTX_SHIFTER_TRIGGER(Config->Shifter),
+                                  FLEXIO_TRIGGER_POLARITY_LOW, FLEXIO_TRIGGER_SOURCE_INTERNAL,
+                                  clock_pin, FLEXIO_PIN_POLARITY_HIGH, clock_cfg,
+                                  FLEXIO_TIMER_MODE_8BIT_BAUD);
+
+    Flexio_Mcl_Ip_SetShifterDMARequest(base, (uint8)(1U << Config->Shifter), TRUE);
+
+    return Flexio_Mcl_Ip_GetShifterBufferAddress(base, Config->Shifter, FLEXIO_SHIFTER_RW_MODE_BIT_SWAP);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,130 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "DmaPool.h"
+#include "FrameBuf.h"
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Allocate both buffers from the DmaPool SRAM region and fill them
+*/
+Std_ReturnType FrameBuf_Init(FrameBuf_Type * Frame, uint32 Bytes, uint32 Fill)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint32 i;
+
+    /* The size may differ from the previous initialisation */
+    DmaPool_Free(Frame->Buffer[0]);
+    DmaPool_Free(Frame->Buffer[1]);
+    Frame->Buffer[0] = (uint32 *)DmaPool_Alloc(Bytes, DMAPOOL_REGION_SRAM);
+    Frame->Buffer[1] = (uint32 *)DmaPool_Alloc(Bytes, DMAPOOL_REGION_SRAM);
+    Frame->Front = 0U;
+    Frame->PresentPending = FALSE;
+
+    if ((Frame->Buffer[0] != NULL_PTR) && (Frame->Buffer[1] != NULL_PTR)) {
+        Frame->Bytes = Bytes;
+        for (i = 0U; i < (Bytes / 4U); i++) {
+            Frame->Buffer[0][i] = Fill;
+            Frame->Buffer[1][i] = Fill;
+        }
+        DmaPool_PrepareTx(Frame->Buffer[0], Bytes);
+        DmaPool_PrepareTx(Frame->Buffer[1], Bytes);
+        ret = (Std_ReturnType)E_OK;
+    } else {
+        /* Keep the pool whole for a smaller retry */
+        DmaPool_Free(Frame->Buffer[0]);
+        DmaPool_Free(Frame->Buffer[1]);
+        Frame->Buffer[0] = NULL_PTR;
+        Frame->Buffer[1] = NULL_PTR;
+        Frame->Bytes = 0U;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Buffer the application draws into
+*/
+uint32 * FrameBuf_Back(const FrameBuf_Type * Frame)
+{
+    return Frame->Buffer[Frame->Front ^ 1U];
+}
+
+/**
+* @brief        Buffer the eDMA reads
+*/
+const uint32 * FrameBuf_Front(const FrameBuf_Type * Frame)
+{
+    return Frame->Buffer[Frame->Front];
+}
+
+/**
+* @brief        Address of the front buffer to program into a TCD
+*/
+uint32 FrameBuf_FrontDmaAddress(const FrameBuf_Type * Frame)
+{
+    return DmaPool_GetDmaAddress(Frame->Buffer[Frame->Front]);
+}
+
+/**
+* @brief        Clean the back buffer to memory and mark it pending
+*/
+void FrameBuf_Present(FrameBuf_Type * Frame)
+{
+    DmaPool_PrepareTx(Frame->Buffer[Frame->Front ^ 1U], Frame->Bytes);
+    Frame->PresentPending = TRUE;
+}
+
+/**
+* @brief        TRUE while a presented buffer waits for the frame boundary
+*/
+boolean FrameBuf_IsPresentPending(const FrameBuf_Type * Frame)
+{
+    return Frame->PresentPending;
+}
+
+/**
+* @brief        Frame boundary: make a pending back buffer the front one
+*/
+boolean FrameBuf_Swap(FrameBuf_Type * Frame)
+{
+    boolean swapped = FALSE;
+
+    if (Frame->PresentPending == TRUE) {
+        Frame->Front ^= 1U;
+        Frame->PresentPending = FALSE;
+        swapped = TRUE;
+    }
+
+    return swapped;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
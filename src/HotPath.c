@@ -0,0 +1,133 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Emios_Mcl_Ip.h"
+#include "Timestamp.h"
+#include "HotPath.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CALIBRATION_RUNS    (16U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* Running statistics of one probe */
+typedef struct {
+    HotPath_StatsType stats;
+    uint64 sum;
+} Probe_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Probe_t probes[HOTPATH_PROBES];
+static uint32 overhead;             /* Cycles of an empty measurement */
+static uint32 cycles_per_tick;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Add one sample to a probe
+*/
+static void Record(Probe_t *probe, uint32 cycles)
+{
+    if (probe->stats.Samples == 0U) {
+        probe->stats.First = cycles;
+        probe->stats.Min = cycles;
+        probe->stats.Max = cycles;
+    } else {
+        probe->stats.Min = (cycles < probe->stats.Min) ? cycles : probe->stats.Min;
+        probe->stats.Max = (cycles > probe->stats.Max) ? cycles : probe->stats.Max;
+    }
+    probe->stats.Samples++;
+    probe->sum += cycles;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+void HotPath_Init(uint32 CyclesPerBusTick)
+{
+    Timestamp_CyclesType start;
+    uint32 cycles;
+    uint32 i;
+
+    for (i = 0U; i < (uint32)HOTPATH_PROBES; i++) {
+        probes[i].stats.Samples = 0U;
+        probes[i].sum = 0U;
+    }
+    cycles_per_tick = CyclesPerBusTick;
+
+    /* The smallest of a few runs, the first ones may miss in the caches */
+    overhead = 0xFFFFFFFFU;
+    for (i = 0U; i < CALIBRATION_RUNS; i++) {
+        start = Timestamp_Get();
+        cycles = (uint32)(Timestamp_Get() - start);
+        overhead = (cycles < overhead) ? cycles : overhead;
+    }
+}
+
+void HotPath_MeasureDutyUpdate(Pwm_ChannelType Channel, uint16 DutyA, uint16 DutyB, uint32 Calls)
+{
+    Timestamp_CyclesType start;
+    uint32 cycles;
+    uint32 i;
+
+    for (i = 0U; i < Calls; i++) {
+        start = Timestamp_Get();
+        Pwm_SetDutyCycle(Channel, ((i & 1U) == 0U) ? DutyA : DutyB);
+        cycles = (uint32)(Timestamp_Get() - start);
+        Record(&probes[HOTPATH_DUTY_UPDATE], (cycles > overhead) ? (cycles - overhead) : 0U);
+    }
+}
+
+void HotPath_SampleIsrLatency(uint8 Instance, uint8 BusChannel, uint32 EventCount)
+{
+    uint32 count = Emios_Mcl_Ip_GetCounterValue(Instance, BusChannel);
+    uint32 period = Emios_Mcl_Ip_GetCounterBusPeriod(Instance, BusChannel);
+    uint32 ticks;
+
+    /* The counter may have wrapped at the period end since the event */
+    ticks = (count >= EventCount) ? (count - EventCount) : ((count + period) - EventCount);
+    Record(&probes[HOTPATH_ISR_LATENCY], ticks * cycles_per_tick);
+}
+
+void HotPath_GetStatistics(HotPath_ProbeType Probe, HotPath_StatsType * Stats)
+{
+    const Probe_t *probe = &probes[Probe];
+
+    *Stats = probe->stats;
+    Stats->Mean = (probe->stats.Samples != 0U) ? (uint32)(probe->sum / probe->stats.Samples) : 0U;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
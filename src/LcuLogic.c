@@ -0,0 +1,115 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Lcu_Ip.h"
+#include "LcuLogic.h"
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Compile a cell description into its register image
+*/
+void LcuLogic_Compile(const LcuLogic_CellType * Cell, Lcu_Ip_LogicCellImageType * Image)
+{
+    const LcuLogic_OutputType *output;
+    uint8 i;
+
+    Image->OutPol = 0U;
+    Image->OutEn = 0U;
+
+    for (i = 0U; i < LCULOGIC_CELL_IO; i++) {
+        output = &Cell->Outputs[i];
+
+        Image->MuxSel[i] = Cell->InputMux[i];
+        Image->LutCtrl[i] = output->Lut;
+        Image->RiseFilt[i] = output->RiseFilter;
+        Image->FallFilt[i] = output->FallFilter;
+
+        if (output->Invert == TRUE) {
+            Image->OutPol |= (uint8)(1U << i);
+        }
+        if (output->Enable == TRUE) {
+            Image->OutEn |= (uint8)(1U << i);
+        }
+    }
+}
+
+/**
+* @brief        Compile and commit a set of cells
+*/
+Lcu_Ip_ReturnType LcuLogic_Commit(const LcuLogic_CellType Cells[], uint8 NumCells)
+{
+    Lcu_Ip_LogicCellImageType image;
+    Lcu_Ip_ReturnType ret = LCU_IP_STATUS_SUCCESS;
+    uint8 i;
+
+    for (i = 0U; i < NumCells; i++) {
+        LcuLogic_Compile(&Cells[i], &image);
+        ret = Lcu_Ip_SetLogicCellImage(Cells[i].LogicInstance, Cells[i].HwLogicCell, &image);
+        if (ret != LCU_IP_STATUS_SUCCESS) {
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Output of a compiled LUT for a combined input value (I3:I2:I1:I0)
+*/
+boolean LcuLogic_Evaluate(uint16 Lut, uint8 Inputs)
+{
+    boolean value = FALSE;
+
+    if ((((uint32)Lut >> (Inputs & 0x0FU)) & 1U) != 0U) {
+        value = TRUE;
+    }
+
+    return value;
+}
+
+/**
+* @brief        Outputs of a compiled cell for a combined input value (I3:I2:I1:I0)
+*/
+uint8 LcuLogic_EvaluateCell(const Lcu_Ip_LogicCellImageType * Image, uint8 Inputs)
+{
+    uint8 outputs = 0U;
+    uint8 i;
+
+    for (i = 0U; i < LCULOGIC_CELL_IO; i++) {
+        if (LcuLogic_Evaluate(Image->LutCtrl[i], Inputs) == TRUE) {
+            outputs |= (uint8)(1U << i);
+        }
+    }
+
+    return (uint8)((outputs ^ Image->OutPol) & Image->OutEn);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,261 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "Emios_Pwm_Ip.h"
+#include "Siul2_Dio_Ip.h"
+#include "DmaPool.h"
+#include "FrameBuf.h"
+#include "LedMatrix.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define ROW_LIST_SIZE         (14U)
+#define COLUMN_LIST_SIZE      (13U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Read by the eDMA, from the DmaPool SRAM arena and cleaned on present. Each frame row holds
+   the UC B register value of every column, i.e. BlankTicks + duty. */
+static FrameBuf_Type frames;
+static uint16 *row_patterns;
+
+static const LedMatrix_ConfigType *matrix_cfg;
+
+static LedMatrix_StatsType matrix_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static void SetLeadingEdges(const LedMatrix_ConfigType *cfg);
+static Std_ReturnType ConfigureDma(const LedMatrix_ConfigType *cfg);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Place the leading edge of every column at BlankTicks with zero duty
+* @details      Output update is disabled meanwhile so all columns change on the same period
+*/
+static void SetLeadingEdges(const LedMatrix_ConfigType *cfg)
+{
+    uint32 mask = ((1UL << cfg->Columns) - 1UL) << cfg->FirstChannel;
+    uint8 col;
+
+    Emios_Pwm_Ip_ComparatorTransferDisable(cfg->EmiosInstance, mask);
+    for (col = 0U; col < cfg->Columns; col++) {
+        Emios_Pwm_Ip_UpdateUCRegA(cfg->EmiosInstance, cfg->FirstChannel + col, (Emios_Pwm_Ip_PeriodType)cfg->BlankTicks);
+        Emios_Pwm_Ip_UpdateUCRegB(cfg->EmiosInstance, cfg->FirstChannel + col, (Emios_Pwm_Ip_PeriodType)cfg->BlankTicks);
+    }
+    Emios_Pwm_Ip_ComparatorTransferEnable(cfg->EmiosInstance, mask);
+}
+
+/**
+* @brief        Program the row and column transfers
+* @details      On every counter bus flag RowDmaCh writes the next row pattern to PGPDO and
+*               links to ColumnDmaCh, which writes one frame row to the B registers of all
+*               columns (destination stride = one unified channel, rewound by the minor loop
+*               offset). Both run their major loop once per frame and reload by themselves.
+*               The minor loop offset also follows the last minor loop, so DLAST stays 0:
+*               rewinding there too would move the next frame below column 0.
+*/
+static Std_ReturnType ConfigureDma(const LedMatrix_ConfigType *cfg)
+{
+    Emios_Pwm_Ip_HwAddrType *base = Emios_Pwm_Ip_aBasePtr[cfg->EmiosInstance];
+    uint32 stride = (uint32)sizeof(base->CH.UC[0]);
+    uint32 row_bytes = (uint32)cfg->Columns * 4U;
+    Dma_Ip_ReturnType status;
+
+    const Dma_Ip_LogicChannelTransferListType row_list[ROW_LIST_SIZE] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS,                   DmaPool_GetDmaAddress(row_patterns) },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET,             2U },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_LAST_ADDR_ADJ,      (uint32)(-(sint32)((uint32)cfg->Rows * 2U)) },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE,             DMA_IP_TRANSFER_SIZE_2_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS,              (uint32)&cfg->RowPort->PGPDO },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET,        0U },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_LAST_ADDR_ADJ, 0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE,        DMA_IP_TRANSFER_SIZE_2_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE,                   2U },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT,                  cfg->Rows },
+        { DMA_IP_CH_SET_MINORLOOP_EN_LINK,                (uint32)TRUE },
+        { DMA_IP_CH_SET_MINORLOOP_LOGIC_LINK_CH,          cfg->ColumnDmaCh },
+        { DMA_IP_CH_SET_MAJORLOOP_EN_LINK,                (uint32)TRUE },
+        { DMA_IP_CH_SET_MAJORLOOP_LOGIC_LINK_CH,          cfg->ColumnDmaCh },
+    };
+
+    const Dma_Ip_LogicChannelTransferListType column_list[COLUMN_LIST_SIZE] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS,                   FrameBuf_FrontDmaAddress(&frames) },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET,             4U },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_LAST_ADDR_ADJ,      (uint32)(-(sint32)(row_bytes * cfg->Rows)) },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE,             DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS,              (uint32)&base->CH.UC[cfg->FirstChannel].B },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET,        stride },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_LAST_ADDR_ADJ, 0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE,        DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_EN_DST_OFFSET,          (uint32)TRUE },
+        { DMA_IP_CH_SET_MINORLOOP_SIGNED_OFFSET,          (uint32)(-(sint32)(stride * cfg->Columns)) },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE,                   row_bytes },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT,                  cfg->Rows },
+        { DMA_IP_CH_SET_CONTROL_EN_MAJOR_INTERRUPT,       (uint32)TRUE },
+    };
+
+    status = Dma_Ip_SetLogicChannelTransferList(cfg->ColumnDmaCh, column_list, COLUMN_LIST_SIZE);
+    if (status == DMA_IP_STATUS_SUCCESS) {
+        status = Dma_Ip_SetLogicChannelTransferList(cfg->RowDmaCh, row_list, ROW_LIST_SIZE);
+    }
+
+    return (status == DMA_IP_STATUS_SUCCESS) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Prepare the frame buffers, the column leading edges and both DMA channels
+* @details      The B registers are double buffered: duties written during row period k
+*               take effect at the start of period k + 1. The row patterns are therefore
+*               stored one row late, so the row switched on at a period start is the one whose
+*               duties just became active.
+*/
+Std_ReturnType LedMatrix_Init(const LedMatrix_ConfigType * Config)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint32 i;
+
+    /* The row patterns are allocated once and kept across re-initialisations */
+    if (row_patterns == NULL_PTR) {
+        row_patterns = (uint16 *)DmaPool_Alloc(LEDMATRIX_MAX_ROWS * 2U, DMAPOOL_REGION_SRAM);
+    }
+
+    if ((Config->Rows > 0U) && (Config->Rows <= LEDMATRIX_MAX_ROWS) &&
+        (Config->Columns > 0U) && (Config->Columns <= LEDMATRIX_MAX_COLUMNS) &&
+        (Config->BlankTicks < Config->Period) && (row_patterns != NULL_PTR) &&
+        (FrameBuf_Init(&frames, (uint32)Config->Rows * Config->Columns * 4U, Config->BlankTicks) == (Std_ReturnType)E_OK)) {
+        matrix_cfg = Config;
+
+        for (i = 0U; i < Config->Rows; i++) {
+            row_patterns[i] = Config->RowPatterns[(i + Config->Rows - 1U) % Config->Rows];
+        }
+        DmaPool_PrepareTx(row_patterns, (uint32)Config->Rows * 2U);
+
+        matrix_stats.Frames = 0U;
+        matrix_stats.Presents = 0U;
+        matrix_stats.RefreshMilliHz = 0U;
+
+        Config->RowPort->PGPDO = Config->RowsOff;
+        SetLeadingEdges(Config);
+        ret = ConfigureDma(Config);
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Start scanning on the next counter bus period
+*/
+void LedMatrix_Start(void)
+{
+    (void)Dma_Ip_SetLogicChannelCommand(matrix_cfg->RowDmaCh, DMA_IP_CH_SET_HARDWARE_REQUEST);
+}
+
+/**
+* @brief        Stop scanning and switch every row off
+* @details      The channels keep their position in the frame, a restart resumes there
+*/
+void LedMatrix_Stop(void)
+{
+    (void)Dma_Ip_SetLogicChannelCommand(matrix_cfg->RowDmaCh, DMA_IP_CH_CLEAR_HARDWARE_REQUEST);
+    matrix_cfg->RowPort->PGPDO = matrix_cfg->RowsOff;
+}
+
+/**
+* @brief        Set one pixel of the back buffer
+*/
+void LedMatrix_SetPixel(uint8 Row, uint8 Column, uint32 Duty)
+{
+    uint32 max_duty = matrix_cfg->Period - matrix_cfg->BlankTicks;
+
+    if ((Row < matrix_cfg->Rows) && (Column < matrix_cfg->Columns)) {
+        if (Duty > max_duty) {
+            Duty = max_duty;
+        }
+        FrameBuf_Back(&frames)[((uint32)Row * matrix_cfg->Columns) + Column] = matrix_cfg->BlankTicks + Duty;
+    }
+}
+
+/**
+* @brief        Show the back buffer from the next frame on
+*/
+void LedMatrix_Present(void)
+{
+    FrameBuf_Present(&frames);
+}
+
+/**
+* @brief        TRUE while a presented buffer waits for the frame boundary
+* @details      Do not draw into the back buffer while this is set, it is still being shown
+*/
+boolean LedMatrix_IsPresentPending(void)
+{
+    return FrameBuf_IsPresentPending(&frames);
+}
+
+/**
+* @brief        Frame boundary, to be called from the ColumnDmaCh major loop callback
+* @details      The column channel has rewound to the start of the frame and waits for the
+*               next link, a full row period away, so its source can be moved safely
+*/
+void LedMatrix_FrameIrq(void)
+{
+    matrix_stats.Frames++;
+
+    if (FrameBuf_Swap(&frames) == TRUE) {
+        (void)Dma_Ip_RearmLogicChannel(matrix_cfg->ColumnDmaCh,
+                                       FrameBuf_FrontDmaAddress(&frames),
+                                       (uint32)&Emios_Pwm_Ip_aBasePtr[matrix_cfg->EmiosInstance]->CH.UC[matrix_cfg->FirstChannel].B,
+                                       matrix_cfg->Rows);
+        matrix_stats.Presents++;
+    }
+}
+
+/**
+* @brief        Copy the scan statistics
+* @details      One row per counter bus period: refresh = bus clock / (Period * Rows)
+*/
+void LedMatrix_GetStatistics(uint32 BusClockHz, LedMatrix_StatsType * Stats)
+{
+    matrix_stats.RefreshMilliHz = (uint32)(((uint64)BusClockHz * 1000U) /
+                                           ((uint64)matrix_cfg->Period * matrix_cfg->Rows));
+    *Stats = matrix_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
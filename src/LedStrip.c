@@ -0,0 +1,391 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "Flexio_Mcl_Ip.h"
+#include "OsIf.h"
+#include "DmaPool.h"
+#include "DmaChain.h"
+#include "FlexioTx.h"
+#include "FrameBuf.h"
+#include "Timestamp.h"
+#include "LedStrip.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* Symbol window and reset time of a protocol */
+typedef struct {
+    uint16 min_symbol_ns;
+    uint16 max_symbol_ns;
+    uint16 reset_us;
+} ProtocolTiming_t;
+
+/* Per strip runtime state */
+typedef struct {
+    FrameBuf_Type frames;       /* Encoded frame being sent and the one encoded into */
+    DmaChain_ChainType chain;   /* Frame data, then the reset zero words */
+    uint32 bytes;               /* Pixel bytes per frame */
+    uint32 shift_buffer;        /* SHIFTBUFBIS address of the shifter */
+    volatile boolean busy;      /* A frame is being sent, cleared by LedStrip_FrameIrq */
+} StripState_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+/* Ten data bits of three symbols per shifter word, so every word ends on a whole bit */
+#define WORD_BITS             (30U)
+
+/* Five pixel bytes encode to 5 x 24 symbols, i.e. four words */
+#define ENCODED_WORDS(bytes)  ((((bytes) * 8U) + 9U) / 10U)
+
+/* Symbols of a data bit: high, the bit, low */
+#define SYMBOL_ONE            (0x6U)
+#define SYMBOL_ZERO           (0x4U)
+
+#define DATA_LIST_SIZE        (8U)
+#define RESET_LIST_SIZE       (10U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static const ProtocolTiming_t protocol_timing[2] = {
+    { 325U, 475U, 280U },   /* LEDSTRIP_WS2812 */
+    { 225U, 375U,  80U },   /* LEDSTRIP_SK6812 */
+};
+
+/* Zero word repeated by the reset descriptors of all strips, taken from DmaPool once */
+static uint32 *reset_word;
+
+/* 24 symbols of every byte value, most significant bit first */
+static uint32 symbol_lut[256];
+
+static const LedStrip_ConfigType *strip_cfg;
+static StripState_t strip_state[LEDSTRIP_MAX_STRIPS];
+
+static LedStrip_StatsType strip_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static boolean CheckTiming(const LedStrip_ConfigType *cfg, uint32 *ResetWords);
+static void ConfigureStrip(uint8 Strip);
+static Std_ReturnType ConfigureDma(uint8 Strip, uint32 ResetWords);
+static void EncodeBytes(const uint8 Src[], uint32 Count, uint32 Dst[]);
+static void StartFrame(uint8 Strip);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Check the symbol time against the protocol and size the reset
+* @details      The clock timer restarts between words, stretching the last symbol of a word
+*               by one or two FlexIO clocks. A word holds ten whole bits, so that symbol is
+*               always the low one ending a bit and the stretch stays far inside T0L/T1L;
+*               the high symbols, with the tighter window, keep their length.
+*/
+static boolean CheckTiming(const LedStrip_ConfigType *cfg, uint32 *ResetWords)
+{
+    const ProtocolTiming_t *timing = &protocol_timing[cfg->Protocol];
+    uint32 symbol_ns = (uint32)(((uint64)cfg->SymbolClockDiv * 1000000000U) / cfg->FlexioClockHz);
+    uint32 word_ns = symbol_ns * WORD_BITS;
+
+    strip_stats.SymbolNs = symbol_ns;
+    *ResetWords = (((uint32)timing->reset_us * 1000U) + word_ns - 1U) / word_ns;
+
+    return ((FlexioTx_IsValidDivider(cfg->SymbolClockDiv) == TRUE) &&
+            (symbol_ns >= timing->min_symbol_ns) && (symbol_ns <= timing->max_symbol_ns)) ? TRUE : FALSE;
+}
+
+/**
+* @brief        Program the transmit shifter and its clock timer
+* @details      The timer runs 30 symbols whenever the buffer holds data, with no clock
+*               output. The line idles low once the reset zeros are out.
+*/
+static void ConfigureStrip(uint8 Strip)
+{
+    const LedStrip_StripConfigType *cfg = &strip_cfg->StripConfig[Strip];
+
+    const FlexioTx_ConfigType tx = {
+        strip_cfg->FlexioInstance, cfg->Shifter, cfg->Timer, cfg->Pin, FLEXIOTX_NO_PIN,
+        (uint8)WORD_BITS, FLEXIO_TIMER_POLARITY_POSEDGE, strip_cfg->SymbolClockDiv
+    };
+
+    strip_state[Strip].shift_buffer = FlexioTx_Configure(&tx);
+}
+
+/**
+* @brief        Build the two descriptor chain of a strip
+* @details      The data descriptor scatter-gathers into the reset descriptor, which repeats
+*               one zero word, raises the frame interrupt and drops the hardware request.
+*/
+static Std_ReturnType ConfigureDma(uint8 Strip, uint32 ResetWords)
+{
+    StripState_t *state = &strip_state[Strip];
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+
+    const Dma_Ip_LogicChannelTransferListType data_list[DATA_LIST_SIZE] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS,                   FrameBuf_FrontDmaAddress(&state->frames) },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET,             4U },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE,             DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS,              state->shift_buffer },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET,        0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE,        DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE,                   4U },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT,                  ENCODED_WORDS(state->bytes) },
+    };
+
+    const Dma_Ip_LogicChannelTransferListType reset_list[RESET_LIST_SIZE] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS,                   DmaPool_GetDmaAddress(reset_word) },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET,             0U },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE,             DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS,              state->shift_buffer },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET,        0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE,        DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE,                   4U },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT,                  ResetWords },
+        { DMA_IP_CH_SET_CONTROL_DIS_AUTO_REQUEST,         (uint32)TRUE },
+        { DMA_IP_CH_SET_CONTROL_EN_MAJOR_INTERRUPT,       (uint32)TRUE },
+    };
+
+    DmaChain_Create(&state->chain, strip_cfg->StripConfig[Strip].DmaCh);
+    if ((DmaChain_Append(&state->chain, data_list, DATA_LIST_SIZE) != DMACHAIN_NO_DESCRIPTOR) &&
+        (DmaChain_Append(&state->chain, reset_list, RESET_LIST_SIZE) != DMACHAIN_NO_DESCRIPTOR)) {
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Encode pixel bytes into symbol words
+* @details      Per five bytes: five table lookups and four word stores, the symbols in
+*               bits 31 ... 2 of each word. A last partial group is completed with zero
+*               symbols, which read as line idle, and takes only the words its bits reach.
+*/
+static void EncodeBytes(const uint8 Src[], uint32 Count, uint32 Dst[])
+{
+    uint32 c[5];
+    uint32 last[4];
+    uint32 i = 0U;
+    uint32 k;
+    uint32 *dst = Dst;
+
+    while ((Count - i) >= 5U) {
+        c[0] = symbol_lut[Src[i]];
+        c[1] = symbol_lut[Src[i + 1U]];
+        c[2] = symbol_lut[Src[i + 2U]];
+        c[3] = symbol_lut[Src[i + 3U]];
+        c[4] = symbol_lut[Src[i + 4U]];
+        dst[0] = (c[0] << 8U) | ((c[1] >> 18U) << 2U);
+        dst[1] = (c[1] << 14U) | ((c[2] >> 12U) << 2U);
+        dst[2] = (c[2] << 20U) | ((c[3] >> 6U) << 2U);
+        dst[3] = (c[3] << 26U) | (c[4] << 2U);
+        dst = &dst[4];
+        i += 5U;
+    }
+
+    if (i < Count) {
+        for (k = 0U; k < 4U; k++) {
+            c[k] = ((i + k) < Count) ? symbol_lut[Src[i + k]] : 0U;
+        }
+        last[0] = (c[0] << 8U) | ((c[1] >> 18U) << 2U);
+        last[1] = (c[1] << 14U) | ((c[2] >> 12U) << 2U);
+        last[2] = (c[2] << 20U) | ((c[3] >> 6U) << 2U);
+        last[3] = c[3] << 26U;
+        for (k = 0U; k < ENCODED_WORDS(Count - i); k++) {
+            dst[k] = last[k];
+        }
+    }
+}
+
+/**
+* @brief        Send the front buffer of a strip
+*/
+static void StartFrame(uint8 Strip)
+{
+    StripState_t *state = &strip_state[Strip];
+
+    (void)DmaChain_Rearm(&state->chain, 0U, FrameBuf_FrontDmaAddress(&state->frames), state->shift_buffer);
+    (void)DmaChain_Start(&state->chain);
+    (void)Dma_Ip_SetLogicChannelCommand(state->chain.LogicCh, DMA_IP_CH_SET_HARDWARE_REQUEST);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Configure the shifters, timers and DMA chains of all strips
+*/
+Std_ReturnType LedStrip_Init(const LedStrip_ConfigType * Config)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint32 reset_words;
+    uint32 bytes;
+    uint32 code;
+    uint32 v;
+    uint8 bit;
+    uint8 s;
+
+    strip_stats.Frames = 0U;
+    strip_stats.Encodes = 0U;
+    strip_stats.EncodedPixels = 0U;
+    strip_stats.EncodeCycles = 0U;
+    strip_stats.EncodePixelsPerMs = 0U;
+
+    if (reset_word == NULL_PTR) {
+        reset_word = (uint32 *)DmaPool_Alloc(4U, DMAPOOL_REGION_SRAM);
+        if (reset_word != NULL_PTR) {
+            *reset_word = 0U;
+            DmaPool_PrepareTx(reset_word, 4U);
+        }
+    }
+
+    if ((Config->Strips > 0U) && (Config->Strips <= LEDSTRIP_MAX_STRIPS) &&
+        (reset_word != NULL_PTR) && (CheckTiming(Config, &reset_words) == TRUE)) {
+        strip_cfg = Config;
+        ret = (Std_ReturnType)E_OK;
+
+        for (v = 0U; v < 256U; v++) {
+            code = 0U;
+            for (bit = 0U; bit < 8U; bit++) {
+                code = (code << 3U) | ((((v << bit) & 0x80U) != 0U) ? SYMBOL_ONE : SYMBOL_ZERO);
+            }
+            symbol_lut[v] = code;
+        }
+
+        FlexioTx_InitInstance(Config->FlexioInstance);
+
+        for (s = 0U; (s < Config->Strips) && (ret == (Std_ReturnType)E_OK); s++) {
+            bytes = (uint32)Config->StripConfig[s].Pixels * Config->StripConfig[s].BytesPerPixel;
+            if ((bytes == 0U) || (bytes > LEDSTRIP_MAX_BYTES) ||
+                (FrameBuf_Init(&strip_state[s].frames, ENCODED_WORDS(bytes) * 4U, 0U) != (Std_ReturnType)E_OK)) {
+                ret = (Std_ReturnType)E_NOT_OK;
+            } else {
+                strip_state[s].bytes = bytes;
+                strip_state[s].busy = FALSE;
+                ConfigureStrip(s);
+                ret = ConfigureDma(s, reset_words);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Encode a frame of one strip into its back buffer
+*/
+Std_ReturnType LedStrip_Encode(uint8 Strip, const uint8 Pixels[])
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    StripState_t *state = &strip_state[Strip];
+    Timestamp_CyclesType start;
+
+    if ((Strip < strip_cfg->Strips) && (FrameBuf_IsPresentPending(&state->frames) == FALSE)) {
+        start = Timestamp_Get();
+        EncodeBytes(Pixels, state->bytes, FrameBuf_Back(&state->frames));
+        strip_stats.EncodeCycles += Timestamp_Get() - start;
+        strip_stats.Encodes++;
+        strip_stats.EncodedPixels += strip_cfg->StripConfig[Strip].Pixels;
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Send the back buffer of one strip
+* @details      The buffer is presented first. An idle strip swaps and starts at once; a busy
+*               one is left to LedStrip_FrameIrq, which swaps at the end of its frame. The
+*               check and the swap are one critical section against that interrupt.
+*/
+void LedStrip_Show(uint8 Strip)
+{
+    StripState_t *state = &strip_state[Strip];
+    boolean start = FALSE;
+
+    if (Strip < strip_cfg->Strips) {
+        FrameBuf_Present(&state->frames);
+
+        OsIf_SuspendAllInterrupts();
+        if ((state->busy == FALSE) && (FrameBuf_Swap(&state->frames) == TRUE)) {
+            state->busy = TRUE;
+            start = TRUE;
+        }
+        OsIf_ResumeAllInterrupts();
+
+        if (start == TRUE) {
+            StartFrame(Strip);
+        }
+    }
+}
+
+/**
+* @brief        TRUE while a frame of the strip is being sent
+*/
+boolean LedStrip_IsBusy(uint8 Strip)
+{
+    return strip_state[Strip].busy;
+}
+
+/**
+* @brief        End of a frame including its reset time
+* @details      The frame interrupt comes when the last reset word enters the shifter buffer,
+*               so a queued frame follows after at least the full reset time.
+*/
+void LedStrip_FrameIrq(uint8 Strip)
+{
+    StripState_t *state = &strip_state[Strip];
+
+    strip_stats.Frames++;
+
+    if (FrameBuf_Swap(&state->frames) == TRUE) {
+        StartFrame(Strip);
+    } else {
+        state->busy = FALSE;
+    }
+}
+
+/**
+* @brief        Copy the driver statistics
+* @details      Encoder throughput = encoded pixels / encode time at the core clock
+*/
+void LedStrip_GetStatistics(LedStrip_StatsType * Stats)
+{
+    if (strip_stats.EncodeCycles > 0U) {
+        strip_stats.EncodePixelsPerMs = (uint32)(((uint64)strip_stats.EncodedPixels * Timestamp_GetFrequency()) /
+                                                 (strip_stats.EncodeCycles * 1000U));
+    }
+    *Stats = strip_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,100 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* OsIf custom timer (OSIF_COUNTER_CUSTOM, OsIfUseCustomTimer in the configuration) on the DWT
+* cycle counter. Driver timeouts counted in OsIf ticks then run at the core clock and follow
+* core clock switches through Timestamp_UpdateFrequency.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "OsIf_Timer_Custom.h"
+#include "Timestamp.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define NS_PER_US         (1000UL)
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+#define BASENXP_START_SEC_CODE
+#include "BaseNXP_MemMap.h"
+
+/**
+* @brief        Start the cycle counter
+* @details      OsIf_Init has to run after the clock tree is initialized, like Timestamp_Init.
+*/
+void OsIf_Timer_Custom_Init(void)
+{
+    Timestamp_Init();
+}
+
+/**
+* @brief        Low 32 bits of the cycle count
+*/
+uint32 OsIf_Timer_Custom_GetCounter(void)
+{
+    return (uint32)Timestamp_Get();
+}
+
+/**
+* @brief        Cycles since the reference, which moves to now
+* @details      Modulo 2^32 like the other OsIf timers, so one call per counter period is
+*               enough however often the counter wraps.
+*/
+uint32 OsIf_Timer_Custom_GetElapsed(uint32 * const CurrentRef)
+{
+    uint32 now = (uint32)Timestamp_Get();
+    uint32 elapsed = now - *CurrentRef;
+
+    *CurrentRef = now;
+
+    return elapsed;
+}
+
+/**
+* @brief        Take a new core clock frequency
+*/
+void OsIf_Timer_Custom_SetTimerFrequency(uint32 Freq)
+{
+    Timestamp_SetFrequency(Freq);
+}
+
+/**
+* @brief        Microseconds to cycles at the current core clock frequency
+*/
+uint32 OsIf_Timer_Custom_MicrosToTicks(uint32 Micros)
+{
+    return (uint32)Timestamp_NsToCycles((uint64)Micros * NS_PER_US);
+}
+
+#define BASENXP_STOP_SEC_CODE
+#include "BaseNXP_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,585 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#if !defined(PWMAUDIO_HOST)
+#include "Dma_Ip.h"
+#include "Emios_Pwm_Ip.h"
+#include "DmaPool.h"
+#include "Timestamp.h"
+#endif
+#include "PwmAudio.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* One queued PCM buffer */
+typedef struct {
+    const void *samples;
+    uint32 count;
+    PwmAudio_FormatType format;
+    uint32 step;                /* Interpolator input samples per PWM period, Q16 */
+    boolean doubled;            /* Upsampled by two through the halfband filter first */
+} PwmAudioBuffer_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define Q16_ONE               (0x10000UL)
+#define Q16_HALF              (0x8000L)
+
+/* Upsampler step while nothing plays: one (silent) sample per period, so a new buffer starts
+   within a few periods */
+#define IDLE_STEP             (Q16_ONE)
+
+/* Coefficient pairs of the halfband filter */
+#define HALFBAND_PAIRS        (18U)
+#define HALFBAND_SHIFT        (20U)
+
+/* Silent samples after the last buffer until the last real one has left the halfband filter
+   and the interpolator */
+#define TAIL_SAMPLES          ((2U * HALFBAND_PAIRS) + 3U)
+
+/* 32-bit words per half of the DMA buffer at most, one per output channel and period */
+#define HALF_WORDS            (PWMAUDIO_BLOCK * 2U)
+
+#if !defined(PWMAUDIO_HOST)
+#define TRANSFER_LIST_SIZE    (14U)
+#endif
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+#if !defined(PWMAUDIO_HOST)
+/* Read by the eDMA, from the DmaPool SRAM arena and cleaned after every render. Each period
+   holds the B register value of every output channel. */
+static uint32 *dma_buffer;
+#endif
+
+static const PwmAudio_ConfigType *audio_cfg;
+
+/* Halfband filter, Q20: odd taps of a Kaiser (beta 10) windowed sinc of 4 * HALFBAND_PAIRS - 1
+   taps at twice the sample rate, the centre tap 1 and the even ones 0. Flat within 0.001 dB up
+   to 0.4 fs, below -99 dB from 0.6 fs. */
+static const sint32 halfband[HALFBAND_PAIRS] = {
+    665109, -215294, 121785, -79578, 54896, -38577, 27108, -18826, 12809,
+    -8475, 5412, -3309, 1916, -1037, 513, -225, 81, -20
+};
+
+/* Written by PwmAudio_Play only (head) and by the renderer only (tail); free running */
+static PwmAudioBuffer_t queue[PWMAUDIO_QUEUE];
+static volatile uint32 queue_head;
+static volatile uint32 queue_tail;
+
+/* Set by PwmAudio_Flush, the renderer drops the buffers up to flush_head */
+static volatile uint32 flush_head;
+static volatile boolean flush_pending;
+
+/* Upsampler: the last four input samples, the output lies between history[1] and [2] */
+static uint32 play_pos;
+static uint32 phase;
+static uint32 phase_step;
+static sint32 history[4];
+static uint8 silent_fetches;
+
+/* Halfband filter: the last 2 * HALFBAND_PAIRS input samples, stored twice so the window
+   starting at hb_pos is contiguous; the newest sample is the last one of the window */
+static sint32 hb_window[4U * HALFBAND_PAIRS];
+static uint32 hb_pos;
+static boolean hb_doubled;
+static boolean hb_odd;
+
+/* Noise shaper: quantisation errors of the two previous periods, Q16 ticks */
+static sint32 shape_e1;
+static sint32 shape_e2;
+
+/* Scaling from a 16-bit sample to Q16 ticks */
+static uint32 full_scale;
+static sint32 mid_q16;
+static volatile sint32 gain;
+
+static PwmAudio_StatsType audio_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static sint32 NextInput(void);
+static sint32 FetchSample(void);
+static inline uint32 NextDuty(void);
+#if !defined(PWMAUDIO_HOST)
+static void RenderBlock(uint32 *dst);
+static void SetOutputs(uint32 duty);
+static Std_ReturnType ConfigureDma(const PwmAudio_ConfigType *cfg);
+#endif
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Next input sample as signed 16-bit, silence if nothing is queued
+* @details      Runs on the renderer side only. The step of a buffer applies from its first
+*               sample on. After the last buffer the old step is kept until the last sample has
+*               left the filters, so the tail plays at the pace of the material; then the idle
+*               step applies and the shaper state is dropped, so silence is the mid duty on
+*               every period and not a limit cycle of one tick.
+*/
+static sint32 NextInput(void)
+{
+    const PwmAudioBuffer_t *buf;
+    sint32 sample = 0;
+
+    if (flush_pending == TRUE) {
+        queue_tail = flush_head;
+        play_pos = 0U;
+        flush_pending = FALSE;
+    }
+
+    if (queue_tail != queue_head) {
+        buf = &queue[queue_tail % PWMAUDIO_QUEUE];
+        if (buf->format == PWMAUDIO_U8) {
+            sample = ((sint32)((const uint8 *)buf->samples)[play_pos] - 128) * 256;
+        } else {
+            sample = (sint32)((const sint16 *)buf->samples)[play_pos];
+        }
+        phase_step = buf->step;
+        hb_doubled = buf->doubled;
+        silent_fetches = 0U;
+        audio_stats.Samples++;
+
+        play_pos++;
+        if (play_pos >= buf->count) {
+            play_pos = 0U;
+            queue_tail++;
+            audio_stats.Buffers++;
+        }
+    } else if (silent_fetches < TAIL_SAMPLES) {
+        silent_fetches++;
+    } else {
+        phase_step = IDLE_STEP;
+        hb_doubled = FALSE;
+        shape_e1 = 0;
+        shape_e2 = 0;
+    }
+
+    return sample;
+}
+
+/**
+* @brief        Next sample for the interpolator
+* @details      A doubled buffer gives two per input sample: the input itself, the centre tap,
+*               and the halfband sum between it and the next one. Otherwise the input passes
+*               with the same delay, so a change of rate between buffers keeps the timing.
+*/
+static sint32 FetchSample(void)
+{
+    const sint32 *w;
+    sint64 acc = 0;
+    sint32 sample;
+    uint32 k;
+
+    if (hb_odd == TRUE) {
+        hb_odd = FALSE;
+        w = &hb_window[hb_pos];
+        for (k = 0U; k < HALFBAND_PAIRS; k++) {
+            acc += (sint64)halfband[k] * (w[HALFBAND_PAIRS - 1U - k] + w[HALFBAND_PAIRS + k]);
+        }
+        sample = (sint32)((acc + (1L << (HALFBAND_SHIFT - 1U))) >> HALFBAND_SHIFT);
+    } else {
+        sample = NextInput();
+        hb_window[hb_pos] = sample;
+        hb_window[hb_pos + (2U * HALFBAND_PAIRS)] = sample;
+        hb_pos = (hb_pos + 1U) % (2U * HALFBAND_PAIRS);
+        hb_odd = hb_doubled;
+        sample = hb_window[hb_pos + HALFBAND_PAIRS - 1U];
+    }
+
+    return sample;
+}
+
+/**
+* @brief        Duty of the next PWM period in ticks, 0 ... full_scale
+* @details      The input is upsampled in two stages. The halfband filter doubles the rate
+*               and removes the image of the material at fs - f, which the cubic stage alone
+*               leaves at about -65 dBc. 4-point cubic (Catmull-Rom) interpolation then goes to
+*               the update rate at a Q16 phase step of 2 fs / update rate; its images around
+*               multiples of 2 fs are far enough from the material to be attenuated. The update
+*               rate is not a multiple of the sample rate, so an image left at this point
+*               aliases back into the audio band instead of staying above it.
+*               The target in Q16 ticks is then quantised to whole ticks with second-order error
+*               feedback: the errors of the two previous periods are fed back as
+*               -2 e[n-1] + e[n-2], so the output is x + (1 - z^-1)^2 e and the quantisation
+*               noise is pushed towards half the update rate. That lowers it only well below a
+*               quarter of the update rate: with 2048 ticks at 78.125 kHz a 1 kHz tone at half
+*               scale keeps about 65 dB SNR up to 20 kHz, close to the flat floor of 11-bit
+*               ticks, and 83 dB up to 8 kHz (test/PwmAudio_Test.c). The error is clamped to
+*               half a tick so clipping at 0 or full scale cannot wind the loop up.
+*/
+static inline uint32 NextDuty(void)
+{
+    sint64 frac;
+    sint32 c1;
+    sint32 c2;
+    sint32 c3;
+    sint32 sample;
+    sint32 target;
+    sint32 duty;
+    sint32 err;
+
+    phase += phase_step;
+    if (phase >= Q16_ONE) {
+        phase -= Q16_ONE;
+        history[0] = history[1];
+        history[1] = history[2];
+        history[2] = history[3];
+        history[3] = FetchSample();
+    }
+
+    /* Coefficients times two; the products need 64 bits, a 16-bit sample difference
+       times five does not fit a 15-bit fraction within 32 bits */
+    frac = (sint64)(phase >> 1U);
+    c1 = history[2] - history[0];
+    c2 = (2 * history[0]) - (5 * history[1]) + (4 * history[2]) - history[3];
+    c3 = (history[3] - history[0]) + (3 * (history[1] - history[2]));
+    sample = (sint32)(((((((((sint64)c3 * frac) >> 15U) + c2) * frac) >> 15U) + c1) * frac) >> 16U) + history[1];
+
+    target = mid_q16 + (sample * gain) - (2 * shape_e1) + shape_e2;
+
+    duty = (target + Q16_HALF) >> 16U;
+    if (duty < 0) {
+        duty = 0;
+    } else if (duty > (sint32)full_scale) {
+        duty = (sint32)full_scale;
+    } else {
+        /* In range */
+    }
+
+    err = (duty * (sint32)Q16_ONE) - target;
+    if (err > Q16_HALF) {
+        err = Q16_HALF;
+    } else if (err < -Q16_HALF) {
+        err = -Q16_HALF;
+    } else {
+        /* In range */
+    }
+    shape_e2 = shape_e1;
+    shape_e1 = err;
+
+    return (uint32)duty;
+}
+
+#if !defined(PWMAUDIO_HOST)
+/**
+* @brief        Render one half of the DMA buffer
+*/
+static void RenderBlock(uint32 *dst)
+{
+    uint32 lead = audio_cfg->LeadTicks;
+    uint32 duty;
+    uint32 i;
+
+    for (i = 0U; i < PWMAUDIO_BLOCK; i++) {
+        duty = NextDuty();
+        if (audio_cfg->Channels == 2U) {
+            dst[(i * 2U)] = lead + duty;
+            dst[(i * 2U) + 1U] = lead + full_scale - duty;
+        } else {
+            dst[i] = lead + duty;
+        }
+    }
+
+    DmaPool_PrepareTx(dst, PWMAUDIO_BLOCK * (uint32)audio_cfg->Channels * 4U);
+
+    audio_stats.Periods += PWMAUDIO_BLOCK;
+    audio_stats.Blocks++;
+}
+
+/**
+* @brief        Leading edge and duty of the output channels, changed on the same period
+*/
+static void SetOutputs(uint32 duty)
+{
+    uint32 mask = ((1UL << audio_cfg->Channels) - 1UL) << audio_cfg->Channel;
+
+    Emios_Pwm_Ip_ComparatorTransferDisable(audio_cfg->EmiosInstance, mask);
+    Emios_Pwm_Ip_UpdateUCRegA(audio_cfg->EmiosInstance, audio_cfg->Channel, (Emios_Pwm_Ip_PeriodType)audio_cfg->LeadTicks);
+    Emios_Pwm_Ip_UpdateUCRegB(audio_cfg->EmiosInstance, audio_cfg->Channel, (Emios_Pwm_Ip_PeriodType)(audio_cfg->LeadTicks + duty));
+    if (audio_cfg->Channels == 2U) {
+        Emios_Pwm_Ip_UpdateUCRegA(audio_cfg->EmiosInstance, audio_cfg->Channel + 1U, (Emios_Pwm_Ip_PeriodType)audio_cfg->LeadTicks);
+        Emios_Pwm_Ip_UpdateUCRegB(audio_cfg->EmiosInstance, audio_cfg->Channel + 1U, (Emios_Pwm_Ip_PeriodType)(audio_cfg->LeadTicks + full_scale - duty));
+    }
+    Emios_Pwm_Ip_ComparatorTransferEnable(audio_cfg->EmiosInstance, mask);
+}
+
+/**
+* @brief        Program the duty transfer
+* @details      On every counter bus flag the channel writes one period, Channels words, to
+*               the B registers of the outputs (destination stride = one unified channel,
+*               rewound by the minor loop offset). The major loop covers both halves and
+*               reloads by itself; the half and major interrupts mark the half just finished.
+*               The minor loop offset applies after the last iteration as well, so DLAST is 0.
+*/
+static Std_ReturnType ConfigureDma(const PwmAudio_ConfigType *cfg)
+{
+    Emios_Pwm_Ip_HwAddrType *base = Emios_Pwm_Ip_aBasePtr[cfg->EmiosInstance];
+    uint32 stride = (uint32)sizeof(base->CH.UC[0]);
+    uint32 period_bytes = (uint32)cfg->Channels * 4U;
+    Dma_Ip_ReturnType status;
+
+    const Dma_Ip_LogicChannelTransferListType list[TRANSFER_LIST_SIZE] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS,                   DmaPool_GetDmaAddress(dma_buffer) },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET,             4U },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_LAST_ADDR_ADJ,      (uint32)(-(sint32)(period_bytes * 2U * PWMAUDIO_BLOCK)) },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE,             DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS,              (uint32)&base->CH.UC[cfg->Channel].B },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET,        stride },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_LAST_ADDR_ADJ, 0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE,        DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_EN_DST_OFFSET,          (uint32)TRUE },
+        { DMA_IP_CH_SET_MINORLOOP_SIGNED_OFFSET,          (uint32)(-(sint32)(stride * cfg->Channels)) },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE,                   period_bytes },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT,                  2U * PWMAUDIO_BLOCK },
+        { DMA_IP_CH_SET_CONTROL_EN_MAJOR_INTERRUPT,       (uint32)TRUE },
+        { DMA_IP_CH_SET_CONTROL_EN_HALF_MAJOR_INTERRUPT,  (uint32)TRUE },
+    };
+
+    status = Dma_Ip_SetLogicChannelTransferList(cfg->DmaCh, list, TRANSFER_LIST_SIZE);
+
+    return (status == DMA_IP_STATUS_SUCCESS) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+#endif /* !PWMAUDIO_HOST */
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Reset the playback state and program the output channels and the DMA channel
+*/
+Std_ReturnType PwmAudio_Init(const PwmAudio_ConfigType * Config)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint32 i;
+
+#if !defined(PWMAUDIO_HOST)
+    /* The double buffer is allocated once and kept across re-initialisations */
+    if (dma_buffer == NULL_PTR) {
+        dma_buffer = (uint32 *)DmaPool_Alloc(2U * HALF_WORDS * 4U, DMAPOOL_REGION_SRAM);
+    }
+#endif
+
+    if (((Config->Channels == 1U) || (Config->Channels == 2U)) &&
+        (Config->Period <= PWMAUDIO_MAX_PERIOD) && (Config->LeadTicks < Config->Period) &&
+#if !defined(PWMAUDIO_HOST)
+        (((uint32)Config->Channel + Config->Channels) <= EMIOS_PWM_IP_CHANNEL_COUNT) &&
+        (dma_buffer != NULL_PTR) &&
+#endif
+        (Config->UpdateRateHz > 0U)) {
+        audio_cfg = Config;
+
+        queue_head = 0U;
+        queue_tail = 0U;
+        flush_pending = FALSE;
+        play_pos = 0U;
+        phase = 0U;
+        phase_step = IDLE_STEP;
+        history[0] = 0;
+        history[1] = 0;
+        history[2] = 0;
+        history[3] = 0;
+        silent_fetches = TAIL_SAMPLES;
+        for (i = 0U; i < (4U * HALFBAND_PAIRS); i++) {
+            hb_window[i] = 0;
+        }
+        hb_pos = 0U;
+        hb_doubled = FALSE;
+        hb_odd = FALSE;
+        shape_e1 = 0;
+        shape_e2 = 0;
+
+        full_scale = (uint32)Config->Period - Config->LeadTicks;
+        mid_q16 = (sint32)(full_scale << 15U);
+        PwmAudio_SetVolume((uint16)PWMAUDIO_VOLUME_MAX);
+
+        audio_stats.Buffers = 0U;
+        audio_stats.Samples = 0U;
+        audio_stats.Periods = 0U;
+        audio_stats.Blocks = 0U;
+        audio_stats.RenderCycles = 0U;
+        audio_stats.CyclesPerSample = 0U;
+
+#if !defined(PWMAUDIO_HOST)
+        SetOutputs(full_scale / 2U);
+        ret = ConfigureDma(Config);
+#else
+        ret = (Std_ReturnType)E_OK;
+#endif
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Queue a PCM buffer
+*/
+Std_ReturnType PwmAudio_Play(const void * Samples,
+                             uint32 Count,
+                             PwmAudio_FormatType Format,
+                             uint32 SampleRateHz)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    PwmAudioBuffer_t *buf;
+
+    if ((Samples != NULL_PTR) && (Count > 0U) &&
+        ((Format == PWMAUDIO_U8) || (Format == PWMAUDIO_S16)) &&
+        (SampleRateHz > 0U) && (SampleRateHz < audio_cfg->UpdateRateHz) &&
+        ((queue_head - queue_tail) < PWMAUDIO_QUEUE)) {
+        buf = &queue[queue_head % PWMAUDIO_QUEUE];
+        buf->samples = Samples;
+        buf->count = Count;
+        buf->format = Format;
+        buf->doubled = ((2U * SampleRateHz) < audio_cfg->UpdateRateHz) ? TRUE : FALSE;
+        buf->step = (uint32)(((uint64)SampleRateHz << ((buf->doubled == TRUE) ? 17U : 16U)) /
+                             audio_cfg->UpdateRateHz);
+
+        /* Publish the entry only once it is complete */
+        queue_head++;
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Drop every queued buffer
+*/
+void PwmAudio_Flush(void)
+{
+    flush_head = queue_head;
+    flush_pending = TRUE;
+}
+
+/**
+* @brief        TRUE while a buffer is queued or playing
+*/
+boolean PwmAudio_IsBusy(void)
+{
+    return (queue_head != queue_tail) ? TRUE : FALSE;
+}
+
+/**
+* @brief        Output scale, PWMAUDIO_VOLUME_MAX for full scale
+* @details      Full scale swings the duty over 0 ... Period - LeadTicks. The gain is the
+*               Q16 tick step of one 16-bit sample LSB: full_scale / 65536 * 65536 * Volume / 256.
+*/
+void PwmAudio_SetVolume(uint16 Volume)
+{
+    uint32 volume = (Volume > PWMAUDIO_VOLUME_MAX) ? PWMAUDIO_VOLUME_MAX : (uint32)Volume;
+
+    gain = (sint32)((full_scale * volume) >> 8U);
+}
+
+/**
+* @brief        Render duty values without the DMA
+*/
+void PwmAudio_Render(uint16 Duty[], uint32 Periods)
+{
+    uint32 i;
+
+    for (i = 0U; i < Periods; i++) {
+        Duty[i] = (uint16)NextDuty();
+    }
+
+    audio_stats.Periods += Periods;
+}
+
+#if !defined(PWMAUDIO_HOST)
+/**
+* @brief        Fill both buffer halves and enable the DMA request
+* @details      The channel is rewound to the start of the buffer, so the first half plays
+*               first and the first refill goes to it.
+*/
+void PwmAudio_Start(void)
+{
+    Timestamp_CyclesType start = Timestamp_Get();
+
+    RenderBlock(&dma_buffer[0]);
+    RenderBlock(&dma_buffer[PWMAUDIO_BLOCK * audio_cfg->Channels]);
+    audio_stats.RenderCycles += Timestamp_Get() - start;
+
+    (void)Dma_Ip_RearmLogicChannel(audio_cfg->DmaCh,
+                                   DmaPool_GetDmaAddress(dma_buffer),
+                                   (uint32)&Emios_Pwm_Ip_aBasePtr[audio_cfg->EmiosInstance]->CH.UC[audio_cfg->Channel].B,
+                                   2U * PWMAUDIO_BLOCK);
+    (void)Dma_Ip_SetLogicChannelCommand(audio_cfg->DmaCh, DMA_IP_CH_SET_HARDWARE_REQUEST);
+}
+
+/**
+* @brief        Disable the DMA request and put the outputs at silence
+* @details      Queued buffers stay queued and continue on the next PwmAudio_Start
+*/
+void PwmAudio_Stop(void)
+{
+    (void)Dma_Ip_SetLogicChannelCommand(audio_cfg->DmaCh, DMA_IP_CH_CLEAR_HARDWARE_REQUEST);
+    SetOutputs(full_scale / 2U);
+}
+
+/**
+* @brief        Refill the buffer half the DMA has left, to be called from the DmaCh callback
+* @details      The half and major interrupts share the callback, so the free half is taken
+*               from the current iteration count: above PWMAUDIO_BLOCK the eDMA is still in
+*               the first half (it just reloaded), else in the second one.
+*/
+void PwmAudio_DmaIrq(void)
+{
+    uint32 iter = 0U;
+    uint32 half;
+    Timestamp_CyclesType start = Timestamp_Get();
+
+    (void)Dma_Ip_GetLogicChannelParam(audio_cfg->DmaCh, DMA_IP_CH_GET_CURRENT_ITER_COUNT, &iter);
+    half = (iter > PWMAUDIO_BLOCK) ? 1U : 0U;
+
+    RenderBlock(&dma_buffer[half * PWMAUDIO_BLOCK * audio_cfg->Channels]);
+
+    audio_stats.RenderCycles += Timestamp_Get() - start;
+}
+#endif /* !PWMAUDIO_HOST */
+
+/**
+* @brief        Copy the playback statistics
+* @details      Cycles per sample counts input samples, so it includes the upsampling and
+*               shaping of every PWM period rendered from them.
+*/
+void PwmAudio_GetStatistics(PwmAudio_StatsType * Stats)
+{
+    audio_stats.CyclesPerSample = (audio_stats.Samples > 0U) ?
+                                  (uint32)(audio_stats.RenderCycles / audio_stats.Samples) : 0U;
+    *Stats = audio_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
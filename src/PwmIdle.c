@@ -0,0 +1,307 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Pwm.h"
+#include "Clock_Ip.h"
+#include "OsIf.h"
+#include "PwmIdle.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* Idle manager runtime state */
+typedef struct {
+    const PwmIdle_ConfigType *config;               /* Active configuration */
+    PwmIdle_StateType state;                        /* Current power state */
+    uint16 duty[PWMIDLE_MAX_CHANNELS];              /* Last requested duty per channel */
+    uint16 static_frames;                           /* Frames since the last duty change */
+    boolean changed;                                /* A duty changed during the current frame */
+    boolean gate_allowed;                           /* Every channel on EmiosClock is supervised */
+    boolean gated;                                  /* EmiosClock gated by the last park */
+    uint32 park_ref;                                /* OsIf reference taken when parking */
+    PwmIdle_StatsType stats;                        /* Accumulated statistics */
+} PwmIdleState_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static PwmIdleState_t idle_state;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static boolean AllChannelsStatic(void);
+static boolean InstanceSupervised(const PwmIdle_ConfigType *cfg);
+static void ParkOutputs(void);
+static void ResumeOutputs(void);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Check that every supervised channel sits on a static level
+* @details      Only 0% and 100% can be held by the output flip-flop once the eMIOS clock stops
+*/
+static boolean AllChannelsStatic(void)
+{
+    const PwmIdle_ConfigType *cfg = idle_state.config;
+    boolean is_static = TRUE;
+    uint8 i;
+
+    for (i = 0U; i < cfg->NumChannels; i++) {
+        if ((idle_state.duty[i] != PWMIDLE_DUTY_0) && (idle_state.duty[i] != PWMIDLE_DUTY_100)) {
+            is_static = FALSE;
+            break;
+        }
+    }
+
+    return is_static;
+}
+
+/**
+* @brief        Check that every channel clocked by EmiosClock is supervised
+* @details      A channel outside the supervised list may be modulating, so the clock it shares
+*               with the supervised channels can only be gated when there is none
+*/
+static boolean InstanceSupervised(const PwmIdle_ConfigType *cfg)
+{
+    boolean supervised = TRUE;
+    uint8 i;
+    uint8 j;
+
+    for (i = 0U; (i < cfg->NumInstanceChannels) && (supervised == TRUE); i++) {
+        supervised = FALSE;
+        for (j = 0U; j < cfg->NumChannels; j++) {
+            if (cfg->Channels[j] == cfg->InstanceChannels[i]) {
+                supervised = TRUE;
+                break;
+            }
+        }
+    }
+
+    return supervised;
+}
+
+/**
+* @brief        Park all supervised outputs and gate the eMIOS clock
+* @details      0% channels go to their configured idle state (which must be the inactive level),
+*               100% channels are already a constant active level and are left untouched. The
+*               clock is gated only when no other channel runs from it.
+*/
+static void ParkOutputs(void)
+{
+    const PwmIdle_ConfigType *cfg = idle_state.config;
+    uint8 i;
+
+    for (i = 0U; i < cfg->NumChannels; i++) {
+        if (idle_state.duty[i] == PWMIDLE_DUTY_0) {
+            Pwm_SetOutputToIdle(cfg->Channels[i]);
+        }
+    }
+
+    if ((cfg->GateClock == TRUE) && (idle_state.gate_allowed == TRUE)) {
+        Clock_Ip_DisableModuleClock(cfg->EmiosClock);
+        idle_state.gated = TRUE;
+    }
+
+    idle_state.park_ref = OsIf_GetCounter(OSIF_COUNTER_SYSTEM);
+    idle_state.state = PWMIDLE_STATE_PARKED;
+    idle_state.stats.ParkCount++;
+}
+
+/**
+* @brief        Ungate the eMIOS clock and restore the last requested duty cycles
+* @details      Pwm_SetDutyCycle reactivates channels left in idle by Pwm_SetOutputToIdle
+*/
+static void ResumeOutputs(void)
+{
+    const PwmIdle_ConfigType *cfg = idle_state.config;
+    uint32 ref;
+    uint32 latency;
+    uint8 i;
+
+    ref = OsIf_GetCounter(OSIF_COUNTER_SYSTEM);
+    idle_state.stats.ParkedTicks += ref - idle_state.park_ref;
+
+    if (idle_state.gated == TRUE) {
+        Clock_Ip_EnableModuleClock(cfg->EmiosClock);
+        idle_state.gated = FALSE;
+    }
+
+    for (i = 0U; i < cfg->NumChannels; i++) {
+        Pwm_SetDutyCycle(cfg->Channels[i], idle_state.duty[i]);
+    }
+
+    latency = OsIf_GetElapsed(&ref, OSIF_COUNTER_SYSTEM);
+
+    idle_state.stats.LastResumeTicks = latency;
+    if (latency > idle_state.stats.MaxResumeTicks) {
+        idle_state.stats.MaxResumeTicks = latency;
+    }
+    if (latency > cfg->ResumeBudgetTicks) {
+        idle_state.stats.ResumeBudgetMisses++;
+    }
+
+    idle_state.state = PWMIDLE_STATE_RUN;
+    idle_state.static_frames = 0U;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Initialize the idle manager
+* @details      Drives every supervised channel to 0% so the shadow duties match the hardware.
+*               A configuration with too many channels leaves the manager uninitialized.
+*/
+void PwmIdle_Init(const PwmIdle_ConfigType * Config)
+{
+    uint8 i;
+
+    /* Called again while parked: give the clock back before the channels are rewritten */
+    if ((idle_state.config != NULL_PTR) && (idle_state.gated == TRUE)) {
+        Clock_Ip_EnableModuleClock(idle_state.config->EmiosClock);
+        idle_state.gated = FALSE;
+    }
+    idle_state.config = NULL_PTR;
+
+    if ((Config != NULL_PTR) && (Config->NumChannels <= PWMIDLE_MAX_CHANNELS)) {
+        idle_state.state = PWMIDLE_STATE_RUN;
+        idle_state.static_frames = 0U;
+        idle_state.changed = FALSE;
+        idle_state.gate_allowed = InstanceSupervised(Config);
+        idle_state.gated = FALSE;
+        idle_state.park_ref = 0U;
+        PwmIdle_ResetStatistics();
+
+        for (i = 0U; i < Config->NumChannels; i++) {
+            idle_state.duty[i] = PWMIDLE_DUTY_0;
+            Pwm_SetDutyCycle(Config->Channels[i], PWMIDLE_DUTY_0);
+        }
+
+        idle_state.config = Config;
+    }
+}
+
+/**
+* @brief        Request a new duty cycle through the idle manager
+* @details      Unchanged duties are filtered so a static frame does not touch the driver
+*/
+void PwmIdle_SetDutyCycle(uint8 Index, uint16 DutyCycle)
+{
+    if ((idle_state.config != NULL_PTR) && (Index < idle_state.config->NumChannels) &&
+        (idle_state.duty[Index] != DutyCycle)) {
+        idle_state.duty[Index] = DutyCycle;
+        idle_state.changed = TRUE;
+
+        if (idle_state.state == PWMIDLE_STATE_PARKED) {
+            /* Resume restores every channel, including the one just changed */
+            ResumeOutputs();
+        } else {
+            Pwm_SetDutyCycle(idle_state.config->Channels[Index], DutyCycle);
+        }
+    }
+}
+
+/**
+* @brief        Frame tick of the idle manager
+* @details      Counts static frames and parks the outputs once the threshold is reached
+*/
+void PwmIdle_MainFunction(void)
+{
+    const PwmIdle_ConfigType *cfg = idle_state.config;
+
+    if (cfg != NULL_PTR) {
+        idle_state.stats.TotalFrames++;
+
+        if (idle_state.changed == TRUE) {
+            idle_state.changed = FALSE;
+            idle_state.static_frames = 0U;
+        } else if (idle_state.static_frames < 0xFFFFU) {
+            idle_state.static_frames++;
+        } else {
+            /* Saturated, nothing to count */
+        }
+
+        if (idle_state.state == PWMIDLE_STATE_PARKED) {
+            idle_state.stats.ParkedFrames++;
+        } else if ((idle_state.static_frames >= cfg->StaticFrames) && (AllChannelsStatic() == TRUE)) {
+            ParkOutputs();
+        } else {
+            /* Keep running */
+        }
+    }
+}
+
+/**
+* @brief        Return the current power state of the supervised outputs
+*/
+PwmIdle_StateType PwmIdle_GetState(void)
+{
+    return idle_state.state;
+}
+
+/**
+* @brief        Copy the idle manager statistics
+* @details      Time parked so far is included when called while the outputs are parked
+*/
+void PwmIdle_GetStatistics(PwmIdle_StatsType * Stats)
+{
+    *Stats = idle_state.stats;
+
+    if (idle_state.state == PWMIDLE_STATE_PARKED) {
+        Stats->ParkedTicks += OsIf_GetCounter(OSIF_COUNTER_SYSTEM) - idle_state.park_ref;
+    }
+}
+
+/**
+* @brief        Clear the idle manager statistics
+*/
+void PwmIdle_ResetStatistics(void)
+{
+    idle_state.stats.ParkCount = 0U;
+    idle_state.stats.ParkedFrames = 0U;
+    idle_state.stats.TotalFrames = 0U;
+    idle_state.stats.ParkedTicks = 0U;
+    idle_state.stats.LastResumeTicks = 0U;
+    idle_state.stats.MaxResumeTicks = 0U;
+    idle_state.stats.ResumeBudgetMisses = 0U;
+
+    if (idle_state.state == PWMIDLE_STATE_PARKED) {
+        idle_state.park_ref = OsIf_GetCounter(OSIF_COUNTER_SYSTEM);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,266 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Dma_Ip.h"
+#include "Flexio_Mcl_Ip.h"
+#include "Siul2_Dio_Ip.h"
+#include "FlexioTx.h"
+#include "FrameBuf.h"
+#include "ShiftOut.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define WORD_BITS             FLEXIOTX_WORD_BITS
+
+#define DMA_LIST_SIZE         (12U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* One spare word past the frame lets ShiftOut_SetChannel update a value straddling two words
+   as a pair; the eDMA never reads it */
+static FrameBuf_Type frames;
+
+static const ShiftOut_ConfigType *shift_cfg;
+static uint32 frame_words;
+static uint32 pad_bits;
+static uint32 shift_buffer;
+static volatile boolean shift_busy;
+static volatile boolean shift_done;
+
+static ShiftOut_StatsType shift_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static void ConfigureFlexio(const ShiftOut_ConfigType *cfg);
+static Std_ReturnType ConfigureDma(const ShiftOut_ConfigType *cfg);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Program the transmit shifter with SCLK, and the optional GSCLK
+* @details      The shifter changes the data on the falling SCLK edge. GSCLK is a free running
+*               50% PWM, independent of the data transfer.
+*/
+static void ConfigureFlexio(const ShiftOut_ConfigType *cfg)
+{
+    FLEXIO_Type *base = Flexio_Ip_paxBase[cfg->FlexioInstance];
+    uint16 half;
+
+    const FlexioTx_ConfigType tx = {
+        cfg->FlexioInstance, cfg->Shifter, cfg->ClockTimer, cfg->DataPin, cfg->ClockPin,
+        (uint8)WORD_BITS, FLEXIO_TIMER_POLARITY_NEGEDGE, cfg->ShiftClockDiv
+    };
+
+    shift_buffer = FlexioTx_Configure(&tx);
+
+    if (cfg->GsclkTimer != SHIFTOUT_NO_TIMER) {
+        half = (uint16)(cfg->GsclkDiv / 2U);
+        Flexio_Mcl_Ip_SetTimerCompare(base, cfg->GsclkTimer, (uint16)(((uint32)(half - 1U) << 8U) | (half - 1U)));
+        Flexio_Mcl_Ip_SetTimerConfig(base, cfg->GsclkTimer,
+                                     FLEXIO_TIMER_START_BIT_DISABLED,
+                                     FLEXIO_TIMER_STOP_BIT_DISABLED,
+                                     FLEXIO_TIMER_ENABLE_ALWAYS,
+                                     FLEXIO_TIMER_DISABLE_NEVER,
+                                     FLEXIO_TIMER_RESET_NEVER,
+                                     FLEXIO_TIMER_DECREMENT_CLK_SHIFT_TMR,
+                                     FLEXIO_TIMER_INITOUT_ONE);
+        Flexio_Mcl_Ip_SetTimerControl(base, cfg->GsclkTimer, 0U,
+                                      FLEXIO_TRIGGER_POLARITY_HIGH, FLEXIO_TRIGGER_SOURCE_INTERNAL,
+                                      cfg->GsclkPin, FLEXIO_PIN_POLARITY_HIGH, FLEXIO_PIN_CONFIG_OUTPUT,
+                                      FLEXIO_TIMER_MODE_8BIT_PWM);
+    }
+}
+
+/**
+* @brief        Program the frame transfer, one word per shifter request
+* @details      The hardware request is dropped at the end of the major loop, so the channel
+*               idles until ShiftOut_FrameTick rearms it on the next frame.
+*/
+static Std_ReturnType ConfigureDma(const ShiftOut_ConfigType *cfg)
+{
+    Dma_Ip_ReturnType status;
+
+    const Dma_Ip_LogicChannelTransferListType list[DMA_LIST_SIZE] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS,                   FrameBuf_FrontDmaAddress(&frames) },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET,             4U },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_LAST_ADDR_ADJ,      0U },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE,             DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS,              shift_buffer },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET,        0U },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_LAST_ADDR_ADJ, 0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE,        DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE,                   4U },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT,                  frame_words },
+        { DMA_IP_CH_SET_CONTROL_DIS_AUTO_REQUEST,         (uint32)TRUE },
+        { DMA_IP_CH_SET_CONTROL_EN_MAJOR_INTERRUPT,       (uint32)TRUE },
+    };
+
+    status = Dma_Ip_SetLogicChannelTransferList(cfg->DmaCh, list, DMA_LIST_SIZE);
+
+    return (status == DMA_IP_STATUS_SUCCESS) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Configure the shifter, the clock timers, the latch pin and the DMA channel
+* @details      The frame is padded at its start to whole words; the pad bits are shifted
+*               first and fall off the far end of the chain.
+*/
+Std_ReturnType ShiftOut_Init(const ShiftOut_ConfigType * Config)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint32 bits = (uint32)Config->Channels * Config->BitsPerChannel;
+
+    if ((Config->Channels > 0U) &&
+        (Config->BitsPerChannel > 0U) && (Config->BitsPerChannel <= 16U) &&
+        (bits <= (SHIFTOUT_MAX_WORDS * WORD_BITS)) &&
+        (FlexioTx_IsValidDivider(Config->ShiftClockDiv) == TRUE) &&
+        ((Config->GsclkTimer == SHIFTOUT_NO_TIMER) || (FlexioTx_IsValidDivider(Config->GsclkDiv) == TRUE)) &&
+        (FrameBuf_Init(&frames, (((bits + WORD_BITS - 1U) / WORD_BITS) + 1U) * 4U, 0U) == (Std_ReturnType)E_OK)) {
+        shift_cfg = Config;
+        frame_words = (bits + WORD_BITS - 1U) / WORD_BITS;
+        pad_bits = (frame_words * WORD_BITS) - bits;
+        shift_busy = FALSE;
+        shift_done = FALSE;
+
+        shift_stats.Frames = 0U;
+        shift_stats.Latches = 0U;
+        shift_stats.BitsPerFrame = frame_words * WORD_BITS;
+        shift_stats.MaxFrameMilliHz = 0U;
+
+        FlexioTx_InitInstance(Config->FlexioInstance);
+        Siul2_Dio_Ip_WritePin(Config->LatchPort, Config->LatchPin, 0U);
+        ConfigureFlexio(Config);
+        ret = ConfigureDma(Config);
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Set one output of the back buffer
+* @details      The stream starts with the pad, then channel Channels - 1 down to channel 0,
+*               each most significant bit first. Stream bit s is bit 31 - (s % 32) of word
+*               s / 32, so a value is a contiguous field of the word pair starting at its
+*               first word and is updated with one 64-bit read-modify-write.
+*/
+void ShiftOut_SetChannel(uint16 Channel, uint16 Value)
+{
+    uint32 *frame = FrameBuf_Back(&frames);
+    uint32 pos;
+    uint32 word;
+    uint32 shift;
+    uint64 mask;
+    uint64 pair;
+
+    if (Channel < shift_cfg->Channels) {
+        pos = pad_bits + ((uint32)(shift_cfg->Channels - 1U - Channel) * shift_cfg->BitsPerChannel);
+        word = pos / WORD_BITS;
+        shift = (2U * WORD_BITS) - (pos % WORD_BITS) - shift_cfg->BitsPerChannel;
+        mask = ((1ULL << shift_cfg->BitsPerChannel) - 1ULL) << shift;
+
+        pair = ((uint64)frame[word] << WORD_BITS) | frame[word + 1U];
+        pair = (pair & ~mask) | (((uint64)Value << shift) & mask);
+        frame[word] = (uint32)(pair >> WORD_BITS);
+        frame[word + 1U] = (uint32)pair;
+    }
+}
+
+/**
+* @brief        Shift the back buffer out from the next frame boundary on
+*/
+void ShiftOut_Present(void)
+{
+    FrameBuf_Present(&frames);
+}
+
+/**
+* @brief        TRUE while a presented buffer waits to be shifted out
+* @details      Do not draw into the back buffer while this is set, it is about to be sent
+*/
+boolean ShiftOut_IsPresentPending(void)
+{
+    return FrameBuf_IsPresentPending(&frames);
+}
+
+/**
+* @brief        Frame boundary: latch the frame shifted since the last call, start the next
+* @details      ShiftOut_FrameIrq fires when the last word enters the shifter buffer, up to
+*               two words before the last bit leaves the pin, hence the latch is deferred to
+*               the next boundary. A frame is only shifted when one was presented, so an idle
+*               chain costs no bus traffic.
+*/
+void ShiftOut_FrameTick(void)
+{
+    if (shift_done == TRUE) {
+        Siul2_Dio_Ip_WritePin(shift_cfg->LatchPort, shift_cfg->LatchPin, 1U);
+        Siul2_Dio_Ip_WritePin(shift_cfg->LatchPort, shift_cfg->LatchPin, 0U);
+        shift_stats.Latches++;
+        shift_done = FALSE;
+        shift_busy = FALSE;
+    }
+
+    if ((shift_busy == FALSE) && (FrameBuf_Swap(&frames) == TRUE)) {
+        shift_busy = TRUE;
+        (void)Dma_Ip_RearmLogicChannel(shift_cfg->DmaCh, FrameBuf_FrontDmaAddress(&frames), shift_buffer, frame_words);
+        (void)Dma_Ip_SetLogicChannelCommand(shift_cfg->DmaCh, DMA_IP_CH_SET_HARDWARE_REQUEST);
+    }
+}
+
+/**
+* @brief        End of a frame transfer, to be called from the DmaCh major loop callback
+*/
+void ShiftOut_FrameIrq(void)
+{
+    shift_stats.Frames++;
+    shift_done = TRUE;
+}
+
+/**
+* @brief        Copy the transfer statistics
+* @details      SCLK = FlexIO clock / ShiftClockDiv, frame rate = SCLK / BitsPerFrame. The
+*               FlexIO clock or two the clock timer needs to restart between words is ignored.
+*               A frame is shifted and latched in separate FrameTick periods, so the rate
+*               reached in practice is also bounded by the tick rate.
+*/
+void ShiftOut_GetStatistics(uint32 FlexioClockHz, ShiftOut_StatsType * Stats)
+{
+    shift_stats.MaxFrameMilliHz = (uint32)(((uint64)FlexioClockHz * 1000U) /
+                                           ((uint64)shift_cfg->ShiftClockDiv * shift_stats.BitsPerFrame));
+    *Stats = shift_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,206 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "StackMon.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define PAINT_PATTERN     (0xA5A5A5A5U)   /* STACK_PAINT_PATTERN of startup_cm7.s */
+
+/* NVIC interrupt active bit registers */
+#define NVIC_IABR         ((volatile const uint32 *)0xE000E300UL)
+#define NVIC_IABR_COUNT   (8U)
+
+#define IPSR_FIRST_IRQ    (16U)           /* Exception numbers below are system exceptions */
+
+#define REGION_SIZE(start, end)   ((uint32)(end) - (uint32)(start))
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint32 level_marks[STACKMON_MAX_LEVELS];
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+/* Linker script symbols */
+extern uint32 __Stack_dtcm_start[];
+extern uint32 __Stack_dtcm_end[];
+extern uint32 __INT_DTCM_FREE_START[];
+extern uint32 __ROM_CACHEABLE_START[];
+extern uint32 __ROM_CACHEABLE_END[];
+extern uint32 __BSS_SRAM_START[];
+extern uint32 __BSS_SRAM_END[];
+extern uint32 __ROM_NO_CACHEABLE_START[];
+extern uint32 __ROM_NO_CACHEABLE_END[];
+extern uint32 __BSS_SRAM_NC_START[];
+extern uint32 __BSS_SRAM_NC_END[];
+extern uint32 __BSS_SRAM_SH_START[];
+extern uint32 __BSS_SRAM_SH_END[];
+extern uint32 __ROM_DTCM_DATA_START[];
+extern uint32 __ROM_DTCM_END[];
+extern uint32 __dtcm_bss_start__[];
+extern uint32 __dtcm_bss_end__[];
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static uint8 NestingLevel(void);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Number of exceptions currently active
+* @details      Counts the active peripheral interrupts, plus one when a system exception
+*               (SysTick, SVC, fault) is running
+*/
+static uint8 NestingLevel(void)
+{
+    uint32 ipsr;
+    uint32 active;
+    uint8 level = 0U;
+    uint8 i;
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+
+    for (i = 0U; i < NVIC_IABR_COUNT; i++) {
+        for (active = NVIC_IABR[i]; active != 0U; active &= active - 1U) {
+            level++;
+        }
+    }
+    if ((ipsr != 0U) && (ipsr < IPSR_FIRST_IRQ)) {
+        level++;
+    }
+
+    return (level < STACKMON_MAX_LEVELS) ? level : (uint8)(STACKMON_MAX_LEVELS - 1U);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Measure the main stack high-water mark
+* @details      The stack grows down into the free DTCM, so both are scanned from the lowest
+*               painted word up to the first one that was overwritten
+*/
+void StackMon_GetStackUsage(StackMon_UsageType * Usage)
+{
+    const volatile uint32 *word = __INT_DTCM_FREE_START;
+    const uint32 *top = __Stack_dtcm_start;
+
+    while ((word < top) && (*word == PAINT_PATTERN)) {
+        word++;
+    }
+
+    Usage->Size = REGION_SIZE(__Stack_dtcm_end, __Stack_dtcm_start);
+    Usage->HighWater = REGION_SIZE(word, top);
+    Usage->DtcmUntouched = REGION_SIZE(__INT_DTCM_FREE_START, word);
+}
+
+/**
+* @brief        Record the current stack depth for the active interrupt nesting level
+* @details      Each level is only written by code running at that level, so no locking
+*               is needed
+*/
+void StackMon_Sample(void)
+{
+    uint32 sp;
+    uint32 depth;
+    uint8 level = NestingLevel();
+
+    __asm volatile ("mrs %0, msp" : "=r" (sp));
+
+    depth = (uint32)__Stack_dtcm_start - sp;
+    if (depth > level_marks[level]) {
+        level_marks[level] = depth;
+    }
+}
+
+/**
+* @brief        Deepest stack use recorded by StackMon_Sample at a nesting level
+*/
+uint32 StackMon_GetLevelMark(uint8 Level)
+{
+    uint32 mark = 0U;
+
+    if (Level < STACKMON_MAX_LEVELS) {
+        mark = level_marks[Level];
+    }
+
+    return mark;
+}
+
+/**
+* @brief        Size in bytes of a static RAM region
+* @details      Initialized data is sized from its load image
+*/
+uint32 StackMon_GetRamFootprint(StackMon_RegionType Region)
+{
+    uint32 size;
+
+    switch (Region) {
+        case STACKMON_REGION_SRAM_DATA:
+            size = REGION_SIZE(__ROM_CACHEABLE_START, __ROM_CACHEABLE_END);
+            break;
+        case STACKMON_REGION_SRAM_BSS:
+            size = REGION_SIZE(__BSS_SRAM_START, __BSS_SRAM_END);
+            break;
+        case STACKMON_REGION_NOCACHE_DATA:
+            size = REGION_SIZE(__ROM_NO_CACHEABLE_START, __ROM_NO_CACHEABLE_END);
+            break;
+        case STACKMON_REGION_NOCACHE_BSS:
+            size = REGION_SIZE(__BSS_SRAM_NC_START, __BSS_SRAM_NC_END);
+            break;
+        case STACKMON_REGION_SHARED_BSS:
+            size = REGION_SIZE(__BSS_SRAM_SH_START, __BSS_SRAM_SH_END);
+            break;
+        case STACKMON_REGION_DTCM_DATA:
+            size = REGION_SIZE(__ROM_DTCM_DATA_START, __ROM_DTCM_END);
+            break;
+        case STACKMON_REGION_DTCM_BSS:
+            size = REGION_SIZE(__dtcm_bss_start__, __dtcm_bss_end__);
+            break;
+        case STACKMON_REGION_DTCM_FREE:
+            size = REGION_SIZE(__INT_DTCM_FREE_START, __Stack_dtcm_end);
+            break;
+        case STACKMON_REGION_STACK:
+            size = REGION_SIZE(__Stack_dtcm_end, __Stack_dtcm_start);
+            break;
+        default:
+            size = 0U;
+            break;
+    }
+
+    return size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
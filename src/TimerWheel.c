@@ -0,0 +1,411 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "OsIf.h"
+#include "TimerWheel.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* One timer of the pool */
+typedef struct {
+    uint32 expires;                     /* Wheel tick of the next expiry */
+    uint32 period;                      /* Re-arm interval, 0 for one-shot */
+    TimerWheel_CallbackType callback;
+    void *context;
+    uint16 prev;                        /* Neighbours in the slot list */
+    uint16 next;                        /* Next in the slot list or the free list */
+    uint16 slot;                        /* Slot list holding the timer, SLOT_FREE if unused */
+    uint16 generation;                  /* Handle generation, advanced on release */
+} TimerWheelEntry_t;
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define SLOT_MASK         (TIMERWHEEL_SLOTS - 1U)
+#define WHEEL_SLOTS       (TIMERWHEEL_SLOTS * TIMERWHEEL_LEVELS)
+#define SLOT_DUE          (WHEEL_SLOTS)         /* Extra list of timers expiring this tick */
+#define SLOT_FREE         (0xFFFFU)
+
+/* Ticks covered by the levels below level n, and by the whole wheel */
+#define LEVEL_SPAN(n)     (1UL << (TIMERWHEEL_SLOT_BITS * (n)))
+#define WHEEL_SPAN        (LEVEL_SPAN(TIMERWHEEL_LEVELS))
+
+/* Generations per pool entry; the largest handle stays below TIMERWHEEL_NO_TIMER */
+#define GENERATIONS       (0xFFFFU / TIMERWHEEL_MAX_TIMERS)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static TimerWheelEntry_t timers[TIMERWHEEL_MAX_TIMERS];
+static uint16 slot_head[WHEEL_SLOTS + 1U];
+static uint16 free_head;
+
+static uint32 wheel_now;                /* Current wheel tick */
+static uint32 tick_length;              /* OsIf counter ticks per wheel tick */
+static uint32 counter_ref;              /* Reference for OsIf_GetElapsed */
+static uint32 counter_residual;         /* Counter ticks not yet turned into wheel ticks */
+static uint16 tick_work;                /* Timers handled on the current tick */
+
+static TimerWheel_StatsType wheel_stats;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static void Link(uint16 timer, uint16 slot);
+static void Unlink(uint16 timer);
+static void Place(uint16 timer);
+static void Arm(uint16 timer, uint32 delay);
+static void Release(uint16 timer);
+static uint16 Lookup(TimerWheel_TimerType handle);
+static void Cascade(uint32 level);
+static void CollectDue(void);
+static uint32 RunDue(void);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Push a timer on the front of a slot list
+*/
+static void Link(uint16 timer, uint16 slot)
+{
+    uint16 head = slot_head[slot];
+
+    timers[timer].slot = slot;
+    timers[timer].prev = TIMERWHEEL_NO_TIMER;
+    timers[timer].next = head;
+    if (head != TIMERWHEEL_NO_TIMER) {
+        timers[head].prev = timer;
+    }
+    slot_head[slot] = timer;
+}
+
+/**
+* @brief        Remove a timer from its slot list
+*/
+static void Unlink(uint16 timer)
+{
+    TimerWheelEntry_t *entry = &timers[timer];
+
+    if (entry->prev != TIMERWHEEL_NO_TIMER) {
+        timers[entry->prev].next = entry->next;
+    } else {
+        slot_head[entry->slot] = entry->next;
+    }
+    if (entry->next != TIMERWHEEL_NO_TIMER) {
+        timers[entry->next].prev = entry->prev;
+    }
+}
+
+/**
+* @brief        Link a timer into the level and slot of its expiry tick
+* @details      The level is the one whose span holds the remaining delay, so every timer in
+*               a level 0 slot is due when the wheel reaches it. Delays beyond the wheel wait
+*               in the top level slot reached last and are placed again from there.
+*/
+static void Place(uint16 timer)
+{
+    uint32 delta = timers[timer].expires - wheel_now;
+    uint32 tick = timers[timer].expires;
+    uint32 level = 0U;
+
+    if (delta >= WHEEL_SPAN) {
+        tick = wheel_now + (WHEEL_SPAN - 1U);
+        level = TIMERWHEEL_LEVELS - 1U;
+    } else {
+        while (delta >= LEVEL_SPAN(level + 1U)) {
+            level++;
+        }
+    }
+
+    Link(timer, (uint16)((level * TIMERWHEEL_SLOTS) + ((tick >> (TIMERWHEEL_SLOT_BITS * level)) & SLOT_MASK)));
+}
+
+/**
+* @brief        Schedule a timer delay ticks from now
+*/
+static void Arm(uint16 timer, uint32 delay)
+{
+    timers[timer].expires = wheel_now + ((delay == 0U) ? 1U : delay);
+    Place(timer);
+}
+
+/**
+* @brief        Put an unlinked timer back on the free list
+* @details      Its generation moves on, so handles to this use of the entry go stale
+*/
+static void Release(uint16 timer)
+{
+    timers[timer].slot = SLOT_FREE;
+    timers[timer].generation = (uint16)((timers[timer].generation + 1U) % GENERATIONS);
+    timers[timer].next = free_head;
+    free_head = timer;
+
+    wheel_stats.InUse--;
+}
+
+/**
+* @brief        Pool index of a running timer, TIMERWHEEL_NO_TIMER for a stale or bad handle
+*/
+static uint16 Lookup(TimerWheel_TimerType handle)
+{
+    uint16 timer = TIMERWHEEL_NO_TIMER;
+    uint16 index = (uint16)(handle % TIMERWHEEL_MAX_TIMERS);
+
+    if ((handle != TIMERWHEEL_NO_TIMER) &&
+        (timers[index].slot != SLOT_FREE) &&
+        (timers[index].generation == (handle / TIMERWHEEL_MAX_TIMERS))) {
+        timer = index;
+    }
+
+    return timer;
+}
+
+/**
+* @brief        Move the timers of the current slot of a level down the wheel
+* @details      Called when the levels below have completed a turn, so the slot holds
+*               the timers due within the span of the levels below
+*/
+static void Cascade(uint32 level)
+{
+    uint16 slot = (uint16)((level * TIMERWHEEL_SLOTS) +
+                           ((wheel_now >> (TIMERWHEEL_SLOT_BITS * level)) & SLOT_MASK));
+    uint16 timer = slot_head[slot];
+    uint16 next;
+
+    slot_head[slot] = TIMERWHEEL_NO_TIMER;
+    while (timer != TIMERWHEEL_NO_TIMER) {
+        next = timers[timer].next;
+        Place(timer);
+        tick_work++;
+        timer = next;
+    }
+}
+
+/**
+* @brief        Move the timers expiring on the current tick to the due list
+* @details      Every timer in the level 0 slot of the current tick is due, nothing else is
+*               looked at
+*/
+static void CollectDue(void)
+{
+    uint16 slot = (uint16)(wheel_now & SLOT_MASK);
+    uint16 timer = slot_head[slot];
+    uint16 next;
+
+    slot_head[slot] = TIMERWHEEL_NO_TIMER;
+    while (timer != TIMERWHEEL_NO_TIMER) {
+        next = timers[timer].next;
+        Link(timer, (uint16)SLOT_DUE);
+        tick_work++;
+        timer = next;
+    }
+
+    if (tick_work > wheel_stats.MaxSlotScan) {
+        wheel_stats.MaxSlotScan = tick_work;
+    }
+}
+
+/**
+* @brief        Run the callbacks of the due list
+* @details      The list head is taken again after every callback, so callbacks may cancel
+*               timers that are due on the same tick
+*/
+static uint32 RunDue(void)
+{
+    TimerWheel_CallbackType callback;
+    void *context;
+    uint16 timer;
+    uint32 count = 0U;
+
+    while (slot_head[SLOT_DUE] != TIMERWHEEL_NO_TIMER) {
+        timer = slot_head[SLOT_DUE];
+        callback = timers[timer].callback;
+        context = timers[timer].context;
+
+        Unlink(timer);
+        if (timers[timer].period != 0U) {
+            Arm(timer, timers[timer].period);
+        } else {
+            Release(timer);
+        }
+
+        wheel_stats.Expired++;
+        count++;
+        callback(context);
+    }
+
+    return count;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Empty the wheel and start counting ticks on the OsIf system timer
+*/
+void TimerWheel_Init(uint32 TickPeriodUs)
+{
+    uint16 i;
+
+    for (i = 0U; i < TIMERWHEEL_MAX_TIMERS; i++) {
+        timers[i].slot = SLOT_FREE;
+        timers[i].generation = 0U;
+        timers[i].next = ((i + 1U) < TIMERWHEEL_MAX_TIMERS) ? (uint16)(i + 1U) : TIMERWHEEL_NO_TIMER;
+    }
+    free_head = 0U;
+
+    for (i = 0U; i <= WHEEL_SLOTS; i++) {
+        slot_head[i] = TIMERWHEEL_NO_TIMER;
+    }
+
+    wheel_now = 0U;
+    tick_length = OsIf_MicrosToTicks(TickPeriodUs, OSIF_COUNTER_SYSTEM);
+    if (tick_length == 0U) {
+        tick_length = 1U;
+    }
+    counter_ref = OsIf_GetCounter(OSIF_COUNTER_SYSTEM);
+    counter_residual = 0U;
+
+    wheel_stats.Expired = 0U;
+    wheel_stats.Failures = 0U;
+    wheel_stats.InUse = 0U;
+    wheel_stats.PeakInUse = 0U;
+    wheel_stats.MaxSlotScan = 0U;
+}
+
+/**
+* @brief        Start a timer
+*/
+TimerWheel_TimerType TimerWheel_Start(uint32 Delay,
+                                      uint32 Period,
+                                      TimerWheel_CallbackType Callback,
+                                      void * Context)
+{
+    TimerWheel_TimerType handle = TIMERWHEEL_NO_TIMER;
+    uint16 timer = free_head;
+
+    if (timer != TIMERWHEEL_NO_TIMER) {
+        free_head = timers[timer].next;
+
+        timers[timer].period = Period;
+        timers[timer].callback = Callback;
+        timers[timer].context = Context;
+        Arm(timer, Delay);
+
+        wheel_stats.InUse++;
+        if (wheel_stats.InUse > wheel_stats.PeakInUse) {
+            wheel_stats.PeakInUse = wheel_stats.InUse;
+        }
+        handle = (TimerWheel_TimerType)(timer + (timers[timer].generation * TIMERWHEEL_MAX_TIMERS));
+    } else {
+        wheel_stats.Failures++;
+    }
+
+    return handle;
+}
+
+/**
+* @brief        Stop a timer and return it to the pool
+*/
+Std_ReturnType TimerWheel_Cancel(TimerWheel_TimerType Timer)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint16 timer = Lookup(Timer);
+
+    if (timer != TIMERWHEEL_NO_TIMER) {
+        Unlink(timer);
+        Release(timer);
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Move the next expiry of a running timer to Delay ticks from now
+*/
+Std_ReturnType TimerWheel_Reschedule(TimerWheel_TimerType Timer, uint32 Delay)
+{
+    Std_ReturnType ret = (Std_ReturnType)E_NOT_OK;
+    uint16 timer = Lookup(Timer);
+
+    if (timer != TIMERWHEEL_NO_TIMER) {
+        Unlink(timer);
+        Arm(timer, Delay);
+        ret = (Std_ReturnType)E_OK;
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Advance the wheel by the time elapsed since the last call and run due callbacks
+*/
+uint32 TimerWheel_Process(void)
+{
+    uint32 count = 0U;
+    uint32 level;
+
+    counter_residual += OsIf_GetElapsed(&counter_ref, OSIF_COUNTER_SYSTEM);
+
+    while (counter_residual >= tick_length) {
+        counter_residual -= tick_length;
+        wheel_now++;
+        tick_work = 0U;
+
+        /* Levels whose lower levels just completed a turn move down, highest first */
+        level = 1U;
+        while ((level < TIMERWHEEL_LEVELS) && ((wheel_now & (LEVEL_SPAN(level) - 1U)) == 0U)) {
+            level++;
+        }
+        while (level > 1U) {
+            level--;
+            Cascade(level);
+        }
+
+        CollectDue();
+        count += RunDue();
+    }
+
+    return count;
+}
+
+/**
+* @brief        Copy the wheel statistics
+*/
+void TimerWheel_GetStatistics(TimerWheel_StatsType * Stats)
+{
+    *Stats = wheel_stats;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
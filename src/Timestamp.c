@@ -0,0 +1,399 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#if defined(TIMESTAMP_HOST) && !defined(_POSIX_C_SOURCE)
+/* clock_gettime under -std=c99 */
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#if defined(TIMESTAMP_HOST)
+#include <time.h>
+#endif
+#include "Clock_Ip.h"
+#if !defined(TIMESTAMP_HOST)
+#include "Dwt.h"
+#endif
+#include "Timestamp.h"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/* Conversion factor as integer part plus 32-bit binary fraction */
+typedef struct {
+    uint32 whole;
+    uint32 frac;
+} TimestampScale_t;
+
+/* Span of constant core clock, from one frequency update to the next */
+typedef struct {
+    Timestamp_CyclesType start;         /* Cycle count at the update */
+    uint64 start_ns;                    /* Nanoseconds since Timestamp_Init at that count */
+    uint32 frequency;
+    TimestampScale_t ns_scale;          /* Nanoseconds per cycle */
+    TimestampScale_t cycle_scale;       /* Cycles per nanosecond */
+} TimestampClockEpoch_t;
+
+#if defined(TIMESTAMP_HOST)
+/* Rate of the simulated counter from one frequency update on */
+typedef struct {
+    uint64 start_ns;                    /* CLOCK_MONOTONIC at the update */
+    uint64 start_count;
+    uint32 frequency;
+} TimestampHostBase_t;
+#endif
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define NS_PER_SECOND     (1000000000UL)
+
+/* Cycle count past every epoch start, selects the current clock epoch */
+#define TIMESTAMP_NOW     (0xFFFFFFFFFFFFFFFFULL)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Half periods of the cycle counter elapsed; bit 0 mirrors counter bit 31 at the last update */
+static volatile uint32 ts_epoch;
+
+/* Ring of the latest clock epochs; ts_clock_seq counts updates and selects the current entry.
+   Only the task switching the clock writes, readers copy an entry and check it was not reused */
+static TimestampClockEpoch_t ts_clock_epochs[TIMESTAMP_CLOCK_EPOCHS];
+static volatile uint32 ts_clock_seq;
+
+#if defined(TIMESTAMP_HOST)
+static TimestampHostBase_t host_bases[2U];
+static volatile uint32 host_base_seq;
+#endif
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static TimestampScale_t MakeScale(uint32 num, uint32 den);
+static uint64 ApplyScale(const TimestampScale_t *scale, uint64 value);
+static void FindEpoch(Timestamp_CyclesType stamp, TimestampClockEpoch_t *epoch);
+#if defined(TIMESTAMP_HOST)
+static uint64 HostNow(void);
+static uint64 HostCount(const TimestampHostBase_t *base, uint64 now);
+static uint32 HostCounter(void);
+static void HostSetRate(uint32 freq);
+#endif
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Precompute num / den for multiply-only conversions
+*/
+static TimestampScale_t MakeScale(uint32 num, uint32 den)
+{
+    TimestampScale_t scale;
+
+    scale.whole = num / den;
+    scale.frac = (uint32)(((uint64)(num % den) << 32U) / den);
+
+    return scale;
+}
+
+/**
+* @brief        value * scale without a 64-bit division
+* @details      The fraction is applied to both halves of the value separately so no
+*               intermediate product overflows
+*/
+static uint64 ApplyScale(const TimestampScale_t *scale, uint64 value)
+{
+    uint64 hi = value >> 32U;
+    uint64 lo = value & 0xFFFFFFFFULL;
+
+    return (value * scale->whole) + (hi * scale->frac) + ((lo * scale->frac) >> 32U);
+}
+
+/**
+* @brief        Copy the clock epoch a cycle count falls in
+* @details      Walks back from the current epoch. The writer reuses the oldest entry of the
+*               ring, so the copy is retried when enough updates happened meanwhile to reach
+*               the entry copied. Counts older than the ring get its oldest epoch.
+*/
+static void FindEpoch(Timestamp_CyclesType stamp, TimestampClockEpoch_t *epoch)
+{
+    uint32 seq;
+    uint32 index;
+
+    do {
+        seq = __atomic_load_n(&ts_clock_seq, __ATOMIC_ACQUIRE);
+        index = seq;
+        *epoch = ts_clock_epochs[index % TIMESTAMP_CLOCK_EPOCHS];
+        while ((stamp < epoch->start) && (index != 0U) && ((seq - index) < (TIMESTAMP_CLOCK_EPOCHS - 2U))) {
+            index--;
+            *epoch = ts_clock_epochs[index % TIMESTAMP_CLOCK_EPOCHS];
+        }
+    } while ((__atomic_load_n(&ts_clock_seq, __ATOMIC_ACQUIRE) - index) >= (TIMESTAMP_CLOCK_EPOCHS - 1U));
+}
+
+#if defined(TIMESTAMP_HOST)
+/**
+* @brief        CLOCK_MONOTONIC in nanoseconds
+*/
+static uint64 HostNow(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64)ts.tv_sec * NS_PER_SECOND) + (uint64)ts.tv_nsec;
+}
+
+/**
+* @brief        Simulated cycle count at now
+* @details      Whole seconds and the remainder are scaled separately so the product fits in
+*               64 bits at any core clock.
+*/
+static uint64 HostCount(const TimestampHostBase_t *base, uint64 now)
+{
+    uint64 elapsed = now - base->start_ns;
+
+    return base->start_count + ((elapsed / NS_PER_SECOND) * base->frequency) +
+           (((elapsed % NS_PER_SECOND) * base->frequency) / NS_PER_SECOND);
+}
+
+/**
+* @brief        Stand-in for DWT_CYCCNT: CLOCK_MONOTONIC scaled to the cached core clock
+* @details      The base is a sequence lock, odd while a rate change is written. The time is
+*               read inside it, so no count is extrapolated at the old rate past a change.
+*/
+static uint32 HostCounter(void)
+{
+    TimestampHostBase_t base;
+    uint64 now;
+    uint32 seq;
+
+    do {
+        seq = __atomic_load_n(&host_base_seq, __ATOMIC_SEQ_CST);
+        base = host_bases[(seq >> 1U) & 1U];
+        now = HostNow();
+    } while (((seq & 1U) != 0U) || (__atomic_load_n(&host_base_seq, __ATOMIC_SEQ_CST) != seq));
+
+    return (uint32)HostCount(&base, now);
+}
+
+/**
+* @brief        Change the rate of the simulated counter without a jump in its value
+*/
+static void HostSetRate(uint32 freq)
+{
+    uint32 seq = host_base_seq;
+    const TimestampHostBase_t *old = &host_bases[(seq >> 1U) & 1U];
+    TimestampHostBase_t *next = &host_bases[((seq >> 1U) + 1U) & 1U];
+    uint64 now;
+
+    __atomic_store_n(&host_base_seq, seq + 1U, __ATOMIC_SEQ_CST);
+    now = HostNow();
+    next->start_count = (old->frequency != 0U) ? HostCount(old, now) : 0U;
+    next->start_ns = now;
+    next->frequency = freq;
+    __atomic_store_n(&host_base_seq, seq + 2U, __ATOMIC_SEQ_CST);
+}
+#endif
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Start the DWT cycle counter and cache the core clock frequency
+* @details      The counter is left at its value, ApiStats or a debugger may be measuring with
+*               it: the first epoch starts at the count read here instead of at zero.
+*/
+void Timestamp_Init(void)
+{
+    uint32 freq = (uint32)Clock_Ip_GetClockFrequency(CORE_CLK);
+    TimestampClockEpoch_t *epoch = &ts_clock_epochs[0U];
+    uint32 count;
+
+#if defined(TIMESTAMP_HOST)
+    HostSetRate(freq);
+    count = HostCounter();
+#else
+    DWT_START_CYCCNT();
+    count = DWT_CYCCNT;
+#endif
+
+    /* Bit 0 mirrors counter bit 31, no half period elapsed yet */
+    ts_epoch = count >> 31U;
+
+    epoch->start = (Timestamp_CyclesType)count;
+    epoch->start_ns = 0U;
+    epoch->frequency = freq;
+    if (freq != 0U) {
+        epoch->ns_scale = MakeScale(NS_PER_SECOND, freq);
+        epoch->cycle_scale = MakeScale(freq, NS_PER_SECOND);
+    }
+    ts_clock_seq = 0U;
+}
+
+/**
+* @brief        Reload the cached core clock frequency
+*/
+void Timestamp_UpdateFrequency(void)
+{
+    Timestamp_SetFrequency((uint32)Clock_Ip_GetClockFrequency(CORE_CLK));
+}
+
+/**
+* @brief        Start a new clock epoch at the given core clock frequency
+* @details      The epoch starts at the current count, and its nanosecond origin is that count
+*               converted by the previous epoch, so Timestamp_ToNs stays continuous.
+*/
+void Timestamp_SetFrequency(uint32 Frequency)
+{
+    uint32 seq = ts_clock_seq;
+    const TimestampClockEpoch_t *last = &ts_clock_epochs[seq % TIMESTAMP_CLOCK_EPOCHS];
+    TimestampClockEpoch_t *next = &ts_clock_epochs[(seq + 1U) % TIMESTAMP_CLOCK_EPOCHS];
+    Timestamp_CyclesType now;
+
+    if ((Frequency != 0U) && (Frequency != last->frequency)) {
+#if defined(TIMESTAMP_HOST)
+        HostSetRate(Frequency);
+#endif
+        now = Timestamp_Get();
+
+        next->start = now;
+        next->start_ns = last->start_ns + ApplyScale(&last->ns_scale, now - last->start);
+        next->frequency = Frequency;
+        next->ns_scale = MakeScale(NS_PER_SECOND, Frequency);
+        next->cycle_scale = MakeScale(Frequency, NS_PER_SECOND);
+        __atomic_store_n(&ts_clock_seq, seq + 1U, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+* @brief        Monotonic 64-bit cycle count
+* @details      The epoch is sampled before the counter. If counter bit 31 no longer matches
+*               epoch bit 0 the counter has crossed a half period since the last update, so the
+*               epoch is advanced by one. The update is a compare-and-swap from the sampled
+*               value: a reader preempted by a newer update cannot move the epoch backwards.
+*/
+Timestamp_CyclesType Timestamp_Get(void)
+{
+    uint32 epoch = ts_epoch;
+#if defined(TIMESTAMP_HOST)
+    uint32 count = HostCounter();
+#else
+    uint32 count = DWT_CYCCNT;
+#endif
+    uint32 expected = epoch;
+
+    if ((epoch & 1U) != (count >> 31U)) {
+        epoch++;
+        (void)__atomic_compare_exchange_n(&ts_epoch, &expected, epoch, 0,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+
+    return ((Timestamp_CyclesType)(epoch >> 1U) << 32U) | (Timestamp_CyclesType)count;
+}
+
+/**
+* @brief        Keep the software extension up to date
+*/
+void Timestamp_Poll(void)
+{
+    (void)Timestamp_Get();
+}
+
+/**
+* @brief        Nanoseconds since Timestamp_Init at a cycle count
+* @details      Each count converts at the frequency of its own clock epoch. Counts older than
+*               the ring are extrapolated from its oldest epoch.
+*/
+uint64 Timestamp_ToNs(Timestamp_CyclesType Stamp)
+{
+    TimestampClockEpoch_t epoch;
+    uint64 ns;
+
+    FindEpoch(Stamp, &epoch);
+
+    if (Stamp >= epoch.start) {
+        ns = epoch.start_ns + ApplyScale(&epoch.ns_scale, Stamp - epoch.start);
+    } else {
+        ns = epoch.start_ns - ApplyScale(&epoch.ns_scale, epoch.start - Stamp);
+    }
+
+    return ns;
+}
+
+/**
+* @brief        Nanoseconds since Timestamp_Init
+*/
+uint64 Timestamp_GetNs(void)
+{
+    return Timestamp_ToNs(Timestamp_Get());
+}
+
+/**
+* @brief        Nanoseconds between two cycle counts, across clock switches
+*/
+uint64 Timestamp_ElapsedNs(Timestamp_CyclesType Start, Timestamp_CyclesType End)
+{
+    return Timestamp_ToNs(End) - Timestamp_ToNs(Start);
+}
+
+/**
+* @brief        Convert cycles to nanoseconds at the current frequency
+*/
+uint64 Timestamp_CyclesToNs(Timestamp_CyclesType Cycles)
+{
+    TimestampClockEpoch_t epoch;
+
+    FindEpoch(TIMESTAMP_NOW, &epoch);
+
+    return ApplyScale(&epoch.ns_scale, Cycles);
+}
+
+/**
+* @brief        Convert nanoseconds to cycles at the current frequency
+*/
+Timestamp_CyclesType Timestamp_NsToCycles(uint64 Ns)
+{
+    TimestampClockEpoch_t epoch;
+
+    FindEpoch(TIMESTAMP_NOW, &epoch);
+
+    return ApplyScale(&epoch.cycle_scale, Ns);
+}
+
+/**
+* @brief        Current core clock frequency in Hz
+*/
+uint32 Timestamp_GetFrequency(void)
+{
+    return ts_clock_epochs[ts_clock_seq % TIMESTAMP_CLOCK_EPOCHS].frequency;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,277 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Mcl.h"
+#include "Trgmux_Ip.h"
+#include "TrigRoute.h"
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Nodes in topological order (sources first), filled by TrigRoute_Validate */
+static uint8 node_order[TRIGROUTE_MAX_NODES];
+static uint8 node_count;
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static TrigRoute_ResultType CheckEdges(const TrigRoute_GraphType *graph, uint8 *failed);
+static TrigRoute_ResultType SortNodes(const TrigRoute_GraphType *graph, uint8 *failed);
+static uint8 LoopEdge(const TrigRoute_GraphType *graph, const uint8 *indegree);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Check node ranges and conflicting sinks
+* @details      Two edges conflict when they program the same TRGMUX trigger or LCU input
+*               with different selections
+*/
+static TrigRoute_ResultType CheckEdges(const TrigRoute_GraphType *graph, uint8 *failed)
+{
+    const TrigRoute_EdgeType *a;
+    const TrigRoute_EdgeType *b;
+    TrigRoute_ResultType ret = TRIGROUTE_OK;
+    uint8 i;
+    uint8 j;
+
+    for (i = 0U; (i < graph->NumEdges) && (ret == TRIGROUTE_OK); i++) {
+        a = &graph->Edges[i];
+        if ((a->From >= graph->NumNodes) || (a->To >= graph->NumNodes)) {
+            ret = TRIGROUTE_BAD_NODE;
+            *failed = i;
+        } else if (a->From == a->To) {
+            ret = TRIGROUTE_CYCLE;
+            *failed = i;
+        } else {
+            for (j = 0U; j < i; j++) {
+                b = &graph->Edges[j];
+                if ((a->Kind == b->Kind) && (a->Target == b->Target) &&
+                    (a->Kind != TRIGROUTE_EDGE_DMA_REQUEST) && (a->Value != b->Value)) {
+                    ret = TRIGROUTE_CONFLICT;
+                    *failed = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Topological sort of the nodes (Kahn)
+* @details      Nodes left with incoming edges after the sort are part of a loop
+*/
+static TrigRoute_ResultType SortNodes(const TrigRoute_GraphType *graph, uint8 *failed)
+{
+    uint8 indegree[TRIGROUTE_MAX_NODES];
+    TrigRoute_ResultType ret = TRIGROUTE_OK;
+    uint8 head = 0U;
+    uint8 node;
+    uint8 i;
+
+    for (i = 0U; i < graph->NumNodes; i++) {
+        indegree[i] = 0U;
+    }
+    for (i = 0U; i < graph->NumEdges; i++) {
+        indegree[graph->Edges[i].To]++;
+    }
+
+    node_count = 0U;
+    for (i = 0U; i < graph->NumNodes; i++) {
+        if (indegree[i] == 0U) {
+            node_order[node_count] = i;
+            node_count++;
+        }
+    }
+
+    /* node_order doubles as the work queue */
+    while (head < node_count) {
+        node = node_order[head];
+        head++;
+        for (i = 0U; i < graph->NumEdges; i++) {
+            if (graph->Edges[i].From == node) {
+                indegree[graph->Edges[i].To]--;
+                if (indegree[graph->Edges[i].To] == 0U) {
+                    node_order[node_count] = graph->Edges[i].To;
+                    node_count++;
+                }
+            }
+        }
+    }
+
+    if (node_count < graph->NumNodes) {
+        ret = TRIGROUTE_CYCLE;
+        *failed = LoopEdge(graph, indegree);
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Find an edge that lies on a loop
+* @details      Nodes left with incoming edges after the sort are on a loop or downstream of one.
+*               Nodes without an outgoing edge inside that set are pruned until every node left
+*               has one, then following the first such edge from any node for NumNodes steps
+*               ends on a loop, and the edge taken from there is part of it
+*/
+static uint8 LoopEdge(const TrigRoute_GraphType *graph, const uint8 *indegree)
+{
+    boolean left[TRIGROUTE_MAX_NODES];
+    boolean pruned = TRUE;
+    boolean leaves;
+    uint8 node = 0U;
+    uint8 edge = TRIGROUTE_NO_EDGE;
+    uint8 i;
+    uint8 n;
+
+    for (i = 0U; i < graph->NumNodes; i++) {
+        left[i] = (indegree[i] != 0U) ? TRUE : FALSE;
+    }
+
+    while (pruned == TRUE) {
+        pruned = FALSE;
+        for (n = 0U; n < graph->NumNodes; n++) {
+            if (left[n] == TRUE) {
+                leaves = FALSE;
+                for (i = 0U; i < graph->NumEdges; i++) {
+                    if ((graph->Edges[i].From == n) && (left[graph->Edges[i].To] == TRUE)) {
+                        leaves = TRUE;
+                        break;
+                    }
+                }
+                if (leaves == FALSE) {
+                    left[n] = FALSE;
+                    pruned = TRUE;
+                }
+            }
+        }
+    }
+
+    for (n = 0U; n < graph->NumNodes; n++) {
+        if (left[n] == TRUE) {
+            node = n;
+            break;
+        }
+    }
+
+    for (n = 0U; n <= graph->NumNodes; n++) {
+        for (i = 0U; i < graph->NumEdges; i++) {
+            if ((graph->Edges[i].From == node) && (left[graph->Edges[i].To] == TRUE)) {
+                edge = i;
+                break;
+            }
+        }
+        node = graph->Edges[edge].To;
+    }
+
+    return edge;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        Check a graph for bad nodes, conflicting sinks and loops
+*/
+TrigRoute_ResultType TrigRoute_Validate(const TrigRoute_GraphType * Graph, uint8 * FailedEdge)
+{
+    TrigRoute_ResultType ret = TRIGROUTE_BAD_NODE;
+
+    *FailedEdge = TRIGROUTE_NO_EDGE;
+
+    if ((Graph->NumNodes <= TRIGROUTE_MAX_NODES) && (Graph->NumEdges <= TRIGROUTE_MAX_EDGES)) {
+        ret = CheckEdges(Graph, FailedEdge);
+        if (ret == TRIGROUTE_OK) {
+            ret = SortNodes(Graph, FailedEdge);
+        }
+    }
+
+    return ret;
+}
+
+/**
+* @brief        Validate and apply a graph in one pass
+* @details      Consumers are armed first: DMA requests, then all LCU input selections in one
+*               list, then the TRGMUX edges in reverse topological order
+*/
+TrigRoute_ResultType TrigRoute_Apply(const TrigRoute_GraphType * Graph, uint8 * FailedEdge)
+{
+    Mcl_LcuSyncInputValueType lcu_list[TRIGROUTE_MAX_EDGES];
+    const TrigRoute_EdgeType *edge;
+    TrigRoute_ResultType ret;
+    uint8 lcu_count = 0U;
+    uint8 node;
+    uint8 i;
+    uint8 n;
+
+    ret = TrigRoute_Validate(Graph, FailedEdge);
+
+    if (ret == TRIGROUTE_OK) {
+        for (i = 0U; i < Graph->NumEdges; i++) {
+            edge = &Graph->Edges[i];
+            if (edge->Kind == TRIGROUTE_EDGE_DMA_REQUEST) {
+                Mcl_SetDmaChannelCommand(edge->Target, MCL_DMA_CH_START_REQUEST);
+            } else if (edge->Kind == TRIGROUTE_EDGE_LCU_INPUT) {
+                lcu_list[lcu_count].LogicInputId = (uint8)edge->Target;
+                lcu_list[lcu_count].Value = (uint8)edge->Value;
+                lcu_count++;
+            } else {
+                /* TRGMUX edges follow below */
+            }
+        }
+
+        if (lcu_count > 0U) {
+            Mcl_SetLcuSyncInputMuxSelect(lcu_list, lcu_count);
+        }
+
+        for (n = node_count; (n > 0U) && (ret == TRIGROUTE_OK); n--) {
+            node = node_order[n - 1U];
+            for (i = 0U; i < Graph->NumEdges; i++) {
+                edge = &Graph->Edges[i];
+                if ((edge->Kind == TRIGROUTE_EDGE_TRGMUX) && (edge->From == node)) {
+                    if (Trgmux_Ip_SetInput(edge->Target, edge->Value) != TRGMUX_IP_STATUS_SUCCESS) {
+                        ret = TRIGROUTE_LOCKED;
+                        *FailedEdge = i;
+                        break;
+                    }
+                    if (edge->Lock == TRUE) {
+                        Mcl_SetTrgMuxLock(edge->Target);
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -27,6 +27,7 @@ extern "C" {
 #include "Mcu.h"
 #include "Port.h"
 #include "Mcl.h"
+#include "OsIf.h"
 
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
@@ -305,6 +306,9 @@ int main(void)
     /* Initialize clock tree */
     Mcu_InitClock(McuClockSettingConfig_0);
 
+    /* Start the cycle counter behind the OsIf custom timer and Timestamp */
+    OsIf_Init(NULL_PTR);
+
     /* Apply mode configuration */
     Mcu_SetMode(McuModeSettingConf_0);
 
@@ -0,0 +1,271 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of ApiStats, built with the Pwm and eMIOS driver sources on the register model of
+* rtd/ and PWM_API_STATS on, the driver reporting through the callouts of ApiStats.c. The OsIf
+* interrupt suspension stands in for the PRIMASK save and restore of the target: one lock, taken
+* recursively, so threads recording at once see the same exclusion. Calls of a fixed length carry
+* the 64-bit sum across 2^32 on nearly every call while a reader takes snapshots: each one has
+* to be whole, Sum equal to Count calls of that length. Pwm_SetDutyCycle is then measured on
+* the host clock, and the benchmark gives the cost of a tracked and an untracked record.
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include "host_test.h"
+#include "Pwm.h"
+#include "Pwm_Host.h"
+#include "Det_Host.h"
+#include "OsIf.h"
+#include "ApiStats.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CALL_TICKS          (0xC0000000UL)  /* Every call carries the low word of the sum */
+#define FAKE_SERVICE        (0x10U)
+#define WRITERS             (4U)
+#define CALLS               (200000U)       /* Calls per writer */
+#define PWM_CALLS           (1000U)
+#define BENCH_CALLS         (1000000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32 nesting;
+static uint32 suspends;
+
+static uint32 fake_now;
+static volatile uint32 writers_done;
+
+static const ApiStats_ServiceType services[] = {
+    { APISTATS_PWM, PWM_SETDUTYCYCLE_ID },
+    { APISTATS_MCL, FAKE_SERVICE },
+    { APISTATS_MCL, FAKE_SERVICE },         /* Duplicate, ignored */
+    { APISTATS_MODULES, 0U }                /* Not a driver, ignored */
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        OsIf stand-ins: one lock for all contexts, nesting as on the target
+*/
+void OsIf_SuspendAllInterrupts(void)
+{
+    if (nesting == 0U) {
+        (void)pthread_mutex_lock(&lock);
+        suspends++;
+    }
+    nesting++;
+}
+
+void OsIf_ResumeAllInterrupts(void)
+{
+    nesting--;
+    if (nesting == 0U) {
+        (void)pthread_mutex_unlock(&lock);
+    }
+}
+
+/**
+* @brief        Tick source of the fake service, moved by the test
+*/
+static uint32 FakeClock(void)
+{
+    return fake_now;
+}
+
+/**
+* @brief        Every field of one fake call, also across the 32-bit sum
+*/
+static void FieldTest(void)
+{
+    ApiStats_StatsType stats;
+    uint32 i;
+
+    ApiStats_Init(services, (uint8)(sizeof(services) / sizeof(services[0])), FakeClock);
+    CHECK(ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, &stats) == (Std_ReturnType)E_OK);
+    CHECK((stats.Count == 0U) && (stats.Min == 0U) && (stats.Max == 0U) && (stats.Sum == 0U));
+    CHECK(ApiStats_Get(APISTATS_PORT, FAKE_SERVICE, &stats) == (Std_ReturnType)E_NOT_OK);
+    CHECK(ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, NULL_PTR) == (Std_ReturnType)E_NOT_OK);
+
+    /* 10, 0 and three calls of CALL_TICKS, the start before the clock wraps */
+    fake_now = 5U;
+    ApiStats_Stop(APISTATS_MCL, FAKE_SERVICE, 0xFFFFFFFBUL);
+    ApiStats_Stop(APISTATS_MCL, FAKE_SERVICE, 5U);
+    for (i = 0U; i < 3U; i++) {
+        ApiStats_Stop(APISTATS_MCL, FAKE_SERVICE, (uint32)(5UL - CALL_TICKS));
+    }
+    /* Untracked: nothing recorded */
+    ApiStats_Stop(APISTATS_PORT, FAKE_SERVICE, 0U);
+
+    CHECK(ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, &stats) == (Std_ReturnType)E_OK);
+    CHECK(stats.Count == 5U);
+    CHECK(stats.Sum == (10ULL + (3ULL * CALL_TICKS)));
+    CHECK((stats.Min == 0U) && (stats.Max == CALL_TICKS));
+    CHECK(stats.Mean == (uint32)((10ULL + (3ULL * CALL_TICKS)) / 5U));
+    CHECK((stats.Histogram[0] == 1U) && (stats.Histogram[3] == 1U) && (stats.Histogram[31] == 3U));
+
+    ApiStats_Reset();
+    CHECK(ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, &stats) == (Std_ReturnType)E_OK);
+    CHECK((stats.Count == 0U) && (stats.Sum == 0U) && (stats.Histogram[31] == 0U));
+}
+
+/**
+* @brief        Calls of CALL_TICKS from one thread
+*/
+static void *Writer(void *arg)
+{
+    uint32 i;
+
+    (void)arg;
+    for (i = 0U; i < CALLS; i++) {
+        ApiStats_Stop(APISTATS_MCL, FAKE_SERVICE, (uint32)(fake_now - CALL_TICKS));
+        if ((i % 64U) == 0U) {
+            (void)sched_yield();
+        }
+    }
+    (void)__atomic_add_fetch(&writers_done, 1U, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/**
+* @brief        Snapshots until the writers are done: Sum, Count and the histogram agree
+*/
+static void *Reader(void *arg)
+{
+    uint32 *torn = (uint32 *)arg;
+    ApiStats_StatsType stats;
+
+    while (__atomic_load_n(&writers_done, __ATOMIC_ACQUIRE) < WRITERS) {
+        (void)ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, &stats);
+        *torn += ((stats.Sum != ((uint64)stats.Count * CALL_TICKS)) ||
+                  (stats.Histogram[31] != stats.Count)) ? 1U : 0U;
+        (void)sched_yield();
+    }
+
+    return NULL;
+}
+
+/**
+* @brief        Writers on every context against a reader, the sum carrying on each call
+*/
+static void ConcurrencyTest(void)
+{
+    pthread_t writers[WRITERS];
+    pthread_t reader;
+    ApiStats_StatsType stats;
+    uint32 torn = 0U;
+    uint32 i;
+
+    ApiStats_Init(services, (uint8)(sizeof(services) / sizeof(services[0])), FakeClock);
+    writers_done = 0U;
+    (void)pthread_create(&reader, NULL, Reader, &torn);
+    for (i = 0U; i < WRITERS; i++) {
+        (void)pthread_create(&writers[i], NULL, Writer, NULL);
+    }
+    for (i = 0U; i < WRITERS; i++) {
+        (void)pthread_join(writers[i], NULL);
+    }
+    (void)pthread_join(reader, NULL);
+
+    (void)ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, &stats);
+    printf("concurrency: %u writers, %u calls of 0x%lx ticks, sum 0x%llx, %u torn snapshots\n",
+           WRITERS, stats.Count, CALL_TICKS, (unsigned long long)stats.Sum, torn);
+    CHECK(stats.Count == (WRITERS * CALLS));
+    CHECK(stats.Sum == ((uint64)WRITERS * CALLS * CALL_TICKS));
+    CHECK(stats.Histogram[31] == (WRITERS * CALLS));
+    CHECK(torn == 0U);
+    CHECK(nesting == 0U);
+}
+
+/**
+* @brief        The driver reporting its own calls on the host clock
+*/
+static void PwmTest(void)
+{
+    ApiStats_StatsType stats;
+    uint32 i;
+
+    ApiStats_Init(services, (uint8)(sizeof(services) / sizeof(services[0])), NULL_PTR);
+    Pwm_Host_Setup(1000U, 500U);
+    Det_Host_Clear();
+    Pwm_Init(&Pwm_Host_Config);
+    for (i = 0U; i < PWM_CALLS; i++) {
+        Pwm_SetDutyCycle((Pwm_ChannelType)(i % 8U), (uint16)(i & 0x7FFFU));
+    }
+    /* Not tracked */
+    Pwm_SetPeriodAndDuty(0U, 2000U, 0x4000U);
+    CHECK(Det_Host_Errors == 0U);
+
+    CHECK(ApiStats_Get(APISTATS_PWM, PWM_SETDUTYCYCLE_ID, &stats) == (Std_ReturnType)E_OK);
+    printf("Pwm_SetDutyCycle: %u calls, min %u, mean %u, max %u ns\n", stats.Count, stats.Min,
+           stats.Mean, stats.Max);
+    CHECK(stats.Count == PWM_CALLS);
+    CHECK((stats.Min > 0U) && (stats.Min <= stats.Mean) && (stats.Mean <= stats.Max));
+    CHECK(ApiStats_Get(APISTATS_PWM, PWM_SETPERIODANDDUTY_ID, &stats) == (Std_ReturnType)E_NOT_OK);
+    Pwm_DeInit();
+}
+
+/**
+* @brief        Cost of a record, tracked and untracked, and of a snapshot
+*/
+static void Benchmark(void)
+{
+    ApiStats_StatsType stats;
+    double t0;
+    double t1;
+    double t2;
+    double t3;
+    uint32 i;
+
+    ApiStats_Init(services, (uint8)(sizeof(services) / sizeof(services[0])), FakeClock);
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        ApiStats_Stop(APISTATS_MCL, FAKE_SERVICE, ApiStats_Start() - i);
+    }
+    t1 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        ApiStats_Stop(APISTATS_PORT, FAKE_SERVICE, ApiStats_Start() - i);
+    }
+    t2 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        (void)ApiStats_Get(APISTATS_MCL, FAKE_SERVICE, &stats);
+    }
+    t3 = host_test_ns();
+
+    printf("Start + Stop tracked: %.1f ns, untracked: %.1f ns, Get: %.1f ns (host lock for the suspend)\n",
+           (t1 - t0) / BENCH_CALLS, (t2 - t1) / BENCH_CALLS, (t3 - t2) / BENCH_CALLS);
+    CHECK(stats.Count == BENCH_CALLS);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    FieldTest();
+    ConcurrencyTest();
+    PwmTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,343 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Counter bus allocation at configuration time: reads the PWM outputs of the board, runs
+* BusAlloc_Solve and prints the eMIOS tables to take into the Mcl and Pwm configuration, the
+* master buses for Mcl and the channels for Pwm, with the placement as a comment above them.
+* The channel fields the allocator does not decide (prescalers, polarity, notifications) are
+* printed with their reset choice. Unsatisfiable input is reported with the line at fault.
+*
+*   BusAllocTool <outputs>.csv
+*
+* One output per line, '#' starts a comment:
+*
+*   name, instance, channels, period, phase, edge|center|internal, group|-
+*
+* where channels lists the channels the pin can be muxed to, as 3 or 1|9 or 0-7.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BusAlloc.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define NAME_LENGTH         (32U)
+#define LINE_LENGTH         (256U)
+#define FIELDS              (7U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static BusAlloc_RequestType requests[BUSALLOC_MAX_REQUESTS];
+static char names[BUSALLOC_MAX_REQUESTS][NAME_LENGTH];
+static unsigned int lines[BUSALLOC_MAX_REQUESTS];
+static unsigned int request_count;
+static BusAlloc_SolutionType solution;
+
+static const char *const results[] = {
+    "ok", "bad request", "more bus periods than buses", "no channel", "phase offsets split over buses"
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Strip blanks around a field
+*/
+static char *Trim(char *field)
+{
+    char *end;
+
+    while ((*field == ' ') || (*field == '\t')) {
+        field++;
+    }
+    end = field + strlen(field);
+    while ((end > field) && ((end[-1] == ' ') || (end[-1] == '\t') || (end[-1] == '\r') || (end[-1] == '\n'))) {
+        end--;
+    }
+    *end = '\0';
+
+    return field;
+}
+
+/**
+* @brief        Decimal number up to max
+*/
+static int ParseNumber(const char *field, unsigned long max, unsigned long *value)
+{
+    char *end;
+
+    *value = strtoul(field, &end, 10);
+
+    return (end != field) && (*end == '\0') && (*value <= max);
+}
+
+/**
+* @brief        Channel list: numbers and ranges separated by '|'
+*/
+static int ParseChannels(char *field, uint32 *mask)
+{
+    char *item;
+    char *dash;
+    unsigned long first;
+    unsigned long last;
+    unsigned long c;
+    int ok = 1;
+
+    *mask = 0UL;
+    for (item = strtok(field, "|"); (item != NULL) && ok; item = strtok(NULL, "|")) {
+        item = Trim(item);
+        dash = strchr(item, '-');
+        if (dash != NULL) {
+            *dash = '\0';
+            ok = ParseNumber(Trim(item), BUSALLOC_CHANNELS - 1U, &first) &&
+                 ParseNumber(Trim(dash + 1), BUSALLOC_CHANNELS - 1U, &last) && (first <= last);
+        } else {
+            ok = ParseNumber(item, BUSALLOC_CHANNELS - 1U, &first);
+            last = first;
+        }
+        for (c = first; ok && (c <= last); c++) {
+            *mask |= (1UL << c);
+        }
+    }
+
+    return ok && (*mask != 0UL);
+}
+
+/**
+* @brief        One output line into the next request
+*/
+static int ParseOutput(char *line, unsigned int number)
+{
+    BusAlloc_RequestType *req = &requests[request_count];
+    char *fields[FIELDS];
+    unsigned long value;
+    unsigned int count = 0U;
+    char *p = line;
+    char *comma;
+    int ok;
+
+    while ((count < FIELDS) && (p != NULL)) {
+        comma = strchr(p, ',');
+        if (comma != NULL) {
+            *comma = '\0';
+        }
+        fields[count++] = Trim(p);
+        p = (comma != NULL) ? (comma + 1) : NULL;
+    }
+    if ((count != FIELDS) || (p != NULL) || (request_count == BUSALLOC_MAX_REQUESTS)) {
+        return 0;
+    }
+
+    (void)snprintf(names[request_count], NAME_LENGTH, "%s", fields[0]);
+    lines[request_count] = number;
+    ok = ParseNumber(fields[1], BUSALLOC_INSTANCES - 1U, &value);
+    req->Instance = (uint8)value;
+    ok = ok && ParseChannels(fields[2], &req->ChannelMask);
+    ok = ok && ParseNumber(fields[3], 0xFFFFUL, &value);
+    req->Period = (uint16)value;
+    ok = ok && ParseNumber(fields[4], 0xFFFFUL, &value);
+    req->Phase = (uint16)value;
+    if (strcmp(fields[5], "edge") == 0) {
+        req->Count = BUSALLOC_EDGE_ALIGNED;
+    } else if (strcmp(fields[5], "center") == 0) {
+        req->Count = BUSALLOC_CENTER_ALIGNED;
+    } else if (strcmp(fields[5], "internal") == 0) {
+        req->Count = BUSALLOC_INTERNAL;
+    } else {
+        ok = 0;
+    }
+    if (strcmp(fields[6], "-") == 0) {
+        req->SyncGroup = BUSALLOC_NO_GROUP;
+    } else {
+        ok = ok && ParseNumber(fields[6], BUSALLOC_NO_GROUP - 1U, &value);
+        req->SyncGroup = (uint8)value;
+    }
+    if (ok) {
+        request_count++;
+    }
+
+    return ok;
+}
+
+/**
+* @brief        Placement of every output, as a comment
+*/
+static void PrintPlacement(const char *input)
+{
+    static const char *const buses[] = { "A", "BCDE", "F", "internal" };
+    const BusAlloc_AssignType *assign;
+    unsigned int r;
+
+    printf("/*\n* eMIOS counter buses from %s: %u outputs, %u buses, %u split sync groups\n*\n",
+           input, request_count, solution.NumBuses, solution.SplitGroups);
+    printf("* %-16s %8s %7s %8s %6s %6s %7s\n", "output", "instance", "channel", "bus", "master", "phase", "maxduty");
+    for (r = 0U; r < request_count; r++) {
+        assign = &solution.Assign[r];
+        printf("* %-16s %8u %7u %8s ", names[r], requests[r].Instance, assign->Channel, buses[assign->Bus]);
+        if (assign->MasterChannel == BUSALLOC_NO_MASTER) {
+            printf("%6s", "-");
+        } else {
+            printf("%6u", assign->MasterChannel);
+        }
+        printf(" %6u %7u\n", assign->PhaseShift, assign->MaxDuty);
+    }
+    printf("*/\n");
+}
+
+/**
+* @brief        Master buses of every instance, Emios_Ip_MasterBusConfigType
+*/
+static void PrintMasterBuses(void)
+{
+    const BusAlloc_BusCfgType *bus;
+    unsigned int instance;
+    unsigned int b;
+    unsigned int n;
+
+    for (instance = 0U; instance < BUSALLOC_INSTANCES; instance++) {
+        for (n = 0U, b = 0U; b < solution.NumBuses; b++) {
+            n += (solution.Buses[b].Instance == instance) ? 1U : 0U;
+        }
+        if (n == 0U) {
+            continue;
+        }
+        printf("\n/* Mcl: master buses of eMIOS_%u, prescalers at divide by 1 */\n", instance);
+        printf("const Emios_Ip_MasterBusConfigType BusAlloc_Emios%u_MasterBuses[%u] =\n{\n", instance, n);
+        for (b = 0U; b < solution.NumBuses; b++) {
+            bus = &solution.Buses[b];
+            if (bus->Instance == instance) {
+                n--;
+                printf("    { %uU, %s, %uU, 0U, 0U, 0U, FALSE }%s\n", bus->MasterChannel,
+                       (bus->Count == BUSALLOC_CENTER_ALIGNED) ? "EMIOS_IP_MCB_UP_DOWN_COUNTER" : "EMIOS_IP_MCB_UP_COUNTER",
+                       bus->Period, (n != 0U) ? "," : "");
+            }
+        }
+        printf("};\n");
+    }
+}
+
+/**
+* @brief        PWM channels of every instance, Emios_Pwm_Ip_ChannelConfigType
+*/
+static void PrintChannels(void)
+{
+    static const char *const modes[] = {
+        "EMIOS_PWM_IP_MODE_OPWMB_FLAG", "EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG", "EMIOS_PWM_IP_MODE_OPWFMB_FLAG"
+    };
+    static const char *const timebases[] = {
+        "EMIOS_PWM_IP_BUS_A", "EMIOS_PWM_IP_BUS_BCDE", "EMIOS_PWM_IP_BUS_F", "EMIOS_PWM_IP_BUS_INTERNAL"
+    };
+    const BusAlloc_AssignType *assign;
+    unsigned int instance;
+    unsigned int r;
+    unsigned int n;
+
+    for (instance = 0U; instance < BUSALLOC_INSTANCES; instance++) {
+        for (n = 0U, r = 0U; r < request_count; r++) {
+            n += (requests[r].Instance == instance) ? 1U : 0U;
+        }
+        if (n == 0U) {
+            continue;
+        }
+        printf("\n/* Pwm: channels of eMIOS_%u, starting at 0%% duty */\n", instance);
+        printf("const Emios_Pwm_Ip_ChannelConfigType BusAlloc_Emios%u_Channels[%u] =\n{\n", instance, n);
+        for (r = 0U; r < request_count; r++) {
+            assign = &solution.Assign[r];
+            if (requests[r].Instance == instance) {
+                n--;
+                printf("    /* %s */\n", names[r]);
+                printf("    {\n");
+                printf("        .ChannelId = %uU,\n", assign->Channel);
+                printf("        .Mode = %s,\n", modes[requests[r].Count]);
+                printf("        .Timebase = %s,\n", timebases[assign->Bus]);
+                printf("        .DebugMode = FALSE,\n");
+                printf("        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,\n");
+                printf("        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,\n");
+                printf("        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,\n");
+                printf("        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,\n");
+                printf("        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,\n");
+                printf("        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,\n");
+                printf("        .PeriodCount = %uU,\n", assign->MaxDuty);
+                printf("        .DutyCycle = 0U,\n");
+                printf("        .PhaseShift = %uU,\n", assign->PhaseShift);
+                printf("        .DeadTime = 0U,\n");
+                printf("        .TriggerPosition = 0U\n");
+                printf("    }%s\n", (n != 0U) ? "," : "");
+            }
+        }
+        printf("};\n");
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(int argc, char **argv)
+{
+    char line[LINE_LENGTH];
+    char *text;
+    FILE *file;
+    unsigned int number = 0U;
+    BusAlloc_ResultType result;
+    uint8 failed;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: BusAllocTool <outputs>.csv\n");
+        return 2;
+    }
+    file = fopen(argv[1], "r");
+    if (file == NULL) {
+        perror(argv[1]);
+        return 2;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        number++;
+        text = strchr(line, '#');
+        if (text != NULL) {
+            *text = '\0';
+        }
+        text = Trim(line);
+        if ((*text != '\0') && !ParseOutput(text, number)) {
+            fprintf(stderr, "%s:%u: not an output line\n", argv[1], number);
+            (void)fclose(file);
+            return 1;
+        }
+    }
+    (void)fclose(file);
+
+    result = BusAlloc_Solve(requests, (uint8)request_count, &solution, &failed);
+    if (result != BUSALLOC_OK) {
+        if (failed < request_count) {
+            fprintf(stderr, "%s:%u: %s: %s\n", argv[1], lines[failed], names[failed], results[result]);
+        } else {
+            fprintf(stderr, "%s: %s\n", argv[1], results[result]);
+        }
+        return 1;
+    }
+
+    PrintPlacement(argv[1]);
+    PrintMasterBuses();
+    PrintChannels();
+
+    return 0;
+}
@@ -0,0 +1,262 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Host test of the counter bus allocator. A phase-staggered sync group has to stay on one bus
+* even when that costs a bus, and is reported when it cannot; the placement carries the phase
+* into PhaseShift and the room it leaves into MaxDuty. The benchmark solves a full board of
+* outputs, which the tool does at configuration time, and a 70-output board where every pin can
+* go to any channel: 70 outputs on 72 channels leave room for two bus channels, so every output
+* beyond the two shared periods runs on its internal counter.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "BusAlloc.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CH(c)               (1UL << (c))
+#define ANY_CH              ((1UL << BUSALLOC_CHANNELS) - 1UL)
+#define BENCH_ROUNDS        (200U)
+#define BENCH_LIMIT_NS      (10000000.0)    /* Per solve, generous for a loaded host */
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static BusAlloc_RequestType req[BUSALLOC_MAX_REQUESTS];
+static BusAlloc_SolutionType sol;
+static uint8 count;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Append one request
+*/
+static void Add(uint8 Instance, uint32 Mask, uint16 Period, uint16 Phase, BusAlloc_CountType Count, uint8 Group)
+{
+    req[count].Instance = Instance;
+    req[count].ChannelMask = Mask;
+    req[count].Period = Period;
+    req[count].Phase = Phase;
+    req[count].Count = Count;
+    req[count].SyncGroup = Group;
+    count++;
+}
+
+/**
+* @brief        Three periods in blocks 0..2 of instance 0, P1 a sync group on channels 1 and 9
+*/
+static void ThreePeriods(uint16 Phase)
+{
+    count = 0U;
+    Add(0U, CH(1), 1000U, 0U, BUSALLOC_EDGE_ALIGNED, 5U);
+    Add(0U, CH(9), 1000U, Phase, BUSALLOC_EDGE_ALIGNED, 5U);
+    Add(0U, CH(2), 2000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(0U, CH(10), 2000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(0U, CH(18), 2000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(0U, CH(3), 3000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(0U, CH(11), 3000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(0U, CH(19), 3000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+}
+
+/**
+* @brief        Phased sync groups are never split, in-phase ones may be
+*/
+static void PhaseTest(void)
+{
+    uint8 failed;
+
+    /* In phase: the group may be split over the local buses, which saves one */
+    ThreePeriods(0U);
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_OK);
+    CHECK(failed == BUSALLOC_NO_REQUEST);
+    CHECK(sol.NumBuses == 4U);
+    CHECK(sol.SplitGroups == 1U);
+
+    /* Staggered: one more bus keeps both members on the same master */
+    ThreePeriods(250U);
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_OK);
+    CHECK(sol.NumBuses == 5U);
+    CHECK(sol.SplitGroups == 0U);
+    CHECK(sol.Assign[0].MasterChannel == sol.Assign[1].MasterChannel);
+    CHECK(sol.Assign[1].PhaseShift == 250U);
+    CHECK(sol.Assign[1].MaxDuty == 750U);
+    CHECK(sol.Assign[0].PhaseShift == 0U);
+    CHECK(sol.Assign[0].MaxDuty == 1000U);
+
+    /* A fourth period takes the last bus: the staggered group has nowhere to go */
+    Add(0U, CH(17), 4000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_PHASE_SPLIT);
+    CHECK(failed == 1U);
+
+    /* ...which fits once the phases agree */
+    req[1].Phase = 0U;
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_OK);
+
+    /* Staggered over two instances can never share a bus */
+    count = 0U;
+    Add(0U, CH(1), 1000U, 0U, BUSALLOC_EDGE_ALIGNED, 2U);
+    Add(1U, CH(1), 1000U, 100U, BUSALLOC_EDGE_ALIGNED, 2U);
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_PHASE_SPLIT);
+    CHECK(failed == 1U);
+
+    /* The same over one instance, in phase, is a plain split group */
+    req[1].Phase = 0U;
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_OK);
+    CHECK(sol.SplitGroups == 1U);
+}
+
+/**
+* @brief        Requests the allocator refuses, and the MaxDuty of a centre-aligned output
+*/
+static void ErrorTest(void)
+{
+    uint8 failed;
+    uint8 c;
+
+    /* Phase on a counter that has no bus to count it from */
+    count = 0U;
+    Add(0U, CH(4), 1000U, 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(0U, CH(5), 1000U, 100U, BUSALLOC_INTERNAL, BUSALLOC_NO_GROUP);
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_BAD_REQUEST);
+    CHECK(failed == 1U);
+    req[1].Count = BUSALLOC_CENTER_ALIGNED;
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_BAD_REQUEST);
+    CHECK(failed == 1U);
+
+    /* Phase beyond the period */
+    req[1].Count = BUSALLOC_EDGE_ALIGNED;
+    req[1].Phase = 1000U;
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_BAD_REQUEST);
+    req[1].Phase = 999U;
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_OK);
+    CHECK(sol.Assign[1].MaxDuty == 1U);
+
+    /* Up/down: the duty runs up to twice the period register */
+    count = 0U;
+    Add(2U, CH(6), 500U, 0U, BUSALLOC_CENTER_ALIGNED, BUSALLOC_NO_GROUP);
+    Add(2U, CH(7), 40000U, 0U, BUSALLOC_CENTER_ALIGNED, BUSALLOC_NO_GROUP);
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_OK);
+    CHECK(sol.Assign[0].MaxDuty == 998U);
+    CHECK(sol.Assign[1].MaxDuty == 0xFFFFU);
+    CHECK(sol.Assign[1].Bus != BUSALLOC_BUS_INTERNAL);
+
+    /* Six periods on one instance */
+    count = 0U;
+    for (c = 0U; c < 6U; c++) {
+        Add(1U, CH(c + 1U), (uint16)(1000U + c), 0U, BUSALLOC_EDGE_ALIGNED, BUSALLOC_NO_GROUP);
+    }
+    CHECK(BusAlloc_Solve(req, count, &sol, &failed) == BUSALLOC_TOO_MANY_PERIODS);
+}
+
+/**
+* @brief        Solve the current requests BENCH_ROUNDS times, check the time and the placement
+*/
+static void Solve(const char *Name)
+{
+    BusAlloc_ResultType result = BUSALLOC_OK;
+    uint32 used[BUSALLOC_INSTANCES] = { 0U, 0U, 0U };
+    uint32 masters[BUSALLOC_INSTANCES] = { 0U, 0U, 0U };
+    uint32 clashes = 0U;
+    uint32 internal = 0U;
+    double t0;
+    double t1;
+    uint8 failed;
+    uint32 i;
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        result = BusAlloc_Solve(req, count, &sol, &failed);
+    }
+    t1 = host_test_ns();
+
+    for (i = 0U; i < sol.NumBuses; i++) {
+        masters[sol.Buses[i].Instance] |= CH(sol.Buses[i].MasterChannel);
+    }
+    for (i = 0U; i < count; i++) {
+        clashes += (((used[req[i].Instance] | masters[req[i].Instance]) & CH(sol.Assign[i].Channel)) != 0U) ? 1U : 0U;
+        clashes += ((req[i].ChannelMask & CH(sol.Assign[i].Channel)) == 0U) ? 1U : 0U;
+        used[req[i].Instance] |= CH(sol.Assign[i].Channel);
+        internal += (sol.Assign[i].Bus == BUSALLOC_BUS_INTERNAL) ? 1U : 0U;
+    }
+    printf("BusAlloc_Solve %s: %u outputs (%u on internal counters), %u buses, %u split groups, %u layouts, "
+           "%.1f us per solve\n", Name, count, internal, sol.NumBuses, sol.SplitGroups, sol.Candidates,
+           (t1 - t0) / (BENCH_ROUNDS * 1000.0));
+    CHECK(result == BUSALLOC_OK);
+    CHECK(clashes == 0U);
+    CHECK(((t1 - t0) / BENCH_ROUNDS) < BENCH_LIMIT_NS);
+    for (i = 0U; i < count; i++) {
+        CHECK((sol.Assign[i].MaxDuty + sol.Assign[i].PhaseShift) <= ((req[i].Count == BUSALLOC_CENTER_ALIGNED) ?
+              (2U * req[i].Period) : req[i].Period));
+    }
+}
+
+/**
+* @brief        A board's worth of outputs, the dense case being a bus in every block, and a
+*               70-output board across the three instances
+*/
+static void Benchmark(void)
+{
+    uint8 c;
+
+    count = 0U;
+    for (c = 1U; c < 22U; c++) {
+        if ((c & 7U) != 0U) {
+            Add(0U, CH(c), (uint16)(1000U * (1U + (c % 3U))), (uint16)(((c % 3U) == 0U) ? (c * 10U) : 0U),
+                BUSALLOC_EDGE_ALIGNED, (uint8)(c % 3U));
+            Add(1U, CH(c), (uint16)(500U * (1U + (c & 1U))), 0U, BUSALLOC_CENTER_ALIGNED, (uint8)(8U + (c & 1U)));
+        }
+    }
+    for (c = 0U; c < 24U; c++) {
+        Add(2U, CH(c), 40000U, 0U, BUSALLOC_INTERNAL, BUSALLOC_NO_GROUP);
+    }
+
+    Solve("board");
+
+    /* 70 outputs: a phase-staggered group and a centre-aligned set each share one bus, every
+       other output has a period of its own and runs on an internal counter */
+    count = 0U;
+    for (c = 0U; c < 23U; c++) {
+        if (c < 12U) {
+            Add(0U, ANY_CH, 1000U, (uint16)(c * 40U), BUSALLOC_EDGE_ALIGNED, 0U);
+            Add(1U, ANY_CH, 500U, 0U, BUSALLOC_CENTER_ALIGNED, 1U);
+        } else {
+            Add(0U, ANY_CH, (uint16)(2000U + (c * 10U)), 0U, BUSALLOC_INTERNAL, BUSALLOC_NO_GROUP);
+            Add(1U, ANY_CH, (uint16)(3000U + (c * 10U)), 0U, BUSALLOC_INTERNAL, BUSALLOC_NO_GROUP);
+        }
+    }
+    for (c = 0U; c < 24U; c++) {
+        Add(2U, ANY_CH, (uint16)(4000U + (c * 10U)), 0U, BUSALLOC_INTERNAL, BUSALLOC_NO_GROUP);
+    }
+    Solve("70 outputs");
+    CHECK((count == 70U) && (sol.NumBuses == 2U) && (sol.SplitGroups == 0U));
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    PhaseTest();
+    ErrorTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,400 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Host test of the counter bus dimming of the eMIOS PWM driver, built from the driver sources on
+* the register model of rtd/. Three buses of 16 channels each, one per instance: OPWMB on an MCB
+* up bus, OPWMCB on an MCB up/down bus, OPWM and OPWMT on an MC up bus. SetBusBrightness only
+* stores the multiplier: no channel register changes and a pending comparator transfer stays
+* pending. Once the duty cycles are written again every channel register has to hold its nominal
+* duty cycle times the brightness, rounded down, so the colour ratios between the channels of a
+* bus hold to the tick, while the bus periods are never touched. Channels initialized on a dimmed
+* bus take its brightness, which is dropped with the last channel. The benchmark gives the cost of
+* SetBusBrightness, of a duty cycle write on a dimmed bus against an undimmed one, and of scaling
+* the 48 duty cycles in the application instead.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "Emios_Host.h"
+#include "Emios_Mcl_Ip.h"
+#include "Emios_Pwm_Ip.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define BUSES               (3U)
+#define BUS_CHANNEL         (23U)           /* Bus A */
+#define CHANNELS            (16U)           /* Per bus */
+#define OPWMT_FIRST         (12U)           /* Channels from here on the MC up bus are OPWMT */
+#define PERIOD              (1000U)
+#define DEAD_TIME           (5U)
+#define TRIGGER             (100U)
+#define BENCH_ROUNDS        (20000U)
+
+#define MODE_MC_UP          (16U)
+#define MODE_MCB_UP         (80U)
+#define MODE_MCB_UP_DOWN    (84U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Emios_Pwm_Ip_ChannelConfigType config[BUSES][CHANNELS];
+static boolean initialized;
+static uint32 mismatches;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Nominal duty cycle of a channel, 0% and 100% included
+*/
+static Emios_Pwm_Ip_DutyType NominalDuty(uint32 bus, uint32 ch)
+{
+    uint32 full = (bus == 1U) ? ((2U * PERIOD) - 2U) : PERIOD;
+
+    return (Emios_Pwm_Ip_DutyType)((ch == 0U) ? 0U : ((ch == 1U) ? full : (((ch * 397U) + 11U) % full)));
+}
+
+/**
+* @brief        Counter buses and their channels, all at full brightness
+* @details      The channels of the previous case are deinitialized first, the buses count
+*               their users across a register reset.
+*/
+static void InitBuses(void)
+{
+    static const uint32 modes[BUSES] = { MODE_MCB_UP, MODE_MCB_UP_DOWN, MODE_MC_UP };
+    Emios_Pwm_Ip_ChannelConfigType *cfg;
+    uint32 bus;
+    uint32 ch;
+
+    for (bus = 0U; (bus < BUSES) && initialized; bus++) {
+        for (ch = 0U; ch < CHANNELS; ch++) {
+            Emios_Pwm_Ip_DeInitChannel((uint8)bus, (uint8)ch);
+        }
+    }
+    initialized = TRUE;
+    Emios_Host_Reset();
+    for (bus = 0U; bus < BUSES; bus++) {
+        Emios_Host_SetBus((uint8)bus, BUS_CHANNEL, PERIOD, modes[bus]);
+        for (ch = 0U; ch < CHANNELS; ch++) {
+            cfg = &config[bus][ch];
+            memset(cfg, 0, sizeof(*cfg));
+            cfg->ChannelId = (uint8)ch;
+            cfg->Timebase = EMIOS_PWM_IP_BUS_A;
+            cfg->OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE;
+            cfg->InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1;
+            cfg->InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1;
+            cfg->InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK;
+            cfg->OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH;
+            cfg->IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED;
+            cfg->DutyCycle = NominalDuty(bus, ch);
+            if (bus == 0U) {
+                cfg->Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG;
+                cfg->PeriodCount = PERIOD;
+            } else if (bus == 1U) {
+                cfg->Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG;
+                cfg->PeriodCount = (2U * PERIOD) - 2U;
+                cfg->DeadTime = DEAD_TIME;
+            } else if (ch < OPWMT_FIRST) {
+                cfg->Mode = EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG;
+                cfg->PeriodCount = PERIOD;
+            } else {
+                cfg->Mode = EMIOS_PWM_IP_MODE_OPWMT;
+                cfg->PeriodCount = PERIOD;
+                cfg->TriggerPosition = TRIGGER;
+            }
+            Emios_Pwm_Ip_InitChannel((uint8)bus, cfg);
+        }
+    }
+}
+
+/**
+* @brief        Count the registers of a channel that do not hold Duty, already dimmed
+*/
+static uint32 Mismatch(uint32 bus, uint32 ch, uint32 duty)
+{
+    uint32 a = Emios_Host_Regs[bus].CH.UC[ch].A;
+    uint32 b = Emios_Host_Regs[bus].CH.UC[ch].B;
+    uint32 errors = 0U;
+
+    if (bus == 0U) {
+        /* OPWMB: trailing edge in B, leading edge at the phase shift in A */
+        errors += (b != duty) ? 1U : 0U;
+        errors += (a != 0U) ? 1U : 0U;
+    } else if (bus == 1U) {
+        /* OPWMCB: half the pulse either side of the bus period end, dead time in B */
+        errors += (a != ((duty == 0U) ? (PERIOD + 1U) :
+                         ((duty == ((2U * PERIOD) - 2U)) ? 1U : (PERIOD - (duty >> 1U))))) ? 1U : 0U;
+        errors += (b != DEAD_TIME) ? 1U : 0U;
+    } else if (ch < OPWMT_FIRST) {
+        /* OPWM: A and B on the same value at 0% and 100% */
+        errors += (b != duty) ? 1U : 0U;
+        errors += (a != (((duty == 0U) || (duty == PERIOD)) ? duty : 1U)) ? 1U : 0U;
+    } else {
+        /* OPWMT: leading edge at 0, trailing edge past the period at 100% */
+        errors += (b != ((duty == PERIOD) ? (PERIOD + 1U) : duty)) ? 1U : 0U;
+        errors += (a != 0U) ? 1U : 0U;
+        errors += (Emios_Host_Regs[bus].CH.UC[ch].ALTA != TRIGGER) ? 1U : 0U;
+    }
+
+    return errors;
+}
+
+/**
+* @brief        Every channel at its nominal duty cycle times Brightness, the buses untouched
+*/
+static void CheckBuses(uint32 brightness)
+{
+    double worst = 0.0;
+    double exact;
+    uint32 duty;
+    uint32 bus;
+    uint32 ch;
+
+    for (bus = 0U; bus < BUSES; bus++) {
+        for (ch = 0U; ch < CHANNELS; ch++) {
+            duty = (uint32)(((uint64)NominalDuty(bus, ch) * brightness) >> 15U);
+            mismatches += Mismatch(bus, ch, duty);
+            mismatches += (Emios_Pwm_Ip_GetDutyCycle((uint8)bus, (uint8)ch) != NominalDuty(bus, ch)) ? 1U : 0U;
+            /* Ratios between channels hold if every one is within a tick of the exact product */
+            exact = ((double)NominalDuty(bus, ch) * brightness) / 32768.0;
+            worst = ((exact - duty) > worst) ? (exact - duty) : worst;
+        }
+        mismatches += (Emios_Host_Regs[bus].CH.UC[BUS_CHANNEL].A != PERIOD) ? 1U : 0U;
+        mismatches += (Emios_Mcl_Ip_GetCounterBusPeriod((uint8)bus, BUS_CHANNEL) != PERIOD) ? 1U : 0U;
+        mismatches += (Emios_Host_Regs[bus].OUDIS != 0U) ? 1U : 0U;
+    }
+    CHECK(worst < 1.0);
+}
+
+/**
+* @brief        Write the nominal duty cycle of every channel again
+*/
+static void WriteNominal(void)
+{
+    uint32 bus;
+    uint32 ch;
+
+    for (bus = 0U; bus < BUSES; bus++) {
+        for (ch = 0U; ch < CHANNELS; ch++) {
+            (void)Emios_Pwm_Ip_SetDutyCycle((uint8)bus, (uint8)ch, NominalDuty(bus, ch));
+        }
+    }
+}
+
+/**
+* @brief        Brightness steps on the three buses
+*/
+static void RatioTest(void)
+{
+    static const uint16 steps[] = { 0x4000U, 0x1234U, 1U, 0U, 0x7FFFU, 0x2AAAU, EMIOS_PWM_IP_BRIGHTNESS_FULL };
+    uint32 i;
+    uint32 bus;
+
+    InitBuses();
+    mismatches = 0U;
+    CheckBuses(EMIOS_PWM_IP_BRIGHTNESS_FULL);
+    CHECK(mismatches == 0U);
+
+    for (i = 0U; i < (sizeof(steps) / sizeof(steps[0])); i++) {
+        for (bus = 0U; bus < BUSES; bus++) {
+            /* Any channel of the bus will do */
+            CHECK(Emios_Pwm_Ip_SetBusBrightness((uint8)bus, (uint8)(bus + 3U), steps[i]) == EMIOS_PWM_IP_STATUS_SUCCESS);
+        }
+        /* Nothing moves until the duty cycles are written */
+        mismatches = 0U;
+        CheckBuses((i == 0U) ? EMIOS_PWM_IP_BRIGHTNESS_FULL : steps[i - 1U]);
+        CHECK(mismatches == 0U);
+        WriteNominal();
+        mismatches = 0U;
+        CheckBuses(steps[i]);
+        CHECK(mismatches == 0U);
+    }
+}
+
+/**
+* @brief        Duty cycles held back for a synchronous update stay held back
+*/
+static void PendingTest(void)
+{
+    const uint32 mask = 0x00F0U;
+
+    InitBuses();
+    Emios_Pwm_Ip_ComparatorTransferDisable(0U, mask);
+    CHECK(Emios_Pwm_Ip_SetBusBrightness(0U, 0U, 0x4000U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(Emios_Host_Regs[0].OUDIS == mask);
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(0U, 5U, 801U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(Emios_Host_Regs[0].CH.UC[5].B == 400U);
+    CHECK(Emios_Host_Regs[0].OUDIS == mask);
+    Emios_Pwm_Ip_ComparatorTransferEnable(0U, mask);
+    CHECK(Emios_Host_Regs[0].OUDIS == 0U);
+    CHECK(SchM_Host_PwmArea[47] != 0U);
+}
+
+/**
+* @brief        Duty cycle updates, channel init and deinit on a dimmed bus
+*/
+static void LifecycleTest(void)
+{
+    const uint32 half = EMIOS_PWM_IP_BRIGHTNESS_FULL / 2U;
+    uint32 ch;
+
+    InitBuses();
+    CHECK(Emios_Pwm_Ip_SetBusBrightness(0U, 0U, (uint16)half) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(Emios_Pwm_Ip_SetBusBrightness(1U, 0U, (uint16)half) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(Emios_Pwm_Ip_SetBusBrightness(2U, 0U, (uint16)half) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    WriteNominal();
+
+    /* A new duty cycle is dimmed, the nominal one is kept */
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(0U, 5U, 801U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(Emios_Host_Regs[0].CH.UC[5].B == 400U);
+    CHECK(Emios_Pwm_Ip_GetDutyCycle(0U, 5U) == 801U);
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(2U, 13U, 900U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(Emios_Host_Regs[2].CH.UC[13].B == 450U);
+    /* The range is checked on the nominal duty cycle */
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(0U, 5U, PERIOD + 1U) == EMIOS_PWM_IP_STATUS_ERROR);
+
+    /* A channel initialized on the dimmed bus starts dimmed */
+    Emios_Pwm_Ip_DeInitChannel(1U, 7U);
+    config[1][7].DutyCycle = 1200U;
+    Emios_Pwm_Ip_InitChannel(1U, &config[1][7]);
+    CHECK(Emios_Host_Regs[1].CH.UC[7].A == (PERIOD - 300U));
+    CHECK(Emios_Pwm_Ip_GetDutyCycle(1U, 7U) == 1200U);
+    config[1][7].DutyCycle = NominalDuty(1U, 7U);
+
+    /* The last channel of the bus takes its brightness with it */
+    for (ch = 0U; ch < CHANNELS; ch++) {
+        Emios_Pwm_Ip_DeInitChannel(0U, (uint8)ch);
+    }
+    config[0][4].DutyCycle = 600U;
+    Emios_Pwm_Ip_InitChannel(0U, &config[0][4]);
+    CHECK(Emios_Host_Regs[0].CH.UC[4].B == 600U);
+    config[0][4].DutyCycle = NominalDuty(0U, 4U);
+
+    /* One channel left keeps the bus dimmed */
+    for (ch = 1U; ch < CHANNELS; ch++) {
+        Emios_Pwm_Ip_DeInitChannel(2U, (uint8)ch);
+    }
+    Emios_Pwm_Ip_InitChannel(2U, &config[2][3]);
+    CHECK(Emios_Host_Regs[2].CH.UC[3].B == (NominalDuty(2U, 3U) / 2U));
+}
+
+/**
+* @brief        Channels without a counter bus and brightness out of range
+*/
+static void ErrorTest(void)
+{
+    Emios_Pwm_Ip_ChannelConfigType cfg;
+
+    InitBuses();
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.ChannelId = 16U;
+    cfg.Mode = EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG;
+    cfg.Timebase = EMIOS_PWM_IP_BUS_INTERNAL;
+    cfg.OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE;
+    cfg.InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1;
+    cfg.InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1;
+    cfg.InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK;
+    cfg.OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH;
+    cfg.IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED;
+    cfg.PeriodCount = PERIOD;
+    cfg.DutyCycle = 300U;
+    Emios_Pwm_Ip_InitChannel(0U, &cfg);
+
+    CHECK(Emios_Pwm_Ip_SetBusBrightness(0U, 16U, 0x4000U) == EMIOS_PWM_IP_STATUS_ERROR);
+    CHECK(Emios_Host_Regs[0].CH.UC[16].A == 300U);
+    CHECK(Emios_Pwm_Ip_SetBusBrightness(0U, 0U, EMIOS_PWM_IP_BRIGHTNESS_FULL + 1U) == EMIOS_PWM_IP_STATUS_ERROR);
+    WriteNominal();
+    mismatches = 0U;
+    CheckBuses(EMIOS_PWM_IP_BRIGHTNESS_FULL);
+    CHECK(mismatches == 0U);
+}
+
+/**
+* @brief        Cost of dimming the 48 channels
+* @details      SetBusBrightness once per bus, the duty cycle writes that apply it against the
+*               same writes on undimmed buses, and the application scaling every duty cycle
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double set;
+    double dimmed;
+    double plain;
+    double scaled;
+    uint16 brightness;
+    uint32 i;
+    uint32 bus;
+    uint32 ch;
+
+    InitBuses();
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        brightness = (uint16)(0x1000U + (i & 0x3FFFU));
+        for (bus = 0U; bus < BUSES; bus++) {
+            (void)Emios_Pwm_Ip_SetBusBrightness((uint8)bus, 0U, brightness);
+        }
+    }
+    set = host_test_ns() - t0;
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        WriteNominal();
+    }
+    dimmed = host_test_ns() - t0;
+    (void)Emios_Pwm_Ip_SetBusBrightness(0U, 0U, EMIOS_PWM_IP_BRIGHTNESS_FULL);
+    (void)Emios_Pwm_Ip_SetBusBrightness(1U, 0U, EMIOS_PWM_IP_BRIGHTNESS_FULL);
+    (void)Emios_Pwm_Ip_SetBusBrightness(2U, 0U, EMIOS_PWM_IP_BRIGHTNESS_FULL);
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        WriteNominal();
+    }
+    plain = host_test_ns() - t0;
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        brightness = (uint16)(0x1000U + (i & 0x3FFFU));
+        for (bus = 0U; bus < BUSES; bus++) {
+            for (ch = 0U; ch < CHANNELS; ch++) {
+                (void)Emios_Pwm_Ip_SetDutyCycle((uint8)bus, (uint8)ch,
+                                                (Emios_Pwm_Ip_DutyType)(((uint32)NominalDuty(bus, ch) * brightness) >> 15U));
+            }
+        }
+    }
+    scaled = host_test_ns() - t0;
+
+    printf("dim %u channels on %u buses: SetBusBrightness %.1f ns for all buses, %u duty writes %.0f ns dimmed, "
+           "%.0f ns undimmed, %.0f ns scaled by the application\n",
+           BUSES * CHANNELS, BUSES, set / BENCH_ROUNDS, BUSES * CHANNELS, dimmed / BENCH_ROUNDS,
+           plain / BENCH_ROUNDS, scaled / BENCH_ROUNDS);
+    CHECK(set < plain);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    RatioTest();
+    PendingTest();
+    LifecycleTest();
+    ErrorTest();
+    Benchmark();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
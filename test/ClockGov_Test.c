@@ -0,0 +1,354 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host simulation of the core clock governor. The clock tree is modelled by MC_CGM MUX_0
+* selector and divider registers read back by a frequency getter shaped like
+* Clock_Ip_Get_CORE_CLK_Frequency; the eMIOS counter bus is clocked by the core through the
+* selected prescaler, as on S32K344. A PCFS ramp steps the core frequency from the old to the
+* new value. Every completed PWM period is timed in simulated time, so the period error seen by
+* the outputs is checked independently of the governor's own measurement, also for the periods
+* a switch lands in. The master bus period can be rewritten at any time, as the A register of an
+* MCB channel.
+*/
+
+#include <math.h>
+#include "host_test.h"
+#include "Emios_Mcl_Ip.h"
+#include "Timestamp.h"
+#include "ClockGov.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define FIRC_HZ             (48000000.0)
+#define PLL_HZ              (160000000.0)
+#define CSS_FIRC            (0U)
+#define CSS_PLL             (1U)
+
+#define BUS_PERIOD          (400U)          /* 20 kHz PWM on an 8 MHz counter bus */
+#define NOMINAL_HZ          (8000000U)
+#define BOUND_PPM           (2000U)
+#define MEASURE_TICKS       (4096U)
+
+#define READ_CYCLES         (6U)            /* Core cycles per peripheral read */
+#define PCFS_STEPS          (8U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Simulated MC_CGM MUX_0 */
+static struct {
+    uint32 MUX_0_CSS;       /* Selected source */
+    uint32 MUX_0_DC_0;      /* Core divider minus one */
+} cgm = { CSS_PLL, 0U };
+
+static double pcfs_scale = 1.0;     /* Source scaling while a PCFS ramp is running */
+static uint32 load_steps;           /* Source switches without a PCFS ramp */
+
+static double sim_t;                /* Simulated time in seconds */
+static uint64 core_cycles;          /* DWT CYCCNT */
+static uint64 cached_hz;            /* Timestamp frequency */
+static uint16 prescaler = 20U;      /* Core clock to counter bus */
+static uint32 bus_period = BUS_PERIOD;
+static double bus_count;            /* Ticks since the last period boundary */
+static uint32 late_period_writes;   /* Period written below the count, the bus would overrun */
+static double last_wrap_t;
+static boolean disturbed = TRUE;    /* Clock or prescaler changed during the current period */
+static double worst_steady_ppm;
+static double worst_transient_ppm;
+static uint32 periods;
+
+static const Clock_Ip_SelectorConfigType run_sel[1] = { { SCS_CLK, CSS_PLL } };
+static const Clock_Ip_DividerConfigType run_div[1] = { { CORE_CLK, 1U } };
+static const Clock_Ip_SelectorConfigType idle_sel[1] = { { SCS_CLK, CSS_FIRC } };
+static const Clock_Ip_DividerConfigType idle_div[1] = { { CORE_CLK, 1U } };
+static const Clock_Ip_PcfsConfigType pcfs[1] = { { PLL_PHI0_CLK, 100U, 2U, SCS_CLK, 160000000U } };
+
+static const Clock_Ip_ClockConfigType run_clock = {
+    0U, 1U, 1U, 1U, &run_sel, &run_div, &pcfs
+};
+static const Clock_Ip_ClockConfigType idle_clock = {
+    1U, 1U, 1U, 1U, &idle_sel, &idle_div, &pcfs
+};
+static const Clock_Ip_ClockConfigType idle_clock_no_pcfs = {
+    2U, 1U, 1U, 0U, &idle_sel, &idle_div, NULL_PTR
+};
+
+/* 160 MHz / 20 = 48 MHz / 6 = 8 MHz */
+static const Mcl_EmiosInitConfigType emios_cfg = { 0U, 20U, 6U };
+static const Mcl_EmiosInitConfigType emios_cfg_wrong = { 0U, 20U, 5U };
+
+static const ClockGov_DomainType domain = {
+    EMIOS0_CLK, CLOCKGOV_DOMAIN_COMPENSATED, 0U, 23U, NOMINAL_HZ
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Core frequency from the simulated MC_CGM registers
+*/
+static double CoreHz(void)
+{
+    double scs = (cgm.MUX_0_CSS == CSS_PLL) ? PLL_HZ : FIRC_HZ;
+
+    return (scs * pcfs_scale) / (double)(cgm.MUX_0_DC_0 + 1U);
+}
+
+/**
+* @brief        Run the core for a number of cycles and time every completed PWM period
+*/
+static void Advance(uint64 cycles)
+{
+    double hz = CoreHz();
+    double t = sim_t;
+    double ticks = (double)cycles / (double)prescaler;
+    double period;
+    double ppm;
+
+    while ((bus_count + ticks) >= (double)bus_period) {
+        ticks -= (double)bus_period - bus_count;
+        t += (((double)bus_period - bus_count) * prescaler) / hz;
+        bus_count = 0.0;
+
+        period = t - last_wrap_t;
+        ppm = fabs((period * NOMINAL_HZ / BUS_PERIOD) - 1.0) * 1e6;
+        if (periods > 0U) {
+            if (disturbed == TRUE) {
+                worst_transient_ppm = (ppm > worst_transient_ppm) ? ppm : worst_transient_ppm;
+            } else {
+                worst_steady_ppm = (ppm > worst_steady_ppm) ? ppm : worst_steady_ppm;
+            }
+        }
+        periods++;
+        disturbed = FALSE;
+        last_wrap_t = t;
+    }
+
+    bus_count += ticks;
+    sim_t += (double)cycles / hz;
+    core_cycles += cycles;
+}
+
+/**
+* @brief        Run the core for a span of simulated time
+*/
+static void AdvanceTime(double seconds)
+{
+    Advance((uint64)(seconds * CoreHz()));
+}
+
+/*==================================================================================================
+*                                  Stand-ins of the drivers
+==================================================================================================*/
+
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName)
+{
+    return ((ClockName == CORE_CLK) || (ClockName == EMIOS0_CLK)) ? (uint64)CoreHz() : 0U;
+}
+
+void Clock_Ip_InitClock(Clock_Ip_ClockConfigType const * Config)
+{
+    uint32 css = (*Config->Selectors)[0].Value;
+    uint32 div = (*Config->Dividers)[0].Value - 1U;
+    double from;
+    double to;
+    uint32 step;
+
+    if (css != cgm.MUX_0_CSS) {
+        if (Config->PcfsCount != 0U) {
+            /* Progressive switch: the core walks evenly from the old to the new frequency, each
+               step at the mean of its part of the ramp */
+            from = CoreHz();
+            to = ((css == CSS_PLL) ? PLL_HZ : FIRC_HZ) / (double)(div + 1U);
+            for (step = 1U; step <= PCFS_STEPS; step++) {
+                pcfs_scale = (from + (((to - from) * ((double)step - 0.5)) / PCFS_STEPS)) / from;
+                disturbed = TRUE;
+                AdvanceTime((*Config->Pcfs)[0].StepDuration * 1e-6);
+            }
+            pcfs_scale = 1.0;
+        } else {
+            load_steps++;
+        }
+    }
+
+    cgm.MUX_0_CSS = css;
+    cgm.MUX_0_DC_0 = div;
+    disturbed = TRUE;
+}
+
+void Mcl_Emios_SetClockMode(const Mcl_EmiosInitConfigType * const pConfig, Mcl_EmiosSelectPrescalerType Prescaler)
+{
+    prescaler = (Prescaler == MCL_EMIOS_ALTERNATIVE_PRESCALER) ? pConfig->AltPrescaler : pConfig->Prescaler;
+    disturbed = TRUE;
+}
+
+Emios_Ip_CommonStatusType Emios_Mcl_Ip_SetCounterBusPeriod(uint8 HwInstance, uint8 HwChannel, uint32 Period)
+{
+    (void)HwInstance;
+    (void)HwChannel;
+    Advance(READ_CYCLES);
+    late_period_writes += ((double)Period <= bus_count) ? 1U : 0U;
+    bus_period = Period;
+    disturbed = TRUE;
+    return EMIOS_IP_COMMON_STATUS_SUCCESS;
+}
+
+uint32 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel)
+{
+    (void)Instance;
+    (void)Channel;
+    return bus_period;
+}
+
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel)
+{
+    (void)Instance;
+    (void)Channel;
+    Advance(READ_CYCLES);
+    return 1U + (uint32)bus_count;
+}
+
+Timestamp_CyclesType Timestamp_Get(void)
+{
+    Advance(2U);
+    return core_cycles;
+}
+
+uint32 Timestamp_GetFrequency(void)
+{
+    return (uint32)cached_hz;
+}
+
+void Timestamp_UpdateFrequency(void)
+{
+    cached_hz = Clock_Ip_GetClockFrequency(CORE_CLK);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    ClockGov_ConfigType cfg = {
+        &run_clock, &idle_clock, &emios_cfg, &domain, 1U, BOUND_PPM, 0U
+    };
+    ClockGov_ConfigType bad;
+    ClockGov_DomainType bad_domain = domain;
+    ClockGov_StatsType stats;
+    double t0;
+    double switch_us = 0.0;
+    uint32 frame;
+
+    Timestamp_UpdateFrequency();
+
+    /* Configuration checks */
+    CHECK(ClockGov_Init(NULL_PTR) == E_NOT_OK);
+    bad = cfg;
+    bad.IdleClock = &idle_clock_no_pcfs;
+    CHECK(ClockGov_Init(&bad) == E_NOT_OK);
+    CHECK(ClockGov_EnterIdle() == E_NOT_OK);
+    bad = cfg;
+    bad_domain.NominalCounterHz = 0U;
+    bad.Domains = &bad_domain;
+    CHECK(ClockGov_Init(&bad) == E_NOT_OK);
+    bad = cfg;
+    bad.EmiosConfig = NULL_PTR;
+    CHECK(ClockGov_Init(&bad) == E_NOT_OK);
+    bad = cfg;
+    bad.MeasureTicks = 1000U;       /* +-1 tick is 1000 ppm, half the bound */
+    CHECK(ClockGov_Init(&bad) == E_NOT_OK);
+    bad = cfg;
+    bad.MaxPeriodErrorPpm = 0U;
+    CHECK(ClockGov_Init(&bad) == E_NOT_OK);
+    bad = cfg;
+    bad.NumDomains = CLOCKGOV_MAX_DOMAINS + 1U;
+    CHECK(ClockGov_Init(&bad) == E_NOT_OK);
+    CHECK(load_steps == 0U);
+
+    /* Frames: 5 ms of computation at full speed, 10 ms idle, no measurement in the switches */
+    CHECK(ClockGov_Init(&cfg) == E_OK);
+    for (frame = 0U; frame < 50U; frame++) {
+        CHECK(ClockGov_EnterRun() == E_OK);
+        CHECK(cgm.MUX_0_CSS == CSS_PLL);
+        AdvanceTime(5e-3);
+        t0 = sim_t;
+        CHECK(ClockGov_EnterIdle() == E_OK);
+        switch_us = ((sim_t - t0) * 1e6 > switch_us) ? (sim_t - t0) * 1e6 : switch_us;
+        CHECK(cgm.MUX_0_CSS == CSS_FIRC);
+        AdvanceTime(10e-3);
+    }
+    ClockGov_GetStatistics(&stats);
+    printf("run/idle: transitions %u, simulated PWM periods %u, steady error max %.1f ppm, "
+           "periods spanning a switch max %.0f ppm, bound %u ppm\n",
+           stats.Transitions, periods, worst_steady_ppm, worst_transient_ppm, BOUND_PPM);
+    printf("          EnterIdle at most %.1f us, %u ns PWM period\n", switch_us,
+           (BUS_PERIOD * 1000U) / (NOMINAL_HZ / 1000000U));
+    CHECK(stats.Transitions == 99U);
+    CHECK((stats.BoundViolations == 0U) && (stats.MaxPeriodErrorPpm == 0U));
+    CHECK(worst_steady_ppm <= (double)BOUND_PPM);
+    CHECK(worst_transient_ppm <= (double)BOUND_PPM);
+    CHECK(switch_us < (3.0 * BUS_PERIOD * 1e6 / NOMINAL_HZ));
+    CHECK((bus_period == BUS_PERIOD) && (late_period_writes == 0U));
+    CHECK(load_steps == 0U);
+
+    /* Measured on demand, then after every switch */
+    CHECK(ClockGov_CheckPeriods(MEASURE_TICKS) == E_OK);
+    CHECK(ClockGov_CheckPeriods(1000U) == E_NOT_OK);
+    cfg.MeasureTicks = MEASURE_TICKS;
+    CHECK(ClockGov_EnterRun() == E_OK);
+    CHECK(ClockGov_Init(&cfg) == E_OK);
+    for (frame = 0U; frame < 10U; frame++) {
+        CHECK(ClockGov_EnterIdle() == E_OK);
+        AdvanceTime(10e-3);
+        CHECK(ClockGov_EnterRun() == E_OK);
+        AdvanceTime(5e-3);
+    }
+    ClockGov_GetStatistics(&stats);
+    printf("measured: transitions %u, error max %u ppm, violations %u, periods spanning a switch max %.0f ppm\n",
+           stats.Transitions, stats.MaxPeriodErrorPpm, stats.BoundViolations, worst_transient_ppm);
+    CHECK((stats.Transitions == 20U) && (stats.BoundViolations == 0U));
+    CHECK(stats.MaxPeriodErrorPpm <= BOUND_PPM);
+    CHECK(worst_transient_ppm <= (double)BOUND_PPM);
+
+    /* A wrong alternate prescaler found on demand reverts to run and inhibits idle mode */
+    cfg.EmiosConfig = &emios_cfg_wrong;
+    cfg.MeasureTicks = 0U;
+    CHECK(ClockGov_Init(&cfg) == E_OK);
+    CHECK(ClockGov_EnterIdle() == E_OK);
+    CHECK(ClockGov_CheckPeriods(MEASURE_TICKS) == E_NOT_OK);
+    ClockGov_GetStatistics(&stats);
+    CHECK((stats.BoundViolations == 1U) && (stats.IdleInhibited == TRUE));
+    CHECK((ClockGov_GetMode() == CLOCKGOV_MODE_RUN) && (prescaler == 20U));
+
+    /* The same measured after the switch, reverted at once */
+    cfg.MeasureTicks = MEASURE_TICKS;
+    CHECK(ClockGov_EnterRun() == E_OK);
+    CHECK(ClockGov_Init(&cfg) == E_OK);
+    CHECK(ClockGov_EnterIdle() == E_NOT_OK);
+    ClockGov_GetStatistics(&stats);
+    printf("wrong prescaler: measured error %u ppm, violations %u, idle inhibited %u\n",
+           stats.MaxPeriodErrorPpm, stats.BoundViolations, stats.IdleInhibited);
+    CHECK(stats.BoundViolations == 1U);
+    CHECK(stats.IdleInhibited == TRUE);
+    CHECK((stats.MaxPeriodErrorPpm > 190000U) && (stats.MaxPeriodErrorPpm < 210000U));
+    CHECK(ClockGov_GetMode() == CLOCKGOV_MODE_RUN);
+    CHECK((cgm.MUX_0_CSS == CSS_PLL) && (prescaler == 20U));
+    CHECK(ClockGov_EnterIdle() == E_NOT_OK);
+
+    return HOST_TEST_RESULT();
+}
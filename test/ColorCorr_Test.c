@@ -0,0 +1,228 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of the colour correction in its portable form, built with the undefined behaviour
+* sanitizer. Every output is compared with a floating point reference: extreme matrices whose
+* rows sum to nearly +-3 with offsets at both ends of their range, which overflowed a 32-bit
+* accumulator, then random matrices and pixels. The benchmark gives the cost per pixel.
+*/
+
+#include <math.h>
+#include "host_test.h"
+#include "ColorCorr.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define PIXELS              (4096U)
+#define RANDOM_MATRICES     (2000U)
+#define BENCH_ROUNDS        (2000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static ColorCorr_PixelType in[PIXELS];
+static ColorCorr_PixelType out[PIXELS];
+static uint32 random_state = 0x2468ACEU;
+static uint32 mismatches;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        xorshift32
+*/
+static uint32 Random(void)
+{
+    random_state ^= random_state << 13U;
+    random_state ^= random_state >> 17U;
+    random_state ^= random_state << 5U;
+
+    return random_state;
+}
+
+/**
+* @brief        Channel value of the reference: round to nearest, clamp to the channel range
+*/
+static uint16 Reference(const ColorCorr_MatrixType *m, const ColorCorr_PixelType *p, uint32 row)
+{
+    double v = ((double)m->Coeff[row][0] * p->R + (double)m->Coeff[row][1] * p->G +
+                (double)m->Coeff[row][2] * p->B) / 32768.0 + (double)m->Offset[row];
+
+    v = floor(v + 0.5);
+
+    return (uint16)((v < 0.0) ? 0.0 : ((v > (double)COLORCORR_MAX_VALUE) ? (double)COLORCORR_MAX_VALUE : v));
+}
+
+/**
+* @brief        Correct the batch in place and compare with the reference
+*/
+static void Verify(const ColorCorr_MatrixType *m, uint32 count)
+{
+    ColorCorr_CompiledType compiled;
+    uint32 i;
+
+    ColorCorr_Compile(m, &compiled);
+    ColorCorr_Apply(&compiled, in, out, count);
+    for (i = 0U; i < count; i++) {
+        mismatches += (out[i].R != Reference(m, &in[i], 0U)) ? 1U : 0U;
+        mismatches += (out[i].G != Reference(m, &in[i], 1U)) ? 1U : 0U;
+        mismatches += (out[i].B != Reference(m, &in[i], 2U)) ? 1U : 0U;
+        mismatches += (out[i].Pad != 0U) ? 1U : 0U;
+    }
+}
+
+/**
+* @brief        Full-scale rows and offsets, with the inputs at the corners of the cube
+*/
+static void ExtremeTest(void)
+{
+    static const sint16 coeffs[2] = { -32768, 32767 };
+    static const sint16 offsets[3] = { -32768, 0, 32767 };
+    ColorCorr_MatrixType m;
+    uint32 corner;
+    uint32 c;
+    uint32 o;
+    uint32 row;
+
+    for (corner = 0U; corner < 8U; corner++) {
+        in[corner].R = ((corner & 1U) != 0U) ? COLORCORR_MAX_VALUE : 0U;
+        in[corner].G = ((corner & 2U) != 0U) ? COLORCORR_MAX_VALUE : 0U;
+        in[corner].B = ((corner & 4U) != 0U) ? COLORCORR_MAX_VALUE : 0U;
+    }
+
+    mismatches = 0U;
+    for (c = 0U; c < 8U; c++) {
+        for (o = 0U; o < 3U; o++) {
+            for (row = 0U; row < 3U; row++) {
+                m.Coeff[row][0] = coeffs[c & 1U];
+                m.Coeff[row][1] = coeffs[(c >> 1U) & 1U];
+                m.Coeff[row][2] = coeffs[(c >> 2U) & 1U];
+                m.Offset[row] = offsets[(o + row) % 3U];
+            }
+            Verify(&m, 8U);
+        }
+    }
+    CHECK(mismatches == 0U);
+
+    /* All gains at +1 and the offset at its top: the largest positive sum */
+    in[0U].R = COLORCORR_MAX_VALUE;
+    in[0U].G = COLORCORR_MAX_VALUE;
+    in[0U].B = COLORCORR_MAX_VALUE;
+    for (row = 0U; row < 3U; row++) {
+        m.Coeff[row][0] = 32767;
+        m.Coeff[row][1] = 32767;
+        m.Coeff[row][2] = 32767;
+        m.Offset[row] = 32767;
+    }
+    Verify(&m, 1U);
+    CHECK(out[0U].R == COLORCORR_MAX_VALUE);
+
+    /* All gains at -1 and the offset at its bottom: the largest negative sum */
+    for (row = 0U; row < 3U; row++) {
+        m.Coeff[row][0] = -32768;
+        m.Coeff[row][1] = -32768;
+        m.Coeff[row][2] = -32768;
+        m.Offset[row] = -32768;
+    }
+    Verify(&m, 1U);
+    CHECK(out[0U].G == 0U);
+    CHECK(mismatches == 0U);
+}
+
+/**
+* @brief        Random matrices and pixels, including in-place correction
+*/
+static void RandomTest(void)
+{
+    ColorCorr_MatrixType m;
+    ColorCorr_CompiledType compiled;
+    ColorCorr_PixelType copy;
+    uint32 n;
+    uint32 i;
+    uint32 row;
+
+    mismatches = 0U;
+    for (n = 0U; n < RANDOM_MATRICES; n++) {
+        for (row = 0U; row < 3U; row++) {
+            m.Coeff[row][0] = (sint16)Random();
+            m.Coeff[row][1] = (sint16)Random();
+            m.Coeff[row][2] = (sint16)Random();
+            m.Offset[row] = ((Random() % 4U) == 0U) ? (sint16)Random() : (sint16)((sint32)(Random() % 513U) - 256);
+        }
+        for (i = 0U; i < 64U; i++) {
+            in[i].R = (uint16)(Random() & COLORCORR_MAX_VALUE);
+            in[i].G = (uint16)(Random() & COLORCORR_MAX_VALUE);
+            in[i].B = (uint16)(Random() & COLORCORR_MAX_VALUE);
+        }
+        Verify(&m, 64U);
+    }
+    CHECK(mismatches == 0U);
+
+    /* In and Out the same array */
+    copy = in[5U];
+    ColorCorr_Compile(&m, &compiled);
+    ColorCorr_Apply(&compiled, in, in, 64U);
+    CHECK((in[5U].R == Reference(&m, &copy, 0U)) && (in[5U].B == Reference(&m, &copy, 2U)));
+}
+
+/**
+* @brief        Cost per pixel of a typical calibration matrix
+*/
+static void Benchmark(void)
+{
+    static const ColorCorr_MatrixType m = {
+        { { COLORCORR_Q15(0.85), COLORCORR_Q15(0.05), COLORCORR_Q15(-0.02) },
+          { COLORCORR_Q15(0.03), COLORCORR_Q15(0.72), COLORCORR_Q15(0.04) },
+          { COLORCORR_Q15(-0.01), COLORCORR_Q15(0.02), COLORCORR_Q15(0.99) } },
+        { 12, -4, 0 }
+    };
+    ColorCorr_CompiledType compiled;
+    double t0;
+    double t1;
+    uint32 sum = 0U;
+    uint32 i;
+
+    for (i = 0U; i < PIXELS; i++) {
+        in[i].R = (uint16)(Random() & COLORCORR_MAX_VALUE);
+        in[i].G = (uint16)(Random() & COLORCORR_MAX_VALUE);
+        in[i].B = (uint16)(Random() & COLORCORR_MAX_VALUE);
+    }
+    ColorCorr_Compile(&m, &compiled);
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        ColorCorr_Apply(&compiled, in, out, PIXELS);
+        sum += out[i % PIXELS].G;
+    }
+    t1 = host_test_ns();
+
+    printf("ColorCorr_Apply: %.2f ns per pixel, portable build (%u)\n",
+           (t1 - t0) / ((double)BENCH_ROUNDS * PIXELS), sum & 1U);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    ExtremeTest();
+    RandomTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,254 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host build of the cooperative scheduler with 100 concurrent effect tasks on the real timer
+* wheel and Timestamp, the OsIf counter advancing one wheel tick per scheduler pass. Fades sleep
+* on the wheel and check they wake after exactly the ticks asked for, blinkers wait for the
+* events a simulated PWM period notification raises and check they only see their own, and
+* busy tasks yield and check they run once per pass. The report gives the scheduler overhead
+* per switch from the scheduler's own accounting, with a 1 GHz core clock so cycles read as ns.
+*/
+
+#include "host_test.h"
+#include "OsIf.h"
+#include "Clock_Ip.h"
+#include "Timestamp.h"
+#include "TimerWheel.h"
+#include "Coro.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CORE_HZ             (1000000000U)
+#define TASKS               (100U)
+#define FADES               (40U)
+#define BLINKERS            (30U)
+
+#define FADE_STEPS          (50U)
+#define BLINKS              (20U)
+#define BUSY_ROUNDS         (200U)
+#define NOTIFY_PASSES       (7U)        /* Passes between period notifications */
+
+#define BENCH_PASSES        (10000U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* State kept across suspensions, one per task */
+typedef struct {
+    uint32 step;
+    uint32 period;          /* Fade: ticks per step; blinker: event bit */
+    uint32 asleep_at;       /* Tick of the last suspension */
+    uint32 errors;
+    uint32 sum;
+} Effect_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Coro_TaskType tasks[TASKS];
+static Effect_t effects[TASKS];
+static uint32 tick;                 /* Wheel ticks since the start */
+static uint32 pass;                 /* Scheduler passes since the start */
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Clock_Ip stand-in for Timestamp
+*/
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName)
+{
+    (void)ClockName;
+
+    return CORE_HZ;
+}
+
+/**
+* @brief        Fade: step and sleep, every wake after exactly the ticks asked for
+*/
+static Coro_StatusType Fade(Coro_TaskType *Task, void *Context)
+{
+    Effect_t *fade = (Effect_t *)Context;
+
+    CORO_BEGIN(Task);
+    for (fade->step = 0U; fade->step < FADE_STEPS; fade->step++) {
+        fade->asleep_at = tick;
+        CORO_SLEEP(Task, fade->period);
+        fade->errors += ((tick - fade->asleep_at) != fade->period) ? 1U : 0U;
+    }
+    CORO_END(Task);
+}
+
+/**
+* @brief        Blinker: wait for its period notification event
+*/
+static Coro_StatusType Blink(Coro_TaskType *Task, void *Context)
+{
+    Effect_t *blink = (Effect_t *)Context;
+
+    CORO_BEGIN(Task);
+    for (blink->step = 0U; blink->step < BLINKS; blink->step++) {
+        CORO_WAIT_EVENT(Task, blink->period);
+        blink->errors += (Task->Events != blink->period) ? 1U : 0U;
+    }
+    CORO_END(Task);
+}
+
+/**
+* @brief        Busy task: a little work and a yield, once per pass
+*/
+static Coro_StatusType Busy(Coro_TaskType *Task, void *Context)
+{
+    Effect_t *busy = (Effect_t *)Context;
+
+    CORO_BEGIN(Task);
+    for (busy->step = 0U; busy->step < BUSY_ROUNDS; busy->step++) {
+        busy->sum += busy->step * 3U;
+        busy->asleep_at = pass;
+        CORO_YIELD(Task);
+        busy->errors += ((pass - busy->asleep_at) != 1U) ? 1U : 0U;
+    }
+    CORO_END(Task);
+}
+
+/**
+* @brief        Yield forever, for the switch benchmark
+*/
+static Coro_StatusType Spin(Coro_TaskType *Task, void *Context)
+{
+    (void)Context;
+
+    CORO_BEGIN(Task);
+    for (;;) {
+        CORO_YIELD(Task);
+    }
+    CORO_END(Task);
+}
+
+/**
+* @brief        One wheel tick and one scheduler pass, with a notification every few passes
+*/
+static uint32 Pass(void)
+{
+    OsIf_Host_Advance(1U);
+    tick++;
+    pass++;
+    if ((pass % NOTIFY_PASSES) == 0U) {
+        /* Period notification of channel (pass / NOTIFY_PASSES) % 8 */
+        Coro_Signal(1UL << ((pass / NOTIFY_PASSES) % 8U));
+    }
+
+    return Coro_Schedule();
+}
+
+/**
+* @brief        100 effect tasks to completion
+*/
+static void EffectTest(void)
+{
+    Coro_StatsType stats;
+    uint32 errors = 0U;
+    uint32 done = 0U;
+    uint32 task_cycles = 0U;
+    uint32 steps = 0U;
+    uint32 i;
+
+    TimerWheel_Init(1U);
+    Timestamp_Init();
+    Coro_Init();
+
+    for (i = 0U; i < TASKS; i++) {
+        effects[i].sum = 0U;
+        effects[i].errors = 0U;
+        if (i < FADES) {
+            effects[i].period = 1U + (i % 5U);
+            Coro_Start(&tasks[i], Fade, &effects[i]);
+        } else if (i < (FADES + BLINKERS)) {
+            effects[i].period = 1UL << (i % 8U);
+            Coro_Start(&tasks[i], Blink, &effects[i]);
+        } else {
+            Coro_Start(&tasks[i], Busy, &effects[i]);
+        }
+    }
+
+    /* Blinkers see a notification every 8 * NOTIFY_PASSES passes */
+    while (pass < ((BLINKS + 1U) * 8U * NOTIFY_PASSES)) {
+        (void)Pass();
+    }
+
+    for (i = 0U; i < TASKS; i++) {
+        errors += effects[i].errors;
+        done += (tasks[i].State == (uint8)CORO_STATE_DONE) ? 1U : 0U;
+        task_cycles += tasks[i].Cycles;
+        steps += tasks[i].Steps;
+    }
+    Coro_GetStatistics(&stats);
+
+    printf("%u tasks (%u fades, %u blinkers, %u busy), %u bytes per task: %u passes, %u switches, "
+           "%u done, %u errors\n",
+           TASKS, FADES, BLINKERS, TASKS - FADES - BLINKERS, (uint32)sizeof(Coro_TaskType),
+           pass, stats.Switches, done, errors);
+    printf("scheduler overhead %.1f ns per switch, tasks %.1f ns per step\n",
+           (double)stats.SchedulerCycles / (double)stats.Switches, (double)task_cycles / (double)steps);
+    CHECK(done == TASKS);
+    CHECK(errors == 0U);
+    CHECK(steps == stats.Switches);
+    CHECK(tasks[0U].Steps == (FADE_STEPS + 1U));
+    CHECK(tasks[TASKS - 1U].Steps == (BUSY_ROUNDS + 1U));
+}
+
+/**
+* @brief        Switch cost with 100 tasks yielding on every pass
+*/
+static void Benchmark(void)
+{
+    Coro_StatsType stats;
+    double t0;
+    double t1;
+    uint32 switches = 0U;
+    uint32 i;
+
+    TimerWheel_Init(1U);
+    Timestamp_Init();
+    Coro_Init();
+    for (i = 0U; i < TASKS; i++) {
+        Coro_Start(&tasks[i], Spin, NULL_PTR);
+    }
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_PASSES; i++) {
+        switches += Pass();
+    }
+    t1 = host_test_ns();
+    Coro_GetStatistics(&stats);
+
+    printf("%u yielding tasks: %.1f ns per switch wall clock, scheduler share %.1f ns\n",
+           TASKS, (t1 - t0) / (double)switches, (double)stats.SchedulerCycles / (double)stats.Switches);
+    CHECK(switches == (TASKS * BENCH_PASSES));
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    EffectTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
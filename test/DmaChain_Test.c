@@ -0,0 +1,381 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host simulation of DmaChain on the real Dma_Ip driver and the simulated eDMA in rtd/. Plays an
+* LED animation through a ping-pong ring and a waveform through a lookup-table ring into a PWM
+* duty register, checks that the descriptors are reused without reconfiguring the channel, and
+* churns the arena to check that descriptors are recycled.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "Dma_Ip.h"
+#include "DmaPool.h"
+#include "DmaChain.h"
+#include "Dma_Host.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define ADDR(p)             ((uint32)(uintptr_t)(p))
+#define CH_LED              (0U)        /* Logic channel n runs on hardware channel n */
+#define CH_WAVE             (1U)
+#define LEDS                (16U)       /* Duty registers refreshed per animation frame */
+#define ANIM_BUFFERS        (4U)
+#define ANIM_FRAMES         (1000U)
+#define LUT_SIZE            (64U)
+#define WAVE_PERIODS        (50U)
+#define CHURN_ROUNDS        (10000U)
+#define CLEAN_LOG           (8U)
+#define MCL_EA_TCD          (8U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint32 anim[ANIM_BUFFERS][LEDS];
+static uint32 led_regs[LEDS];
+static uint16 sine_lut[LUT_SIZE];
+static uint16 ramp_lut[LUT_SIZE];
+static uint16 duty_reg;
+
+/* Line-aligned addresses of the recent clean operations */
+static uint32 clean_log[CLEAN_LOG];
+static uint32 clean_count;
+
+static Dma_Ip_HwChannelStateType ch_state[DMA_IP_NOF_CFG_LOGIC_CHANNELS];
+static Dma_Ip_HwChannelStateType *ch_state_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_state[0], &ch_state[1], &ch_state[2], &ch_state[3]
+};
+static const Dma_Ip_GlobalConfigType global_cfg = {
+    { FALSE, FALSE }, { FALSE }, { FALSE }, { 0U }, { 0U, 0U, FALSE, FALSE }
+};
+static const Dma_Ip_TransferConfigType transfer_cfg;
+
+#define CH_CFG(Ch) \
+    { { (Ch), DMA_IP_HARDWARE_VERSION_3, 0U, (Ch), NULL_PTR, NULL_PTR }, &global_cfg, &transfer_cfg, NULL_PTR }
+
+static const Dma_Ip_LogicChannelConfigType ch_cfg[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    CH_CFG(0U), CH_CFG(1U), CH_CFG(2U), CH_CFG(3U)
+};
+static const Dma_Ip_LogicChannelConfigType * const ch_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_cfg[0], &ch_cfg[1], &ch_cfg[2], &ch_cfg[3]
+};
+static const Dma_Ip_LogicInstanceConfigType inst_cfg = {
+    { 0U, DMA_IP_HARDWARE_VERSION_3, 0U }, FALSE, FALSE, TRUE, TRUE, FALSE
+};
+static const Dma_Ip_LogicInstanceConfigType * const inst_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_INSTANCES] = {
+    &inst_cfg
+};
+static const Dma_Ip_InitType dma_init = {
+    ch_state_ptr, &ch_cfg[0], ch_cfg_ptr, &inst_cfg, inst_cfg_ptr
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
+{
+    uint32 line;
+
+    (void)CacheType;
+    (void)BusType;
+    (void)EnInvalidate;
+    for (line = Addr; line < (Addr + Length); line += DMAPOOL_CACHE_LINE) {
+        clean_log[clean_count % CLEAN_LOG] = line;
+        clean_count++;
+    }
+}
+
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    (void)Channel;
+    (void)Command;
+}
+
+/**
+* @brief        Check that the line holding a descriptor was among the recent cleans
+*/
+static boolean Cleaned(uint32 TcdAddr)
+{
+    boolean found = FALSE;
+    uint32 i;
+
+    for (i = 0U; (i < CLEAN_LOG) && (i < clean_count); i++) {
+        if (clean_log[i] == (TcdAddr & ~(DMAPOOL_CACHE_LINE - 1U))) {
+            found = TRUE;
+        }
+    }
+
+    return found;
+}
+
+/**
+* @brief        Serve hardware requests of a channel until it finished Count major loops
+*/
+static void Serve(uint32 Ch, uint32 Count)
+{
+    uint32 target = Dma_Host_MajorLoops[Ch] + Count;
+
+    while ((Dma_Host_MajorLoops[Ch] < target) && (Dma_Host_Request(Ch) == TRUE)) {
+    }
+}
+
+/**
+* @brief        LED animation through a two-descriptor ring: the CPU re-arms the idle half only
+*/
+static void Animation(void)
+{
+    DmaChain_ChainType chain;
+    DmaChain_StatsType stats;
+    Dma_Ip_LogicChannelTransferListType frame_list[] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS, 0U },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET, 4U },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE, DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS, ADDR(led_regs) },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET, 4U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE, DMA_IP_TRANSFER_SIZE_4_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE, 4U },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT, LEDS },
+        { DMA_IP_CH_SET_CONTROL_EN_MAJOR_INTERRUPT, 1U },
+    };
+    const uint32 list_len = sizeof(frame_list) / sizeof(frame_list[0]);
+    uint32 ea;
+    uint32 frame;
+    uint32 mismatches = 0U;
+    uint32 tcd_addr;
+    double t0;
+    double rearm_ns;
+    double reconfig_ns;
+    uint32 i;
+
+    for (frame = 0U; frame < ANIM_BUFFERS; frame++) {
+        for (i = 0U; i < LEDS; i++) {
+            anim[frame][i] = (frame << 16) | (i * 0x111U);
+        }
+    }
+
+    DmaChain_Create(&chain, CH_LED);
+    frame_list[0].Value = ADDR(anim[0]);
+    CHECK(DmaChain_Append(&chain, frame_list, list_len) == 0U);
+    frame_list[0].Value = ADDR(anim[1]);
+    CHECK(DmaChain_Append(&chain, frame_list, list_len) == 1U);
+    CHECK(DmaChain_Close(&chain) == (Std_ReturnType)E_OK);
+    CHECK(DmaChain_Append(&chain, frame_list, list_len) == DMACHAIN_NO_DESCRIPTOR);
+    CHECK(DmaChain_Start(&chain) == DMA_IP_STATUS_SUCCESS);
+
+    /* The ring links descriptor 1 back to 0, both scatter/gather addresses are TCD aligned */
+    tcd_addr = Dma_Host_Tcd.TCD_RSV[CH_LED].tChTcdReg.tTcdReg.reg_DLAST_SGA;
+    CHECK((tcd_addr % 32U) == 0U);
+    CHECK(Cleaned(tcd_addr) == TRUE);
+    CHECK(Dma_Ip_SetLogicChannelCommand(CH_LED, DMA_IP_CH_SET_HARDWARE_REQUEST) == DMA_IP_STATUS_SUCCESS);
+
+    ea = SchM_Host_MclArea[MCL_EA_TCD];
+    for (frame = 0U; frame < ANIM_FRAMES; frame++) {
+        Serve(CH_LED, 1U);
+        if (memcmp(led_regs, anim[frame % ANIM_BUFFERS], sizeof(led_regs)) != 0) {
+            mismatches++;
+        }
+        /* The eDMA already runs the other half, which links back to the one that just finished:
+           refill that one and clean it to memory before the eDMA fetches it again */
+        tcd_addr = Dma_Host_Tcd.TCD_RSV[CH_LED].tChTcdReg.tTcdReg.reg_DLAST_SGA;
+        clean_count = 0U;
+        CHECK(DmaChain_Rearm(&chain, (uint8)(frame % 2U), ADDR(anim[(frame + 2U) % ANIM_BUFFERS]), ADDR(led_regs)) == (Std_ReturnType)E_OK);
+        CHECK(((const Dma_Ip_SwTcdRegType *)(uintptr_t)tcd_addr)->reg_SADDR == ADDR(anim[(frame + 2U) % ANIM_BUFFERS]));
+        CHECK(Cleaned(tcd_addr) == TRUE);
+    }
+    CHECK(mismatches == 0U);
+    CHECK(Dma_Host_DescriptorLoads[CH_LED] == ANIM_FRAMES);
+    CHECK(Dma_Host_MinorLoops[CH_LED] == (ANIM_FRAMES * LEDS));
+    /* No channel reconfiguration while running: the TCD exclusive area was never entered */
+    CHECK(SchM_Host_MclArea[MCL_EA_TCD] == ea);
+
+    DmaChain_GetStatistics(&stats);
+    CHECK((stats.Allocs == 2U) && (stats.InUse == 2U));
+
+    /* CPU cost of a frame: re-arm the idle descriptor, or reprogram the channel from the list */
+    t0 = host_test_ns();
+    for (i = 0U; i < 100000U; i++) {
+        (void)DmaChain_Rearm(&chain, (uint8)(i & 1U), ADDR(anim[i % ANIM_BUFFERS]), ADDR(led_regs));
+    }
+    rearm_ns = (host_test_ns() - t0) / 100000.0;
+    t0 = host_test_ns();
+    for (i = 0U; i < 100000U; i++) {
+        frame_list[0].Value = ADDR(anim[i % ANIM_BUFFERS]);
+        (void)Dma_Ip_SetLogicChannelTransferList(CH_LED, frame_list, list_len);
+    }
+    reconfig_ns = (host_test_ns() - t0) / 100000.0;
+
+    printf("animation: %u frames, %u words moved, %u descriptor fetches, 1 CPU call per frame "
+           "(rearm %.1f ns, channel reconfig %.1f ns), mismatches %u\n",
+           ANIM_FRAMES, Dma_Host_MinorLoops[CH_LED], Dma_Host_DescriptorLoads[CH_LED],
+           rearm_ns, reconfig_ns, mismatches);
+    CHECK(rearm_ns < reconfig_ns);
+
+    (void)Dma_Ip_SetLogicChannelCommand(CH_LED, DMA_IP_CH_CLEAR_HARDWARE_REQUEST);
+    DmaChain_Release(&chain);
+}
+
+/**
+* @brief        Waveform playback: lookup tables stream into one PWM duty register per request
+*/
+static void Waveform(void)
+{
+    DmaChain_ChainType chain;
+    Dma_Ip_LogicChannelTransferListType lut_list[] = {
+        { DMA_IP_CH_SET_SOURCE_ADDRESS, 0U },
+        { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET, 2U },
+        { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE, DMA_IP_TRANSFER_SIZE_2_BYTE },
+        { DMA_IP_CH_SET_DESTINATION_ADDRESS, ADDR(&duty_reg) },
+        { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET, 0U },
+        { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE, DMA_IP_TRANSFER_SIZE_2_BYTE },
+        { DMA_IP_CH_SET_MINORLOOP_SIZE, 2U },
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT, LUT_SIZE },
+    };
+    const uint32 list_len = sizeof(lut_list) / sizeof(lut_list[0]);
+    uint32 period;
+    uint32 i;
+    uint32 errors = 0U;
+    uint32 ea;
+
+    for (i = 0U; i < LUT_SIZE; i++) {
+        /* Coarse sine by a parabola per half period, and a saw-tooth */
+        uint32 x = (i % (LUT_SIZE / 2U)) * 2U;
+        uint32 half = (x * (LUT_SIZE - x) * 0x7FFFU) / ((LUT_SIZE / 2U) * (LUT_SIZE / 2U));
+        sine_lut[i] = (uint16)((i < (LUT_SIZE / 2U)) ? (0x8000U + half) : (0x8000U - half));
+        ramp_lut[i] = (uint16)(i * (0x10000U / LUT_SIZE));
+    }
+
+    DmaChain_Create(&chain, CH_WAVE);
+    lut_list[0].Value = ADDR(sine_lut);
+    CHECK(DmaChain_Append(&chain, lut_list, list_len) == 0U);
+    lut_list[0].Value = ADDR(ramp_lut);
+    CHECK(DmaChain_Append(&chain, lut_list, list_len) == 1U);
+    CHECK(DmaChain_Close(&chain) == (Std_ReturnType)E_OK);
+    CHECK(DmaChain_Start(&chain) == DMA_IP_STATUS_SUCCESS);
+    CHECK(Dma_Ip_SetLogicChannelCommand(CH_WAVE, DMA_IP_CH_SET_HARDWARE_REQUEST) == DMA_IP_STATUS_SUCCESS);
+
+    ea = SchM_Host_MclArea[MCL_EA_TCD];
+    for (period = 0U; period < WAVE_PERIODS; period++) {
+        const uint16 *lut = ((period % 2U) == 0U) ? sine_lut : ramp_lut;
+
+        for (i = 0U; i < LUT_SIZE; i++) {
+            (void)Dma_Host_Request(CH_WAVE);
+            if (duty_reg != lut[i]) {
+                errors++;
+            }
+        }
+    }
+    printf("waveform: %u periods, %u duty updates, %u descriptor fetches, sample errors %u\n",
+           WAVE_PERIODS, Dma_Host_MinorLoops[CH_WAVE], Dma_Host_DescriptorLoads[CH_WAVE], errors);
+    CHECK(errors == 0U);
+    CHECK(Dma_Host_DescriptorLoads[CH_WAVE] == WAVE_PERIODS);
+    CHECK(SchM_Host_MclArea[MCL_EA_TCD] == ea);
+
+    (void)Dma_Ip_SetLogicChannelCommand(CH_WAVE, DMA_IP_CH_CLEAR_HARDWARE_REQUEST);
+    DmaChain_Release(&chain);
+}
+
+/**
+* @brief        Build and release chains of varying length, then exhaust the arena
+*/
+static void Churn(void)
+{
+    const Dma_Ip_LogicChannelTransferListType list[] = {
+        { DMA_IP_CH_SET_MAJORLOOP_COUNT, 1U },
+    };
+    DmaChain_ChainType chains[3];
+    DmaChain_ChainType big;
+    DmaChain_StatsType stats;
+    uint32 round;
+    uint32 n;
+    uint32 appended = 0U;
+
+    for (n = 0U; n < 3U; n++) {
+        DmaChain_Create(&chains[n], CH_LED);
+    }
+
+    for (round = 0U; round < CHURN_ROUNDS; round++) {
+        DmaChain_ChainType *chain = &chains[round % 3U];
+
+        DmaChain_Release(chain);
+        for (n = 0U; n <= (round % 5U); n++) {
+            (void)DmaChain_Append(chain, list, 1U);
+        }
+        if ((round % 2U) == 0U) {
+            (void)DmaChain_Close(chain);
+        }
+        appended += n;
+    }
+    for (n = 0U; n < 3U; n++) {
+        DmaChain_Release(&chains[n]);
+    }
+
+    DmaChain_GetStatistics(&stats);
+    printf("churn: %u rounds, %u descriptors handed out from an arena of %u, peak in use %u, failures %u\n",
+           CHURN_ROUNDS, stats.Allocs, DMACHAIN_MAX_DESCRIPTORS, stats.PeakInUse, stats.Failures);
+    CHECK(stats.InUse == 0U);
+    CHECK(stats.Allocs == stats.Frees);
+    CHECK(stats.Failures == 0U);
+    CHECK(stats.Allocs >= appended);
+
+    /* Every descriptor can be taken, the next append is refused and counted */
+    DmaChain_Create(&big, CH_LED);
+    for (n = 0U; n < DMACHAIN_MAX_DESCRIPTORS; n++) {
+        CHECK(DmaChain_Append(&big, list, 1U) == (uint8)n);
+    }
+    CHECK(DmaChain_Append(&big, list, 1U) == DMACHAIN_NO_DESCRIPTOR);
+    DmaChain_GetStatistics(&stats);
+    CHECK((stats.Failures == 1U) && (stats.InUse == DMACHAIN_MAX_DESCRIPTORS));
+    DmaChain_Release(&big);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    uint32 ch;
+
+    CHECK(Dma_Ip_Init(&dma_init) == DMA_IP_STATUS_SUCCESS);
+    for (ch = 0U; ch < DMA_IP_NOF_CFG_LOGIC_CHANNELS; ch++) {
+        /* The clear-error write of the init sets ERR in RAM, the target reads it back as 0 */
+        Dma_Host_Tcd.TCD_RSV[ch].tChTcdReg.tChReg.reg_CH_ES = 0U;
+    }
+
+    /* The arena comes from the pool and stays allocated across re-initialisations */
+    DmaPool_Init();
+    CHECK(DmaChain_Init() == (Std_ReturnType)E_OK);
+    CHECK(DmaPool_Alloc(DMAPOOL_SRAM_SIZE - (DMACHAIN_MAX_DESCRIPTORS * 32U) + 1U, DMAPOOL_REGION_SRAM) == NULL_PTR);
+    CHECK(DmaChain_Init() == (Std_ReturnType)E_OK);
+
+    Animation();
+    Waveform();
+    Churn();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,465 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host model of the DMA buffer pool against a write-back, write-allocate data cache. The pool
+* arenas are the main memory seen by the eDMA; CPU accesses go through the cache model and the
+* Mcl cache maintenance calls act on it by address. Every byte the CPU or the eDMA reads is
+* compared with the value last written by the other side, so a missing or misplaced clean or
+* invalidate shows up as a stale read. Each scenario is run once with the raw Mcl calls and
+* once through the pool to show the model catches the bug the pool prevents.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "DmaPool.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define LINE                (DMAPOOL_CACHE_LINE)
+#define CACHE_LINES         (256U)      /* 8 KiB data cache */
+#define MAX_UNCACHED        (8U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* One cache line of the model */
+typedef struct {
+    uint32 tag;             /* Line address */
+    boolean valid;
+    boolean dirty;
+    uint8 data[LINE];
+} Line_t;
+
+/* Transfer started by the next channel command */
+typedef struct {
+    const uint8 *src;
+    uint8 *dst;
+    uint32 length;
+} Transfer_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Line_t cache[CACHE_LINES];
+static struct {
+    const uint8 *start;
+    uint32 length;
+} uncached[MAX_UNCACHED];
+static uint32 num_uncached;
+
+static Transfer_t pending;
+static uint8 expect_cpu[DMAPOOL_SRAM_SIZE];   /* Last value the eDMA wrote, per destination byte */
+static uint32 stale_cpu;                      /* CPU read a value older than the eDMA wrote */
+static uint32 stale_dma;                      /* eDMA read a value older than the CPU wrote */
+static uint32 maint_calls;
+static uint32 maint_lines;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+static boolean Uncached(const uint8 *ptr)
+{
+    boolean hit = FALSE;
+    uint32 i;
+
+    for (i = 0U; i < num_uncached; i++) {
+        if ((ptr >= uncached[i].start) && (ptr < &uncached[i].start[uncached[i].length])) {
+            hit = TRUE;
+        }
+    }
+
+    return hit;
+}
+
+static uint8 *Memory(uint32 addr)
+{
+    return (uint8 *)(uintptr_t)addr;
+}
+
+static Line_t *Lookup(uint32 tag)
+{
+    Line_t *line = NULL_PTR;
+    uint32 i;
+
+    for (i = 0U; i < CACHE_LINES; i++) {
+        if ((cache[i].valid == TRUE) && (cache[i].tag == tag)) {
+            line = &cache[i];
+        }
+    }
+
+    return line;
+}
+
+static void WriteBack(Line_t *line)
+{
+    if (line->dirty == TRUE) {
+        memcpy(Memory(line->tag), line->data, LINE);
+        line->dirty = FALSE;
+    }
+}
+
+/**
+* @brief        Line fill, by a CPU access or by a speculative prefetch
+*/
+static Line_t *Fill(uint32 tag)
+{
+    Line_t *line = Lookup(tag);
+    uint32 i;
+
+    if (line == NULL_PTR) {
+        for (i = 0U; (i < CACHE_LINES) && (line == NULL_PTR); i++) {
+            if (cache[i].valid == FALSE) {
+                line = &cache[i];
+            }
+        }
+        if (line == NULL_PTR) {
+            line = &cache[tag % CACHE_LINES];
+            WriteBack(line);
+        }
+        line->tag = tag;
+        line->valid = TRUE;
+        line->dirty = FALSE;
+        memcpy(line->data, Memory(tag), LINE);
+    }
+
+    return line;
+}
+
+/**
+* @brief        Write every dirty line back and drop it, as capacity pressure eventually does
+*/
+static void EvictAll(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < CACHE_LINES; i++) {
+        if (cache[i].valid == TRUE) {
+            WriteBack(&cache[i]);
+            cache[i].valid = FALSE;
+        }
+    }
+}
+
+static void CpuWrite(uint8 *ptr, uint32 length, uint8 value)
+{
+    uint32 addr;
+    uint32 i;
+    Line_t *line;
+
+    for (i = 0U; i < length; i++) {
+        if (Uncached(&ptr[i]) == TRUE) {
+            ptr[i] = value;
+        } else {
+            addr = (uint32)(uintptr_t)&ptr[i];
+            line = Fill(addr & ~(LINE - 1U));
+            line->data[addr & (LINE - 1U)] = value;
+            line->dirty = TRUE;
+        }
+    }
+}
+
+/**
+* @brief        CPU read of a DMA destination, checked against what the eDMA wrote
+*/
+static void CpuReadCheck(const uint8 *ptr, uint32 length, const uint8 *expect)
+{
+    uint32 addr;
+    uint32 i;
+    uint8 value;
+    Line_t *line;
+
+    for (i = 0U; i < length; i++) {
+        if (Uncached(&ptr[i]) == TRUE) {
+            value = ptr[i];
+        } else {
+            addr = (uint32)(uintptr_t)&ptr[i];
+            line = Fill(addr & ~(LINE - 1U));
+            value = line->data[addr & (LINE - 1U)];
+        }
+        if (value != expect[i]) {
+            stale_cpu++;
+        }
+    }
+}
+
+static void Reset(void)
+{
+    memset(cache, 0, sizeof(cache));
+    num_uncached = 0U;
+    stale_cpu = 0U;
+    stale_dma = 0U;
+    maint_calls = 0U;
+    maint_lines = 0U;
+    DmaPool_Init();
+}
+
+static void *Alloc(uint32 size, DmaPool_RegionType region)
+{
+    void *buffer = DmaPool_Alloc(size, region);
+
+    if ((buffer != NULL_PTR) && (region == DMAPOOL_REGION_DTCM)) {
+        uncached[num_uncached].start = (const uint8 *)buffer;
+        uncached[num_uncached].length = size;
+        num_uncached++;
+    }
+
+    return buffer;
+}
+
+/*==================================================================================================
+*                                  Stand-ins of the drivers
+==================================================================================================*/
+
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
+{
+    uint32 tag;
+    Line_t *line;
+
+    CHECK((CacheType == MCL_CACHE_CORE) && (BusType == MCL_CACHE_DATA));
+    CHECK(((Addr % LINE) == 0U) && ((Length % LINE) == 0U));
+    maint_calls++;
+    for (tag = Addr; tag < (Addr + Length); tag += LINE) {
+        line = Lookup(tag);
+        if (line != NULL_PTR) {
+            WriteBack(line);
+            if (EnInvalidate == TRUE) {
+                line->valid = FALSE;
+            }
+        }
+        maint_lines++;
+    }
+}
+
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
+{
+    uint32 tag;
+    Line_t *line;
+
+    CHECK((CacheType == MCL_CACHE_CORE) && (BusType == MCL_CACHE_DATA));
+    CHECK(((Addr % LINE) == 0U) && ((Length % LINE) == 0U));
+    maint_calls++;
+    for (tag = Addr; tag < (Addr + Length); tag += LINE) {
+        line = Lookup(tag);
+        if (line != NULL_PTR) {
+            line->valid = FALSE;
+        }
+        maint_lines++;
+    }
+}
+
+/**
+* @brief        eDMA: copies memory to memory, bypassing the cache
+* @details      The source is checked against the CPU's view, which must have reached memory
+*/
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    uint32 addr;
+    uint32 i;
+    Line_t *line;
+
+    (void)Channel;
+    if ((Command == MCL_DMA_CH_START_SERVICE) && (pending.length != 0U)) {
+        for (i = 0U; i < pending.length; i++) {
+            addr = (uint32)(uintptr_t)&pending.src[i];
+            line = (Uncached(&pending.src[i]) == TRUE) ? NULL_PTR : Lookup(addr & ~(LINE - 1U));
+            if ((line != NULL_PTR) && (line->data[addr & (LINE - 1U)] != pending.src[i])) {
+                stale_dma++;
+            }
+            pending.dst[i] = pending.src[i];
+        }
+        pending.length = 0U;
+    }
+}
+
+/*==================================================================================================
+*                                        Scenarios
+==================================================================================================*/
+
+/**
+* @brief        CPU fills a buffer, the eDMA sends it
+*/
+static uint32 TxScenario(boolean use_pool)
+{
+    uint8 *tx;
+    uint8 *sink;
+
+    Reset();
+    tx = Alloc(100U, DMAPOOL_REGION_SRAM);
+    sink = Alloc(100U, DMAPOOL_REGION_SRAM);
+    CpuWrite(tx, 100U, 0x11U);              /* Earlier frame, pulled into the cache */
+    EvictAll();
+    CpuWrite(tx, 100U, 0x22U);              /* This frame, still dirty in the cache */
+
+    pending.src = tx;
+    pending.dst = sink;
+    pending.length = 100U;
+    if (use_pool == TRUE) {
+        DmaPool_SetDmaChannelCommand(0U, MCL_DMA_CH_START_SERVICE, tx, 100U, NULL_PTR, 0U);
+    } else {
+        Mcl_SetDmaChannelCommand(0U, MCL_DMA_CH_START_SERVICE);
+    }
+
+    return stale_dma;
+}
+
+/**
+* @brief        The eDMA receives into a buffer the CPU touched before and prefetches during
+*/
+static uint32 RxScenario(boolean use_pool)
+{
+    uint8 source[100];
+    uint8 *rx;
+
+    Reset();
+    memset(source, 0x5AU, sizeof(source));
+    memcpy(expect_cpu, source, sizeof(source));
+    rx = Alloc(100U, DMAPOOL_REGION_SRAM);
+    CpuWrite(rx, 100U, 0x00U);              /* Clear before use leaves dirty lines */
+
+    pending.src = source;
+    pending.dst = rx;
+    pending.length = 100U;
+    if (use_pool == TRUE) {
+        DmaPool_SetDmaChannelCommand(1U, MCL_DMA_CH_START_SERVICE, NULL_PTR, 0U, rx, 100U);
+    } else {
+        Mcl_SetDmaChannelCommand(1U, MCL_DMA_CH_START_SERVICE);
+    }
+    (void)Fill((uint32)(uintptr_t)rx + LINE);   /* Speculative line fill while DMA runs */
+    if (use_pool == TRUE) {
+        DmaPool_CompleteRx(rx, 100U);
+    }
+    CpuReadCheck(rx, 100U, expect_cpu);
+    EvictAll();                             /* Dirty lines left behind land over DMA data */
+    Reset();
+    CpuReadCheck(rx, 100U, expect_cpu);
+
+    return stale_cpu;
+}
+
+/**
+* @brief        Unpadded buffer sharing a line with CPU data written during the transfer
+*/
+static uint32 SharedLineScenario(boolean use_pool)
+{
+    static uint8 packed[2U * LINE] __attribute__((aligned(32)));
+    uint8 source[40];
+    uint8 *rx;
+    uint8 *counter;
+    const uint8 one = 0x01U;
+
+    Reset();
+    memset(source, 0xA5U, sizeof(source));
+    memcpy(expect_cpu, source, sizeof(source));
+    memset(packed, 0, sizeof(packed));
+    if (use_pool == TRUE) {
+        rx = Alloc(40U, DMAPOOL_REGION_SRAM);
+        counter = Alloc(1U, DMAPOOL_REGION_SRAM);
+    } else {
+        rx = packed;
+        counter = &packed[40];              /* Same line as the tail of the DMA buffer */
+    }
+
+    pending.src = source;
+    pending.dst = rx;
+    pending.length = 40U;
+    DmaPool_PrepareRx(rx, 40U);
+    CpuWrite(counter, 1U, 0x01U);           /* Pulls the line in while the eDMA is running */
+    Mcl_SetDmaChannelCommand(2U, MCL_DMA_CH_START_SERVICE);
+    DmaPool_CompleteRx(rx, 40U);            /* Drops the counter if it shares the line */
+    EvictAll();
+    CpuReadCheck(rx, 40U, expect_cpu);
+    CpuReadCheck(counter, 1U, &one);
+
+    return stale_cpu;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    DmaPool_StatsType stats;
+    uint8 *a;
+    uint8 *b;
+    uint8 *d;
+    uint8 *big[DMAPOOL_SRAM_SIZE / (4U * LINE)];
+    uint32 i;
+    uint32 lines;
+
+    /* Allocator: aligned, padded to whole lines, first fit reuse, exhaustion */
+    Reset();
+    a = Alloc(10U, DMAPOOL_REGION_SRAM);
+    b = Alloc(10U, DMAPOOL_REGION_SRAM);
+    CHECK((a != NULL_PTR) && (b != NULL_PTR));
+    CHECK((((uintptr_t)a % LINE) == 0U) && (((uintptr_t)b % LINE) == 0U));
+    CHECK((b - a) == (ptrdiff_t)LINE);
+    CHECK(Alloc(0U, DMAPOOL_REGION_SRAM) == NULL_PTR);
+    DmaPool_Free(a);
+    CHECK(Alloc(LINE, DMAPOOL_REGION_SRAM) == a);
+    DmaPool_Free(&a[1]);                    /* Inside a run: ignored */
+    DmaPool_Free(expect_cpu);               /* Not from the pool: ignored */
+    CHECK(Alloc(LINE, DMAPOOL_REGION_SRAM) != a);
+    Reset();
+    for (i = 0U; i < (sizeof(big) / sizeof(big[0])); i++) {
+        big[i] = Alloc(4U * LINE, DMAPOOL_REGION_SRAM);
+        CHECK(big[i] != NULL_PTR);
+    }
+    CHECK(Alloc(1U, DMAPOOL_REGION_SRAM) == NULL_PTR);
+    DmaPool_Free(big[3]);
+    CHECK(Alloc((4U * LINE) + 1U, DMAPOOL_REGION_SRAM) == NULL_PTR);
+    CHECK(Alloc(4U * LINE, DMAPOOL_REGION_SRAM) == big[3]);
+
+    /* Stale reads: the model catches each bug without the pool, none with it */
+    printf("%-26s %12s %12s\n", "scenario", "raw Mcl", "DmaPool");
+    printf("%-26s %12u %12u  stale eDMA reads\n", "tx from dirty cache", TxScenario(FALSE), TxScenario(TRUE));
+    printf("%-26s %12u %12u  stale CPU reads\n", "rx with prefetch", RxScenario(FALSE), RxScenario(TRUE));
+    printf("%-26s %12u %12u  stale CPU reads\n", "rx sharing a line", SharedLineScenario(FALSE), SharedLineScenario(TRUE));
+    CHECK(TxScenario(FALSE) > 0U);
+    CHECK(TxScenario(TRUE) == 0U);
+    CHECK(RxScenario(FALSE) > 0U);
+    CHECK(RxScenario(TRUE) == 0U);
+    CHECK(SharedLineScenario(FALSE) > 0U);
+    CHECK(SharedLineScenario(TRUE) == 0U);
+
+    /* Maintenance cost: one call per direction, only the padded buffer lines */
+    (void)TxScenario(TRUE);
+    DmaPool_GetStatistics(&stats);
+    lines = (100U + LINE - 1U) / LINE;
+    CHECK((stats.CleanOps == 1U) && (stats.CleanBytes == (lines * LINE)) && (maint_lines == lines));
+    Reset();
+    a = Alloc(100U, DMAPOOL_REGION_SRAM);
+    DmaPool_SetDmaChannelCommand(1U, MCL_DMA_CH_START_SERVICE, NULL_PTR, 0U, a, 100U);
+    DmaPool_CompleteRx(a, 100U);
+    CHECK((maint_calls == 2U) && (maint_lines == (2U * lines)));
+    printf("100-byte rx: %u maintenance calls over %u lines, whole-cache maintenance touches %u lines\n",
+           maint_calls, maint_lines, CACHE_LINES);
+
+    /* DTCM buffers: no maintenance, eDMA programmed with the backdoor address */
+    Reset();
+    d = Alloc(64U, DMAPOOL_REGION_DTCM);
+    CHECK(d != NULL_PTR);
+    CHECK(DmaPool_GetDmaAddress(d) == ((uint32)(uintptr_t)d + DMAPOOL_DTCM_BACKDOOR_OFFSET));
+    CHECK(DmaPool_GetDmaAddress(a) == (uint32)(uintptr_t)a);
+    DmaPool_SetDmaChannelCommand(3U, MCL_DMA_CH_START_SERVICE, d, 64U, d, 64U);
+    DmaPool_CompleteRx(d, 64U);
+    DmaPool_GetStatistics(&stats);
+    CHECK((stats.SkippedOps == 3U) && (stats.CleanOps == 0U) && (stats.InvalidateOps == 0U));
+    CHECK(maint_calls == 0U);
+
+    return HOST_TEST_RESULT();
+}
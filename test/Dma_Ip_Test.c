@@ -0,0 +1,326 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host build of the Dma_Ip driver against the simulated eDMA3 block in rtd/. Checks that a
+* compiled TCD image programs the same descriptor as the transfer list it was built from, that
+* re-arming keeps everything but the addresses and the major count, and measures the cost of
+* the three ways of reprogramming a channel.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "Dma_Ip.h"
+#include "Dma_Host.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define ADDR(p)             ((uint32)(uintptr_t)(p))
+#define WORDS               (64U)
+#define BENCH_CALLS         (200000U)
+#define LOGIC_CH_LIST       (0U)        /* Reprogrammed through the transfer list */
+#define LOGIC_CH_IMAGE      (1U)        /* Reprogrammed from a compiled image */
+#define LOGIC_CH_LINKED     (2U)        /* Image with minor loop channel link */
+#define LOGIC_CH_IDLE       (3U)        /* No transfer configuration: stays READY after init */
+#define MCL_EA_TCD          (8U)        /* MCL_EXCLUSIVE_AREA_08 protects the TCD words */
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint32 src_a[WORDS];
+static uint32 src_b[WORDS];
+static uint32 dst_a[WORDS];
+static uint32 dst_b[WORDS];
+static Dma_Ip_SwTcdRegType image;
+static Dma_Ip_SwTcdRegType image_linked;
+static Dma_Ip_SwTcdRegType chain[2];
+
+static Dma_Ip_HwChannelStateType ch_state[DMA_IP_NOF_CFG_LOGIC_CHANNELS];
+static Dma_Ip_HwChannelStateType *ch_state_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_state[0], &ch_state[1], &ch_state[2], &ch_state[3]
+};
+
+static const Dma_Ip_GlobalConfigType global_cfg = {
+    { FALSE, FALSE }, { FALSE }, { FALSE }, { 0U }, { 0U, 0U, FALSE, FALSE }
+};
+static const Dma_Ip_TransferConfigType transfer_cfg;
+
+#define CH_CFG(Logic, Hw, Transfer) \
+    { { (Logic), DMA_IP_HARDWARE_VERSION_3, 0U, (Hw), NULL_PTR, NULL_PTR }, &global_cfg, (Transfer), NULL_PTR }
+
+static const Dma_Ip_LogicChannelConfigType ch_cfg[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    CH_CFG(0U, 0U, &transfer_cfg),
+    CH_CFG(1U, 1U, &transfer_cfg),
+    CH_CFG(2U, 2U, &transfer_cfg),
+    CH_CFG(3U, 3U, NULL_PTR),
+};
+static const Dma_Ip_LogicChannelConfigType ch_reset_cfg = CH_CFG(0U, 0U, &transfer_cfg);
+static const Dma_Ip_LogicChannelConfigType * const ch_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_cfg[0], &ch_cfg[1], &ch_cfg[2], &ch_cfg[3]
+};
+
+static const Dma_Ip_LogicInstanceConfigType inst_cfg = {
+    { 0U, DMA_IP_HARDWARE_VERSION_3, 0U }, FALSE, FALSE, TRUE, TRUE, FALSE
+};
+static const Dma_Ip_LogicInstanceConfigType * const inst_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_INSTANCES] = {
+    &inst_cfg
+};
+
+static const Dma_Ip_InitType dma_init = {
+    ch_state_ptr, &ch_reset_cfg, ch_cfg_ptr, &inst_cfg, inst_cfg_ptr
+};
+
+/* Word copy with a major interrupt, the shape of a typical peripheral buffer refill */
+static Dma_Ip_LogicChannelTransferListType copy_list[] = {
+    { DMA_IP_CH_SET_SOURCE_ADDRESS, 0U },
+    { DMA_IP_CH_SET_SOURCE_SIGNED_OFFSET, 4U },
+    { DMA_IP_CH_SET_SOURCE_SIGNED_LAST_ADDR_ADJ, (uint32)(-(sint32)(WORDS * 4U)) },
+    { DMA_IP_CH_SET_SOURCE_TRANSFER_SIZE, 2U },
+    { DMA_IP_CH_SET_DESTINATION_ADDRESS, 0U },
+    { DMA_IP_CH_SET_DESTINATION_SIGNED_OFFSET, 4U },
+    { DMA_IP_CH_SET_DESTINATION_SIGNED_LAST_ADDR_ADJ, (uint32)(-(sint32)(WORDS * 4U)) },
+    { DMA_IP_CH_SET_DESTINATION_TRANSFER_SIZE, 2U },
+    { DMA_IP_CH_SET_MINORLOOP_SIZE, 4U },
+    { DMA_IP_CH_SET_MAJORLOOP_COUNT, WORDS },
+    { DMA_IP_CH_SET_CONTROL_EN_MAJOR_INTERRUPT, 1U },
+    { DMA_IP_CH_SET_CONTROL_DIS_AUTO_REQUEST, 1U },
+};
+#define COPY_LIST_LEN       (sizeof(copy_list) / sizeof(copy_list[0]))
+
+/* Minor loop link to another channel, kept in the upper bits of CITER/BITER */
+static const Dma_Ip_LogicChannelTransferListType link_list[] = {
+    { DMA_IP_CH_SET_MINORLOOP_EN_LINK, 1U },
+    { DMA_IP_CH_SET_MINORLOOP_LOGIC_LINK_CH, LOGIC_CH_IMAGE },
+    { DMA_IP_CH_SET_MAJORLOOP_COUNT, 16U },
+};
+#define LINK_LIST_LEN       (sizeof(link_list) / sizeof(link_list[0]))
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+static Dma_Ip_ChRegType *HwCh(uint32 Ch)
+{
+    return &Dma_Host_Tcd.TCD_RSV[Ch].tChTcdReg.tChReg;
+}
+
+static Dma_Ip_TcdRegType *HwTcd(uint32 Ch)
+{
+    return &Dma_Host_Tcd.TCD_RSV[Ch].tChTcdReg.tTcdReg;
+}
+
+static void Fill(uint32 *buf, uint32 seed)
+{
+    uint32 i;
+
+    for (i = 0U; i < WORDS; i++) {
+        buf[i] = (seed * 0x9E3779B9UL) + i;
+    }
+}
+
+/**
+* @brief        Issue software requests until the channel completed Count major loops
+* @return       Number of requests issued
+*/
+static uint32 RunMajorLoops(uint32 Ch, uint32 Count)
+{
+    uint32 target = Dma_Host_MajorLoops[Ch] + Count;
+    uint32 requests = 0U;
+
+    while ((Dma_Host_MajorLoops[Ch] < target) && (requests < 0x10000U)) {
+        (void)Dma_Ip_SetLogicChannelCommand(Ch, DMA_IP_CH_SET_SOFTWARE_REQUEST);
+        Dma_Host_Run();
+        requests++;
+    }
+
+    return requests;
+}
+
+/**
+* @brief        The image and the list program the same descriptor, and the image runs
+*/
+static void CheckImageMatchesList(void)
+{
+    uint32 ea;
+
+    copy_list[0].Value = ADDR(src_a);
+    copy_list[4].Value = ADDR(dst_a);
+    CHECK(Dma_Ip_SetLogicChannelTransferList(LOGIC_CH_LIST, copy_list, COPY_LIST_LEN) == DMA_IP_STATUS_SUCCESS);
+    CHECK(Dma_Ip_CompileLogicChannelTransferList(LOGIC_CH_IMAGE, copy_list, COPY_LIST_LEN, &image) == DMA_IP_STATUS_SUCCESS);
+
+    /* Compiling only touches RAM, loading enters the TCD exclusive area once */
+    ea = SchM_Host_MclArea[MCL_EA_TCD];
+    CHECK(memcmp((const void *)HwTcd(LOGIC_CH_IMAGE), &image, sizeof(image)) != 0);
+    CHECK(Dma_Ip_LoadLogicChannelTcdImage(LOGIC_CH_IMAGE, &image) == DMA_IP_STATUS_SUCCESS);
+    CHECK(SchM_Host_MclArea[MCL_EA_TCD] == (ea + 1U));
+    CHECK(memcmp((const void *)HwTcd(LOGIC_CH_LIST), (const void *)HwTcd(LOGIC_CH_IMAGE), sizeof(image)) == 0);
+
+    Fill(src_a, 1U);
+    memset(dst_a, 0, sizeof(dst_a));
+    HwCh(LOGIC_CH_IMAGE)->reg_CH_CSR = 0U;
+    HwCh(LOGIC_CH_IMAGE)->reg_CH_INT = 0U;
+    CHECK(RunMajorLoops(LOGIC_CH_IMAGE, 1U) == WORDS);
+    CHECK(memcmp(src_a, dst_a, sizeof(src_a)) == 0);
+    CHECK((HwCh(LOGIC_CH_IMAGE)->reg_CH_CSR & DMA_IP_TCD_CH_CSR_DONE_MASK) != 0U);
+    CHECK(HwCh(LOGIC_CH_IMAGE)->reg_CH_INT == DMA_IP_TCD_CH_INT_INT_MASK);
+}
+
+/**
+* @brief        Re-arming changes the addresses and the count only, and clears DONE
+*/
+static void CheckRearm(void)
+{
+    Dma_Ip_TcdRegType before;
+    Dma_Ip_TcdRegType after;
+    uint32 value = 0U;
+
+    memcpy(&before, (const void *)HwTcd(LOGIC_CH_IMAGE), sizeof(before));
+    HwCh(LOGIC_CH_IMAGE)->reg_CH_CSR = 0U;
+    CHECK(Dma_Ip_RearmLogicChannel(LOGIC_CH_IMAGE, ADDR(src_b), ADDR(dst_b), WORDS / 2U) == DMA_IP_STATUS_SUCCESS);
+    memcpy(&after, (const void *)HwTcd(LOGIC_CH_IMAGE), sizeof(after));
+
+    /* DONE is write-one-to-clear: the rearm wrote the 1 that clears it on the target */
+    CHECK((HwCh(LOGIC_CH_IMAGE)->reg_CH_CSR & DMA_IP_TCD_CH_CSR_DONE_MASK) != 0U);
+    CHECK((after.reg_SADDR == ADDR(src_b)) && (after.reg_DADDR == ADDR(dst_b)));
+    CHECK((Dma_Ip_GetLogicChannelParam(LOGIC_CH_IMAGE, DMA_IP_CH_GET_BEGIN_ITER_COUNT, &value) == DMA_IP_STATUS_SUCCESS) &&
+          (value == (WORDS / 2U)));
+    CHECK((Dma_Ip_GetLogicChannelParam(LOGIC_CH_IMAGE, DMA_IP_CH_GET_CURRENT_ITER_COUNT, &value) == DMA_IP_STATUS_SUCCESS) &&
+          (value == (WORDS / 2U)));
+    CHECK((after.reg_SOFF == before.reg_SOFF) && (after.reg_ATTR == before.reg_ATTR) &&
+          (after.reg_NBYTES.reg_MLOFFYES == before.reg_NBYTES.reg_MLOFFYES) &&
+          (after.reg_SLAST_SDA == before.reg_SLAST_SDA) && (after.reg_DOFF == before.reg_DOFF) &&
+          (after.reg_DLAST_SGA == before.reg_DLAST_SGA) && (after.reg_CSR == before.reg_CSR));
+
+    Fill(src_b, 2U);
+    memset(dst_b, 0, sizeof(dst_b));
+    CHECK(RunMajorLoops(LOGIC_CH_IMAGE, 1U) == (WORDS / 2U));
+    CHECK(memcmp(src_b, dst_b, (WORDS / 2U) * 4U) == 0);
+    CHECK(dst_b[WORDS / 2U] == 0U);
+
+    /* The minor loop link survives a rearm */
+    CHECK(Dma_Ip_CompileLogicChannelTransferList(LOGIC_CH_LINKED, copy_list, COPY_LIST_LEN, &image_linked) == DMA_IP_STATUS_SUCCESS);
+    CHECK(Dma_Ip_CompileLogicChannelTransferList(LOGIC_CH_LINKED, link_list, LINK_LIST_LEN, &image_linked) == DMA_IP_STATUS_SUCCESS);
+    /* A new compile starts from an empty image */
+    CHECK(image_linked.reg_SADDR == 0U);
+    CHECK(Dma_Ip_LoadLogicChannelTcdImage(LOGIC_CH_LINKED, &image_linked) == DMA_IP_STATUS_SUCCESS);
+    before.reg_CITER.reg_ELINKYES = HwTcd(LOGIC_CH_LINKED)->reg_CITER.reg_ELINKYES;
+    CHECK((before.reg_CITER.reg_ELINKYES & DMA_IP_TCD_CITER_ELINKYES_ELINK_MASK) != 0U);
+    CHECK(Dma_Ip_RearmLogicChannel(LOGIC_CH_LINKED, ADDR(src_b), ADDR(dst_b), 5U) == DMA_IP_STATUS_SUCCESS);
+    after.reg_CITER.reg_ELINKYES = HwTcd(LOGIC_CH_LINKED)->reg_CITER.reg_ELINKYES;
+    after.reg_BITER.reg_ELINKYES = HwTcd(LOGIC_CH_LINKED)->reg_BITER.reg_ELINKYES;
+    CHECK((after.reg_CITER.reg_ELINKYES & ~DMA_IP_TCD_CITER_ELINKYES_CITER_MASK) ==
+          (before.reg_CITER.reg_ELINKYES & ~DMA_IP_TCD_CITER_ELINKYES_CITER_MASK));
+    CHECK(((after.reg_CITER.reg_ELINKYES & DMA_IP_TCD_CITER_ELINKYES_CITER_MASK) == 5U) &&
+          ((after.reg_BITER.reg_ELINKYES & DMA_IP_TCD_BITER_ELINKYES_BITER_MASK) == 5U));
+
+    /* A channel that never received a transfer is not re-armed, loading an image starts it */
+    CHECK(Dma_Ip_RearmLogicChannel(LOGIC_CH_IDLE, ADDR(src_b), ADDR(dst_b), 1U) == DMA_IP_STATUS_WRONG_STATE);
+    CHECK(Dma_Ip_LoadLogicChannelTcdImage(LOGIC_CH_IDLE, &image) == DMA_IP_STATUS_SUCCESS);
+    CHECK(Dma_Ip_RearmLogicChannel(LOGIC_CH_IDLE, ADDR(src_b), ADDR(dst_b), 1U) == DMA_IP_STATUS_SUCCESS);
+}
+
+/**
+* @brief        Two linked images run back to back from one software request
+*/
+static void CheckScatterGather(void)
+{
+    uint32 loops = Dma_Host_MajorLoops[LOGIC_CH_IMAGE];
+
+    copy_list[0].Value = ADDR(src_a);
+    copy_list[4].Value = ADDR(dst_a);
+    CHECK(Dma_Ip_CompileLogicChannelTransferList(LOGIC_CH_IMAGE, copy_list, COPY_LIST_LEN, &chain[0]) == DMA_IP_STATUS_SUCCESS);
+    copy_list[0].Value = ADDR(src_b);
+    copy_list[4].Value = ADDR(dst_b);
+    CHECK(Dma_Ip_CompileLogicChannelTransferList(LOGIC_CH_IMAGE, copy_list, COPY_LIST_LEN, &chain[1]) == DMA_IP_STATUS_SUCCESS);
+    CHECK(Dma_Ip_LinkTcdImage(LOGIC_CH_IMAGE, &chain[0], &chain[1]) == DMA_IP_STATUS_SUCCESS);
+    CHECK(Dma_Ip_LinkTcdImage(LOGIC_CH_IMAGE, &chain[1], NULL_PTR) == DMA_IP_STATUS_SUCCESS);
+    /* The engine fetches the next element and serves its first minor loop without a request */
+    chain[1].reg_CSR |= DMA_IP_TCD_CSR_START_MASK;
+
+    Fill(src_a, 3U);
+    Fill(src_b, 4U);
+    memset(dst_a, 0, sizeof(dst_a));
+    memset(dst_b, 0, sizeof(dst_b));
+    CHECK(Dma_Ip_LoadLogicChannelTcdImage(LOGIC_CH_IMAGE, &chain[0]) == DMA_IP_STATUS_SUCCESS);
+    CHECK(RunMajorLoops(LOGIC_CH_IMAGE, 2U) == (2U * WORDS) - 1U);
+    CHECK(Dma_Host_MajorLoops[LOGIC_CH_IMAGE] == (loops + 2U));
+    CHECK((memcmp(src_a, dst_a, sizeof(src_a)) == 0) && (memcmp(src_b, dst_b, sizeof(src_b)) == 0));
+}
+
+/**
+* @brief        Time the three ways of reprogramming a channel and print ns per call
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double list_ns;
+    double load_ns;
+    double rearm_ns;
+    uint32 i;
+
+    copy_list[0].Value = ADDR(src_a);
+    copy_list[4].Value = ADDR(dst_a);
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        (void)Dma_Ip_SetLogicChannelTransferList(LOGIC_CH_LIST, copy_list, COPY_LIST_LEN);
+    }
+    list_ns = (host_test_ns() - t0) / (double)BENCH_CALLS;
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        (void)Dma_Ip_LoadLogicChannelTcdImage(LOGIC_CH_IMAGE, &image);
+    }
+    load_ns = (host_test_ns() - t0) / (double)BENCH_CALLS;
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        (void)Dma_Ip_RearmLogicChannel(LOGIC_CH_IMAGE, ADDR(src_a) + (i & 4U), ADDR(dst_a), WORDS);
+    }
+    rearm_ns = (host_test_ns() - t0) / (double)BENCH_CALLS;
+
+    printf("reprogram %u-entry list %6.1f ns   load image %6.1f ns   rearm %6.1f ns   (%u calls each)\n",
+           (unsigned int)COPY_LIST_LEN, list_ns, load_ns, rearm_ns, BENCH_CALLS);
+    CHECK(load_ns < list_ns);
+    CHECK(rearm_ns < list_ns);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    uint32 ch;
+
+    CHECK(Dma_Ip_Init(&dma_init) == DMA_IP_STATUS_SUCCESS);
+    for (ch = 0U; ch < DMA_IP_NOF_CFG_LOGIC_CHANNELS; ch++) {
+        CHECK(ch_state[ch].StateValue == ((ch == LOGIC_CH_IDLE) ? DMA_IP_CH_READY_STATE : DMA_IP_CH_TRANSFER_STATE));
+        /* The clear-error write of the init sets ERR in RAM, the target reads it back as 0 */
+        CHECK(HwCh(ch)->reg_CH_ES == DMA_IP_TCD_CH_ES_ERR_MASK);
+        HwCh(ch)->reg_CH_ES = 0U;
+    }
+
+    CheckImageMatchesList();
+    CheckRearm();
+    CheckScatterGather();
+    Benchmark();
+
+    /* Every exclusive area entered by the driver was left again */
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
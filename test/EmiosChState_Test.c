@@ -0,0 +1,275 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Host test of the eMIOS PWM channel state records, built from the driver sources on the
+* register model of rtd/. Every record has to fill exactly one 32-byte line and start on one.
+* The paths that reach the records through a ChState pointer are run once each: the bus user
+* count of InitChannel and DeInitChannel, the notification of InitOutputIrqAndMode, the 0% and
+* 100% cases of OPWMCB and DAOC and the DAOC interrupt. The benchmark times duty updates and
+* interrupts spread over the records of 69 channels; the host caches say little about the M7
+* ones, so only the ratio between the modes is worth comparing.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "Emios_Host.h"
+#include "Emios_Pwm_Ip.h"
+#include "Emios_Pwm_Ip_HwAccess.h"
+#include "Emios_Pwm_Ip_Irq.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define BUS_CHANNEL         (23U)           /* Bus A */
+#define PERIOD              (1000U)
+#define DAOC_PERIOD         (300U)
+#define INSTANCES           (3U)
+#define CHANNELS            (23U)           /* Per instance, the bus channel excluded */
+#define BENCH_ROUNDS        (20000U)
+
+#define MODE_MCB_UP         (80U)
+#define MODE_MCB_UP_DOWN    (84U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Emios_Pwm_Ip_ChannelConfigType config[INSTANCES][CHANNELS];
+static uint32 callbacks;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+static void Notification(uint8 Channel)
+{
+    (void)Channel;
+    callbacks++;
+}
+
+/**
+* @brief        State record of a channel
+*/
+static Emios_Pwm_Ip_ChStateType *State(uint8 Instance, uint8 Channel)
+{
+    return &Emios_Pwm_Ip_aChState[eMios_Pwm_Ip_IndexInChState[Instance][Channel]];
+}
+
+/**
+* @brief        Configuration of one channel on bus A, no notification
+*/
+static Emios_Pwm_Ip_ChannelConfigType *Config(uint8 Instance, uint8 Channel, Emios_Pwm_Ip_PwmModeType Mode,
+                                              uint32 Period, uint32 Duty)
+{
+    Emios_Pwm_Ip_ChannelConfigType *cfg = &config[Instance][Channel];
+
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->ChannelId = Channel;
+    cfg->Mode = Mode;
+    cfg->Timebase = EMIOS_PWM_IP_BUS_A;
+    cfg->OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE;
+    cfg->InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1;
+    cfg->InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1;
+    cfg->InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK;
+    cfg->OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH;
+    cfg->IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED;
+    cfg->PeriodCount = Period;
+    cfg->DutyCycle = Duty;
+
+    return cfg;
+}
+
+/**
+* @brief        One record per line, each on a line boundary
+*/
+static void LayoutTest(void)
+{
+    uint32 misaligned = 0U;
+    uint32 i;
+
+    printf("channel state: %u bytes (%u of fields), array at line offset %u, %u records\n",
+           (uint32)sizeof(Emios_Pwm_Ip_ChStateType), (uint32)EMIOS_PWM_IP_CH_STATE_FIELDS,
+           (uint32)((uintptr_t)Emios_Pwm_Ip_aChState % EMIOS_PWM_IP_CH_STATE_SIZE),
+           (uint32)EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8);
+    CHECK(sizeof(Emios_Pwm_Ip_ChStateType) == EMIOS_PWM_IP_CH_STATE_SIZE);
+    for (i = 0U; i < EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8; i++) {
+        misaligned += (((uintptr_t)&Emios_Pwm_Ip_aChState[i] % EMIOS_PWM_IP_CH_STATE_SIZE) != 0U) ? 1U : 0U;
+    }
+    CHECK(misaligned == 0U);
+    CHECK((offsetof(Emios_Pwm_Ip_ChStateType, Polarity) + 1U) <= EMIOS_PWM_IP_CH_STATE_SIZE);
+}
+
+/**
+* @brief        Bus channel user count and the registered notification
+*/
+static void InitTest(void)
+{
+    Emios_Pwm_Ip_ChannelConfigType *cfg;
+    uint8 ch;
+
+    Emios_Host_Reset();
+    Emios_Host_SetBus(0U, BUS_CHANNEL, PERIOD, MODE_MCB_UP);
+    for (ch = 0U; ch < 3U; ch++) {
+        cfg = Config(0U, ch, EMIOS_PWM_IP_MODE_OPWMB_FLAG, PERIOD, 100U);
+        cfg->IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST;
+        cfg->UserCallback.CbFunction = Notification;
+        cfg->UserCallback.CbParameter = ch;
+        Emios_Pwm_Ip_InitChannel(0U, cfg);
+    }
+    CHECK(State(0U, BUS_CHANNEL)->CheckState == 3U);
+    CHECK(State(0U, 1U)->CheckState == 1U);
+    CHECK(State(0U, 1U)->InitialMode == EMIOS_PWM_IP_MODE_OPWMB_FLAG);
+    CHECK(State(0U, 1U)->CurrentMode == EMIOS_PWM_IP_MODE_OPWMB_FLAG);
+    CHECK(State(0U, 2U)->NotificationPtr == &config[0][2].UserCallback);
+    CHECK(Emios_Pwm_Ip_GetChannelMode(0U, 2U) == EMIOS_PWM_IP_MODE_OPWMB_FLAG);
+    CHECK(Emios_Pwm_Ip_GetDutyCycle(0U, 2U) == 100U);
+
+    /* The interrupt reaches the callback through the record */
+    callbacks = 0U;
+    Emios_Pwm_Ip_SetFlagRequest(0U, 1U, EMIOS_PWM_IP_INTERRUPT_REQUEST);
+    Emios_Host_RaiseFlag(0U, 1U);
+    Emios_Pwm_Ip_IrqHandler(0U, 1U);
+    CHECK(callbacks == 1U);
+
+    Emios_Pwm_Ip_DeInitChannel(0U, 1U);
+    CHECK(State(0U, 1U)->CheckState == 0U);
+    CHECK(State(0U, 1U)->CheckEnableNotif == 0U);
+    CHECK(State(0U, BUS_CHANNEL)->CheckState == 2U);
+    Emios_Pwm_Ip_DeInitChannel(0U, 0U);
+    Emios_Pwm_Ip_DeInitChannel(0U, 2U);
+    CHECK(State(0U, BUS_CHANNEL)->CheckState == 0U);
+    /* A second deinit does not wrap the count */
+    Emios_Pwm_Ip_DeInitChannel(0U, 2U);
+    CHECK(State(0U, BUS_CHANNEL)->CheckState == 0U);
+}
+
+/**
+* @brief        0% and 100% of the modes that hold them in the record
+*/
+static void DutyTest(void)
+{
+    const eMIOS_Type *regs = &Emios_Host_Regs[1];
+    Emios_Pwm_Ip_ChannelConfigType *cfg;
+    uint32 full = (2U * PERIOD) - 2U;
+
+    Emios_Host_Reset();
+    Emios_Host_SetBus(1U, BUS_CHANNEL, PERIOD, MODE_MCB_UP_DOWN);
+    Emios_Pwm_Ip_InitChannel(1U, Config(1U, 4U, EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG, full, 200U));
+    /* DAOC runs on its interrupt, which needs a notification even when it stays disabled */
+    cfg = Config(1U, 5U, EMIOS_PWM_IP_MODE_DAOC_FLAG, DAOC_PERIOD, 100U);
+    cfg->IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST;
+    cfg->UserCallback.CbFunction = Notification;
+    Emios_Pwm_Ip_InitChannel(1U, cfg);
+
+    /* OPWMCB */
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 4U, 0U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK((regs->CH.UC[4].A == (PERIOD + 1U)) && (State(1U, 4U)->Notif == 1U));
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 4U, full) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK((regs->CH.UC[4].A == 1U) && (State(1U, 4U)->Notif == 1U));
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 4U, 400U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK((regs->CH.UC[4].A == (PERIOD - 200U)) && (State(1U, 4U)->Notif == 0U));
+    CHECK(State(1U, 4U)->DutyCycle == 400U);
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 4U, full + 1U) == EMIOS_PWM_IP_STATUS_ERROR);
+    CHECK(regs->CH.UC[4].A == (PERIOD - 200U));
+
+    /* DAOC: the start of the next pulse is computed in the interrupt */
+    CHECK(State(1U, 5U)->Period == DAOC_PERIOD);
+    CHECK(State(1U, 5U)->DutyCycle == 100U);
+    CHECK((regs->CH.UC[5].A == 1U) && (regs->CH.UC[5].B == 101U));
+    Emios_Host_RaiseFlag(1U, 5U);
+    Emios_Pwm_Ip_IrqHandler(1U, 5U);
+    CHECK(regs->CH.UC[5].A == (101U + DAOC_PERIOD - 100U));
+    CHECK(regs->CH.UC[5].B == (101U + DAOC_PERIOD));
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 5U, 0U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK((State(1U, 5U)->DutyCycle == 0U) && (State(1U, 5U)->Notif == 1U));
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 5U, DAOC_PERIOD) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK(State(1U, 5U)->Notif == 1U);
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 5U, 50U) == EMIOS_PWM_IP_STATUS_SUCCESS);
+    CHECK((State(1U, 5U)->DutyCycle == 50U) && (State(1U, 5U)->Notif == 0U));
+    CHECK(Emios_Pwm_Ip_SetDutyCycle(1U, 5U, DAOC_PERIOD + 1U) == EMIOS_PWM_IP_STATUS_ERROR);
+
+    Emios_Pwm_Ip_DeInitChannel(1U, 4U);
+    Emios_Pwm_Ip_DeInitChannel(1U, 5U);
+    CHECK(State(1U, BUS_CHANNEL)->CheckState == 0U);
+}
+
+/**
+* @brief        Duty updates and interrupts over every record, a different line each call
+*/
+static void Benchmark(void)
+{
+    static const Emios_Pwm_Ip_PwmModeType modes[INSTANCES] = {
+        EMIOS_PWM_IP_MODE_OPWMB_FLAG, EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG, EMIOS_PWM_IP_MODE_OPWFMB_FLAG
+    };
+    static const uint32 periods[INSTANCES] = { PERIOD, (2U * PERIOD) - 2U, PERIOD };
+    Emios_Pwm_Ip_ChannelConfigType *cfg;
+    double t[INSTANCES + 2U];
+    uint32 instance;
+    uint32 i;
+    uint8 ch;
+
+    Emios_Host_Reset();
+    for (instance = 0U; instance < INSTANCES; instance++) {
+        Emios_Host_SetBus((uint8)instance, BUS_CHANNEL, PERIOD, (instance == 1U) ? MODE_MCB_UP_DOWN : MODE_MCB_UP);
+        for (ch = 0U; ch < CHANNELS; ch++) {
+            cfg = Config((uint8)instance, ch, modes[instance], periods[instance], 10U);
+            if (instance == 2U) {
+                cfg->Timebase = EMIOS_PWM_IP_BUS_INTERNAL;
+            }
+            cfg->IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST;
+            cfg->UserCallback.CbFunction = Notification;
+            Emios_Pwm_Ip_InitChannel((uint8)instance, cfg);
+            Emios_Pwm_Ip_SetFlagRequest((uint8)instance, ch, EMIOS_PWM_IP_INTERRUPT_REQUEST);
+        }
+    }
+
+    t[0] = host_test_ns();
+    for (instance = 0U; instance < INSTANCES; instance++) {
+        for (i = 0U; i < BENCH_ROUNDS; i++) {
+            ch = (uint8)((i * 7U) % CHANNELS);
+            (void)Emios_Pwm_Ip_SetDutyCycle((uint8)instance, ch, (Emios_Pwm_Ip_DutyType)(1U + (i % (PERIOD - 2U))));
+        }
+        t[instance + 1U] = host_test_ns();
+    }
+    callbacks = 0U;
+    for (i = 0U; i < BENCH_ROUNDS; i++) {
+        instance = i % INSTANCES;
+        ch = (uint8)((i * 7U) % CHANNELS);
+        Emios_Host_RaiseFlag((uint8)instance, ch);
+        Emios_Pwm_Ip_IrqHandler((uint8)instance, ch);
+    }
+    t[INSTANCES + 1U] = host_test_ns();
+
+    printf("SetDutyCycle over %u records: OPWMB %.1f ns, OPWMCB %.1f ns, OPWFMB %.1f ns; IrqHandler %.1f ns\n",
+           INSTANCES * CHANNELS, (t[1] - t[0]) / BENCH_ROUNDS, (t[2] - t[1]) / BENCH_ROUNDS,
+           (t[3] - t[2]) / BENCH_ROUNDS, (t[4] - t[3]) / BENCH_ROUNDS);
+    CHECK(callbacks == BENCH_ROUNDS);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    LayoutTest();
+    InitTest();
+    DutyTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,283 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Stress test of the eMIOS PWM deferred notification queue, built from the driver sources on the
+* register model of rtd/. Each producer thread stands for one eMIOS vector: it raises the FLAG
+* of its own channels and runs the IRQ handler, while one consumer thread dispatches. The OsIf
+* counter is a ticket taken inside the push, so the events leave the queue in ticket order and
+* every ticket is seen once unless the event was counted as an overflow. A single-threaded case
+* then raises a second vector from inside the push, where the first one takes its timestamp:
+* before the push was guarded, the second event took the same slot and one of them was lost.
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+#include "Emios_Host.h"
+#include "Emios_Pwm_Ip.h"
+#include "Emios_Pwm_Ip_Irq.h"
+#include "OsIf.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define PRODUCERS           (4U)
+#define CHANNELS            (3U)            /* Channels per producer */
+#define EVENTS              (100000U)       /* Events per producer */
+#define YIELD_EVERY         (8U)
+#define BENCH_EVENTS        (1000000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Emios_Pwm_Ip_ChannelConfigType config[PRODUCERS * CHANNELS];
+
+static volatile uint32 ticket;
+static volatile uint32 producers_done;
+static boolean preempt;             /* Raise the other vector from inside the next push */
+
+/* Consumer side, only touched by the consumer thread */
+static uint8 *seen;
+static uint32 last_ticket;
+static uint32 out_of_order;
+static uint32 duplicates;
+static uint32 bad_channel;
+static uint32 callbacks;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Second eMIOS vector, of a higher priority, on channel 1
+*/
+static void PreemptingVector(void)
+{
+    Emios_Host_RaiseFlag(0U, 1U);
+    Emios_Pwm_Ip_IrqHandler(0U, 1U);
+}
+
+/**
+* @brief        OsIf stand-in: a ticket per call instead of a time
+*/
+uint32 OsIf_GetCounter(OsIf_CounterType SelectedCounter)
+{
+    (void)SelectedCounter;
+    if (preempt) {
+        preempt = FALSE;
+        SchM_Host_RaiseInterrupt(PreemptingVector);
+    }
+
+    return __atomic_add_fetch(&ticket, 1U, __ATOMIC_RELAXED);
+}
+
+/**
+* @brief        Deferred callback: the queued event has to belong to this channel and be newer
+*               than the previous one
+*/
+static void Notification(uint8 Channel)
+{
+    const Emios_Pwm_Ip_NotifEventType *event = Emios_Pwm_Ip_GetDispatchedEvent();
+
+    bad_channel += (config[event->ChannelIdx].ChannelId != Channel) ? 1U : 0U;
+    out_of_order += (event->Timestamp <= last_ticket) ? 1U : 0U;
+    if (seen != NULL) {
+        duplicates += (seen[event->Timestamp] != 0U) ? 1U : 0U;
+        seen[event->Timestamp] = 1U;
+    }
+    last_ticket = event->Timestamp;
+    callbacks++;
+}
+
+/**
+* @brief        One OPWFM channel per configuration, interrupt on FLAG
+*/
+static void InitChannels(void)
+{
+    uint32 i;
+
+    Emios_Host_Reset();
+    for (i = 0U; i < (PRODUCERS * CHANNELS); i++) {
+        memset(&config[i], 0, sizeof(config[i]));
+        config[i].ChannelId = (uint8)i;
+        config[i].Mode = EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG;
+        config[i].Timebase = EMIOS_PWM_IP_BUS_INTERNAL;
+        config[i].InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1;
+        config[i].InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1;
+        config[i].InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK;
+        config[i].OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH;
+        config[i].IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST;
+        config[i].UserCallback.CbFunction = Notification;
+        config[i].UserCallback.CbParameter = (uint8)i;
+        config[i].PeriodCount = 1000U;
+        config[i].DutyCycle = 500U;
+        Emios_Pwm_Ip_InitChannel(0U, &config[i]);
+        Emios_Pwm_Ip_SetFlagRequest(0U, (uint8)i, EMIOS_PWM_IP_INTERRUPT_REQUEST);
+    }
+}
+
+/**
+* @brief        One eMIOS vector: raise a flag of one of its channels and take the interrupt
+*/
+static void *Producer(void *arg)
+{
+    uint32 first = (uint32)(uintptr_t)arg * CHANNELS;
+    uint32 i;
+    uint8 channel;
+
+    for (i = 0U; i < EVENTS; i++) {
+        channel = (uint8)(first + (i % CHANNELS));
+        Emios_Host_RaiseFlag(0U, channel);
+        Emios_Pwm_Ip_IrqHandler(0U, channel);
+        if ((i % YIELD_EVERY) == 0U) {
+            /* Let the dispatcher run, the host may have a single core */
+            (void)sched_yield();
+        }
+    }
+    (void)__atomic_add_fetch(&producers_done, 1U, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/**
+* @brief        The main loop: dispatch until every producer is done and the queue is empty
+*/
+static void *Consumer(void *arg)
+{
+    (void)arg;
+    while (__atomic_load_n(&producers_done, __ATOMIC_ACQUIRE) < PRODUCERS) {
+        if (Emios_Pwm_Ip_DispatchNotifications() == 0U) {
+            (void)sched_yield();
+        }
+    }
+    (void)Emios_Pwm_Ip_DispatchNotifications();
+
+    return NULL;
+}
+
+/**
+* @brief        Producers on every vector against one dispatcher
+*/
+static void StressTest(void)
+{
+    pthread_t producers[PRODUCERS];
+    pthread_t consumer;
+    Emios_Pwm_Ip_NotifStatsType stats;
+    uint32 i;
+
+    seen = calloc((PRODUCERS * EVENTS) + 1U, 1U);
+    InitChannels();
+
+    (void)pthread_create(&consumer, NULL, Consumer, NULL);
+    for (i = 0U; i < PRODUCERS; i++) {
+        (void)pthread_create(&producers[i], NULL, Producer, (void *)(uintptr_t)i);
+    }
+    for (i = 0U; i < PRODUCERS; i++) {
+        (void)pthread_join(producers[i], NULL);
+    }
+    (void)pthread_join(consumer, NULL);
+
+    Emios_Pwm_Ip_GetNotifStats(&stats);
+    printf("stress: %u producers, %u events, %u dispatched, %u dropped, peak level %u of %u\n",
+           PRODUCERS, PRODUCERS * EVENTS, stats.Dispatched, stats.Overflows, stats.PeakLevel,
+           EMIOS_PWM_IP_NOTIF_QUEUE_SIZE);
+    CHECK(ticket == stats.Dispatched);
+    CHECK(callbacks == stats.Dispatched);
+    CHECK((stats.Dispatched + stats.Overflows) == (PRODUCERS * EVENTS));
+    CHECK(stats.PeakLevel <= EMIOS_PWM_IP_NOTIF_QUEUE_SIZE);
+    CHECK(out_of_order == 0U);
+    CHECK(duplicates == 0U);
+    CHECK(bad_channel == 0U);
+    CHECK(SchM_Host_Depth == 0U);
+    CHECK(SchM_Host_PwmArea[29] >= (PRODUCERS * EVENTS));
+    free(seen);
+    seen = NULL;
+}
+
+/**
+* @brief        A vector preempting another one in the middle of its push
+*/
+static void PreemptionTest(void)
+{
+    Emios_Pwm_Ip_NotifStatsType before;
+    Emios_Pwm_Ip_NotifStatsType after;
+
+    (void)Emios_Pwm_Ip_DispatchNotifications();
+    Emios_Pwm_Ip_GetNotifStats(&before);
+    callbacks = 0U;
+    bad_channel = 0U;
+    out_of_order = 0U;
+    last_ticket = ticket;
+
+    preempt = TRUE;
+    Emios_Host_RaiseFlag(0U, 0U);
+    Emios_Pwm_Ip_IrqHandler(0U, 0U);
+    CHECK(Emios_Pwm_Ip_DispatchNotifications() == 2U);
+    Emios_Pwm_Ip_GetNotifStats(&after);
+
+    CHECK(callbacks == 2U);
+    CHECK(bad_channel == 0U);
+    CHECK(out_of_order == 0U);
+    CHECK(after.Overflows == before.Overflows);
+    CHECK(SchM_Host_Depth == 0U);
+}
+
+/**
+* @brief        Cost of the interrupt with its push, and of the dispatch, on one thread
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double t1;
+    double t2;
+    double push = 0.0;
+    double pop = 0.0;
+    uint32 i;
+    uint32 j;
+
+    for (i = 0U; i < (BENCH_EVENTS / EMIOS_PWM_IP_NOTIF_QUEUE_SIZE); i++) {
+        ticket = 0U;
+        last_ticket = 0U;
+        t0 = host_test_ns();
+        for (j = 0U; j < EMIOS_PWM_IP_NOTIF_QUEUE_SIZE; j++) {
+            Emios_Host_RaiseFlag(0U, 0U);
+            Emios_Pwm_Ip_IrqHandler(0U, 0U);
+        }
+        t1 = host_test_ns();
+        (void)Emios_Pwm_Ip_DispatchNotifications();
+        t2 = host_test_ns();
+        push += t1 - t0;
+        pop += t2 - t1;
+    }
+    printf("IRQ handler with push: %.1f ns, dispatch: %.1f ns per event (host lock for the area)\n",
+           push / BENCH_EVENTS, pop / BENCH_EVENTS);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    StressTest();
+    PreemptionTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,152 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of the hot-path cycle probes on the Timestamp host backend, with a 1 GHz core clock
+* so cycles read as ns. A fake Pwm_SetDutyCycle spins for a known time and a fake counter bus
+* stands behind the latency probe. This checks the bookkeeping only: the ITCM against flash
+* figures the probes exist for need the target, built with and without TCM_HOT_PATH.
+*/
+
+#include "host_test.h"
+#include "Clock_Ip.h"
+#include "Emios_Mcl_Ip.h"
+#include "Timestamp.h"
+#include "HotPath.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CORE_HZ             (1000000000U)
+#define CALL_NS             (2000.0)        /* Time the fake duty update takes */
+#define CALLS               (1000U)
+#define BUS_PERIOD          (1000U)
+#define CYCLES_PER_TICK     (6U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint32 duty_calls;
+static uint16 last_duty;
+static uint32 bus_count;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Clock_Ip stand-in for Timestamp
+*/
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName)
+{
+    (void)ClockName;
+
+    return CORE_HZ;
+}
+
+/**
+* @brief        Pwm stand-in taking CALL_NS
+*/
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    double end = host_test_ns() + CALL_NS;
+
+    (void)ChannelNumber;
+    duty_calls++;
+    last_duty = DutyCycle;
+    while (host_test_ns() < end) {
+    }
+}
+
+/**
+* @brief        Counter bus stand-ins
+*/
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel)
+{
+    (void)Instance;
+    (void)Channel;
+
+    return bus_count;
+}
+
+uint32 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel)
+{
+    (void)Instance;
+    (void)Channel;
+
+    return BUS_PERIOD;
+}
+
+/**
+* @brief        Duty update timing against the known cost of the fake
+*/
+static void DutyTest(void)
+{
+    HotPath_StatsType stats;
+
+    Timestamp_Init();
+    HotPath_Init(CYCLES_PER_TICK);
+    HotPath_MeasureDutyUpdate(3U, 0x1000U, 0x3000U, CALLS);
+    HotPath_GetStatistics(HOTPATH_DUTY_UPDATE, &stats);
+
+    printf("duty update: %u samples, first %u, min %u, mean %u, max %u cycles (fake takes %.0f)\n",
+           stats.Samples, stats.First, stats.Min, stats.Mean, stats.Max, CALL_NS);
+    CHECK(duty_calls == CALLS);
+    CHECK(last_duty == 0x3000U);
+    CHECK(stats.Samples == CALLS);
+    CHECK(stats.Min >= (uint32)CALL_NS);
+    CHECK((stats.Min <= stats.Mean) && (stats.Mean <= stats.Max));
+    /* The host may preempt a few samples by milliseconds, which moves the mean but not the min */
+    CHECK(stats.Min < (uint32)(CALL_NS * 1.5));
+}
+
+/**
+* @brief        Latency from the counter bus, also across the period end
+*/
+static void LatencyTest(void)
+{
+    HotPath_StatsType stats;
+
+    HotPath_Init(CYCLES_PER_TICK);
+    bus_count = 510U;
+    HotPath_SampleIsrLatency(0U, 23U, 500U);
+    bus_count = 3U;
+    HotPath_SampleIsrLatency(0U, 23U, BUS_PERIOD - 2U);
+    bus_count = 40U;
+    HotPath_SampleIsrLatency(0U, 23U, 40U);
+    HotPath_GetStatistics(HOTPATH_ISR_LATENCY, &stats);
+
+    CHECK(stats.Samples == 3U);
+    CHECK(stats.First == (10U * CYCLES_PER_TICK));
+    CHECK(stats.Max == (10U * CYCLES_PER_TICK));
+    CHECK(stats.Min == 0U);
+    CHECK(stats.Mean == (15U * CYCLES_PER_TICK / 3U));
+
+    /* Init clears the statistics */
+    HotPath_Init(CYCLES_PER_TICK);
+    HotPath_GetStatistics(HOTPATH_ISR_LATENCY, &stats);
+    CHECK((stats.Samples == 0U) && (stats.Mean == 0U));
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    DutyTest();
+    LatencyTest();
+
+    return HOST_TEST_RESULT();
+}
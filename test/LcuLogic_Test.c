@@ -0,0 +1,297 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host tests of LcuLogic. Every compiled LUT is checked against its expression over all 16
+* input combinations: the operators, the gating examples of the header, and random expression
+* trees. The compiled cell image is evaluated output by output with its polarity and enables,
+* and the commit is checked against a recording Lcu_Ip_SetLogicCellImage.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "LcuLogic.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define COMBINATIONS        (16U)
+#define RANDOM_EXPRESSIONS  (20000U)
+#define MAX_DEPTH           (5U)
+#define MAX_CELLS           (4U)
+
+#define IN(n, v)            ((((uint32)(v)) >> (n)) & 1U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Recorded calls of the fake driver */
+static uint8 commit_instance[MAX_CELLS];
+static uint8 commit_cell[MAX_CELLS];
+static Lcu_Ip_LogicCellImageType commit_image[MAX_CELLS];
+static uint32 commit_count;
+static uint32 protected_cell = 0xFFU;
+
+static uint32 rng_state = 0x2545F491U;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+static uint32 Random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+/*
+* Build a random expression with the LCULOGIC_ macros, and its reference value for every input
+* combination evaluated one combination at a time on plain booleans
+*/
+static uint16 RandomExpression(uint32 Depth, uint8 Reference[COMBINATIONS])
+{
+    uint8 a[COMBINATIONS];
+    uint8 b[COMBINATIONS];
+    uint8 s[COMBINATIONS];
+    uint16 lut;
+    uint16 la;
+    uint16 lb;
+    uint16 ls;
+    uint32 op = (Depth == 0U) ? (Random() % 6U) : (6U + (Random() % 5U));
+    uint32 v;
+
+    switch (op) {
+    case 0U: lut = LCULOGIC_I0; for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)IN(0U, v); } break;
+    case 1U: lut = LCULOGIC_I1; for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)IN(1U, v); } break;
+    case 2U: lut = LCULOGIC_I2; for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)IN(2U, v); } break;
+    case 3U: lut = LCULOGIC_I3; for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)IN(3U, v); } break;
+    case 4U: lut = LCULOGIC_TRUE; (void)memset(Reference, 1, COMBINATIONS); break;
+    case 5U: lut = LCULOGIC_FALSE; (void)memset(Reference, 0, COMBINATIONS); break;
+    case 6U:
+        la = RandomExpression(Random() % Depth, a);
+        lut = LCULOGIC_NOT(la);
+        for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)!a[v]; }
+        break;
+    case 7U:
+        la = RandomExpression(Random() % Depth, a);
+        lb = RandomExpression(Random() % Depth, b);
+        lut = LCULOGIC_AND(la, lb);
+        for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)(a[v] && b[v]); }
+        break;
+    case 8U:
+        la = RandomExpression(Random() % Depth, a);
+        lb = RandomExpression(Random() % Depth, b);
+        lut = LCULOGIC_OR(la, lb);
+        for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)(a[v] || b[v]); }
+        break;
+    case 9U:
+        la = RandomExpression(Random() % Depth, a);
+        lb = RandomExpression(Random() % Depth, b);
+        lut = LCULOGIC_XOR(la, lb);
+        for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (uint8)(a[v] != b[v]); }
+        break;
+    default:
+        ls = RandomExpression(Random() % Depth, s);
+        la = RandomExpression(Random() % Depth, a);
+        lb = RandomExpression(Random() % Depth, b);
+        lut = LCULOGIC_MUX(ls, la, lb);
+        for (v = 0U; v < COMBINATIONS; v++) { Reference[v] = (s[v] != 0U) ? a[v] : b[v]; }
+        break;
+    }
+
+    return lut;
+}
+
+/* The LUT of an expression against a reference function of the combined inputs */
+static void CheckTruthTable(uint16 Lut, uint8 (*Reference)(uint32 Inputs))
+{
+    uint32 v;
+
+    for (v = 0U; v < COMBINATIONS; v++) {
+        CHECK(LcuLogic_Evaluate(Lut, (uint8)v) == (boolean)Reference(v));
+    }
+}
+
+static uint8 RefI0(uint32 v) { return (uint8)IN(0U, v); }
+static uint8 RefI1(uint32 v) { return (uint8)IN(1U, v); }
+static uint8 RefI2(uint32 v) { return (uint8)IN(2U, v); }
+static uint8 RefI3(uint32 v) { return (uint8)IN(3U, v); }
+static uint8 RefTrue(uint32 v) { (void)v; return 1U; }
+static uint8 RefFalse(uint32 v) { (void)v; return 0U; }
+static uint8 RefNot(uint32 v) { return (uint8)!IN(2U, v); }
+static uint8 RefAnd(uint32 v) { return (uint8)(IN(0U, v) && IN(3U, v)); }
+static uint8 RefOr(uint32 v) { return (uint8)(IN(1U, v) || IN(2U, v)); }
+static uint8 RefXor(uint32 v) { return (uint8)(IN(0U, v) != IN(1U, v)); }
+static uint8 RefMux(uint32 v) { return (uint8)(IN(3U, v) ? IN(1U, v) : IN(2U, v)); }
+/* Complementary PWM on I0, blanking on I1 and fault on I2 */
+static uint8 RefHigh(uint32 v) { return (uint8)(IN(0U, v) && !(IN(1U, v) || IN(2U, v))); }
+static uint8 RefLow(uint32 v) { return (uint8)(!IN(0U, v) && !(IN(1U, v) || IN(2U, v))); }
+
+static void Operators(void)
+{
+    CheckTruthTable(LCULOGIC_I0, RefI0);
+    CheckTruthTable(LCULOGIC_I1, RefI1);
+    CheckTruthTable(LCULOGIC_I2, RefI2);
+    CheckTruthTable(LCULOGIC_I3, RefI3);
+    CheckTruthTable(LCULOGIC_TRUE, RefTrue);
+    CheckTruthTable(LCULOGIC_FALSE, RefFalse);
+    CheckTruthTable(LCULOGIC_NOT(LCULOGIC_I2), RefNot);
+    CheckTruthTable(LCULOGIC_AND(LCULOGIC_I0, LCULOGIC_I3), RefAnd);
+    CheckTruthTable(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2), RefOr);
+    CheckTruthTable(LCULOGIC_XOR(LCULOGIC_I0, LCULOGIC_I1), RefXor);
+    CheckTruthTable(LCULOGIC_MUX(LCULOGIC_I3, LCULOGIC_I1, LCULOGIC_I2), RefMux);
+    CheckTruthTable(LCULOGIC_AND(LCULOGIC_I0, LCULOGIC_NOT(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2))), RefHigh);
+    CheckTruthTable(LCULOGIC_AND(LCULOGIC_NOT(LCULOGIC_I0), LCULOGIC_NOT(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2))), RefLow);
+}
+
+static void RandomExpressions(void)
+{
+    uint8 reference[COMBINATIONS];
+    uint32 mismatches = 0U;
+    uint32 n;
+    uint32 v;
+    uint16 lut;
+
+    for (n = 0U; n < RANDOM_EXPRESSIONS; n++) {
+        lut = RandomExpression(1U + (Random() % MAX_DEPTH), reference);
+        for (v = 0U; v < COMBINATIONS; v++) {
+            if (LcuLogic_Evaluate(lut, (uint8)v) != (boolean)reference[v]) {
+                mismatches++;
+            }
+        }
+    }
+    CHECK(mismatches == 0U);
+}
+
+static const LcuLogic_CellType gate_cell = {
+    .LogicInstance = 0U,
+    .HwLogicCell = 2U,
+    .InputMux = { 5U, 17U, 33U, 0U },
+    .Outputs = {
+        { LCULOGIC_AND(LCULOGIC_I0, LCULOGIC_NOT(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2))), 4U, 6U, FALSE, TRUE },
+        { LCULOGIC_AND(LCULOGIC_NOT(LCULOGIC_I0), LCULOGIC_NOT(LCULOGIC_OR(LCULOGIC_I1, LCULOGIC_I2))), 4U, 6U, FALSE, TRUE },
+        /* Active-low fault indication */
+        { LCULOGIC_I2, 0U, 0U, TRUE, TRUE },
+        /* Computed but not driven */
+        { LCULOGIC_TRUE, 0U, 0U, FALSE, FALSE },
+    },
+};
+
+/* The compiled image drives every output of the cell from its LUT, polarity and enable */
+static void Cell(void)
+{
+    Lcu_Ip_LogicCellImageType image;
+    uint8 outputs;
+    uint8 expected;
+    uint32 v;
+    uint32 i;
+
+    LcuLogic_Compile(&gate_cell, &image);
+    for (i = 0U; i < LCULOGIC_CELL_IO; i++) {
+        CHECK(image.MuxSel[i] == gate_cell.InputMux[i]);
+        CHECK(image.LutCtrl[i] == gate_cell.Outputs[i].Lut);
+        CHECK(image.RiseFilt[i] == gate_cell.Outputs[i].RiseFilter);
+        CHECK(image.FallFilt[i] == gate_cell.Outputs[i].FallFilter);
+    }
+    CHECK(image.OutPol == 0x4U);
+    CHECK(image.OutEn == 0x7U);
+
+    for (v = 0U; v < COMBINATIONS; v++) {
+        outputs = LcuLogic_EvaluateCell(&image, (uint8)v);
+        expected = (uint8)((RefHigh(v) << 0) | (RefLow(v) << 1) | ((IN(2U, v) ^ 1U) << 2));
+        CHECK(outputs == expected);
+        /* The two sides of the bridge are never on together */
+        CHECK((outputs & 0x3U) != 0x3U);
+    }
+}
+
+/* Every cell is committed in order, the first refused cell stops the commit */
+static void Commit(void)
+{
+    LcuLogic_CellType cells[3];
+    Lcu_Ip_LogicCellImageType image;
+    uint32 i;
+
+    for (i = 0U; i < 3U; i++) {
+        cells[i] = gate_cell;
+        cells[i].HwLogicCell = (uint8)i;
+        cells[i].Outputs[3].Lut = (uint16)(0x1111U * (i + 1U));
+    }
+
+    commit_count = 0U;
+    CHECK(LcuLogic_Commit(cells, 3U) == LCU_IP_STATUS_SUCCESS);
+    CHECK(commit_count == 3U);
+    for (i = 0U; i < commit_count; i++) {
+        LcuLogic_Compile(&cells[i], &image);
+        CHECK(commit_cell[i] == (uint8)i);
+        CHECK(commit_instance[i] == 0U);
+        CHECK(memcmp(&commit_image[i], &image, sizeof(image)) == 0);
+    }
+
+    commit_count = 0U;
+    protected_cell = 1U;
+    CHECK(LcuLogic_Commit(cells, 3U) == LCU_IP_STATUS_PROTECTED);
+    CHECK(commit_count == 2U);
+    protected_cell = 0xFFU;
+}
+
+static void Benchmark(void)
+{
+    Lcu_Ip_LogicCellImageType image;
+    volatile uint8 sink = 0U;
+    double start;
+    uint32 n;
+
+    start = host_test_ns();
+    for (n = 0U; n < 1000000U; n++) {
+        LcuLogic_Compile(&gate_cell, &image);
+        sink ^= LcuLogic_EvaluateCell(&image, (uint8)n & 0xFU);
+    }
+    printf("compile and evaluate a cell: %.1f ns\n", (host_test_ns() - start) / 1e6);
+    (void)sink;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/* Recording stand-in for the driver commit */
+Lcu_Ip_ReturnType Lcu_Ip_SetLogicCellImage(const uint8 LogicInstance, const uint8 HwLogicCell, const Lcu_Ip_LogicCellImageType * const pxImage)
+{
+    Lcu_Ip_ReturnType ret = LCU_IP_STATUS_SUCCESS;
+
+    if (commit_count < MAX_CELLS) {
+        commit_instance[commit_count] = LogicInstance;
+        commit_cell[commit_count] = HwLogicCell;
+        commit_image[commit_count] = *pxImage;
+        commit_count++;
+    }
+    if (HwLogicCell == protected_cell) {
+        ret = LCU_IP_STATUS_PROTECTED;
+    }
+
+    return ret;
+}
+
+int main(void)
+{
+    Operators();
+    RandomExpressions();
+    Cell();
+    Commit();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,459 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Scan simulation of the LED matrix engine, built with the Dma_Ip and eMIOS PWM driver sources
+* on the register models of rtd/. Each counter bus period the eMIOS B registers written in the
+* previous period become active, then the bus flag requests the row channel, which writes the
+* row pattern and links to the column channel for the next row's duties. The test rebuilds
+* every displayed frame from the row lit and the active duties: rows have to come in order,
+* each frame has to be one presented image as a whole, and each present has to show within two
+* frames. The frame buffers come from DmaPool and are cleaned on present. The scan runs at 8,
+* 16 and 32 rows; beyond 16 the row patterns are decoder addresses.
+*
+* The register models have no notion of time, so the eDMA service of each bus period is timed
+* from the accesses it made, at assumed eDMA costs (request to channel start, SRAM read,
+* peripheral bridge write) in core cycles. That gives the ghosting window: the row switch has
+* to land after the B registers switch at the period boundary and before the column leading
+* edges at BlankTicks. The refresh rate is checked both from LedMatrix_GetStatistics and from
+* the frame interrupts of the model. The benchmark gives the CPU side of a frame: drawing,
+* present and the frame interrupt, and the load of the interrupt at each refresh rate.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "Dma_Ip.h"
+#include "Dma_Host.h"
+#include "Emios_Host.h"
+#include "DmaPool.h"
+#include "LedMatrix.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define ROW_CH              (0U)
+#define COLUMN_CH           (1U)
+#define ROWS                (8U)
+#define COLUMNS             (12U)
+#define PERIOD              (1000U)
+#define BLANK               (20U)
+#define BUS_HZ              (8000000U)
+#define IMAGES              (16U)
+#define BENCH_FRAMES        (20000U)
+#define MIN_REFRESH_HZ      (200U)
+
+/* Assumed eDMA costs in core cycles at CORE_HZ: request to channel start with arbitration,
+   descriptor fetch, one SRAM read, one write through the peripheral bridge */
+#define CORE_HZ             (160000000U)
+#define DMA_REQUEST_CYCLES  (12U)
+#define DMA_TCD_CYCLES      (16U)
+#define DMA_READ_CYCLES     (4U)
+#define DMA_WRITE_CYCLES    (8U)
+#define CYCLES_PER_TICK     (CORE_HZ / BUS_HZ)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static const uint32 scan_rows[] = { ROWS, 16U, LEDMATRIX_MAX_ROWS };
+
+static Siul2_Dio_Ip_GpioType row_port;
+static uint16 row_patterns[LEDMATRIX_MAX_ROWS];
+static uint32 images[IMAGES + 1U][LEDMATRIX_MAX_ROWS][COLUMNS];  /* Image 0 is the blank frame after init */
+
+static uint32 rows;
+static uint32 observed[LEDMATRIX_MAX_ROWS][COLUMNS];
+static uint32 next_row;
+static uint32 bad_rows;
+static uint32 clean_bytes;
+
+static uint32 period_count;
+static uint32 first_irq_period;    /* Second frame interrupt, the first frame after start is short */
+static uint32 last_irq_period;
+static uint32 frame_irqs;
+static uint32 row_switch_cycles;    /* Latest row switch after the B switch, over all periods */
+static uint32 column_done_cycles;   /* Latest end of the next row's B writes */
+static double irq_ns;               /* Frame interrupt, from the benchmark */
+
+static Dma_Ip_HwChannelStateType ch_state[DMA_IP_NOF_CFG_LOGIC_CHANNELS];
+static Dma_Ip_HwChannelStateType *ch_state_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_state[0], &ch_state[1], &ch_state[2], &ch_state[3]
+};
+static const Dma_Ip_GlobalConfigType global_cfg = {
+    { FALSE, FALSE }, { FALSE }, { FALSE }, { 0U }, { 0U, 0U, FALSE, FALSE }
+};
+static const Dma_Ip_TransferConfigType transfer_cfg;
+
+#define CH_CFG(Ch) \
+    { { (Ch), DMA_IP_HARDWARE_VERSION_3, 0U, (Ch), NULL_PTR, NULL_PTR }, &global_cfg, &transfer_cfg, NULL_PTR }
+
+static const Dma_Ip_LogicChannelConfigType ch_cfg[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    CH_CFG(0U), CH_CFG(1U), CH_CFG(2U), CH_CFG(3U)
+};
+static const Dma_Ip_LogicChannelConfigType * const ch_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_cfg[0], &ch_cfg[1], &ch_cfg[2], &ch_cfg[3]
+};
+static const Dma_Ip_LogicInstanceConfigType inst_cfg = {
+    { 0U, DMA_IP_HARDWARE_VERSION_3, 0U }, FALSE, FALSE, TRUE, TRUE, FALSE
+};
+static const Dma_Ip_LogicInstanceConfigType * const inst_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_INSTANCES] = {
+    &inst_cfg
+};
+static const Dma_Ip_InitType dma_init = {
+    ch_state_ptr, &ch_cfg[0], ch_cfg_ptr, &inst_cfg, inst_cfg_ptr
+};
+
+static LedMatrix_ConfigType matrix = {
+    0U, 0U, COLUMNS, ROWS, PERIOD, BLANK, &row_port, row_patterns, 0U, ROW_CH, COLUMN_CH
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)EnInvalidate;
+    (void)Addr;
+    clean_bytes += Length;
+}
+
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    (void)Channel;
+    (void)Command;
+}
+
+/**
+* @brief        Row selected by a PGPDO value, rows if none or several
+*/
+static uint32 LitRow(uint16 Pattern)
+{
+    uint32 row = rows;
+    uint32 r;
+
+    for (r = 0U; r < rows; r++) {
+        if (Pattern == row_patterns[r]) {
+            row = r;
+        }
+    }
+
+    return row;
+}
+
+/**
+* @brief        One counter bus period
+* @details      The buffered B values become active, the bus flag requests the row channel,
+*               the column channel's major loop interrupt calls the frame boundary. The row lit
+*               and the active duties are recorded, and the eDMA service is timed from the
+*               descriptor fetches and minor loops it made: the row write is the first access
+*               of the row channel, the B writes of the linked column channel follow it.
+*               Returns TRUE when the last row was shown.
+*/
+static boolean BusPeriod(void)
+{
+    Dma_Ip_ChRegType *column = &Dma_Host_Tcd.TCD_RSV[COLUMN_CH].tChTcdReg.tChReg;
+    uint32 active[COLUMNS];
+    uint32 tcd_loads = Dma_Host_DescriptorLoads[ROW_CH];
+    uint32 column_loops = Dma_Host_MinorLoops[COLUMN_CH];
+    uint32 row_cycles;
+    uint32 done_cycles;
+    uint32 row;
+    uint32 c;
+
+    for (c = 0U; c < COLUMNS; c++) {
+        active[c] = Emios_Host_Regs[0].CH.UC[c].B;
+    }
+    (void)Dma_Host_Request(ROW_CH);
+    row_cycles = DMA_REQUEST_CYCLES + ((Dma_Host_DescriptorLoads[ROW_CH] - tcd_loads) * DMA_TCD_CYCLES) +
+                 DMA_READ_CYCLES + DMA_WRITE_CYCLES;
+    done_cycles = row_cycles + ((Dma_Host_MinorLoops[COLUMN_CH] - column_loops) *
+                                (DMA_REQUEST_CYCLES + (COLUMNS * (DMA_READ_CYCLES + DMA_WRITE_CYCLES))));
+    row_switch_cycles = (row_cycles > row_switch_cycles) ? row_cycles : row_switch_cycles;
+    column_done_cycles = (done_cycles > column_done_cycles) ? done_cycles : column_done_cycles;
+    if ((column->reg_CH_INT & DMA_IP_TCD_CH_INT_INT_MASK) != 0U) {
+        column->reg_CH_INT = 0U;
+        LedMatrix_FrameIrq();
+        first_irq_period = (frame_irqs == 1U) ? period_count : first_irq_period;
+        last_irq_period = period_count;
+        frame_irqs++;
+    }
+    period_count++;
+
+    row = LitRow(row_port.PGPDO);
+    if (row != next_row) {
+        bad_rows++;
+    }
+    next_row = (row + 1U) % rows;
+    if (row < rows) {
+        for (c = 0U; c < COLUMNS; c++) {
+            observed[row][c] = active[c] - BLANK;
+        }
+    }
+
+    return (row == (rows - 1U)) ? TRUE : FALSE;
+}
+
+/**
+* @brief        Run to the end of the next whole frame and return the image it showed
+* @return       Index into images, IMAGES + 1 if the frame matched none of them
+*/
+static uint32 NextFrame(void)
+{
+    uint32 image = IMAGES + 1U;
+    uint32 i;
+
+    while (BusPeriod() == FALSE) {
+    }
+    for (i = 0U; i <= IMAGES; i++) {
+        if (memcmp(observed, images[i], rows * sizeof(observed[0])) == 0) {
+            image = i;
+        }
+    }
+
+    return image;
+}
+
+/**
+* @brief        Draw an image into the back buffer and present it
+*/
+static void Draw(uint32 Image)
+{
+    uint32 r;
+    uint32 c;
+
+    for (r = 0U; r < rows; r++) {
+        for (c = 0U; c < COLUMNS; c++) {
+            LedMatrix_SetPixel((uint8)r, (uint8)c, images[Image][r][c]);
+        }
+    }
+    LedMatrix_Present();
+}
+
+/**
+* @brief        Presents at random points of the scan, every frame checked whole
+* @details      Also times the row switch against the blanking window and the refresh rate
+*               against the frame interrupts of the model
+*/
+static void ScanTest(uint32 Rows)
+{
+    LedMatrix_StatsType stats;
+    uint32 image;
+    uint32 shown;
+    uint32 frames;
+    uint32 mixed = 0U;
+    uint32 late = 0U;
+    uint32 backwards = 0U;
+    uint32 model_milli_hz;
+    uint32 r;
+    uint32 c;
+    uint32 i;
+
+    rows = Rows;
+    matrix.Rows = (uint8)Rows;
+    for (i = 1U; i <= IMAGES; i++) {
+        for (r = 0U; r < rows; r++) {
+            for (c = 0U; c < COLUMNS; c++) {
+                images[i][r][c] = ((i * 131U) + (r * 17U) + (c * 7U)) % (PERIOD - BLANK + 1U);
+            }
+        }
+    }
+    for (r = 0U; r < rows; r++) {
+        /* One pin per row up to 16, then the address of a row decoder with its enable */
+        row_patterns[r] = (rows <= 16U) ? (uint16)(1U << r) : (uint16)(0x8000U | r);
+    }
+
+    (void)memset(observed, 0, sizeof(observed));
+    bad_rows = 0U;
+    period_count = 0U;
+    frame_irqs = 0U;
+    row_switch_cycles = 0U;
+    column_done_cycles = 0U;
+    clean_bytes = 0U;
+    CHECK(LedMatrix_Init(&matrix) == (Std_ReturnType)E_OK);
+    CHECK(Emios_Host_Regs[0].OUDIS == 0U);
+    CHECK(row_port.PGPDO == 0U);
+    LedMatrix_Start();
+
+    /* The first period lights the last row with the blank duties of the leading edges */
+    next_row = rows - 1U;
+    CHECK(NextFrame() == 0U);
+    CHECK(NextFrame() == 0U);
+
+    shown = 0U;
+    for (i = 1U; i <= IMAGES; i++) {
+        /* Some periods into the frame, so the present lands mid-scan */
+        for (r = 0U; r < (i % rows); r++) {
+            (void)BusPeriod();
+        }
+        Draw(i);
+        CHECK(clean_bytes >= (rows * COLUMNS * 4U));
+        clean_bytes = 0U;
+
+        for (frames = 0U; frames < 3U; frames++) {
+            image = NextFrame();
+            mixed += (image > IMAGES) ? 1U : 0U;
+            backwards += ((image <= IMAGES) && (image < shown)) ? 1U : 0U;
+            shown = (image <= IMAGES) ? image : shown;
+            if (image == i) {
+                break;
+            }
+        }
+        late += (image != i) ? 1U : 0U;
+        CHECK(LedMatrix_IsPresentPending() == FALSE);
+    }
+    printf("scan: %u rows x %u columns, %u presents, %u mixed frames, %u late, %u row errors\n",
+           rows, COLUMNS, IMAGES, mixed, late, bad_rows);
+    CHECK(mixed == 0U);
+    CHECK(late == 0U);
+    CHECK(backwards == 0U);
+    CHECK(bad_rows == 0U);
+
+    /* Ghosting: the row switches after the B registers, at the period boundary, and has to
+       settle before the column leading edges at BLANK; the next row's B writes have to end
+       within the period */
+    printf("      row switch %.2f ticks after the B switch, %u ticks blanking (%.1f %% used), "
+           "B writes done at %.2f of %u ticks\n",
+           (double)row_switch_cycles / CYCLES_PER_TICK, BLANK,
+           (100.0 * row_switch_cycles) / (BLANK * CYCLES_PER_TICK),
+           (double)column_done_cycles / CYCLES_PER_TICK, PERIOD);
+    CHECK(row_switch_cycles < (BLANK * CYCLES_PER_TICK));
+    CHECK(column_done_cycles < (PERIOD * CYCLES_PER_TICK));
+
+    /* Refresh: reported, and counted from the frame interrupts of the model */
+    LedMatrix_GetStatistics(BUS_HZ, &stats);
+    model_milli_hz = (uint32)(((uint64)BUS_HZ * 1000U * (frame_irqs - 2U)) /
+                              ((uint64)PERIOD * (last_irq_period - first_irq_period)));
+    printf("      refresh %u.%03u Hz, %u.%03u Hz from %u frame interrupts, at least %u Hz\n",
+           stats.RefreshMilliHz / 1000U, stats.RefreshMilliHz % 1000U,
+           model_milli_hz / 1000U, model_milli_hz % 1000U, frame_irqs, MIN_REFRESH_HZ);
+    CHECK(stats.Presents == IMAGES);
+    CHECK(stats.Frames == frame_irqs);
+    CHECK(stats.RefreshMilliHz == (uint32)(((uint64)BUS_HZ * 1000U) / (PERIOD * rows)));
+    CHECK(model_milli_hz == stats.RefreshMilliHz);
+    CHECK(stats.RefreshMilliHz >= (MIN_REFRESH_HZ * 1000U));
+
+    /* Stopped: every row off and the bus flag no longer served */
+    LedMatrix_Stop();
+    CHECK(row_port.PGPDO == 0U);
+    CHECK(Dma_Host_Request(ROW_CH) == FALSE);
+}
+
+/**
+* @brief        Limits of the configuration and of the pool
+*/
+static void InitTest(void)
+{
+    LedMatrix_ConfigType cfg = matrix;
+    void *hog[DMAPOOL_SRAM_SIZE / 1024U];
+    uint32 hogs = 0U;
+    uint32 i;
+
+    cfg.Rows = LEDMATRIX_MAX_ROWS + 1U;
+    CHECK(LedMatrix_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    cfg.Rows = ROWS;
+    cfg.Columns = 0U;
+    CHECK(LedMatrix_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    cfg.Columns = COLUMNS;
+    cfg.BlankTicks = PERIOD;
+    CHECK(LedMatrix_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+
+    /* Fill the pool with 1 KiB blocks and free every other one: a full-size matrix no longer
+       fits, a small one still does, and the failed attempt leaves the pool as it was */
+    while ((hogs < (DMAPOOL_SRAM_SIZE / 1024U)) && ((hog[hogs] = DmaPool_Alloc(1024U, DMAPOOL_REGION_SRAM)) != NULL_PTR)) {
+        hogs++;
+    }
+    for (i = 0U; i < hogs; i += 2U) {
+        DmaPool_Free(hog[i]);
+    }
+    cfg = matrix;
+    cfg.Rows = LEDMATRIX_MAX_ROWS;
+    cfg.Columns = LEDMATRIX_MAX_COLUMNS;
+    CHECK(LedMatrix_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    CHECK(LedMatrix_Init(&matrix) == (Std_ReturnType)E_OK);
+    for (i = 1U; i < hogs; i += 2U) {
+        DmaPool_Free(hog[i]);
+    }
+    CHECK(LedMatrix_Init(&cfg) == (Std_ReturnType)E_OK);
+    CHECK(LedMatrix_Init(&matrix) == (Std_ReturnType)E_OK);
+}
+
+/**
+* @brief        CPU side of a frame: draw every pixel, present, and the frame interrupt
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double draw = 0.0;
+    double irq = 0.0;
+    uint32 i;
+
+    rows = ROWS;
+    matrix.Rows = ROWS;
+    CHECK(LedMatrix_Init(&matrix) == (Std_ReturnType)E_OK);
+    for (i = 0U; i < BENCH_FRAMES; i++) {
+        t0 = host_test_ns();
+        Draw((i % IMAGES) + 1U);
+        draw += host_test_ns() - t0;
+        t0 = host_test_ns();
+        LedMatrix_FrameIrq();
+        irq += host_test_ns() - t0;
+    }
+    irq_ns = irq / BENCH_FRAMES;
+    printf("frame: draw and present %.1f ns (%.2f ns per pixel), frame interrupt with swap %.1f ns\n",
+           draw / BENCH_FRAMES, draw / ((double)BENCH_FRAMES * ROWS * COLUMNS), irq_ns);
+    for (i = 0U; i < (sizeof(scan_rows) / sizeof(scan_rows[0])); i++) {
+        printf("       %u rows at %u Hz: the frame interrupt is %.4f %% of a host core\n", scan_rows[i],
+               BUS_HZ / (PERIOD * scan_rows[i]), irq_ns * (BUS_HZ / (PERIOD * scan_rows[i])) * 1e-7);
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    uint32 ch;
+
+    Emios_Host_Reset();
+    Dma_Host_Reset();
+    CHECK(Dma_Ip_Init(&dma_init) == DMA_IP_STATUS_SUCCESS);
+    for (ch = 0U; ch < DMA_IP_NOF_CFG_LOGIC_CHANNELS; ch++) {
+        /* The clear-error write of the init sets ERR in RAM, the target reads it back as 0 */
+        Dma_Host_Tcd.TCD_RSV[ch].tChTcdReg.tChReg.reg_CH_ES = 0U;
+    }
+    DmaPool_Init();
+
+    for (ch = 0U; ch < (sizeof(scan_rows) / sizeof(scan_rows[0])); ch++) {
+        ScanTest(scan_rows[ch]);
+    }
+    matrix.Rows = ROWS;
+    InitTest();
+    Benchmark();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
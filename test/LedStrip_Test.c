@@ -0,0 +1,524 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Simulation of the LED strip engine, built with the Dma_Ip and Flexio_Mcl_Ip driver sources on
+* the register models of rtd/. Each eDMA request moves one word of the descriptor chain into the
+* shifter buffer and the FlexIO model puts its symbols on the line of the strip. The line is
+* decoded back, 110 -> 1 and 100 -> 0, word by word: every word has to hold whole bits, so the
+* symbol stretched by the timer restart between words is always a low one. The reset zeros that
+* follow each frame are counted against the protocol. Frames are shown while the previous one is
+* on the line, also with the frame interrupt landing right before the critical section of
+* LedStrip_Show. The benchmark gives the encoder cost per pixel.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "Clock_Ip.h"
+#include "Dma_Ip.h"
+#include "Dma_Host.h"
+#include "Flexio_Host.h"
+#include "OsIf.h"
+#include "DmaPool.h"
+#include "DmaChain.h"
+#include "Timestamp.h"
+#include "LedStrip.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CORE_HZ             (1000000000U)
+#define FLEXIO_HZ           (48000000U)
+#define WS2812_DIV          (18U)           /* 375 ns */
+#define SK6812_DIV          (14U)           /* 291.7 ns */
+#define WORD_SYMBOLS        (30U)
+#define STRIPS              (2U)
+#define MAX_WORDS           (1024U)
+#define FRAMES              (12U)
+#define BENCH_PIXELS        (170U)
+#define BENCH_FRAMES        (20000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint8 pixels[STRIPS][LEDSTRIP_MAX_BYTES];
+static uint8 decoded[STRIPS][LEDSTRIP_MAX_BYTES];
+static uint32 random_state = 0x5A5A1234U;
+
+/* Decoder state of the line of each strip */
+static uint32 data_words[STRIPS];
+static uint32 reset_words[STRIPS];
+static uint32 bad_symbols;
+static uint32 split_bits;
+static uint32 frame_irqs[STRIPS];
+
+static uint32 irq_depth;
+static boolean irq_in_suspend;      /* End the frame of strip 0 inside the next suspend */
+
+static LedStrip_StripConfigType strip_cfg[STRIPS] = {
+    { 0U, 0U, 4U, 3U, 7U, 0U },
+    { 1U, 1U, 5U, 4U, 8U, 1U },
+};
+
+static LedStrip_ConfigType led_cfg = {
+    0U, LEDSTRIP_WS2812, FLEXIO_HZ, WS2812_DIV, STRIPS, strip_cfg
+};
+
+static Dma_Ip_HwChannelStateType ch_state[DMA_IP_NOF_CFG_LOGIC_CHANNELS];
+static Dma_Ip_HwChannelStateType *ch_state_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_state[0], &ch_state[1], &ch_state[2], &ch_state[3]
+};
+static const Dma_Ip_GlobalConfigType global_cfg = {
+    { FALSE, FALSE }, { FALSE }, { FALSE }, { 0U }, { 0U, 0U, FALSE, FALSE }
+};
+static const Dma_Ip_TransferConfigType transfer_cfg;
+
+#define CH_CFG(Ch) \
+    { { (Ch), DMA_IP_HARDWARE_VERSION_3, 0U, (Ch), NULL_PTR, NULL_PTR }, &global_cfg, &transfer_cfg, NULL_PTR }
+
+static const Dma_Ip_LogicChannelConfigType ch_cfg[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    CH_CFG(0U), CH_CFG(1U), CH_CFG(2U), CH_CFG(3U)
+};
+static const Dma_Ip_LogicChannelConfigType * const ch_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_cfg[0], &ch_cfg[1], &ch_cfg[2], &ch_cfg[3]
+};
+static const Dma_Ip_LogicInstanceConfigType inst_cfg = {
+    { 0U, DMA_IP_HARDWARE_VERSION_3, 0U }, FALSE, FALSE, TRUE, TRUE, FALSE
+};
+static const Dma_Ip_LogicInstanceConfigType * const inst_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_INSTANCES] = {
+    &inst_cfg
+};
+static const Dma_Ip_InitType dma_init = {
+    ch_state_ptr, &ch_cfg[0], ch_cfg_ptr, &inst_cfg, inst_cfg_ptr
+};
+
+/*==================================================================================================
+*                                   Local function prototypes
+==================================================================================================*/
+static uint32 Send(uint8 Strip, uint32 Words);
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName)
+{
+    (void)ClockName;
+
+    return CORE_HZ;
+}
+
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)EnInvalidate;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    (void)Channel;
+    (void)Command;
+}
+
+/**
+* @brief        OsIf stand-ins: the nesting depth, and the frame end of strip 0 on request
+*/
+void OsIf_SuspendAllInterrupts(void)
+{
+    if (irq_in_suspend == TRUE) {
+        irq_in_suspend = FALSE;
+        (void)Send(0U, MAX_WORDS);
+    }
+    irq_depth++;
+}
+
+void OsIf_ResumeAllInterrupts(void)
+{
+    irq_depth--;
+}
+
+/**
+* @brief        xorshift32
+*/
+static uint32 Random(void)
+{
+    random_state ^= random_state << 13U;
+    random_state ^= random_state >> 17U;
+    random_state ^= random_state << 5U;
+
+    return random_state;
+}
+
+/**
+* @brief        Decode one word of the line
+* @details      Ten triples of symbols: 110 and 100 are data bits, 000 the idle line. A word
+*               of only zeros is a reset word, any other word is data and has to start with a
+*               bit, the high symbol, and end with the low symbol of a bit or the idle line.
+*/
+static void DecodeWord(uint8 Strip, const uint8 Symbols[], uint32 *Bit)
+{
+    uint32 ones = 0U;
+    uint32 t;
+    uint32 triple;
+
+    for (t = 0U; t < WORD_SYMBOLS; t++) {
+        ones += Symbols[t];
+    }
+
+    if (ones == 0U) {
+        reset_words[Strip]++;
+    } else {
+        /* Data after a reset starts a new frame */
+        if (reset_words[Strip] != 0U) {
+            reset_words[Strip] = 0U;
+            data_words[Strip] = 0U;
+            *Bit = 0U;
+        }
+        data_words[Strip]++;
+        split_bits += ((Symbols[0] != 1U) || (Symbols[WORD_SYMBOLS - 1U] != 0U)) ? 1U : 0U;
+        for (t = 0U; t < WORD_SYMBOLS; t += 3U) {
+            triple = ((uint32)Symbols[t] << 2U) | ((uint32)Symbols[t + 1U] << 1U) | Symbols[t + 2U];
+            if ((triple == 6U) || (triple == 4U)) {
+                if ((*Bit / 8U) < LEDSTRIP_MAX_BYTES) {
+                    decoded[Strip][*Bit / 8U] = (uint8)((decoded[Strip][*Bit / 8U] << 1U) |
+                                                        ((triple == 6U) ? 1U : 0U));
+                }
+                (*Bit)++;
+            } else if (triple != 0U) {
+                bad_symbols++;
+            } else {
+                /* Idle after the last bit */
+            }
+        }
+    }
+}
+
+/**
+* @brief        Serve up to Words requests of a strip's shifter and decode what reaches the line
+* @return       Words moved
+*/
+static uint32 Send(uint8 Strip, uint32 Words)
+{
+    static uint32 bit[STRIPS];
+    Dma_Ip_ChRegType *ch = &Dma_Host_Tcd.TCD_RSV[strip_cfg[Strip].DmaCh].tChTcdReg.tChReg;
+    uint8 symbols[32];
+    uint32 words = 0U;
+    boolean end = FALSE;
+
+    /* The interrupt clear of the start reads back as a raised flag in the model */
+    ch->reg_CH_INT = 0U;
+    while ((words < Words) && (end == FALSE) && (Dma_Host_Request(strip_cfg[Strip].DmaCh) == TRUE)) {
+        CHECK(Flexio_Host_ShiftWord(strip_cfg[Strip].Shifter, symbols) == WORD_SYMBOLS);
+        DecodeWord(Strip, symbols, &bit[Strip]);
+        words++;
+        if ((ch->reg_CH_INT & DMA_IP_TCD_CH_INT_INT_MASK) != 0U) {
+            ch->reg_CH_INT = 0U;
+            frame_irqs[Strip]++;
+            end = TRUE;
+            LedStrip_FrameIrq(Strip);
+        }
+    }
+
+    return words;
+}
+
+/**
+* @brief        Random bytes for every pixel of a strip
+*/
+static void Draw(uint8 Strip)
+{
+    uint32 i;
+
+    for (i = 0U; i < ((uint32)strip_cfg[Strip].Pixels * strip_cfg[Strip].BytesPerPixel); i++) {
+        pixels[Strip][i] = (uint8)Random();
+    }
+}
+
+/**
+* @brief        Reset words the protocol needs at the configured symbol time
+*/
+static uint32 ResetWords(uint32 ResetUs, uint32 Div)
+{
+    uint32 word_ns = (uint32)(((uint64)Div * 1000000000U) / FLEXIO_HZ) * WORD_SYMBOLS;
+
+    return ((ResetUs * 1000U) + word_ns - 1U) / word_ns;
+}
+
+/**
+* @brief        Restart the driver on a new configuration
+*/
+static Std_ReturnType Init(void)
+{
+    Flexio_Host_Reset();
+    (void)DmaChain_Init();
+
+    return LedStrip_Init(&led_cfg);
+}
+
+/**
+* @brief        Register setup and the limits of the configuration
+*/
+static void ConfigTest(void)
+{
+    LedStrip_StatsType stats;
+    void *hog[DMAPOOL_SRAM_SIZE / 32U];
+    uint32 hogs = 0U;
+    uint32 i;
+    uint8 s;
+
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    CHECK((Flexio_Host_Regs.CTRL & FLEXIO_CTRL_FLEXEN_MASK) != 0U);
+    for (s = 0U; s < STRIPS; s++) {
+        CHECK(Flexio_Host_Regs.TIMCMP[strip_cfg[s].Timer] == ((((WORD_SYMBOLS * 2U) - 1U) << 8U) | ((WS2812_DIV / 2U) - 1U)));
+        CHECK((Flexio_Host_Regs.TIMCTL[strip_cfg[s].Timer] & FLEXIO_TIMCTL_PINCFG_MASK) == 0U);
+        CHECK(Flexio_Host_Regs.SHIFTCTL[strip_cfg[s].Shifter] ==
+              (FLEXIO_SHIFTCTL_TIMSEL(strip_cfg[s].Timer) | FLEXIO_SHIFTCTL_PINCFG(3U) |
+               FLEXIO_SHIFTCTL_PINSEL(strip_cfg[s].Pin) | FLEXIO_SHIFTCTL_SMOD(2U)));
+        CHECK(LedStrip_IsBusy(s) == FALSE);
+    }
+    CHECK(Flexio_Host_Regs.SHIFTSDEN == 3U);
+    LedStrip_GetStatistics(&stats);
+    CHECK(stats.SymbolNs == 375U);
+
+    /* Symbol time outside the window, divider the baud counter cannot make */
+    led_cfg.SymbolClockDiv = 24U;
+    CHECK(Init() == (Std_ReturnType)E_NOT_OK);
+    led_cfg.SymbolClockDiv = 17U;
+    CHECK(Init() == (Std_ReturnType)E_NOT_OK);
+    led_cfg.Protocol = LEDSTRIP_SK6812;
+    led_cfg.SymbolClockDiv = WS2812_DIV;
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    led_cfg.SymbolClockDiv = SK6812_DIV;
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    LedStrip_GetStatistics(&stats);
+    CHECK(stats.SymbolNs == 291U);
+    led_cfg.Protocol = LEDSTRIP_WS2812;
+    led_cfg.SymbolClockDiv = WS2812_DIV;
+
+    /* Strip lengths */
+    strip_cfg[1].Pixels = (uint16)((LEDSTRIP_MAX_BYTES / 4U) + 1U);
+    CHECK(Init() == (Std_ReturnType)E_NOT_OK);
+    strip_cfg[1].Pixels = (uint16)(LEDSTRIP_MAX_BYTES / 4U);
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    strip_cfg[1].Pixels = 0U;
+    CHECK(Init() == (Std_ReturnType)E_NOT_OK);
+    strip_cfg[1].Pixels = 8U;
+
+    /* The pool full but for the buffers of the current strips: longer strips no longer fit */
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    while ((hogs < (DMAPOOL_SRAM_SIZE / 32U)) && ((hog[hogs] = DmaPool_Alloc(32U, DMAPOOL_REGION_SRAM)) != NULL_PTR)) {
+        hogs++;
+    }
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    strip_cfg[0].Pixels = 100U;
+    CHECK(Init() == (Std_ReturnType)E_NOT_OK);
+    strip_cfg[0].Pixels = 7U;
+    for (i = 0U; i < hogs; i++) {
+        DmaPool_Free(hog[i]);
+    }
+    CHECK(Init() == (Std_ReturnType)E_OK);
+}
+
+/**
+* @brief        Every tail length of the encoder, sent and decoded
+* @details      Pixels of 3 and 4 bytes on strips of 1 ... 10 pixels give every remainder of
+*               the five byte groups.
+*/
+static void EncodeTest(void)
+{
+    uint32 bytes;
+    uint32 errors = 0U;
+    uint16 n;
+    uint8 s;
+
+    bad_symbols = 0U;
+    split_bits = 0U;
+    for (n = 1U; n <= 10U; n++) {
+        strip_cfg[0].Pixels = n;
+        strip_cfg[1].Pixels = n;
+        CHECK(Init() == (Std_ReturnType)E_OK);
+        for (s = 0U; s < STRIPS; s++) {
+            bytes = (uint32)n * strip_cfg[s].BytesPerPixel;
+            Draw(s);
+            CHECK(LedStrip_Encode(s, pixels[s]) == (Std_ReturnType)E_OK);
+            LedStrip_Show(s);
+            CHECK(LedStrip_IsBusy(s) == TRUE);
+            (void)Send(s, MAX_WORDS);
+            CHECK(LedStrip_IsBusy(s) == FALSE);
+            CHECK(data_words[s] == (((bytes * 8U) + 9U) / 10U));
+            CHECK(reset_words[s] == ResetWords(280U, WS2812_DIV));
+            errors += (memcmp(decoded[s], pixels[s], bytes) != 0) ? 1U : 0U;
+        }
+    }
+    CHECK(errors == 0U);
+    CHECK(bad_symbols == 0U);
+    CHECK(split_bits == 0U);
+    strip_cfg[0].Pixels = 7U;
+    strip_cfg[1].Pixels = 8U;
+}
+
+/**
+* @brief        Frames shown while the previous one is on the line, on two strips at once
+*/
+static void FrameTest(void)
+{
+    LedStrip_StatsType stats;
+    uint8 sent[STRIPS][LEDSTRIP_MAX_BYTES];
+    uint32 bytes[STRIPS];
+    uint32 errors = 0U;
+    uint32 f;
+    uint8 s;
+
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    bad_symbols = 0U;
+    split_bits = 0U;
+    for (s = 0U; s < STRIPS; s++) {
+        bytes[s] = (uint32)strip_cfg[s].Pixels * strip_cfg[s].BytesPerPixel;
+        frame_irqs[s] = 0U;
+        Draw(s);
+        CHECK(LedStrip_Encode(s, pixels[s]) == (Std_ReturnType)E_OK);
+        (void)memcpy(sent[s], pixels[s], bytes[s]);
+        LedStrip_Show(s);
+    }
+
+    for (f = 0U; f < FRAMES; f++) {
+        for (s = 0U; s < STRIPS; s++) {
+            /* Part of the frame out, then the next one queued behind it */
+            CHECK(Send(s, 3U) == 3U);
+            Draw(s);
+            CHECK(LedStrip_Encode(s, pixels[s]) == (Std_ReturnType)E_OK);
+            LedStrip_Show(s);
+            CHECK(LedStrip_Encode(s, pixels[s]) == (Std_ReturnType)E_NOT_OK);
+            CHECK(LedStrip_IsBusy(s) == TRUE);
+        }
+        for (s = 0U; s < STRIPS; s++) {
+            /* The frame ends, the queued one starts from the interrupt */
+            (void)Send(s, MAX_WORDS);
+            errors += (memcmp(decoded[s], sent[s], bytes[s]) != 0) ? 1U : 0U;
+            CHECK(reset_words[s] == ResetWords(280U, WS2812_DIV));
+            CHECK(LedStrip_IsBusy(s) == TRUE);
+            (void)memcpy(sent[s], pixels[s], bytes[s]);
+        }
+    }
+
+    /* The last frame out, then one started and the next shown while it is on the line,
+       with its end landing between the present and the critical section of the show */
+    s = 0U;
+    (void)Send(s, MAX_WORDS);
+    errors += (memcmp(decoded[s], sent[s], bytes[s]) != 0) ? 1U : 0U;
+    CHECK(LedStrip_IsBusy(s) == FALSE);
+    Draw(s);
+    (void)memcpy(sent[s], pixels[s], bytes[s]);
+    CHECK(LedStrip_Encode(s, pixels[s]) == (Std_ReturnType)E_OK);
+    LedStrip_Show(s);
+    CHECK(Send(s, 3U) == 3U);
+    Draw(s);
+    CHECK(LedStrip_Encode(s, pixels[s]) == (Std_ReturnType)E_OK);
+    irq_in_suspend = TRUE;
+    LedStrip_Show(s);
+    CHECK(irq_in_suspend == FALSE);
+    CHECK(LedStrip_IsBusy(s) == TRUE);
+    errors += (memcmp(decoded[s], sent[s], bytes[s]) != 0) ? 1U : 0U;
+    (void)memcpy(sent[s], pixels[s], bytes[s]);
+    (void)Send(s, MAX_WORDS);
+    errors += (memcmp(decoded[s], sent[s], bytes[s]) != 0) ? 1U : 0U;
+    CHECK(LedStrip_IsBusy(s) == FALSE);
+    CHECK(irq_depth == 0U);
+
+    LedStrip_GetStatistics(&stats);
+    printf("frames: %u + %u, the last of %u + %u words with the reset, %u errors, %u split bits\n",
+           frame_irqs[0], frame_irqs[1], data_words[0] + reset_words[0], data_words[1] + reset_words[1],
+           errors, split_bits);
+    CHECK(errors == 0U);
+    CHECK(bad_symbols == 0U);
+    CHECK(split_bits == 0U);
+    CHECK(frame_irqs[0] == (FRAMES + 3U));
+    CHECK(frame_irqs[1] == FRAMES);
+    CHECK(stats.Frames == (frame_irqs[0] + frame_irqs[1]));
+
+    /* Nothing left queued */
+    (void)Send(1U, MAX_WORDS);
+    CHECK(LedStrip_IsBusy(1U) == FALSE);
+    CHECK(Send(0U, MAX_WORDS) == 0U);
+}
+
+/**
+* @brief        Encoder cost per pixel of a full GRB strip, and of the show with its start
+*/
+static void Benchmark(void)
+{
+    LedStrip_StatsType stats;
+    double t0;
+    double encode = 0.0;
+    double show = 0.0;
+    uint32 i;
+
+    strip_cfg[0].Pixels = BENCH_PIXELS;
+    CHECK(Init() == (Std_ReturnType)E_OK);
+    Draw(0U);
+    for (i = 0U; i < BENCH_FRAMES; i++) {
+        pixels[0][i % (BENCH_PIXELS * 3U)] = (uint8)i;
+        t0 = host_test_ns();
+        (void)LedStrip_Encode(0U, pixels[0]);
+        encode += host_test_ns() - t0;
+        t0 = host_test_ns();
+        LedStrip_Show(0U);
+        show += host_test_ns() - t0;
+        LedStrip_FrameIrq(0U);
+    }
+    LedStrip_GetStatistics(&stats);
+    printf("LedStrip_Encode: %.2f ns per pixel (%u pixels/ms by its own count), show with start: %.1f ns\n",
+           encode / ((double)BENCH_FRAMES * BENCH_PIXELS), stats.EncodePixelsPerMs, show / BENCH_FRAMES);
+    CHECK(stats.Encodes == BENCH_FRAMES);
+    strip_cfg[0].Pixels = 7U;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    uint32 ch;
+
+    Dma_Host_Reset();
+    CHECK(Dma_Ip_Init(&dma_init) == DMA_IP_STATUS_SUCCESS);
+    for (ch = 0U; ch < DMA_IP_NOF_CFG_LOGIC_CHANNELS; ch++) {
+        /* The clear-error write of the init sets ERR in RAM, the target reads it back as 0 */
+        Dma_Host_Tcd.TCD_RSV[ch].tChTcdReg.tChReg.reg_CH_ES = 0U;
+    }
+    DmaPool_Init();
+    Timestamp_Init();
+
+    ConfigTest();
+    EncodeTest();
+    FrameTest();
+    Benchmark();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,529 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Simulation of the PWM audio output, built with the Dma_Ip and Emios_Pwm_Ip driver sources on
+* the register models of rtd/. Every counter bus period requests the eDMA once, which writes the
+* B registers of the outputs; the B register read back after each request is the duty of that
+* period, the mean level the output filter sees. A tone played through the queue is captured
+* that way and its spectrum taken with a Blackman-Harris window: the SNR counts every other bin
+* of the band as noise, images and harmonics included, and is given up to half the sample rate
+* and up to 20 kHz, with the image of the upsampler at fs - f0 on its own. The render cost per
+* input sample comes from the statistics on the host clock, the benchmark gives it without the
+* DMA.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "host_test.h"
+#include "Clock_Ip.h"
+#include "Dma_Ip.h"
+#include "Dma_Host.h"
+#include "Emios_Host.h"
+#include "OsIf.h"
+#include "DmaPool.h"
+#include "Timestamp.h"
+#include "PwmAudio.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CORE_HZ             (1000000000U)
+#define EMIOS_INST          (0U)
+#define OUT_CH              (4U)
+#define DMA_CH              (0U)
+#define PERIOD              (2048U)
+#define UPDATE_HZ           (78125U)        /* 160 MHz / 2048 */
+#define SAMPLE_HZ           (16000U)
+#define TONE_HZ             (1000U)
+#define TONE_AMPLITUDE      (16384)         /* Half scale, -6 dBFS */
+#define TONE_SAMPLES        (1600U)         /* Whole cycles, so buffers join without a step */
+#define AUDIO_BAND_HZ       (20000U)
+#define LOW_CUT_HZ          (20U)
+#define FFT_SIZE            (65536U)
+#define WARMUP_PERIODS      (4096U)
+#define TONE_BINS           (8U)            /* Main lobe of the window and then some */
+#define BENCH_PERIODS       (1000000U)
+
+#ifndef M_PI
+#define M_PI                (3.14159265358979323846)
+#endif
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static sint16 tone[TONE_SAMPLES];
+static uint8 silence[TONE_SAMPLES];
+static double fft_re[FFT_SIZE];
+static double fft_im[FFT_SIZE];
+static uint16 bench_duty[PWMAUDIO_BLOCK];
+
+/* Mismatches of the inverted output, refill interrupts */
+static uint32 bridge_errors;
+static uint32 irqs;
+
+static PwmAudio_ConfigType audio_cfg = {
+    EMIOS_INST, OUT_CH, 1U, PERIOD, 0U, UPDATE_HZ, DMA_CH
+};
+
+static Dma_Ip_HwChannelStateType ch_state[DMA_IP_NOF_CFG_LOGIC_CHANNELS];
+static Dma_Ip_HwChannelStateType *ch_state_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_state[0], &ch_state[1], &ch_state[2], &ch_state[3]
+};
+static const Dma_Ip_GlobalConfigType global_cfg = {
+    { FALSE, FALSE }, { FALSE }, { FALSE }, { 0U }, { 0U, 0U, FALSE, FALSE }
+};
+static const Dma_Ip_TransferConfigType transfer_cfg;
+
+#define CH_CFG(Ch) \
+    { { (Ch), DMA_IP_HARDWARE_VERSION_3, 0U, (Ch), NULL_PTR, NULL_PTR }, &global_cfg, &transfer_cfg, NULL_PTR }
+
+static const Dma_Ip_LogicChannelConfigType ch_cfg[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    CH_CFG(0U), CH_CFG(1U), CH_CFG(2U), CH_CFG(3U)
+};
+static const Dma_Ip_LogicChannelConfigType * const ch_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_cfg[0], &ch_cfg[1], &ch_cfg[2], &ch_cfg[3]
+};
+static const Dma_Ip_LogicInstanceConfigType inst_cfg = {
+    { 0U, DMA_IP_HARDWARE_VERSION_3, 0U }, FALSE, FALSE, TRUE, TRUE, FALSE
+};
+static const Dma_Ip_LogicInstanceConfigType * const inst_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_INSTANCES] = {
+    &inst_cfg
+};
+static const Dma_Ip_InitType dma_init = {
+    ch_state_ptr, &ch_cfg[0], ch_cfg_ptr, &inst_cfg, inst_cfg_ptr
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName)
+{
+    (void)ClockName;
+
+    return CORE_HZ;
+}
+
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)EnInvalidate;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    (void)Channel;
+    (void)Command;
+}
+
+void OsIf_SuspendAllInterrupts(void)
+{
+}
+
+void OsIf_ResumeAllInterrupts(void)
+{
+}
+
+/**
+* @brief        B register of an output channel
+*/
+static uint32 RegB(uint8 Channel)
+{
+    return Emios_Host_Regs[EMIOS_INST].CH.UC[Channel].B;
+}
+
+/**
+* @brief        Restart the output on the configuration, the DMA request enabled
+*/
+static Std_ReturnType Start(uint8 Channels)
+{
+    Std_ReturnType ret;
+
+    audio_cfg.Channels = Channels;
+    ret = PwmAudio_Init(&audio_cfg);
+    if (ret == (Std_ReturnType)E_OK) {
+        Dma_Host_Tcd.TCD_RSV[DMA_CH].tChTcdReg.tChReg.reg_CH_INT = 0U;
+        PwmAudio_Start();
+    }
+    bridge_errors = 0U;
+    irqs = 0U;
+
+    return ret;
+}
+
+/**
+* @brief        Serve the requests of Periods counter bus periods, the duty of each in Duty
+* @details      The half and major interrupts call the refill at once, as the callback of the
+*               channel would. Duty may be NULL.
+*/
+static void Run(uint32 Periods, double Duty[])
+{
+    Dma_Ip_ChRegType *ch = &Dma_Host_Tcd.TCD_RSV[DMA_CH].tChTcdReg.tChReg;
+    uint32 lead = audio_cfg.LeadTicks;
+    uint32 full = (uint32)audio_cfg.Period - lead;
+    uint32 duty;
+    uint32 i;
+
+    for (i = 0U; i < Periods; i++) {
+        (void)Dma_Host_Request(DMA_CH);
+        duty = RegB(OUT_CH) - lead;
+        if (audio_cfg.Channels == 2U) {
+            bridge_errors += (RegB(OUT_CH + 1U) != (lead + full - duty)) ? 1U : 0U;
+        }
+        if (Duty != NULL_PTR) {
+            Duty[i] = (double)duty;
+        }
+        if ((ch->reg_CH_INT & DMA_IP_TCD_CH_INT_INT_MASK) != 0U) {
+            ch->reg_CH_INT = 0U;
+            irqs++;
+            PwmAudio_DmaIrq();
+        }
+    }
+}
+
+/**
+* @brief        Keep the queue full of tone buffers
+*/
+static void Feed(void)
+{
+    while (PwmAudio_Play(tone, TONE_SAMPLES, PWMAUDIO_S16, SAMPLE_HZ) == (Std_ReturnType)E_OK) {
+    }
+}
+
+/**
+* @brief        Periods of the tone, fed as the queue drains, captured into fft_re
+*/
+static void Capture(void)
+{
+    uint32 i;
+
+    Feed();
+    for (i = 0U; i < WARMUP_PERIODS; i += PWMAUDIO_BLOCK) {
+        Run(PWMAUDIO_BLOCK, NULL_PTR);
+        Feed();
+    }
+    for (i = 0U; i < FFT_SIZE; i += PWMAUDIO_BLOCK) {
+        Run(PWMAUDIO_BLOCK, &fft_re[i]);
+        Feed();
+    }
+}
+
+/**
+* @brief        In-place radix-2 FFT of fft_re, fft_im
+*/
+static void Fft(void)
+{
+    uint32 i;
+    uint32 j = 0U;
+    uint32 bit;
+    uint32 len;
+    uint32 k;
+    double t;
+
+    for (i = 1U; i < FFT_SIZE; i++) {
+        bit = FFT_SIZE >> 1U;
+        while ((j & bit) != 0U) {
+            j ^= bit;
+            bit >>= 1U;
+        }
+        j |= bit;
+        if (i < j) {
+            t = fft_re[i]; fft_re[i] = fft_re[j]; fft_re[j] = t;
+            t = fft_im[i]; fft_im[i] = fft_im[j]; fft_im[j] = t;
+        }
+    }
+    for (len = 2U; len <= FFT_SIZE; len <<= 1U) {
+        double ang = -2.0 * M_PI / (double)len;
+        for (i = 0U; i < FFT_SIZE; i += len) {
+            for (k = 0U; k < (len / 2U); k++) {
+                double wr = cos(ang * (double)k);
+                double wi = sin(ang * (double)k);
+                uint32 a = i + k;
+                uint32 b = a + (len / 2U);
+                double xr = (fft_re[b] * wr) - (fft_im[b] * wi);
+                double xi = (fft_re[b] * wi) + (fft_im[b] * wr);
+                fft_re[b] = fft_re[a] - xr;
+                fft_im[b] = fft_im[a] - xi;
+                fft_re[a] += xr;
+                fft_im[a] += xi;
+            }
+        }
+    }
+}
+
+/**
+* @brief        Power of the bins around Hz
+*/
+static double TonePower(double Hz)
+{
+    uint32 centre = (uint32)((Hz * FFT_SIZE / UPDATE_HZ) + 0.5);
+    double power = 0.0;
+    uint32 k;
+
+    for (k = centre - TONE_BINS; k <= (centre + TONE_BINS); k++) {
+        power += (fft_re[k] * fft_re[k]) + (fft_im[k] * fft_im[k]);
+    }
+
+    return power;
+}
+
+/**
+* @brief        Power of the bins from LOW_CUT_HZ up to Hz, the tone excluded
+*/
+static double NoisePower(double Hz)
+{
+    uint32 tone_bin = (uint32)(((double)TONE_HZ * FFT_SIZE / UPDATE_HZ) + 0.5);
+    uint32 first = (uint32)((double)LOW_CUT_HZ * FFT_SIZE / UPDATE_HZ) + 1U;
+    uint32 last = (uint32)(Hz * FFT_SIZE / UPDATE_HZ);
+    double power = 0.0;
+    uint32 k;
+
+    for (k = first; k <= last; k++) {
+        if ((k + TONE_BINS < tone_bin) || (k > tone_bin + TONE_BINS)) {
+            power += (fft_re[k] * fft_re[k]) + (fft_im[k] * fft_im[k]);
+        }
+    }
+
+    return power;
+}
+
+/**
+* @brief        Register setup, the limits of the configuration and the buffer of the pool
+*/
+static void ConfigTest(void)
+{
+    void *hog[DMAPOOL_SRAM_SIZE / 32U];
+    uint32 hogs = 0U;
+    uint32 i;
+
+    /* No room in the pool for the double buffer */
+    while ((hogs < (DMAPOOL_SRAM_SIZE / 32U)) && ((hog[hogs] = DmaPool_Alloc(32U, DMAPOOL_REGION_SRAM)) != NULL_PTR)) {
+        hogs++;
+    }
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_NOT_OK);
+    for (i = 0U; i < hogs; i++) {
+        DmaPool_Free(hog[i]);
+    }
+
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_OK);
+    CHECK((RegB(OUT_CH) == (PERIOD / 2U)) && (Emios_Host_Regs[EMIOS_INST].CH.UC[OUT_CH].A == 0U));
+
+    /* The buffer is kept: a full pool does not fail the next init */
+    hogs = 0U;
+    while ((hogs < (DMAPOOL_SRAM_SIZE / 32U)) && ((hog[hogs] = DmaPool_Alloc(32U, DMAPOOL_REGION_SRAM)) != NULL_PTR)) {
+        hogs++;
+    }
+    audio_cfg.LeadTicks = 48U;
+    audio_cfg.Channels = 2U;
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_OK);
+    CHECK((RegB(OUT_CH) == (48U + ((PERIOD - 48U) / 2U))) && (RegB(OUT_CH + 1U) == RegB(OUT_CH)));
+    CHECK(Emios_Host_Regs[EMIOS_INST].CH.UC[OUT_CH + 1U].A == 48U);
+    for (i = 0U; i < hogs; i++) {
+        DmaPool_Free(hog[i]);
+    }
+    audio_cfg.LeadTicks = 0U;
+    audio_cfg.Channels = 1U;
+
+    audio_cfg.Channels = 3U;
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_NOT_OK);
+    audio_cfg.Channels = 1U;
+    audio_cfg.LeadTicks = PERIOD;
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_NOT_OK);
+    audio_cfg.LeadTicks = 0U;
+    audio_cfg.Period = PWMAUDIO_MAX_PERIOD + 1U;
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_NOT_OK);
+    audio_cfg.Period = PERIOD;
+
+    /* Sample rates the upsampler cannot take, the queue limit */
+    CHECK(PwmAudio_Init(&audio_cfg) == (Std_ReturnType)E_OK);
+    CHECK(PwmAudio_Play(tone, TONE_SAMPLES, PWMAUDIO_S16, UPDATE_HZ) == (Std_ReturnType)E_NOT_OK);
+    CHECK(PwmAudio_Play(tone, 0U, PWMAUDIO_S16, SAMPLE_HZ) == (Std_ReturnType)E_NOT_OK);
+    /* Above half the update rate only the cubic stage */
+    CHECK(PwmAudio_Play(tone, TONE_SAMPLES, PWMAUDIO_S16, 44100U) == (Std_ReturnType)E_OK);
+    for (i = 1U; i < PWMAUDIO_QUEUE; i++) {
+        CHECK(PwmAudio_Play(tone, TONE_SAMPLES, PWMAUDIO_S16, SAMPLE_HZ) == (Std_ReturnType)E_OK);
+    }
+    CHECK(PwmAudio_Play(tone, TONE_SAMPLES, PWMAUDIO_S16, SAMPLE_HZ) == (Std_ReturnType)E_NOT_OK);
+}
+
+/**
+* @brief        Queue, flush and silence through the DMA, both output stages
+*/
+static void PlaybackTest(void)
+{
+    PwmAudio_StatsType stats;
+    DmaPool_StatsType pool;
+    uint32 periods;
+    uint32 off_mid;
+    uint32 i;
+
+    /* 8-bit silence is the mid duty on every period */
+    CHECK(Start(1U) == (Std_ReturnType)E_OK);
+    CHECK(PwmAudio_Play(silence, TONE_SAMPLES, PWMAUDIO_U8, SAMPLE_HZ) == (Std_ReturnType)E_OK);
+    Run(PWMAUDIO_BLOCK * 64U, fft_re);
+    off_mid = 0U;
+    for (i = 0U; i < (PWMAUDIO_BLOCK * 64U); i++) {
+        off_mid += (fft_re[i] != (double)(PERIOD / 2U)) ? 1U : 0U;
+    }
+    CHECK(off_mid == 0U);
+    CHECK(PwmAudio_IsBusy() == FALSE);
+    PwmAudio_GetStatistics(&stats);
+    CHECK((stats.Buffers == 1U) && (stats.Samples == TONE_SAMPLES));
+    CHECK((irqs == 64U) && (stats.Blocks == (irqs + 2U)) && (stats.Periods == (stats.Blocks * PWMAUDIO_BLOCK)));
+    CHECK(Dma_Host_MajorLoops[DMA_CH] == 32U);
+
+    /* Bridged: every period the inverted duty on the second channel, one clean per half */
+    DmaPool_GetStatistics(&pool);
+    periods = pool.CleanOps;
+    CHECK(Start(2U) == (Std_ReturnType)E_OK);
+    Feed();
+    Run(PWMAUDIO_BLOCK * 16U, fft_re);
+    CHECK(bridge_errors == 0U);
+    DmaPool_GetStatistics(&pool);
+    CHECK((pool.CleanOps - periods) == (irqs + 2U));
+    off_mid = 0U;
+    for (i = 0U; i < (PWMAUDIO_BLOCK * 16U); i++) {
+        off_mid += (fft_re[i] != (double)(PERIOD / 2U)) ? 1U : 0U;
+    }
+    CHECK(off_mid > (PWMAUDIO_BLOCK * 8U));
+
+    /* Flushed, back to silence once both halves and the filters have played out */
+    PwmAudio_Flush();
+    Run(PWMAUDIO_BLOCK * 4U, NULL_PTR);
+    CHECK(PwmAudio_IsBusy() == FALSE);
+    Run(PWMAUDIO_BLOCK * 2U, fft_re);
+    off_mid = 0U;
+    for (i = 0U; i < (PWMAUDIO_BLOCK * 2U); i++) {
+        off_mid += (fft_re[i] != (double)(PERIOD / 2U)) ? 1U : 0U;
+    }
+    CHECK(off_mid == 0U);
+    CHECK(bridge_errors == 0U);
+
+    PwmAudio_Stop();
+    CHECK(RegB(OUT_CH) == (PERIOD / 2U));
+    CHECK(Dma_Host_Request(DMA_CH) == FALSE);
+}
+
+/**
+* @brief        SNR and image level of a half scale tone, render cost per sample
+*/
+static void SnrTest(void)
+{
+    PwmAudio_StatsType stats;
+    double signal;
+    double snr_nyq;
+    double snr_band;
+    double image;
+    double w;
+    uint32 i;
+
+    CHECK(Start(1U) == (Std_ReturnType)E_OK);
+    Capture();
+    PwmAudio_GetStatistics(&stats);
+    PwmAudio_Stop();
+
+    /* 4-term Blackman-Harris, the DC of the mid duty removed first */
+    for (i = 0U; i < FFT_SIZE; i++) {
+        w = (2.0 * M_PI * (double)i) / (double)FFT_SIZE;
+        fft_re[i] = (fft_re[i] - (PERIOD / 2.0)) *
+                    (0.35875 - (0.48829 * cos(w)) + (0.14128 * cos(2.0 * w)) - (0.01168 * cos(3.0 * w)));
+        fft_im[i] = 0.0;
+    }
+    Fft();
+
+    signal = TonePower(TONE_HZ);
+    snr_nyq = 10.0 * log10(signal / NoisePower(SAMPLE_HZ / 2.0));
+    snr_band = 10.0 * log10(signal / NoisePower(AUDIO_BAND_HZ));
+    image = 10.0 * log10(TonePower(SAMPLE_HZ - TONE_HZ) / signal);
+
+    printf("%u Hz tone at -6 dBFS, %u Hz material, %u ticks at %u Hz: SNR %.1f dB to %u Hz, "
+           "%.1f dB to %u Hz, image at %u Hz %.1f dBc\n", TONE_HZ, SAMPLE_HZ, PERIOD, UPDATE_HZ,
+           snr_nyq, SAMPLE_HZ / 2U, snr_band, AUDIO_BAND_HZ, SAMPLE_HZ - TONE_HZ, image);
+    printf("render: %u samples, %u periods, %u ns per sample at %u MHz\n", stats.Samples, stats.Periods,
+           stats.CyclesPerSample, CORE_HZ / 1000000U);
+    CHECK(snr_nyq > 80.0);
+    CHECK(snr_band > 63.0);
+    CHECK(image < -90.0);
+    CHECK(stats.CyclesPerSample > 0U);
+}
+
+/**
+* @brief        Render cost without the DMA
+*/
+static void Benchmark(void)
+{
+    PwmAudio_StatsType stats;
+    double t0;
+    double t1;
+    uint32 i;
+
+    (void)PwmAudio_Init(&audio_cfg);
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_PERIODS; i += PWMAUDIO_BLOCK) {
+        Feed();
+        PwmAudio_Render(bench_duty, PWMAUDIO_BLOCK);
+    }
+    t1 = host_test_ns();
+    PwmAudio_GetStatistics(&stats);
+
+    printf("PwmAudio_Render: %.1f ns per period, %.1f ns per %u Hz sample\n", (t1 - t0) / BENCH_PERIODS,
+           (t1 - t0) / stats.Samples, SAMPLE_HZ);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    uint32 ch;
+    uint32 i;
+
+    for (i = 0U; i < TONE_SAMPLES; i++) {
+        tone[i] = (sint16)lround(TONE_AMPLITUDE * sin((2.0 * M_PI * TONE_HZ * (double)i) / SAMPLE_HZ));
+        silence[i] = 0x80U;
+    }
+
+    Dma_Host_Reset();
+    Emios_Host_Reset();
+    CHECK(Dma_Ip_Init(&dma_init) == DMA_IP_STATUS_SUCCESS);
+    for (ch = 0U; ch < DMA_IP_NOF_CFG_LOGIC_CHANNELS; ch++) {
+        /* The clear-error write of the init sets ERR in RAM, the target reads it back as 0 */
+        Dma_Host_Tcd.TCD_RSV[ch].tChTcdReg.tChReg.reg_CH_ES = 0U;
+    }
+    DmaPool_Init();
+    Timestamp_Init();
+
+    ConfigTest();
+    PlaybackTest();
+    SnrTest();
+    Benchmark();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
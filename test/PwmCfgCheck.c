@@ -0,0 +1,170 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+
+/*
+* Host check of a Pwm configuration for the trusted configuration mode: every channel goes
+* through Pwm_Ipw_ValidateChannelConfig, the check Pwm_Init runs with PWM_TRUSTED_CONFIG on,
+* so an inconsistent channel is found before the image is flashed instead of as an init
+* failure on the board. One line per channel, then the count; the exit status is 1 when a
+* channel is refused. The configuration is compiled in:
+*
+*   make -C test pwmcheck PWM_CFG="<Pwm_PBcfg.c> <eMIOS channel configuration>.c" PWM_CONFIG=<symbol>
+*
+* The channel limit is PWM_CONFIG_LOGIC_CHANNELS of rtd/Pwm_Cfg.h, not the project's.
+*/
+
+#include <stdio.h>
+#include "Pwm.h"
+#include "Pwm_Ipw.h"
+#include "Emios_Pwm_Ip.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#ifndef PWMCFGCHECK_CONFIG
+    #define PWMCFGCHECK_CONFIG  PwmCfgCheck_Sample
+#endif
+
+#define STRINGIFY(x)        #x
+#define NAME(x)             STRINGIFY(x)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+extern const Pwm_ConfigType PWMCFGCHECK_CONFIG;
+
+static const char *const classes[] = { "variable", "fixed", "shifted" };
+static const char *const buses[] = { "A", "BCDE", "F", "internal" };
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Short name of an eMIOS mode, the _BOTH variants under the same one
+*/
+static const char *ModeName(Emios_Pwm_Ip_PwmModeType Mode)
+{
+    const char *name;
+
+    switch (Mode) {
+        case EMIOS_PWM_IP_MODE_GPO:
+            name = "GPO";
+            break;
+        case EMIOS_PWM_IP_MODE_DAOC_FLAG:
+        case EMIOS_PWM_IP_MODE_DAOC_FLAG_BOTH:
+            name = "DAOC";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWMT:
+            name = "OPWMT";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWFMB_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWFMB_FLAG_BOTH:
+            name = "OPWFMB";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG_BOTH:
+            name = "OPWMCB trail";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWMCB_LEAD_EDGE_FLAG_BOTH:
+            name = "OPWMCB lead";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWMB_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWMB_FLAG_BOTH:
+            name = "OPWMB";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWM_IMMEDIATE_UPDATE_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWM_NEXT_PERIOD_UPDATE_FLAG_BOTH:
+            name = "OPWM";
+            break;
+        case EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWFM_IMMEDIATE_UPDATE_FLAG_BOTH:
+        case EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG:
+        case EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG_BOTH:
+            name = "OPWFM";
+            break;
+        default:
+            name = "?";
+            break;
+    }
+
+    return name;
+}
+
+/**
+* @brief        Report line of one channel
+*/
+static void PrintChannel(Pwm_ChannelType Channel, const Pwm_ChannelConfigType *ChannelCfg, boolean Ok)
+{
+    const Emios_Pwm_Ip_ChannelConfigType *emios;
+    const char *class_name = (ChannelCfg->PwmChannelClass <= PWM_FIXED_PERIOD_SHIFTED) ?
+                             classes[ChannelCfg->PwmChannelClass] : "?";
+    const char *notif = (NULL_PTR != ChannelCfg->PwmChannelNotification) ? "yes" : "no";
+
+    if ((PWM_CHANNEL_EMIOS == ChannelCfg->IpwChannelCfg.ChannelType) &&
+        (NULL_PTR != ChannelCfg->IpwChannelCfg.EmiosChConfig)) {
+        emios = (const Emios_Pwm_Ip_ChannelConfigType *)ChannelCfg->IpwChannelCfg.EmiosChConfig;
+        printf("%3u  %-8s  eMIOS_%u %2u  %-12s  %-8s  %6u %6u  %-5s  %s\n",
+               (unsigned int)Channel, class_name,
+               (unsigned int)ChannelCfg->IpwChannelCfg.ChannelInstanceId, (unsigned int)emios->ChannelId,
+               ModeName(emios->Mode), (emios->Timebase <= EMIOS_PWM_IP_BUS_INTERNAL) ? buses[emios->Timebase] : "?",
+               (unsigned int)emios->DutyCycle, (unsigned int)emios->DeadTime, notif,
+               (TRUE == Ok) ? "ok" : "refused");
+    } else {
+        printf("%3u  %-8s  %-10s  %-12s  %-8s  %6s %6s  %-5s  %s\n",
+               (unsigned int)Channel, class_name, "other IP", "-", "-", "-", "-", notif,
+               (TRUE == Ok) ? "ok" : "refused");
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    const Pwm_ConfigType *config = &PWMCFGCHECK_CONFIG;
+    const Pwm_ChannelConfigType *channel_cfg;
+    Pwm_ChannelType channel;
+    unsigned int refused = 0U;
+    boolean notification_used;
+    boolean ok;
+
+    printf("%s: %u channels, at most %u\n", NAME(PWMCFGCHECK_CONFIG),
+           (unsigned int)config->NumChannels, (unsigned int)PWM_CONFIG_LOGIC_CHANNELS);
+    if (config->NumChannels > PWM_CONFIG_LOGIC_CHANNELS) {
+        printf("more channels than PWM_CONFIG_LOGIC_CHANNELS: refused\n");
+        return 1;
+    }
+
+    printf("%3s  %-8s  %-10s  %-12s  %-8s  %6s %6s  %-5s  %s\n",
+           "ch", "class", "channel", "mode", "bus", "duty", "dead", "notif", "result");
+    for (channel = 0U; channel < config->NumChannels; channel++) {
+        channel_cfg = &((*config->PwmChannelsConfig)[channel]);
+        notification_used = (NULL_PTR != channel_cfg->PwmChannelNotification) ? TRUE : FALSE;
+        ok = ((Std_ReturnType)E_OK == Pwm_Ipw_ValidateChannelConfig(channel_cfg->PwmChannelClass,
+                                                                    notification_used,
+                                                                    &(channel_cfg->IpwChannelCfg))) ? TRUE : FALSE;
+        refused += (TRUE == ok) ? 0U : 1U;
+        PrintChannel(channel, channel_cfg, ok);
+    }
+    printf("%u of %u channels refused, Pwm_Init would %s the configuration\n", refused,
+           (unsigned int)config->NumChannels, (refused == 0U) ? "take" : "refuse");
+
+    return (refused == 0U) ? 0 : 1;
+}
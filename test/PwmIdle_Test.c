@@ -0,0 +1,207 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host model of the PWM idle manager: replays recorded duty traces frame by frame against a
+* simulated Pwm driver and eMIOS clock gate, and reports the time spent parked and the resume
+* latency. Driver calls advance the simulated OsIf counter by their typical cost on target.
+*/
+
+#include "host_test.h"
+#include "OsIf.h"
+#include "PwmIdle.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define FRAME_TICKS         (15000U)    /* 66 Hz frame, OsIf ticks are microseconds */
+#define COST_SET_DUTY       (3U)        /* Pwm_SetDutyCycle */
+#define COST_SET_IDLE       (2U)        /* Pwm_SetOutputToIdle */
+#define COST_CLOCK_ENABLE   (5U)        /* Clock_Ip_EnableModuleClock */
+#define NUM_CHANNELS        (3U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* One duty change of a recorded trace */
+typedef struct {
+    uint32 Frame;
+    uint8 Index;
+    uint16 Duty;
+} TraceEvent_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static uint16 pwm_duty[8];
+static boolean pwm_idle[8];
+static uint32 pwm_calls;
+static boolean clock_on = TRUE;
+static uint32 clock_gates;
+
+static const Pwm_ChannelType channels[NUM_CHANNELS] = { 0U, 1U, 2U };
+static const Pwm_ChannelType instance_all[NUM_CHANNELS] = { 2U, 0U, 1U };
+static const Pwm_ChannelType instance_shared[NUM_CHANNELS + 1U] = { 0U, 1U, 2U, 5U };
+
+/* Notification LED: everything off, channel 0 flashes for 10 frames every 200 frames */
+static const TraceEvent_t trace_blink[] = {
+    {  200U, 0U, 0x8000U }, {  210U, 0U, 0U },
+    {  400U, 0U, 0x8000U }, {  410U, 0U, 0U },
+    {  600U, 0U, 0x8000U }, {  610U, 0U, 0U },
+    {  800U, 0U, 0x8000U }, {  810U, 0U, 0U },
+};
+
+/* Colour fade, a dimmed hold that can not be parked, then white held at 100% */
+static const TraceEvent_t trace_fade[] = {
+    {  10U, 0U, 0x1000U }, {  20U, 1U, 0x2000U }, {  30U, 2U, 0x3000U },
+    {  40U, 0U, 0x4000U }, {  50U, 1U, 0x5000U }, {  60U, 2U, 0x6000U },
+    { 300U, 0U, 0x8000U }, { 300U, 1U, 0x8000U }, { 300U, 2U, 0x8000U },
+    { 700U, 2U, 0U },
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    CHECK(clock_on == TRUE);
+    pwm_duty[ChannelNumber] = DutyCycle;
+    pwm_idle[ChannelNumber] = FALSE;
+    pwm_calls++;
+    OsIf_Host_Advance(COST_SET_DUTY);
+}
+
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
+{
+    CHECK(clock_on == TRUE);
+    pwm_idle[ChannelNumber] = TRUE;
+    pwm_calls++;
+    OsIf_Host_Advance(COST_SET_IDLE);
+}
+
+void Clock_Ip_DisableModuleClock(Clock_Ip_NameType ClockName)
+{
+    CHECK(ClockName == EMIOS1_CLK);
+    clock_on = FALSE;
+    clock_gates++;
+}
+
+void Clock_Ip_EnableModuleClock(Clock_Ip_NameType ClockName)
+{
+    CHECK(ClockName == EMIOS1_CLK);
+    clock_on = TRUE;
+    OsIf_Host_Advance(COST_CLOCK_ENABLE);
+}
+
+/**
+* @brief        Replay a trace and print the time parked and the resume latency
+*/
+static void Replay(const char *name, const PwmIdle_ConfigType *cfg,
+                   const TraceEvent_t *trace, uint32 events, uint32 frames)
+{
+    PwmIdle_StatsType stats;
+    uint16 expect[NUM_CHANNELS] = { 0U, 0U, 0U };
+    uint32 next = 0U;
+    uint32 frame;
+    uint32 i;
+
+    clock_gates = 0U;
+    PwmIdle_Init(cfg);
+
+    for (frame = 0U; frame < frames; frame++) {
+        while ((next < events) && (trace[next].Frame == frame)) {
+            PwmIdle_SetDutyCycle(trace[next].Index, trace[next].Duty);
+            expect[trace[next].Index] = trace[next].Duty;
+            next++;
+        }
+        PwmIdle_MainFunction();
+
+        /* While running every output modulates its last requested duty */
+        if (PwmIdle_GetState() == PWMIDLE_STATE_RUN) {
+            CHECK(clock_on == TRUE);
+            for (i = 0U; i < cfg->NumChannels; i++) {
+                CHECK((pwm_idle[channels[i]] == FALSE) && (pwm_duty[channels[i]] == expect[i]));
+            }
+        }
+        OsIf_Host_Advance(FRAME_TICKS);
+    }
+
+    PwmIdle_GetStatistics(&stats);
+    printf("%-22s frames %5u parked %5u (%5.1f%%) time parked %6.2f s parks %3u gates %3u "
+           "resume last %u us max %u us misses %u\n",
+           name, stats.TotalFrames, stats.ParkedFrames,
+           100.0 * (double)stats.ParkedFrames / (double)stats.TotalFrames,
+           (double)stats.ParkedTicks / 1e6, stats.ParkCount, clock_gates,
+           stats.LastResumeTicks, stats.MaxResumeTicks, stats.ResumeBudgetMisses);
+
+    CHECK(stats.ResumeBudgetMisses == 0U);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    PwmIdle_ConfigType cfg = {
+        channels, NUM_CHANNELS, 20U, TRUE, EMIOS1_CLK, instance_all, NUM_CHANNELS, 30U
+    };
+    PwmIdle_ConfigType too_many = cfg;
+    PwmIdle_ConfigType shared = cfg;
+    PwmIdle_StatsType stats;
+    uint32 frame;
+
+    /* Not initialized: requests and frame ticks are ignored */
+    PwmIdle_SetDutyCycle(0U, 0x4000U);
+    PwmIdle_MainFunction();
+    CHECK(pwm_calls == 0U);
+
+    too_many.NumChannels = PWMIDLE_MAX_CHANNELS + 1U;
+    PwmIdle_Init(&too_many);
+    PwmIdle_SetDutyCycle(0U, 0x4000U);
+    CHECK(pwm_calls == 0U);
+
+    /* Parks after StaticFrames static frames, gates the clock and resumes on a change */
+    PwmIdle_Init(&cfg);
+    for (frame = 0U; frame < 20U; frame++) {
+        CHECK(PwmIdle_GetState() == PWMIDLE_STATE_RUN);
+        PwmIdle_MainFunction();
+    }
+    CHECK(PwmIdle_GetState() == PWMIDLE_STATE_PARKED);
+    CHECK(clock_on == FALSE);
+    CHECK((pwm_idle[0] == TRUE) && (pwm_idle[1] == TRUE) && (pwm_idle[2] == TRUE));
+    PwmIdle_SetDutyCycle(1U, 0x2000U);
+    CHECK(PwmIdle_GetState() == PWMIDLE_STATE_RUN);
+    CHECK(clock_on == TRUE);
+    CHECK((pwm_duty[1] == 0x2000U) && (pwm_idle[0] == FALSE));
+
+    /* A channel on the same instance outside the manager keeps the clock running */
+    shared.InstanceChannels = instance_shared;
+    shared.NumInstanceChannels = NUM_CHANNELS + 1U;
+    PwmIdle_Init(&shared);
+    for (frame = 0U; frame < 25U; frame++) {
+        PwmIdle_MainFunction();
+    }
+    CHECK(PwmIdle_GetState() == PWMIDLE_STATE_PARKED);
+    CHECK(clock_on == TRUE);
+    PwmIdle_GetStatistics(&stats);
+    CHECK(stats.ParkCount == 1U);
+
+    Replay("blink, clock gated", &cfg, trace_blink, sizeof(trace_blink) / sizeof(trace_blink[0]), 1000U);
+    Replay("blink, shared clock", &shared, trace_blink, sizeof(trace_blink) / sizeof(trace_blink[0]), 1000U);
+    Replay("fade and hold", &cfg, trace_fade, sizeof(trace_fade) / sizeof(trace_fade[0]), 1000U);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,208 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Interrupt-rate model of the decimated Pwm notifications, built from the Pwm and eMIOS driver
+* sources on the register model of rtd/. One simulated second of a 20 kHz PWM is played on
+* channels with different intervals: the eMIOS interrupt still fires on every edge, only the
+* user notification is divided. The measured cost of one interrupt then gives the CPU load the
+* decimation cannot save, against the load of the notifications it does. The remaining cases
+* check that Pwm_DisableNotification forgets the interval and that a decimated channel
+* preempted by its own interrupt while the interval is being set keeps a consistent count.
+*/
+
+#include "host_test.h"
+#include "Pwm.h"
+#include "Pwm_Host.h"
+#include "Det_Host.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define PWM_HZ              (20000U)        /* Edges per second of every channel */
+#define MODEL_CHANNELS      (5U)
+#define BENCH_EDGES         (1000000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static const uint16 intervals[MODEL_CHANNELS] = { 0U, 1U, 4U, 20U, 1000U };
+static volatile uint32 spin;        /* Work of the user notification in the benchmark */
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Pwm_Init on the host configuration with every channel at 50 %
+*/
+static void Init(void)
+{
+    Pwm_Host_Setup(1000U, 500U);
+    Det_Host_Clear();
+    Pwm_Init(&Pwm_Host_Config);
+}
+
+/**
+* @brief        Interrupt of the channel in the middle of the interval update
+*/
+static void EdgeOfChannel3(void)
+{
+    Pwm_Host_Edge(3U);
+}
+
+/**
+* @brief        One simulated second on each interval, interrupts against notifications
+*/
+static void RateModel(void)
+{
+    uint32 edge;
+    uint32 i;
+    uint32 irqs = 0U;
+
+    Init();
+    for (i = 0U; i < MODEL_CHANNELS; i++) {
+        Pwm_EnableNotificationDecimated((Pwm_ChannelType)i, PWM_RISING_EDGE, intervals[i]);
+    }
+    for (edge = 0U; edge < PWM_HZ; edge++) {
+        for (i = 0U; i < MODEL_CHANNELS; i++) {
+            Pwm_Host_Edge((Pwm_ChannelType)i);
+            irqs++;
+        }
+    }
+
+    printf("%u Hz PWM, 1 s: interval / interrupts / notifications per channel\n", PWM_HZ);
+    for (i = 0U; i < MODEL_CHANNELS; i++) {
+        printf("  %5u %8u %8u\n", intervals[i], PWM_HZ, Pwm_Host_Notifications[i]);
+        CHECK(Pwm_Host_Notifications[i] == ((intervals[i] > 1U) ? (PWM_HZ / intervals[i]) : PWM_HZ));
+    }
+    CHECK(irqs == (PWM_HZ * MODEL_CHANNELS));
+    CHECK(Det_Host_Errors == 0U);
+    CHECK(SchM_Host_Depth == 0U);
+    Pwm_DeInit();
+}
+
+/**
+* @brief        Disable forgets the interval, Enable and a new decimation restart the count
+*/
+static void DisableTest(void)
+{
+    uint32 i;
+
+    Init();
+    Pwm_EnableNotificationDecimated(2U, PWM_RISING_EDGE, 10U);
+    for (i = 0U; i < 7U; i++) {
+        Pwm_Host_Edge(2U);
+    }
+    CHECK(Pwm_Host_Notifications[2] == 0U);
+
+    /* Seven edges counted, enabled again after the disable every edge notifies */
+    Pwm_DisableNotification(2U);
+    Pwm_EnableNotification(2U, PWM_RISING_EDGE);
+    for (i = 0U; i < 5U; i++) {
+        Pwm_Host_Edge(2U);
+    }
+    CHECK(Pwm_Host_Notifications[2] == 5U);
+
+    /* A new interval starts from zero, not from the old count */
+    Pwm_EnableNotificationDecimated(2U, PWM_RISING_EDGE, 3U);
+    Pwm_Host_Edge(2U);
+    Pwm_Host_Edge(2U);
+    CHECK(Pwm_Host_Notifications[2] == 5U);
+    Pwm_Host_Edge(2U);
+    CHECK(Pwm_Host_Notifications[2] == 6U);
+
+    /* Disabled, the edges do not reach the user */
+    Pwm_DisableNotification(2U);
+    Pwm_Host_Edge(2U);
+    CHECK(Pwm_Host_Notifications[2] == 6U);
+    CHECK(Det_Host_Errors == 0U);
+    Pwm_DeInit();
+}
+
+/**
+* @brief        The channel's own interrupt arrives while its interval is being changed
+*/
+static void PreemptionTest(void)
+{
+    uint32 entries;
+    uint32 i;
+
+    Init();
+    Pwm_EnableNotificationDecimated(3U, PWM_RISING_EDGE, 4U);
+    Pwm_Host_Edge(3U);
+    Pwm_Host_Edge(3U);
+
+    /* Taken after the update: the edge counts towards the new interval of 2 */
+    entries = SchM_Host_PwmArea[30];
+    SchM_Host_RaiseInterruptOnEnter(EdgeOfChannel3);
+    Pwm_EnableNotificationDecimated(3U, PWM_RISING_EDGE, 2U);
+    CHECK(SchM_Host_PwmArea[30] == (entries + 1U));
+    CHECK(Pwm_Host_Notifications[3] == 0U);
+    Pwm_Host_Edge(3U);
+    CHECK(Pwm_Host_Notifications[3] == 1U);
+    for (i = 0U; i < 4U; i++) {
+        Pwm_Host_Edge(3U);
+    }
+    CHECK(Pwm_Host_Notifications[3] == 3U);
+    CHECK(SchM_Host_Depth == 0U);
+    Pwm_DeInit();
+}
+
+/**
+* @brief        Cost of one eMIOS interrupt through Pwm_Notification, decimated or not
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double t1;
+    double t2;
+    uint32 i;
+
+    Init();
+    Pwm_EnableNotification(0U, PWM_RISING_EDGE);
+    Pwm_EnableNotificationDecimated(1U, PWM_RISING_EDGE, 100U);
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_EDGES; i++) {
+        Pwm_Host_Edge(0U);
+    }
+    t1 = host_test_ns();
+    for (i = 0U; i < BENCH_EDGES; i++) {
+        Pwm_Host_Edge(1U);
+    }
+    t2 = host_test_ns();
+    spin = Pwm_Host_Notifications[0] + Pwm_Host_Notifications[1];
+
+    printf("interrupt with notification: %.1f ns, decimated by 100: %.1f ns per edge (%u)\n",
+           (t1 - t0) / BENCH_EDGES, (t2 - t1) / BENCH_EDGES, spin & 1U);
+    printf("at %u Hz that is %.2f %% and %.2f %% of a host core per channel\n", PWM_HZ,
+           (t1 - t0) / BENCH_EDGES * PWM_HZ * 1e-7, (t2 - t1) / BENCH_EDGES * PWM_HZ * 1e-7);
+    Pwm_DeInit();
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    RateModel();
+    DisableTest();
+    PreemptionTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
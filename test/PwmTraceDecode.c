@@ -0,0 +1,407 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Decoder of a Pwm event trace, the 8-byte Pwm_TraceRecordType records of a PWM_TRACE build
+* saved from the debugger. The dump is either the buffer filled by Pwm_TraceRead, oldest record
+* first, or the raw Pwm_aTraceRing with the value of Pwm_u32TraceHead, from which the oldest
+* record is found. Time stamps are unwrapped past 2^32 and given in ns from the first record at
+* the clock of PWM_TRACE_TIMESTAMP(), the core clock for the DWT cycles of OSIF_COUNTER_CUSTOM.
+* A record preempted between its slot and its time stamp is stamped after the next one; the
+* next one is then given the time of the preempted record, so that time never goes back.
+*
+*   PwmTraceDecode [-csv | -vcd] [-hz <time stamp clock>] [-head <Pwm_u32TraceHead>] <dump>.bin
+*
+* CSV gives one line per record. VCD gives, per channel seen, the duty cycle as a fraction of
+* the period, the period and the phase shift in ticks, the values buffered for Pwm_SyncUpdate,
+* the idle state and the notifications, and per module the synchronous updates, for a waveform
+* viewer such as GTKWave.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define RECORD_SIZE         (8U)
+#define MAX_RECORDS         (65536U)
+#define MAX_CHANNELS        (256U)
+#define DEFAULT_HZ          (160000000.0)
+
+/* Pwm_TraceEventType */
+#define EV_SET_DUTY                 (0x01U)
+#define EV_SET_PERIOD               (0x02U)
+#define EV_SET_DUTY_NO_UPDATE       (0x03U)
+#define EV_SET_PERIOD_NO_UPDATE     (0x04U)
+#define EV_SYNC_UPDATE              (0x05U)
+#define EV_OUTPUT_TO_IDLE           (0x06U)
+#define EV_NOTIFICATION             (0x07U)
+#define EV_SET_PHASE                (0x08U)
+#define EV_COUNT                    (0x09U)
+
+#define DUTY_100_PERCENT    (32768.0)
+
+/* VCD variables of a channel, then the one of a module */
+#define VAR_DUTY            (0U)
+#define VAR_PERIOD          (1U)
+#define VAR_PHASE           (2U)
+#define VAR_DUTY_BUFFERED   (3U)
+#define VAR_PERIOD_BUFFERED (4U)
+#define VAR_IDLE            (5U)
+#define VAR_NOTIFICATION    (6U)
+#define CHANNEL_VARS        (7U)
+#define VAR_SYNC            (CHANNEL_VARS)
+#define VARS                (CHANNEL_VARS + 1U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* One decoded record */
+typedef struct {
+    unsigned long long time_ns;
+    unsigned long timestamp;
+    unsigned int event;
+    unsigned int channel;
+    unsigned long value;
+} Record_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Record_t records[MAX_RECORDS];
+static unsigned char raw[MAX_RECORDS * RECORD_SIZE];
+
+/* Channels, and modules for the synchronous updates, seen in the trace */
+static unsigned char channel_seen[MAX_CHANNELS];
+static unsigned char module_seen[MAX_CHANNELS];
+
+static const char *const event_names[EV_COUNT] = {
+    "?", "duty", "period", "duty_buffered", "period_buffered", "sync_update", "idle",
+    "notification", "phase"
+};
+
+static const char *const var_names[VARS] = {
+    "duty", "period", "phase", "duty_buffered", "period_buffered", "idle", "notification", "sync_update"
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Little endian half word of the dump, the byte order of the target
+*/
+static unsigned long Half(const unsigned char *p)
+{
+    return (unsigned long)p[0] | ((unsigned long)p[1] << 8);
+}
+
+/**
+* @brief        Little endian word of the dump, the byte order of the target
+*/
+static unsigned long Word(const unsigned char *p)
+{
+    return (unsigned long)p[0] | ((unsigned long)p[1] << 8) | ((unsigned long)p[2] << 16) |
+           ((unsigned long)p[3] << 24);
+}
+
+/**
+* @brief        Name of an event, the number for one this decoder does not know
+*/
+static const char *EventName(unsigned int Event, char *Buffer)
+{
+    if ((Event > 0U) && (Event < EV_COUNT)) {
+        return event_names[Event];
+    }
+    sprintf(Buffer, "0x%02x", Event);
+
+    return Buffer;
+}
+
+/**
+* @brief        VCD identifier of a variable, printable characters from '!' on
+*/
+static void VcdId(unsigned int Var, unsigned int Index, char *Id)
+{
+    unsigned int n = (Index * VARS) + Var;
+    unsigned int i = 0U;
+
+    do {
+        Id[i++] = (char)('!' + (n % 94U));
+        n /= 94U;
+    } while (n > 0U);
+    Id[i] = '\0';
+}
+
+/**
+* @brief        Records of the dump in time order, time stamps unwrapped; returns the count
+*/
+static unsigned long Decode(size_t Bytes, int HeadGiven, unsigned long Head, double Hz)
+{
+    unsigned long count = (unsigned long)(Bytes / RECORD_SIZE);
+    unsigned long first = 0U;
+    unsigned long long ticks = 0U;
+    unsigned long previous = 0U;
+    unsigned long delta;
+    unsigned long i;
+    const unsigned char *p;
+
+    if (HeadGiven != 0) {
+        /* A ring of count records, full once the head went past it */
+        if (Head < count) {
+            count = Head;
+        } else {
+            first = Head % count;
+        }
+    }
+
+    for (i = 0U; i < count; i++) {
+        p = &raw[((first + i) % (Bytes / RECORD_SIZE)) * RECORD_SIZE];
+        records[i].timestamp = Word(&p[0]);
+        records[i].event = p[4];
+        records[i].channel = p[5];
+        records[i].value = Half(&p[6]);
+        if (i > 0U) {
+            /* Half the range back is a step back, behind a preempted record */
+            delta = (records[i].timestamp - previous) & 0xFFFFFFFFUL;
+            if (delta < 0x80000000UL) {
+                ticks += delta;
+                previous = records[i].timestamp;
+            }
+        } else {
+            previous = records[i].timestamp;
+        }
+        records[i].time_ns = (unsigned long long)(((double)ticks * 1.0e9 / Hz) + 0.5);
+    }
+
+    return count;
+}
+
+/**
+* @brief        One CSV line per record
+*/
+static void PrintCsv(unsigned long Count)
+{
+    char buffer[8];
+    unsigned long i;
+
+    printf("time_ns,timestamp,event,channel,value\n");
+    for (i = 0U; i < Count; i++) {
+        printf("%llu,%lu,%s,%u,%lu\n", records[i].time_ns, records[i].timestamp,
+               EventName(records[i].event, buffer), records[i].channel, records[i].value);
+    }
+}
+
+/**
+* @brief        Declarations of the variables of the channels and modules seen
+*/
+static void PrintVcdHeader(double Hz)
+{
+    char id[4];
+    unsigned int ch;
+    unsigned int var;
+
+    printf("$comment Pwm trace, time stamps at %.0f Hz $end\n", Hz);
+    printf("$timescale 1ns $end\n");
+    printf("$scope module pwm $end\n");
+    for (ch = 0U; ch < MAX_CHANNELS; ch++) {
+        if (channel_seen[ch] != 0U) {
+            printf("$scope module ch%u $end\n", ch);
+            for (var = 0U; var < CHANNEL_VARS; var++) {
+                VcdId(var, ch, id);
+                if ((var == VAR_DUTY) || (var == VAR_DUTY_BUFFERED)) {
+                    printf("$var real 64 %s %s $end\n", id, var_names[var]);
+                } else if (var == VAR_IDLE) {
+                    printf("$var wire 1 %s %s $end\n", id, var_names[var]);
+                } else if (var == VAR_NOTIFICATION) {
+                    printf("$var event 1 %s %s $end\n", id, var_names[var]);
+                } else {
+                    printf("$var reg 16 %s %s $end\n", id, var_names[var]);
+                }
+            }
+            printf("$upscope $end\n");
+        }
+    }
+    for (ch = 0U; ch < MAX_CHANNELS; ch++) {
+        if (module_seen[ch] != 0U) {
+            printf("$scope module module%u $end\n", ch);
+            VcdId(VAR_SYNC, ch, id);
+            printf("$var event 1 %s %s $end\n", id, var_names[VAR_SYNC]);
+            printf("$upscope $end\n");
+        }
+    }
+    printf("$upscope $end\n");
+    printf("$enddefinitions $end\n");
+}
+
+/**
+* @brief        16-bit register value in VCD binary
+*/
+static void PrintVcdBits(unsigned long Value, const char *Id)
+{
+    char bits[17];
+    int i = 16;
+
+    bits[i] = '\0';
+    do {
+        bits[--i] = (char)('0' + (Value & 1UL));
+        Value >>= 1;
+    } while (Value != 0UL);
+    printf("b%s %s\n", &bits[i], Id);
+}
+
+/**
+* @brief        Value changes, the records of one time stamp under one time
+*/
+static void PrintVcd(unsigned long Count, double Hz)
+{
+    char id[4];
+    unsigned long long now = 0U;
+    unsigned long i;
+    unsigned int ch;
+    unsigned int var;
+    const Record_t *r;
+
+    for (i = 0U; i < Count; i++) {
+        if (records[i].event == EV_SYNC_UPDATE) {
+            module_seen[records[i].channel] = 1U;
+        } else {
+            channel_seen[records[i].channel] = 1U;
+        }
+    }
+    PrintVcdHeader(Hz);
+
+    /* Unknown until the first record of the channel, not idle */
+    printf("#0\n$dumpvars\n");
+    for (ch = 0U; ch < MAX_CHANNELS; ch++) {
+        if (channel_seen[ch] != 0U) {
+            for (var = 0U; var < VAR_IDLE; var++) {
+                VcdId(var, ch, id);
+                printf("%s %s\n", ((var == VAR_DUTY) || (var == VAR_DUTY_BUFFERED)) ? "r0" : "bx", id);
+            }
+            VcdId(VAR_IDLE, ch, id);
+            printf("0%s\n", id);
+        }
+    }
+    printf("$end\n");
+
+    for (i = 0U; i < Count; i++) {
+        r = &records[i];
+        if (r->time_ns != now) {
+            now = r->time_ns;
+            printf("#%llu\n", now);
+        }
+        switch (r->event) {
+            case EV_SET_DUTY:
+                VcdId(VAR_DUTY, r->channel, id);
+                printf("r%.6g %s\n", (double)r->value / DUTY_100_PERCENT, id);
+                VcdId(VAR_IDLE, r->channel, id);
+                printf("0%s\n", id);
+                break;
+            case EV_SET_PERIOD:
+                VcdId(VAR_PERIOD, r->channel, id);
+                PrintVcdBits(r->value, id);
+                VcdId(VAR_IDLE, r->channel, id);
+                printf("0%s\n", id);
+                break;
+            case EV_SET_PHASE:
+                VcdId(VAR_PHASE, r->channel, id);
+                PrintVcdBits(r->value, id);
+                break;
+            case EV_SET_DUTY_NO_UPDATE:
+                VcdId(VAR_DUTY_BUFFERED, r->channel, id);
+                printf("r%.6g %s\n", (double)r->value / DUTY_100_PERCENT, id);
+                break;
+            case EV_SET_PERIOD_NO_UPDATE:
+                VcdId(VAR_PERIOD_BUFFERED, r->channel, id);
+                PrintVcdBits(r->value, id);
+                break;
+            case EV_OUTPUT_TO_IDLE:
+                VcdId(VAR_IDLE, r->channel, id);
+                printf("1%s\n", id);
+                break;
+            case EV_NOTIFICATION:
+                VcdId(VAR_NOTIFICATION, r->channel, id);
+                printf("1%s\n", id);
+                break;
+            case EV_SYNC_UPDATE:
+                VcdId(VAR_SYNC, r->channel, id);
+                printf("1%s\n", id);
+                break;
+            default:
+                /* An event of a newer driver, kept in the CSV only */
+                break;
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    int vcd = 0;
+    int head_given = 0;
+    unsigned long head = 0U;
+    double hz = DEFAULT_HZ;
+    unsigned long count;
+    size_t bytes;
+    FILE *f;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-csv") == 0) {
+            vcd = 0;
+        } else if (strcmp(argv[i], "-vcd") == 0) {
+            vcd = 1;
+        } else if ((strcmp(argv[i], "-hz") == 0) && ((i + 1) < argc)) {
+            hz = strtod(argv[++i], NULL);
+        } else if ((strcmp(argv[i], "-head") == 0) && ((i + 1) < argc)) {
+            head = strtoul(argv[++i], NULL, 0);
+            head_given = 1;
+        } else {
+            path = argv[i];
+        }
+    }
+    if ((path == NULL) || (hz <= 0.0)) {
+        fprintf(stderr, "usage: %s [-csv | -vcd] [-hz <time stamp clock>] [-head <Pwm_u32TraceHead>] <dump>.bin\n",
+                argv[0]);
+        return 1;
+    }
+
+    f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+    bytes = fread(raw, 1U, sizeof(raw), f);
+    fclose(f);
+    if (((bytes % RECORD_SIZE) != 0U) || ((head_given != 0) && (bytes == 0U))) {
+        fprintf(stderr, "%s: %lu bytes, not a dump of 8-byte records\n", path, (unsigned long)bytes);
+        return 1;
+    }
+
+    count = Decode(bytes, head_given, head, hz);
+    if (vcd != 0) {
+        PrintVcd(count, hz);
+    } else {
+        PrintCsv(count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of the Pwm event trace, built from the Pwm and eMIOS driver sources on the register
+* model of rtd/ with PWM_TRACE on. The default time stamp reads OsIf_GetCounter, which hands out
+* tickets here. The 8-byte records of the services are checked field by field, with a period and
+* a phase shift using all 16 bits of the target counters. Threads then update their own channels
+* at once, each slot taken by an atomic increment of the head: every record has to be whole and
+* none lost. A record preempted between its slot and its time stamp may hold a later ticket than
+* the next one; those are counted, not refused. The benchmark gives the cost of a record on a
+* duty update.
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include "host_test.h"
+#include "Pwm.h"
+#include "Pwm_Host.h"
+#include "Emios_Host.h"
+#include "Det_Host.h"
+#include "SchM_Host.h"
+#include "OsIf.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define BUS_PERIOD          (0xC000U)       /* Top bit of the 16-bit counters set */
+#define PHASE               (0x9234U)
+#define MCB_UP              (80U)
+#define THREADS             (4U)
+#define THREAD_CHANNELS     (4U)
+#define UPDATES             (20000U)        /* Duty updates per thread */
+#define BENCH_CALLS         (1000000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static volatile uint32 ticket;
+static Pwm_TraceRecordType records[PWM_TRACE_SIZE];
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        OsIf stand-in: a ticket per call instead of a time
+*/
+uint32 OsIf_GetCounter(OsIf_CounterType SelectedCounter)
+{
+    (void)SelectedCounter;
+
+    return __atomic_add_fetch(&ticket, 1U, __ATOMIC_RELAXED);
+}
+
+/**
+* @brief        Host configuration at 50 %, channel 1 moved to OPWMB on bus A for the phase shift
+*/
+static void Init(void)
+{
+    Pwm_Host_Setup(1000U, 500U);
+    Pwm_Host_EmiosChannels[1].Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG;
+    Pwm_Host_EmiosChannels[1].Timebase = EMIOS_PWM_IP_BUS_A;
+    Pwm_Host_EmiosChannels[1].DutyCycle = 0U;
+    Emios_Host_SetBus(0U, 23U, BUS_PERIOD, MCB_UP);
+    Det_Host_Clear();
+    Pwm_Init(&Pwm_Host_Config);
+    Pwm_TraceEnable(TRUE);
+}
+
+/**
+* @brief        Record i of the last count read
+*/
+static boolean IsRecord(uint32 i, Pwm_TraceEventType Event, uint8 Channel, uint16 Value)
+{
+    return ((records[i].Event == (uint8)Event) && (records[i].Channel == Channel) &&
+            (records[i].Value == Value)) ? TRUE : FALSE;
+}
+
+/**
+* @brief        One record per event of each service, values kept whole
+*/
+static void RecordTest(void)
+{
+    uint32 total;
+    uint32 count;
+
+    CHECK(sizeof(Pwm_TraceRecordType) == 8U);
+
+    Init();
+    total = Pwm_TraceGetTotal();
+    Pwm_SetDutyCycle(0U, 0x2000U);
+    Pwm_SetPeriodAndDuty(2U, 0xA000U, 0x4000U);
+    Pwm_SetDutyPhaseShift(1U, 0x1000U, PHASE, FALSE);
+    Pwm_SetOutputToIdle(3U);
+    Pwm_EnableNotification(4U, PWM_RISING_EDGE);
+    Pwm_Host_Edge(4U);
+    CHECK(Det_Host_Errors == 0U);
+
+    CHECK(Pwm_TraceGetTotal() == (total + 7U));
+    count = Pwm_TraceRead(records, 7U);
+    CHECK(count == 7U);
+    CHECK(IsRecord(0U, PWM_TRACE_SET_DUTY, 0U, 0x2000U));
+    CHECK(IsRecord(1U, PWM_TRACE_SET_PERIOD, 2U, 0xA000U));
+    CHECK(IsRecord(2U, PWM_TRACE_SET_DUTY, 2U, 0x4000U));
+    CHECK(IsRecord(3U, PWM_TRACE_SET_PHASE, 1U, PHASE));
+    CHECK(IsRecord(4U, PWM_TRACE_SET_DUTY, 1U, 0x1000U));
+    CHECK(IsRecord(5U, PWM_TRACE_OUTPUT_TO_IDLE, 3U, (uint16)PWM_LOW));
+    CHECK(IsRecord(6U, PWM_TRACE_NOTIFICATION, 4U, 0U));
+    CHECK((records[0].Timestamp < records[3].Timestamp) && (records[3].Timestamp < records[6].Timestamp));
+
+    /* The buffered phase shift has its own record as well */
+    Pwm_SetDutyPhaseShift(1U, 0x800U, 7U, TRUE);
+    count = Pwm_TraceRead(records, 2U);
+    CHECK(count == 2U);
+    CHECK(IsRecord(0U, PWM_TRACE_SET_PHASE, 1U, 7U));
+    CHECK(IsRecord(1U, PWM_TRACE_SET_DUTY_NO_UPDATE, 1U, 0x800U));
+
+    /* Frozen, the ring and the total stay as they are */
+    total = Pwm_TraceGetTotal();
+    Pwm_TraceEnable(FALSE);
+    Pwm_SetDutyCycle(0U, 0x3000U);
+    CHECK(Pwm_TraceGetTotal() == total);
+    CHECK((Pwm_TraceRead(records, 1U) == 1U) && IsRecord(0U, PWM_TRACE_SET_DUTY_NO_UPDATE, 1U, 0x800U));
+    Pwm_TraceEnable(TRUE);
+
+    /* No buffer: nothing copied, the error reported */
+    Det_Host_Clear();
+    CHECK(Pwm_TraceRead(NULL_PTR, PWM_TRACE_SIZE) == 0U);
+    CHECK((Det_Host_Errors == 1U) && (Det_Host_Last.ApiId == PWM_TRACEREAD_ID) &&
+          (Det_Host_Last.ErrorId == PWM_E_PARAM_POINTER));
+    Pwm_DeInit();
+}
+
+/**
+* @brief        Duty updates on the channels of one thread, the duty names the thread and update
+*/
+static void *Updater(void *arg)
+{
+    uint32 thread = (uint32)(uintptr_t)arg;
+    Pwm_ChannelType channel;
+    uint32 i;
+
+    for (i = 0U; i < UPDATES; i++) {
+        channel = (Pwm_ChannelType)(8U + (thread * THREAD_CHANNELS) + (i % THREAD_CHANNELS));
+        Pwm_SetDutyCycle(channel, (uint16)((thread << 12U) | (i & 0xFFFU)));
+        if ((i % 64U) == 0U) {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+* @brief        Threads tracing at once: whole records, none lost
+*/
+static void ConcurrencyTest(void)
+{
+    pthread_t threads[THREADS];
+    uint32 total;
+    uint32 count;
+    uint32 torn = 0U;
+    uint32 out_of_order = 0U;
+    uint32 thread;
+    uint32 i;
+
+    Init();
+    total = Pwm_TraceGetTotal();
+    for (i = 0U; i < THREADS; i++) {
+        (void)pthread_create(&threads[i], NULL, Updater, (void *)(uintptr_t)i);
+    }
+    for (i = 0U; i < THREADS; i++) {
+        (void)pthread_join(threads[i], NULL);
+    }
+
+    CHECK(Pwm_TraceGetTotal() == (total + (THREADS * UPDATES)));
+    count = Pwm_TraceRead(records, PWM_TRACE_SIZE);
+    CHECK(count == PWM_TRACE_SIZE);
+    for (i = 0U; i < count; i++) {
+        /* The channel has to belong to the thread the duty names */
+        thread = records[i].Value >> 12U;
+        torn += ((records[i].Event != (uint8)PWM_TRACE_SET_DUTY) || (thread >= THREADS) ||
+                 (((uint32)records[i].Channel - 8U) / THREAD_CHANNELS != thread)) ? 1U : 0U;
+        out_of_order += ((i > 0U) && (records[i].Timestamp <= records[i - 1U].Timestamp)) ? 1U : 0U;
+    }
+    printf("concurrency: %u threads, %u records, last %u read: %u torn, %u out of order\n",
+           THREADS, THREADS * UPDATES, count, torn, out_of_order);
+    CHECK(torn == 0U);
+    CHECK(Det_Host_Errors == 0U);
+    CHECK(SchM_Host_Depth == 0U);
+    Pwm_DeInit();
+}
+
+/**
+* @brief        Duty update with and without its record
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double t1;
+    double t2;
+    uint32 i;
+
+    Init();
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        Pwm_SetDutyCycle(0U, (uint16)(i & 0x7FFFU));
+    }
+    t1 = host_test_ns();
+    Pwm_TraceEnable(FALSE);
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        Pwm_SetDutyCycle(0U, (uint16)(i & 0x7FFFU));
+    }
+    t2 = host_test_ns();
+    Pwm_TraceEnable(TRUE);
+
+    printf("Pwm_SetDutyCycle traced: %.1f ns, frozen: %.1f ns, record %.1f ns\n",
+           (t1 - t0) / BENCH_CALLS, (t2 - t1) / BENCH_CALLS, ((t1 - t0) - (t2 - t1)) / BENCH_CALLS);
+    Pwm_DeInit();
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    RecordTest();
+    ConcurrencyTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,299 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of the trusted configuration mode, built from the Pwm and eMIOS driver sources on
+* the register model of rtd/, once with PWM_TRUSTED_CONFIG on (PwmTrusted_Test) and once with
+* it off (PwmTrustedOff_Test). A three channel configuration (OPWFM with a notification, OPWMB
+* on bus A, OPWMCB on the bus of channel 8) is broken one field at a time: with the mode on,
+* Pwm_Init has to refuse each one before taking it, so the next service reports the driver
+* uninitialised and a second Pwm_Init is not refused as a repeated one. An OPWMCB channel with
+* a dead time and a 0 % duty cycle is accepted. On the accepted configuration the per-call
+* checks of a channel against its mode are only made with the mode off, the argument range
+* checks in both builds. The benchmark gives the cost of Pwm_Init and of the services, to be
+* compared between the two builds.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "Pwm.h"
+#include "Pwm_Notif.h"
+#include "Emios_Host.h"
+#include "Det_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define CHANNELS            (3U)
+#define BUS_PERIOD          (1000U)
+#define OPWFM_CHANNEL       (0U)
+#define OPWMB_CHANNEL       (1U)
+#define OPWMCB_CHANNEL      (9U)            /* On the BCDE bus run by channel 8 */
+#define MCB_UP              (80U)
+#define MCB_UP_DOWN         (84U)
+#define BENCH_INITS         (10000U)
+#define BENCH_CALLS         (1000000U)
+
+#define TRUSTED_CHANNEL(n, Class, Notify) \
+    { (Pwm_ChannelType)(n), (Class), { PWM_CHANNEL_EMIOS, &emios[n], 0U, 0x4000U }, PWM_LOW, (Notify) }
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Emios_Pwm_Ip_ChannelConfigType emios[CHANNELS];
+static uint32 notifications;
+
+static void Notify(void);
+
+static const Pwm_ChannelConfigType channels[CHANNELS] = {
+    TRUSTED_CHANNEL(0, PWM_VARIABLE_PERIOD, Notify),
+    TRUSTED_CHANNEL(1, PWM_FIXED_PERIOD, NULL_PTR),
+    TRUSTED_CHANNEL(2, PWM_FIXED_PERIOD, NULL_PTR)
+};
+
+static const Pwm_ConfigType config = { (Pwm_ChannelType)CHANNELS, &channels, { 0U, 1U, 2U } };
+
+#if (PWM_TRUSTED_CONFIG == STD_ON)
+/* The same channels with a variable period asked of the one on bus A */
+static const Pwm_ChannelConfigType variable_bus_channels[CHANNELS] = {
+    TRUSTED_CHANNEL(0, PWM_VARIABLE_PERIOD, Notify),
+    TRUSTED_CHANNEL(1, PWM_VARIABLE_PERIOD, NULL_PTR),
+    TRUSTED_CHANNEL(2, PWM_FIXED_PERIOD, NULL_PTR)
+};
+static const Pwm_ConfigType variable_bus_config = {
+    (Pwm_ChannelType)CHANNELS, &variable_bus_channels, { 0U, 1U, 2U }
+};
+#endif
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Notification of the OPWFM channel
+*/
+static void Notify(void)
+{
+    notifications++;
+}
+
+/**
+* @brief        The consistent configuration, on a reset register model with both buses running
+*/
+static void Setup(void)
+{
+    uint32 i;
+
+    Emios_Host_Reset();
+    Emios_Host_SetBus(0U, 23U, BUS_PERIOD, MCB_UP);
+    Emios_Host_SetBus(0U, 8U, BUS_PERIOD, MCB_UP_DOWN);
+    for (i = 0U; i < CHANNELS; i++) {
+        memset(&emios[i], 0, sizeof(emios[i]));
+        emios[i].InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1;
+        emios[i].InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1;
+        emios[i].InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK;
+        emios[i].OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH;
+        emios[i].IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST;
+        emios[i].UserCallback.CbFunction = Pwm_Notification;
+        emios[i].UserCallback.CbParameter = (uint8)i;
+    }
+
+    emios[0].ChannelId = OPWFM_CHANNEL;
+    emios[0].Mode = EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG;
+    emios[0].Timebase = EMIOS_PWM_IP_BUS_INTERNAL;
+    emios[0].PeriodCount = BUS_PERIOD;
+    emios[0].DutyCycle = 500U;
+
+    emios[1].ChannelId = OPWMB_CHANNEL;
+    emios[1].Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG;
+    emios[1].Timebase = EMIOS_PWM_IP_BUS_A;
+    emios[1].DutyCycle = 250U;
+
+    emios[2].ChannelId = OPWMCB_CHANNEL;
+    emios[2].Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG;
+    emios[2].Timebase = EMIOS_PWM_IP_BUS_BCDE;
+    emios[2].DutyCycle = 400U;
+    emios[2].DeadTime = 100U;
+
+    notifications = 0U;
+    Det_Host_Clear();
+}
+
+#if (PWM_TRUSTED_CONFIG == STD_ON)
+/**
+* @brief        Init on a refused configuration: the driver stays uninitialised
+*/
+static void ExpectRefused(const Pwm_ConfigType *ConfigPtr)
+{
+    Det_Host_Clear();
+    Pwm_Init(ConfigPtr);
+    CHECK(Det_Host_Errors == 1U);
+    CHECK((Det_Host_Last.ApiId == PWM_INIT_ID) && (Det_Host_Last.ErrorId == PWM_E_INIT_FAILED));
+
+    /* The configuration was not taken */
+    Pwm_SetDutyCycle(0U, 0x2000U);
+    CHECK((Det_Host_Last.ApiId == PWM_SETDUTYCYCLE_ID) && (Det_Host_Last.ErrorId == PWM_E_UNINIT));
+
+    /* Nor the driver left half initialised: the consistent one is still taken */
+    Setup();
+    Pwm_Init(&config);
+    CHECK(Det_Host_Errors == 0U);
+    Pwm_DeInit();
+}
+
+/**
+* @brief        One field broken at a time
+*/
+static void InitTest(void)
+{
+    Setup();
+    Pwm_Init(&config);
+    CHECK(Det_Host_Errors == 0U);
+    Pwm_DeInit();
+
+    /* A variable period on a channel taking it from a counter bus */
+    Setup();
+    ExpectRefused(&variable_bus_config);
+
+    /* The channel running bus A on bus A */
+    Setup();
+    emios[1].ChannelId = 23U;
+    ExpectRefused(&config);
+
+    /* A notification on a channel raising DMA requests */
+    Setup();
+    emios[0].IrqMode = EMIOS_PWM_IP_DMA_REQUEST;
+    ExpectRefused(&config);
+
+    /* A trail edge dead time taking the whole first half of the pulse */
+    Setup();
+    emios[2].DeadTime = emios[2].DutyCycle >> 1U;
+    ExpectRefused(&config);
+
+    /* The same dead time on a 0 % output, which has no pulse to take it from */
+    Setup();
+    emios[2].DutyCycle = 0U;
+    Pwm_Init(&config);
+    CHECK(Det_Host_Errors == 0U);
+    Pwm_DeInit();
+}
+#endif /* PWM_TRUSTED_CONFIG */
+
+/**
+* @brief        The per-call checks on an accepted configuration
+*/
+static void CallTest(void)
+{
+    Setup();
+    Pwm_Init(&config);
+    CHECK(Det_Host_Errors == 0U);
+
+#if (PWM_TRUSTED_CONFIG == STD_OFF)
+    /* Trigger delay is an OPWMT service */
+    Pwm_SetTriggerDelay(0U, 100U);
+    CHECK((Det_Host_Last.ApiId == PWM_SETTRIGGERDELAY_ID) && (Det_Host_Last.ErrorId == PWM_E_PARAM_CHANNEL));
+
+    /* Dead time is an OPWMCB service */
+    Det_Host_Clear();
+    Pwm_SetChannelDeadTime(0U, 10U);
+    CHECK((Det_Host_Last.ApiId == PWM_SETCHANNELDEADTIME_ID) && (Det_Host_Last.ErrorId == PWM_E_PARAM_CHANNEL));
+
+    /* Phase shift, in ticks, needs a channel on a counter bus */
+    Det_Host_Clear();
+    Pwm_SetDutyPhaseShift(0U, 0x2000U, 100U, FALSE);
+    CHECK((Det_Host_Last.ApiId == PWM_SETDUTYPHASESHIFT_ID) &&
+          (Det_Host_Last.ErrorId == PWM_E_CHANNEL_PHASE_SHIFT_NOT_SUPPORTED));
+#endif
+
+    /* The services the channel modes support */
+    Det_Host_Clear();
+    Pwm_SetChannelDeadTime(2U, 10U);
+    Pwm_SetDutyPhaseShift(1U, 0x2000U, 100U, FALSE);
+    CHECK(Det_Host_Errors == 0U);
+
+    /* The arguments are checked in both builds, against the mode where they depend on it */
+    Pwm_SetChannelDeadTime(2U, emios[2].DutyCycle);
+    CHECK((Det_Host_Last.ApiId == PWM_SETCHANNELDEADTIME_ID) && (Det_Host_Last.ErrorId == PWM_E_DEADTIME_RANGE));
+    Pwm_SetDutyPhaseShift(1U, 0x4000U, (Pwm_DutyType)BUS_PERIOD, FALSE);
+    CHECK((Det_Host_Last.ApiId == PWM_SETDUTYPHASESHIFT_ID) && (Det_Host_Last.ErrorId == PWM_E_PARAM_PHASESHIFT_RANGE));
+    Pwm_SetDutyCycle(0U, 0x8001U);
+    CHECK((Det_Host_Last.ApiId == PWM_SETDUTYCYCLE_ID) && (Det_Host_Last.ErrorId == PWM_E_DUTYCYCLE_RANGE));
+    Pwm_SetDutyCycle((Pwm_ChannelType)PWM_CONFIG_LOGIC_CHANNELS, 0x2000U);
+    CHECK((Det_Host_Last.ApiId == PWM_SETDUTYCYCLE_ID) && (Det_Host_Last.ErrorId == PWM_E_PARAM_CHANNEL));
+
+    /* The channel class is still checked per call */
+    Pwm_SetPeriodAndDuty(1U, 500U, 0x2000U);
+    CHECK((Det_Host_Last.ApiId == PWM_SETPERIODANDDUTY_ID) && (Det_Host_Last.ErrorId == PWM_E_PERIOD_UNCHANGEABLE));
+
+    Pwm_DeInit();
+}
+
+/**
+* @brief        Init and the services, with the checks of the build
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double t1;
+    double t2;
+    double t3;
+    uint32 i;
+
+    Setup();
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_INITS; i++) {
+        Pwm_Init(&config);
+        Pwm_DeInit();
+    }
+    t1 = host_test_ns();
+
+    Pwm_Init(&config);
+    t2 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        Pwm_SetDutyCycle(0U, (uint16)(i & 0x7FFFU));
+    }
+    t3 = host_test_ns();
+    printf("trusted configuration %s\n", (PWM_TRUSTED_CONFIG == STD_ON) ? "on" : "off");
+    printf("Pwm_Init + Pwm_DeInit of %u channels: %.0f ns, Pwm_SetDutyCycle: %.1f ns\n",
+           CHANNELS, (t1 - t0) / BENCH_INITS, (t3 - t2) / BENCH_CALLS);
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        Pwm_SetDutyPhaseShift(1U, (uint16)(i & 0x3FFFU), 100U, FALSE);
+    }
+    t1 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        Pwm_SetChannelDeadTime(2U, (Pwm_PeriodType)(i & 0x3FU));
+    }
+    t2 = host_test_ns();
+    printf("Pwm_SetDutyPhaseShift: %.1f ns, Pwm_SetChannelDeadTime: %.1f ns\n",
+           (t1 - t0) / BENCH_CALLS, (t2 - t1) / BENCH_CALLS);
+    CHECK(Det_Host_Errors == 0U);
+    Pwm_DeInit();
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+#if (PWM_TRUSTED_CONFIG == STD_ON)
+    InitTest();
+#endif
+    CallTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
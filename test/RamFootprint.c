@@ -0,0 +1,334 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Per-module static RAM footprint from a GNU ld map file, run on demand on the map of the
+* target image (see footprint in the Makefile). Every input section is charged to the object
+* file it came from, or to the archive for library members, and to the memory region its run
+* address falls in. Regions named *flash* are not RAM and are left out, so are sections outside
+* every region (debug information). Alignment padding is reported as its own row.
+*
+*   RamFootprint <image>.map
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define MAX_REGIONS         (16U)
+#define MAX_MODULES         (512U)
+#define NAME_LENGTH         (64U)
+#define LINE_LENGTH         (1024U)
+
+#define PADDING             "(padding)"
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* One memory region of the map */
+typedef struct {
+    char name[NAME_LENGTH];
+    unsigned long origin;
+    unsigned long length;
+    unsigned long used;
+} Region_t;
+
+/* Bytes of one module per region */
+typedef struct {
+    char name[NAME_LENGTH];
+    unsigned long bytes[MAX_REGIONS];
+    unsigned long total;
+} Module_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Region_t regions[MAX_REGIONS];
+static unsigned int region_count;
+static Module_t modules[MAX_MODULES];
+static unsigned int module_count;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Parse a 0x-prefixed hex token
+*/
+static int ParseHex(const char *token, unsigned long *value)
+{
+    char *end;
+
+    if ((token == NULL) || (strncmp(token, "0x", 2U) != 0)) {
+        return 0;
+    }
+    *value = strtoul(token, &end, 16);
+
+    return (*end == '\0');
+}
+
+/**
+* @brief        Module name of an input file: the object file, or the archive of a member
+*/
+static void ModuleName(const char *file, char *name)
+{
+    const char *base = file;
+    const char *p;
+    size_t length;
+
+    for (p = file; *p != '\0'; p++) {
+        if ((*p == '/') || (*p == '\\')) {
+            base = p + 1;
+        }
+        if (*p == '(') {
+            break;
+        }
+    }
+    length = (size_t)(p - base);
+    if (length >= NAME_LENGTH) {
+        length = NAME_LENGTH - 1U;
+    }
+    memcpy(name, base, length);
+    name[length] = '\0';
+}
+
+/**
+* @brief        Charge size bytes at address to a module
+*/
+static void Charge(const char *module, unsigned long address, unsigned long size)
+{
+    unsigned int r;
+    unsigned int m;
+
+    for (r = 0U; r < region_count; r++) {
+        if ((address >= regions[r].origin) && (address < (regions[r].origin + regions[r].length))) {
+            break;
+        }
+    }
+    if ((r == region_count) || (size == 0UL)) {
+        return;
+    }
+
+    for (m = 0U; (m < module_count) && (strcmp(modules[m].name, module) != 0); m++) {
+    }
+    if (m == module_count) {
+        if (module_count == MAX_MODULES) {
+            fprintf(stderr, "RamFootprint: more than %u modules\n", MAX_MODULES);
+            exit(1);
+        }
+        (void)snprintf(modules[m].name, NAME_LENGTH, "%s", module);
+        module_count++;
+    }
+    modules[m].bytes[r] += size;
+    modules[m].total += size;
+    regions[r].used += size;
+}
+
+/**
+* @brief        Memory region line: name origin length [attributes]
+*/
+static void ParseRegion(char *line)
+{
+    char *name = strtok(line, " \t\r\n");
+    unsigned long origin;
+    unsigned long length;
+
+    if ((name == NULL) || (strcmp(name, "Name") == 0) || (strcmp(name, "*default*") == 0) ||
+        !ParseHex(strtok(NULL, " \t\r\n"), &origin) || !ParseHex(strtok(NULL, " \t\r\n"), &length) ||
+        (strstr(name, "flash") != NULL) || (length == 0UL) || (region_count == MAX_REGIONS)) {
+        return;
+    }
+    (void)snprintf(regions[region_count].name, NAME_LENGTH, "%s", name);
+    regions[region_count].origin = origin;
+    regions[region_count].length = length;
+    region_count++;
+}
+
+/**
+* @brief        Output sections that are not loaded; they sit at address 0, which is ITCM
+*/
+static int NotLoaded(const char *section)
+{
+    static const char *const prefixes[] = {
+        ".debug", ".comment", ".ARM.attributes", ".stab", ".note", "/DISCARD/"
+    };
+    unsigned int i;
+    int found = 0;
+
+    for (i = 0U; i < (sizeof(prefixes) / sizeof(prefixes[0])); i++) {
+        found = found || (strncmp(section, prefixes[i], strlen(prefixes[i])) == 0);
+    }
+
+    return found;
+}
+
+/**
+* @brief        Line of the memory map
+* @details      Output sections start in column 0. Input sections start with one blank and
+*               carry address, size and file, on the next line when the section name is long.
+*               Symbols and assignments have no size and file.
+*/
+static void ParseMapLine(const char *line, int *pending, int *skip)
+{
+    char copy[LINE_LENGTH];
+    char module[NAME_LENGTH];
+    char *tokens[4];
+    unsigned int count;
+    unsigned long address;
+    unsigned long size;
+    int input = (line[0] == ' ') && (line[1] != ' ');
+
+    (void)snprintf(copy, sizeof(copy), "%s", line);
+    for (count = 0U; count < 4U; count++) {
+        tokens[count] = strtok((count == 0U) ? copy : NULL, " \t\r\n");
+        if (tokens[count] == NULL) {
+            break;
+        }
+    }
+
+    if (count == 0U) {
+        *pending = 0;
+    } else if ((line[0] != ' ') && (line[0] != '\t')) {
+        *skip = NotLoaded(tokens[0]);
+        *pending = 0;
+    } else if (*skip) {
+        /* Debug information and the like */
+    } else if (input && (strcmp(tokens[0], "*fill*") == 0)) {
+        if ((count >= 3U) && ParseHex(tokens[1], &address) && ParseHex(tokens[2], &size)) {
+            Charge(PADDING, address, size);
+        }
+        *pending = 0;
+    } else if (input && (tokens[0][0] != '*')) {
+        *pending = (count == 1U);
+        if ((count == 4U) && ParseHex(tokens[1], &address) && ParseHex(tokens[2], &size)) {
+            ModuleName(tokens[3], module);
+            Charge(module, address, size);
+        }
+    } else if (*pending && (count >= 3U) && ParseHex(tokens[0], &address) && ParseHex(tokens[1], &size)) {
+        ModuleName(tokens[2], module);
+        Charge(module, address, size);
+        *pending = 0;
+    } else {
+        *pending = 0;
+    }
+}
+
+/**
+* @brief        Order modules by total, largest first, then by name
+*/
+static int CompareModules(const void *a, const void *b)
+{
+    const Module_t *ma = (const Module_t *)a;
+    const Module_t *mb = (const Module_t *)b;
+    int order = (ma->total < mb->total) - (ma->total > mb->total);
+
+    return (order != 0) ? order : strcmp(ma->name, mb->name);
+}
+
+/**
+* @brief        Print the table, one column per region with something in it
+*/
+static void Report(const char *map)
+{
+    unsigned int r;
+    unsigned int m;
+    unsigned long total = 0UL;
+
+    qsort(modules, module_count, sizeof(Module_t), CompareModules);
+
+    printf("Static RAM per module from %s, bytes\n\n", map);
+    printf("%-32s", "module");
+    for (r = 0U; r < region_count; r++) {
+        if (regions[r].used != 0UL) {
+            printf(" %22s", regions[r].name);
+        }
+    }
+    printf(" %10s\n", "total");
+
+    for (m = 0U; m < module_count; m++) {
+        printf("%-32s", modules[m].name);
+        for (r = 0U; r < region_count; r++) {
+            if (regions[r].used != 0UL) {
+                printf(" %22lu", modules[m].bytes[r]);
+            }
+        }
+        printf(" %10lu\n", modules[m].total);
+        total += modules[m].total;
+    }
+
+    printf("%-32s", "all modules");
+    for (r = 0U; r < region_count; r++) {
+        if (regions[r].used != 0UL) {
+            printf(" %22lu", regions[r].used);
+        }
+    }
+    printf(" %10lu\n", total);
+
+    printf("%-32s", "region size");
+    for (r = 0U; r < region_count; r++) {
+        if (regions[r].used != 0UL) {
+            printf(" %22lu", regions[r].length);
+        }
+    }
+    printf("\n");
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(int argc, char **argv)
+{
+    char line[LINE_LENGTH];
+    FILE *file;
+    int section = 0;    /* 1: memory configuration, 2: memory map */
+    int pending = 0;
+    int skip = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: RamFootprint <image>.map\n");
+        return 2;
+    }
+    file = fopen(argv[1], "r");
+    if (file == NULL) {
+        perror(argv[1]);
+        return 2;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (strncmp(line, "Memory Configuration", 20U) == 0) {
+            section = 1;
+        } else if (strncmp(line, "Linker script and memory map", 28U) == 0) {
+            section = 2;
+        } else if (section == 1) {
+            ParseRegion(line);
+        } else if (section == 2) {
+            ParseMapLine(line, &pending, &skip);
+        } else {
+            /* Archive members and discarded sections */
+        }
+    }
+    (void)fclose(file);
+
+    if (region_count == 0U) {
+        fprintf(stderr, "RamFootprint: no memory configuration in %s\n", argv[1]);
+        return 1;
+    }
+    Report(argv[1]);
+
+    return 0;
+}
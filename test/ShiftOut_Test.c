@@ -0,0 +1,395 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Simulation of the shift register engine, built with the Dma_Ip and Flexio_Mcl_Ip driver
+* sources on the register models of rtd/. Each eDMA request moves one frame word into the
+* shifter buffer, which the FlexIO model shifts into a model of the daisy chain; the latch pin
+* copies the chain to the outputs. Frames are redrawn while the previous one is being shifted
+* and each latched frame has to be the one presented, whole. The benchmark gives the CPU side:
+* the channel update and the frame tick with its swap and rearm.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "Dma_Ip.h"
+#include "Dma_Host.h"
+#include "Flexio_Host.h"
+#include "DmaPool.h"
+#include "FlexioTx.h"
+#include "ShiftOut.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define DMA_CH              (0U)
+#define SHIFTER             (2U)
+#define CLOCK_TIMER         (3U)
+#define GSCLK_TIMER         (4U)
+#define LATCH_PIN           (3U)
+#define SHIFT_DIV           (4U)
+#define GSCLK_DIV           (8U)
+#define FLEXIO_HZ           (48000000U)
+#define TLC_CHANNELS        (37U)           /* 444 bits, four pad bits */
+#define TLC_BITS            (12U)
+#define MAX_CHAIN_BITS      (TLC_CHANNELS * TLC_BITS)
+#define FRAMES              (24U)
+#define BENCH_FRAMES        (20000U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Siul2_Dio_Ip_GpioType latch_port;
+static uint8 latch_level;
+static uint32 latch_errors;
+
+/* The daisy chain: position 0 is the input of the device nearest to the MCU */
+static uint8 chain[MAX_CHAIN_BITS];
+static uint32 chain_bits;
+static uint16 latched[TLC_CHANNELS];
+static uint32 latches;
+static uint32 frame_irqs;
+static uint32 clean_bytes;
+
+static uint16 drawn[FRAMES + 2U][TLC_CHANNELS];
+static uint32 random_state = 0x13572468U;
+
+static Dma_Ip_HwChannelStateType ch_state[DMA_IP_NOF_CFG_LOGIC_CHANNELS];
+static Dma_Ip_HwChannelStateType *ch_state_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_state[0], &ch_state[1], &ch_state[2], &ch_state[3]
+};
+static const Dma_Ip_GlobalConfigType global_cfg = {
+    { FALSE, FALSE }, { FALSE }, { FALSE }, { 0U }, { 0U, 0U, FALSE, FALSE }
+};
+static const Dma_Ip_TransferConfigType transfer_cfg;
+
+#define CH_CFG(Ch) \
+    { { (Ch), DMA_IP_HARDWARE_VERSION_3, 0U, (Ch), NULL_PTR, NULL_PTR }, &global_cfg, &transfer_cfg, NULL_PTR }
+
+static const Dma_Ip_LogicChannelConfigType ch_cfg[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    CH_CFG(0U), CH_CFG(1U), CH_CFG(2U), CH_CFG(3U)
+};
+static const Dma_Ip_LogicChannelConfigType * const ch_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_CHANNELS] = {
+    &ch_cfg[0], &ch_cfg[1], &ch_cfg[2], &ch_cfg[3]
+};
+static const Dma_Ip_LogicInstanceConfigType inst_cfg = {
+    { 0U, DMA_IP_HARDWARE_VERSION_3, 0U }, FALSE, FALSE, TRUE, TRUE, FALSE
+};
+static const Dma_Ip_LogicInstanceConfigType * const inst_cfg_ptr[DMA_IP_NOF_CFG_LOGIC_INSTANCES] = {
+    &inst_cfg
+};
+static const Dma_Ip_InitType dma_init = {
+    ch_state_ptr, &ch_cfg[0], ch_cfg_ptr, &inst_cfg, inst_cfg_ptr
+};
+
+static const ShiftOut_ConfigType tlc5940 = {
+    0U, SHIFTER, CLOCK_TIMER, GSCLK_TIMER, 5U, 6U, 7U, TLC_BITS, TLC_CHANNELS,
+    SHIFT_DIV, GSCLK_DIV, &latch_port, LATCH_PIN, DMA_CH
+};
+
+/* Three 74HC595, GSCLK not used */
+static const ShiftOut_ConfigType hc595 = {
+    0U, SHIFTER, CLOCK_TIMER, SHIFTOUT_NO_TIMER, 5U, 6U, 0U, 8U, 3U,
+    SHIFT_DIV, 0U, &latch_port, LATCH_PIN, DMA_CH
+};
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnInvalidate, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)EnInvalidate;
+    (void)Addr;
+    clean_bytes += Length;
+}
+
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length)
+{
+    (void)CacheType;
+    (void)BusType;
+    (void)Addr;
+    (void)Length;
+}
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    (void)Channel;
+    (void)Command;
+}
+
+/**
+* @brief        Latch pin: the rising edge copies the chain to the outputs
+* @details      The value of a channel is the bits of its device, the first shifted being
+*               the furthest along the chain and the most significant.
+*/
+void Siul2_Dio_Ip_WritePin(Siul2_Dio_Ip_GpioType * const base, Siul2_Dio_Ip_PinsChannelType pin,
+                           Siul2_Dio_Ip_PinsLevelType value)
+{
+    const ShiftOut_ConfigType *cfg = (chain_bits == (TLC_CHANNELS * TLC_BITS)) ? &tlc5940 : &hc595;
+    uint32 c;
+    uint32 k;
+
+    latch_errors += ((base != &latch_port) || (pin != LATCH_PIN)) ? 1U : 0U;
+    if ((value == 1U) && (latch_level == 0U)) {
+        for (c = 0U; c < cfg->Channels; c++) {
+            latched[c] = 0U;
+            for (k = 0U; k < cfg->BitsPerChannel; k++) {
+                latched[c] |= (uint16)((uint32)chain[(c * cfg->BitsPerChannel) + k] << k);
+            }
+        }
+        latches++;
+    }
+    latch_level = value;
+}
+
+/**
+* @brief        xorshift32
+*/
+static uint32 Random(void)
+{
+    random_state ^= random_state << 13U;
+    random_state ^= random_state >> 17U;
+    random_state ^= random_state << 5U;
+
+    return random_state;
+}
+
+/**
+* @brief        Serve up to Words requests of the shifter, each shifting one word into the chain
+* @return       Words moved
+*/
+static uint32 Shift(uint32 Words)
+{
+    Dma_Ip_ChRegType *ch = &Dma_Host_Tcd.TCD_RSV[DMA_CH].tChTcdReg.tChReg;
+    uint8 bits[32];
+    uint32 n;
+    uint32 words = 0U;
+    uint32 i;
+
+    /* The interrupt clear of the rearm reads back as a raised flag in the model */
+    ch->reg_CH_INT = 0U;
+    while ((words < Words) && (Dma_Host_Request(DMA_CH) == TRUE)) {
+        n = Flexio_Host_ShiftWord(SHIFTER, bits);
+        CHECK(n == FLEXIOTX_WORD_BITS);
+        for (i = 0U; i < n; i++) {
+            (void)memmove(&chain[1], &chain[0], chain_bits - 1U);
+            chain[0] = bits[i];
+        }
+        words++;
+        if ((ch->reg_CH_INT & DMA_IP_TCD_CH_INT_INT_MASK) != 0U) {
+            ch->reg_CH_INT = 0U;
+            frame_irqs++;
+            ShiftOut_FrameIrq();
+        }
+    }
+
+    return words;
+}
+
+/**
+* @brief        Draw random values into the back buffer and keep them as frame Frame
+*/
+static void Draw(const ShiftOut_ConfigType *Cfg, uint32 Frame)
+{
+    uint16 c;
+
+    for (c = 0U; c < Cfg->Channels; c++) {
+        drawn[Frame][c] = (uint16)(Random() & ((1U << Cfg->BitsPerChannel) - 1U));
+        ShiftOut_SetChannel(c, drawn[Frame][c]);
+    }
+}
+
+/**
+* @brief        Register setup of the shifter, the clocks and the latch
+*/
+static void ConfigTest(void)
+{
+    ShiftOut_ConfigType cfg = tlc5940;
+    void *hog[DMAPOOL_SRAM_SIZE / 32U];
+    uint32 hogs = 0U;
+    uint32 i;
+
+    Flexio_Host_Reset();
+    latch_level = 1U;
+    CHECK(ShiftOut_Init(&tlc5940) == (Std_ReturnType)E_OK);
+    CHECK((Flexio_Host_Regs.CTRL & FLEXIO_CTRL_FLEXEN_MASK) != 0U);
+    CHECK(Flexio_Host_Regs.TIMCMP[CLOCK_TIMER] == ((63U << 8U) | ((SHIFT_DIV / 2U) - 1U)));
+    CHECK(Flexio_Host_Regs.TIMCTL[CLOCK_TIMER] ==
+          (FLEXIO_TIMCTL_TRGSEL(FLEXIOTX_SHIFTER_TRIGGER(SHIFTER)) | FLEXIO_TIMCTL_TRGPOL(1U) |
+           FLEXIO_TIMCTL_TRGSRC(1U) | FLEXIO_TIMCTL_PINCFG(3U) | FLEXIO_TIMCTL_PINSEL(6U) |
+           FLEXIO_TIMCTL_TIMOD(1U)));
+    CHECK(Flexio_Host_Regs.SHIFTCTL[SHIFTER] ==
+          (FLEXIO_SHIFTCTL_TIMSEL(CLOCK_TIMER) | FLEXIO_SHIFTCTL_TIMPOL(1U) | FLEXIO_SHIFTCTL_PINCFG(3U) |
+           FLEXIO_SHIFTCTL_PINSEL(5U) | FLEXIO_SHIFTCTL_SMOD(2U)));
+    CHECK(Flexio_Host_Regs.SHIFTSDEN == (1U << SHIFTER));
+    CHECK(Flexio_Host_Regs.TIMCMP[GSCLK_TIMER] == ((((GSCLK_DIV / 2U) - 1U) << 8U) | ((GSCLK_DIV / 2U) - 1U)));
+    CHECK((Flexio_Host_Regs.TIMCTL[GSCLK_TIMER] & FLEXIO_TIMCTL_TIMOD_MASK) == (uint32)FLEXIO_TIMER_MODE_8BIT_PWM);
+    CHECK((latch_level == 0U) && (latch_errors == 0U));
+
+    /* Limits of the configuration */
+    cfg.BitsPerChannel = 17U;
+    CHECK(ShiftOut_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    cfg.BitsPerChannel = 16U;
+    cfg.Channels = (uint16)(((SHIFTOUT_MAX_WORDS * 32U) / 16U) + 1U);
+    CHECK(ShiftOut_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    cfg.Channels = (uint16)((SHIFTOUT_MAX_WORDS * 32U) / 16U);
+    CHECK(ShiftOut_Init(&cfg) == (Std_ReturnType)E_OK);
+    cfg = tlc5940;
+    cfg.ShiftClockDiv = 5U;
+    CHECK(ShiftOut_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    cfg.ShiftClockDiv = SHIFT_DIV;
+    cfg.GsclkDiv = 514U;
+    CHECK(ShiftOut_Init(&cfg) == (Std_ReturnType)E_NOT_OK);
+    cfg.GsclkTimer = SHIFTOUT_NO_TIMER;
+    CHECK(ShiftOut_Init(&cfg) == (Std_ReturnType)E_OK);
+
+    /* The pool full but for the buffers of a short chain: a re-init of the same size takes
+       them back, a longer chain no longer fits */
+    CHECK(ShiftOut_Init(&hc595) == (Std_ReturnType)E_OK);
+    while ((hogs < (DMAPOOL_SRAM_SIZE / 32U)) && ((hog[hogs] = DmaPool_Alloc(32U, DMAPOOL_REGION_SRAM)) != NULL_PTR)) {
+        hogs++;
+    }
+    CHECK(ShiftOut_Init(&tlc5940) == (Std_ReturnType)E_NOT_OK);
+    CHECK(ShiftOut_Init(&hc595) == (Std_ReturnType)E_OK);
+    for (i = 0U; i < hogs; i++) {
+        DmaPool_Free(hog[i]);
+    }
+}
+
+/**
+* @brief        Frames drawn while the previous one shifts, each latched whole
+*/
+static void FrameTest(const ShiftOut_ConfigType *Cfg)
+{
+    ShiftOut_StatsType stats;
+    uint32 words = ((uint32)Cfg->Channels * Cfg->BitsPerChannel + 31U) / 32U;
+    uint32 torn = 0U;
+    uint32 f;
+    uint32 c;
+
+    Flexio_Host_Reset();
+    chain_bits = (uint32)Cfg->Channels * Cfg->BitsPerChannel;
+    (void)memset(chain, 0, sizeof(chain));
+    latches = 0U;
+    frame_irqs = 0U;
+    CHECK(ShiftOut_Init(Cfg) == (Std_ReturnType)E_OK);
+
+    /* Nothing presented: the tick neither shifts nor latches */
+    ShiftOut_FrameTick();
+    CHECK(Shift(words) == 0U);
+    ShiftOut_FrameTick();
+    CHECK(latches == 0U);
+
+    Draw(Cfg, 1U);
+    clean_bytes = 0U;
+    ShiftOut_Present();
+    CHECK(clean_bytes >= (words * 4U));
+    for (f = 1U; f <= FRAMES; f++) {
+        ShiftOut_FrameTick();
+        CHECK(ShiftOut_IsPresentPending() == FALSE);
+        if (f > 1U) {
+            CHECK(latches == (f - 1U));
+            torn += (memcmp(latched, drawn[f - 1U], Cfg->Channels * sizeof(uint16)) != 0) ? 1U : 0U;
+        }
+
+        /* Half of the frame out, then the next one drawn over the old back buffer */
+        CHECK(Shift(words / 2U) == (words / 2U));
+        Draw(Cfg, f + 1U);
+        ShiftOut_Present();
+        /* A tick while the frame shifts changes nothing */
+        ShiftOut_FrameTick();
+        CHECK(ShiftOut_IsPresentPending() == TRUE);
+        CHECK(Shift(words) == (words - (words / 2U)));
+        CHECK(frame_irqs == f);
+    }
+    ShiftOut_FrameTick();
+    torn += (memcmp(latched, drawn[FRAMES], Cfg->Channels * sizeof(uint16)) != 0) ? 1U : 0U;
+    printf("frames: %u channels x %u bits in %u words, %u latched, %u torn\n",
+           Cfg->Channels, Cfg->BitsPerChannel, words, latches, torn);
+    CHECK(latches == FRAMES);
+    CHECK(torn == 0U);
+    CHECK(latch_errors == 0U);
+
+    /* The last present shifts on that tick and latches on the next */
+    CHECK(Shift(words) == words);
+    ShiftOut_FrameTick();
+    CHECK(memcmp(latched, drawn[FRAMES + 1U], Cfg->Channels * sizeof(uint16)) == 0);
+    for (c = 0U; c < 3U; c++) {
+        ShiftOut_FrameTick();
+    }
+    CHECK(latches == (FRAMES + 1U));
+
+    ShiftOut_GetStatistics(FLEXIO_HZ, &stats);
+    CHECK(stats.Frames == (FRAMES + 1U));
+    CHECK(stats.Latches == (FRAMES + 1U));
+    CHECK(stats.BitsPerFrame == (words * 32U));
+    CHECK(stats.MaxFrameMilliHz == (uint32)(((uint64)FLEXIO_HZ * 1000U) / (SHIFT_DIV * words * 32U)));
+}
+
+/**
+* @brief        CPU side: every channel of a frame, and the frame tick with swap and rearm
+*/
+static void Benchmark(void)
+{
+    double t0;
+    double draw = 0.0;
+    double tick = 0.0;
+    uint32 i;
+    uint16 c;
+
+    CHECK(ShiftOut_Init(&tlc5940) == (Std_ReturnType)E_OK);
+    for (i = 0U; i < BENCH_FRAMES; i++) {
+        t0 = host_test_ns();
+        for (c = 0U; c < TLC_CHANNELS; c++) {
+            ShiftOut_SetChannel(c, (uint16)(i + c));
+        }
+        ShiftOut_Present();
+        draw += host_test_ns() - t0;
+        ShiftOut_FrameIrq();
+        t0 = host_test_ns();
+        ShiftOut_FrameTick();
+        tick += host_test_ns() - t0;
+    }
+    printf("SetChannel: %.1f ns per channel, frame tick with latch, swap and rearm: %.1f ns\n",
+           draw / ((double)BENCH_FRAMES * TLC_CHANNELS), tick / BENCH_FRAMES);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    uint32 ch;
+
+    Dma_Host_Reset();
+    CHECK(Dma_Ip_Init(&dma_init) == DMA_IP_STATUS_SUCCESS);
+    for (ch = 0U; ch < DMA_IP_NOF_CFG_LOGIC_CHANNELS; ch++) {
+        /* The clear-error write of the init sets ERR in RAM, the target reads it back as 0 */
+        Dma_Host_Tcd.TCD_RSV[ch].tChTcdReg.tChReg.reg_CH_ES = 0U;
+    }
+    DmaPool_Init();
+
+    ConfigTest();
+    FrameTest(&tlc5940);
+    FrameTest(&hc595);
+    Benchmark();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,319 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of the timer wheel with a pool of 10240 timers on the simulated OsIf counter, one
+* counter tick per wheel tick. Random starts, cancels and reschedules run against a reference
+* list of expected expiry ticks, so every callback is checked to come on its own tick, with
+* delays from one tick to past the top level of the wheel. The benchmark times starts and
+* expiries at 10k timers and the tick cost with growing numbers of parked timers.
+*/
+
+#include "host_test.h"
+#include "OsIf.h"
+#include "TimerWheel.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define POOL                (TIMERWHEEL_MAX_TIMERS)
+#define RANDOM_TICKS        (200000U)
+#define BENCH_TIMERS        (10000U)
+#define BENCH_TICKS         (65536U)
+#define PARKED_DELAY        (1UL << 24U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* Reference of one timer, as many as the pool holds */
+typedef struct {
+    TimerWheel_TimerType handle;
+    uint32 expires;         /* Expected wheel tick of the next callback */
+    uint32 period;
+    boolean running;
+} Model_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static Model_t model[POOL];
+static uint32 now;                  /* Wheel tick the test has advanced to */
+static uint32 random_state = 0x1234567U;
+static uint32 late;                 /* Callbacks not on their expected tick */
+static uint32 unexpected;           /* Callbacks of timers the model has not running */
+static uint32 callbacks;
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        xorshift32
+*/
+static uint32 Random(void)
+{
+    random_state ^= random_state << 13U;
+    random_state ^= random_state >> 17U;
+    random_state ^= random_state << 5U;
+
+    return random_state;
+}
+
+/**
+* @brief        Delay with a spread over every level of the wheel
+*/
+static uint32 RandomDelay(void)
+{
+    uint32 kind = Random() % 100U;
+    uint32 delay;
+
+    if (kind < 50U) {
+        delay = 1U + (Random() % 64U);
+    } else if (kind < 80U) {
+        delay = 1U + (Random() % 4096U);
+    } else if (kind < 98U) {
+        delay = 1U + (Random() % 262144U);
+    } else {
+        delay = 1U + (Random() % 16777216U);
+    }
+
+    return delay;
+}
+
+/**
+* @brief        Expiry callback: check the tick against the model and re-arm it there
+*/
+static void Expired(void *context)
+{
+    Model_t *m = (Model_t *)context;
+
+    callbacks++;
+    if (!m->running) {
+        unexpected++;
+    } else {
+        late += (m->expires != now) ? 1U : 0U;
+        if (m->period != 0U) {
+            m->expires = now + m->period;
+        } else {
+            m->running = FALSE;
+        }
+    }
+}
+
+/**
+* @brief        Callback for the benchmark
+*/
+static void Count(void *context)
+{
+    (void)context;
+    callbacks++;
+}
+
+/**
+* @brief        Advance the counter and the wheel tick by tick
+*/
+static void Tick(uint32 ticks)
+{
+    uint32 i;
+
+    for (i = 0U; i < ticks; i++) {
+        OsIf_Host_Advance(1U);
+        now++;
+        (void)TimerWheel_Process();
+    }
+}
+
+/**
+* @brief        Random operations against the reference
+*/
+static void RandomTest(void)
+{
+    TimerWheel_TimerType handle;
+    TimerWheel_StatsType stats;
+    Model_t *m;
+    uint32 delay;
+    uint32 period;
+    uint32 i;
+    uint32 op;
+    uint32 pick;
+    uint32 refused = 0U;
+    uint32 wrong_status = 0U;
+    uint32 starts = 0U;
+
+    TimerWheel_Init(1U);
+    now = 0U;
+
+    for (i = 0U; i < RANDOM_TICKS; i++) {
+        op = Random() % 100U;
+        pick = Random() % POOL;
+        m = &model[pick];
+
+        if (op < 40U) {
+            if (!m->running) {
+                delay = RandomDelay();
+                period = ((Random() % 4U) == 0U) ? RandomDelay() : 0U;
+                handle = TimerWheel_Start(delay, period, Expired, m);
+                if (handle == TIMERWHEEL_NO_TIMER) {
+                    refused++;
+                } else {
+                    m->handle = handle;
+                    m->expires = now + delay;
+                    m->period = period;
+                    m->running = TRUE;
+                    starts++;
+                }
+            }
+        } else if (op < 55U) {
+            if (m->running) {
+                wrong_status += (TimerWheel_Cancel(m->handle) != (Std_ReturnType)E_OK) ? 1U : 0U;
+                m->running = FALSE;
+                /* The handle is stale from now on */
+                wrong_status += (TimerWheel_Cancel(m->handle) != (Std_ReturnType)E_NOT_OK) ? 1U : 0U;
+            }
+        } else if (op < 70U) {
+            if (m->running) {
+                delay = RandomDelay();
+                wrong_status += (TimerWheel_Reschedule(m->handle, delay) != (Std_ReturnType)E_OK) ? 1U : 0U;
+                m->expires = now + delay;
+            }
+        } else {
+            /* Time passes */
+        }
+        Tick(1U + (Random() % 4U));
+    }
+
+    TimerWheel_GetStatistics(&stats);
+    printf("random: %u starts, %u callbacks, %u refused, late %u, unexpected %u, wrong status %u, "
+           "peak %u, most timers on one tick %u\n",
+           starts, callbacks, refused, late, unexpected, wrong_status, stats.PeakInUse, stats.MaxSlotScan);
+    CHECK(callbacks > 10000U);
+    CHECK(late == 0U);
+    CHECK(unexpected == 0U);
+    CHECK(wrong_status == 0U);
+    CHECK(refused == 0U);
+}
+
+/**
+* @brief        Stale handles, delays beyond the wheel and the tick length
+*/
+static void HandleTest(void)
+{
+    TimerWheel_TimerType a;
+    TimerWheel_TimerType b;
+    TimerWheel_StatsType stats;
+    Model_t *m;
+
+    TimerWheel_Init(1U);
+    now = 0U;
+    callbacks = 0U;
+    late = 0U;
+
+    /* The entry of a cancelled timer is reused at once: the old handle no longer reaches it */
+    a = TimerWheel_Start(10U, 0U, Count, NULL_PTR);
+    CHECK(TimerWheel_Cancel(a) == (Std_ReturnType)E_OK);
+    b = TimerWheel_Start(10U, 0U, Count, NULL_PTR);
+    CHECK((a % POOL) == (b % POOL));
+    CHECK(a != b);
+    CHECK(TimerWheel_Cancel(a) == (Std_ReturnType)E_NOT_OK);
+    CHECK(TimerWheel_Reschedule(a, 5U) == (Std_ReturnType)E_NOT_OK);
+    CHECK(TimerWheel_Cancel(TIMERWHEEL_NO_TIMER) == (Std_ReturnType)E_NOT_OK);
+
+    /* Same after expiry */
+    Tick(10U);
+    CHECK(callbacks == 1U);
+    CHECK(TimerWheel_Cancel(b) == (Std_ReturnType)E_NOT_OK);
+
+    /* One tick past the top level of the wheel */
+    m = &model[0U];
+    m->expires = now + (1UL << (TIMERWHEEL_SLOT_BITS * TIMERWHEEL_LEVELS)) + 1U;
+    m->period = 0U;
+    m->running = TRUE;
+    (void)TimerWheel_Start(m->expires - now, 0U, Expired, m);
+    OsIf_Host_Advance(m->expires - now - 1U);
+    now = m->expires - 1U;
+    (void)TimerWheel_Process();
+    CHECK(m->running);
+    Tick(1U);
+    CHECK(!m->running);
+    CHECK(late == 0U);
+    TimerWheel_GetStatistics(&stats);
+    CHECK(stats.InUse == 0U);
+
+    /* Wheel ticks of several counter ticks, the residual carries over */
+    TimerWheel_Init(3U);
+    callbacks = 0U;
+    (void)TimerWheel_Start(2U, 0U, Count, NULL_PTR);
+    OsIf_Host_Advance(5U);
+    CHECK(TimerWheel_Process() == 0U);
+    OsIf_Host_Advance(1U);
+    CHECK(TimerWheel_Process() == 1U);
+}
+
+/**
+* @brief        Start and expiry cost at 10k timers, tick cost against parked timers
+*/
+static void Benchmark(void)
+{
+    static const uint32 parked[4] = { 0U, 100U, 1000U, BENCH_TIMERS };
+    TimerWheel_StatsType stats;
+    double t0;
+    double t1;
+    double t2;
+    uint32 i;
+    uint32 n;
+
+    /* 10k timers due within 4096 ticks, then run them all out */
+    TimerWheel_Init(1U);
+    callbacks = 0U;
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_TIMERS; i++) {
+        (void)TimerWheel_Start(1U + (Random() % 4096U), 0U, Count, NULL_PTR);
+    }
+    t1 = host_test_ns();
+    OsIf_Host_Advance(4096U);
+    (void)TimerWheel_Process();
+    t2 = host_test_ns();
+    CHECK(callbacks == BENCH_TIMERS);
+    printf("10k timers: start %.1f ns each, expire %.1f ns each including the tick walk\n",
+           (t1 - t0) / BENCH_TIMERS, (t2 - t1) / BENCH_TIMERS);
+
+    /* Tick cost does not grow with the timers running */
+    for (n = 0U; n < 4U; n++) {
+        TimerWheel_Init(1U);
+        for (i = 0U; i < parked[n]; i++) {
+            (void)TimerWheel_Start(PARKED_DELAY + (Random() % PARKED_DELAY), 0U, Count, NULL_PTR);
+        }
+        t0 = host_test_ns();
+        OsIf_Host_Advance(BENCH_TICKS);
+        (void)TimerWheel_Process();
+        t1 = host_test_ns();
+        TimerWheel_GetStatistics(&stats);
+        printf("%5u timers parked: %.2f ns per tick over %u ticks, most timers on one tick %u\n",
+               parked[n], (t1 - t0) / BENCH_TICKS, BENCH_TICKS, stats.MaxSlotScan);
+        CHECK(stats.MaxSlotScan <= ((parked[n] / 64U) + 64U));
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    RandomTest();
+    HandleTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
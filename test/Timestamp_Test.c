@@ -0,0 +1,353 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host test of Timestamp and the OsIf custom timer on its host backend, where CLOCK_MONOTONIC
+* scaled to the core clock frequency stands in for DWT_CYCCNT. Core clocks of several GHz make
+* the 32-bit counter cross a half period every few hundred milliseconds, so the software
+* extension is raced by reader threads while another thread keeps switching the clock. Every
+* reader checks its stamps never go backwards, also against the newest stamp any thread has
+* seen, and nanosecond conversions are compared with CLOCK_MONOTONIC across the switches. A
+* reader the host deschedules for longer than the kept epochs is left out of the conversion check.
+* A second Timestamp_Init has to leave the counter counting.
+*/
+
+#include <pthread.h>
+#include "host_test.h"
+#include "Timestamp.h"
+#include "Clock_Ip.h"
+#include "OsIf_Timer_Custom.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define SLOW_HZ             (1000000000U)
+#define MID_HZ              (4000000000U)
+#define RACE_SLOW_HZ        (3000000000U)
+#define RACE_FAST_HZ        (4000000000U)       /* Half counter period 537 ms */
+
+#define READERS             (4U)
+#define RACE_NS             (3000000000.0)
+#define SWITCH_NS           (1000000.0)
+#define TOLERANCE_NS        (2000000.0)         /* Switch windows plus scheduling noise */
+
+#define BENCH_CALLS         (1000000U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* Result of one reader thread */
+typedef struct {
+    uint32 stamps;
+    uint32 backwards;       /* Below the thread's previous stamp */
+    uint32 stale;           /* Below the newest stamp published before the read */
+    uint32 ns_backwards;    /* Converted time earlier than the previous one beyond the tolerance */
+    uint32 aged;            /* Stamps converted more than TIMESTAMP_CLOCK_EPOCHS - 2 switches later */
+    uint32 half_periods;    /* Counter bit 31 changes seen */
+} Reader_t;
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+static volatile uint32 core_hz;
+static volatile uint32 race_done;
+static volatile uint32 switches;
+static volatile uint64 newest_stamp;
+static Reader_t readers[READERS];
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+
+/**
+* @brief        Clock_Ip stand-in: the core clock the test has switched to
+*/
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName)
+{
+    (void)ClockName;
+
+    return core_hz;
+}
+
+/**
+* @brief        Busy wait, the counter keeps running in the meantime
+*/
+static void Spin(double ns)
+{
+    double end = host_test_ns() + ns;
+
+    while (host_test_ns() < end) {
+        Timestamp_Poll();
+    }
+}
+
+/**
+* @brief        Switch the simulated core clock and tell Timestamp, as ClockGov does
+*/
+static void SwitchClock(uint32 hz)
+{
+    core_hz = hz;
+    Timestamp_UpdateFrequency();
+}
+
+/**
+* @brief        Stamp continuously and check the stamps against each other
+*/
+static void *Reader(void *arg)
+{
+    Reader_t *r = (Reader_t *)arg;
+    uint64 prev = 0U;
+    uint64 prev_ns = 0U;
+    uint64 newest;
+    uint64 stamp;
+    uint64 ns;
+    uint32 seq;
+
+    while (race_done == 0U) {
+        newest = __atomic_load_n(&newest_stamp, __ATOMIC_ACQUIRE);
+        seq = __atomic_load_n(&switches, __ATOMIC_ACQUIRE);
+        stamp = Timestamp_Get();
+        ns = Timestamp_ToNs(stamp);
+
+        r->stamps++;
+        r->backwards += (stamp < prev) ? 1U : 0U;
+        r->stale += (stamp < newest) ? 1U : 0U;
+        /* A reader descheduled between the two calls may convert a stamp whose epoch is gone,
+           which Timestamp_ToNs only does approximately: leave those out of the comparison */
+        if ((__atomic_load_n(&switches, __ATOMIC_ACQUIRE) - seq) > (TIMESTAMP_CLOCK_EPOCHS - 2U)) {
+            r->aged++;
+            ns = prev_ns;
+        }
+        r->ns_backwards += ((double)ns + TOLERANCE_NS < (double)prev_ns) ? 1U : 0U;
+        r->half_periods += (((stamp ^ prev) >> 31U) != 0U) ? 1U : 0U;
+
+        while ((newest < stamp) &&
+               !__atomic_compare_exchange_n(&newest_stamp, &newest, stamp, 0,
+                                            __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+        }
+        prev = stamp;
+        prev_ns = ns;
+    }
+
+    return NULL;
+}
+
+/**
+* @brief        Conversions across clock switches against CLOCK_MONOTONIC
+*/
+static void EpochTest(void)
+{
+    static const uint32 rates[3] = { MID_HZ, MID_HZ, SLOW_HZ };
+    Timestamp_CyclesType stamps[TIMESTAMP_CLOCK_EPOCHS];
+    uint64 stamp_ns[TIMESTAMP_CLOCK_EPOCHS];
+    double start;
+    double ns_err;
+    double naive_err;
+    double real;
+    uint32 i;
+    uint32 j;
+    boolean kept = TRUE;
+
+    core_hz = SLOW_HZ;
+    start = host_test_ns();
+    Timestamp_Init();
+
+    for (i = 0U; i < 30U; i++) {
+        Spin(2000000.0);
+        stamps[i % TIMESTAMP_CLOCK_EPOCHS] = Timestamp_Get();
+        stamp_ns[i % TIMESTAMP_CLOCK_EPOCHS] = Timestamp_ToNs(stamps[i % TIMESTAMP_CLOCK_EPOCHS]);
+        SwitchClock(rates[i % 3U]);
+
+        /* Stamps from the kept epochs convert as they did before the switches */
+        for (j = 0U; (j < (TIMESTAMP_CLOCK_EPOCHS - 2U)) && (j <= i); j++) {
+            kept = kept && (Timestamp_ToNs(stamps[(i - j) % TIMESTAMP_CLOCK_EPOCHS]) ==
+                            stamp_ns[(i - j) % TIMESTAMP_CLOCK_EPOCHS]);
+        }
+    }
+    Spin(2000000.0);
+
+    real = host_test_ns() - start;
+    ns_err = (double)Timestamp_GetNs() - real;
+    naive_err = (double)Timestamp_CyclesToNs(Timestamp_Get()) - real;
+    printf("30 switches over %.1f ms: per-epoch error %.1f us, single-factor error %.1f us\n",
+           real / 1e6, ns_err / 1e3, naive_err / 1e3);
+    CHECK(kept);
+    CHECK((ns_err < TOLERANCE_NS) && (ns_err > -TOLERANCE_NS));
+    CHECK((naive_err > (10.0 * TOLERANCE_NS)) || (naive_err < (-10.0 * TOLERANCE_NS)));
+    CHECK(Timestamp_GetFrequency() == rates[29U % 3U]);
+
+    /* Same frequency again: no new epoch, conversions unchanged */
+    i = (uint32)Timestamp_ToNs(stamps[29U % TIMESTAMP_CLOCK_EPOCHS]);
+    SwitchClock(rates[29U % 3U]);
+    CHECK((uint32)Timestamp_ToNs(stamps[29U % TIMESTAMP_CLOCK_EPOCHS]) == i);
+}
+
+/**
+* @brief        A second Timestamp_Init leaves the counter running for whoever measures with it
+*/
+static void InitTest(void)
+{
+    uint32 before;
+    uint32 after;
+
+    core_hz = SLOW_HZ;
+    Timestamp_Init();
+    Spin(1000000.0);
+    before = (uint32)Timestamp_Get();
+    Timestamp_Init();
+    after = (uint32)Timestamp_Get();
+
+    /* Counted on from before, the nanoseconds from the new init */
+    CHECK((after - before) < (SLOW_HZ / 1000U));
+    CHECK(after != 0U);
+    CHECK(Timestamp_GetNs() < 1000000U);
+}
+
+/**
+* @brief        Readers against a switcher while the counter wraps
+*/
+static void RaceTest(void)
+{
+    pthread_t threads[READERS];
+    Reader_t total = { 0U, 0U, 0U, 0U, 0U, 0U };
+    double start;
+    double end;
+    double err;
+    uint32 i;
+
+    core_hz = RACE_FAST_HZ;
+    start = host_test_ns();
+    Timestamp_Init();
+    newest_stamp = 0U;
+    race_done = 0U;
+    switches = 0U;
+
+    for (i = 0U; i < READERS; i++) {
+        (void)pthread_create(&threads[i], NULL, Reader, &readers[i]);
+    }
+    end = start + RACE_NS;
+    while (host_test_ns() < end) {
+        Spin(SWITCH_NS);
+        SwitchClock(((switches & 1U) == 0U) ? RACE_SLOW_HZ : RACE_FAST_HZ);
+        __atomic_store_n(&switches, switches + 1U, __ATOMIC_RELEASE);
+    }
+    race_done = 1U;
+    for (i = 0U; i < READERS; i++) {
+        (void)pthread_join(threads[i], NULL);
+        total.stamps += readers[i].stamps;
+        total.backwards += readers[i].backwards;
+        total.stale += readers[i].stale;
+        total.ns_backwards += readers[i].ns_backwards;
+        total.aged += readers[i].aged;
+        total.half_periods = (readers[i].half_periods > total.half_periods) ? readers[i].half_periods : total.half_periods;
+    }
+    err = (double)Timestamp_GetNs() - (host_test_ns() - start);
+
+    printf("race: %u readers, %u stamps, %u clock switches, %u half periods, "
+           "backwards %u, stale %u, ns backwards %u (%u aged), final error %.1f us\n",
+           READERS, total.stamps, switches, total.half_periods,
+           total.backwards, total.stale, total.ns_backwards, total.aged, err / 1e3);
+    CHECK(total.half_periods >= 3U);
+    CHECK(total.backwards == 0U);
+    CHECK(total.stale == 0U);
+    CHECK(total.ns_backwards == 0U);
+    CHECK(total.aged < (total.stamps / 1000U));
+    CHECK((err < TOLERANCE_NS) && (err > -TOLERANCE_NS));
+}
+
+/**
+* @brief        OsIf custom timer on the cycle counter
+*/
+static void OsIfTest(void)
+{
+    Timestamp_CyclesType start;
+    Timestamp_CyclesType end;
+    uint64 sum = 0U;
+    uint32 ref;
+    boolean wrapped = FALSE;
+
+    core_hz = RACE_FAST_HZ;
+    OsIf_Timer_Custom_Init();
+    CHECK(OsIf_Timer_Custom_MicrosToTicks(1000U) == 4000000U);
+
+    /* Elapsed ticks add up across a counter wrap */
+    start = Timestamp_Get();
+    ref = (uint32)start;
+    while (!wrapped) {
+        sum += OsIf_Timer_Custom_GetElapsed(&ref);
+        wrapped = (ref < (uint32)start);
+    }
+    end = Timestamp_Get();
+    CHECK((uint32)(start + sum) == ref);
+    CHECK((end >= (start + sum)) && ((end - (start + sum)) < (RACE_FAST_HZ / 1000U)));
+
+    OsIf_Timer_Custom_SetTimerFrequency(SLOW_HZ);
+    CHECK(Timestamp_GetFrequency() == SLOW_HZ);
+    CHECK(OsIf_Timer_Custom_MicrosToTicks(1000U) == 1000000U);
+}
+
+/**
+* @brief        Cost of the read and conversion paths
+*/
+static void Benchmark(void)
+{
+    Timestamp_CyclesType stamp = 0U;
+    Timestamp_CyclesType old;
+    uint64 ns = 0U;
+    double t0;
+    double t1;
+    double t2;
+    double t3;
+    uint32 i;
+
+    core_hz = SLOW_HZ;
+    Timestamp_Init();
+    old = Timestamp_Get();
+    for (i = 0U; i < (TIMESTAMP_CLOCK_EPOCHS - 2U); i++) {
+        SwitchClock(((i & 1U) == 0U) ? MID_HZ : SLOW_HZ);
+    }
+
+    t0 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        stamp += Timestamp_Get();
+    }
+    t1 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        ns += Timestamp_ToNs(stamp + i);
+    }
+    t2 = host_test_ns();
+    for (i = 0U; i < BENCH_CALLS; i++) {
+        ns += Timestamp_ToNs(old + (i & 0xFFU));
+    }
+    t3 = host_test_ns();
+
+    printf("Timestamp_Get %.1f ns, ToNs current epoch %.1f ns, ToNs %u epochs back %.1f ns (%llu)\n",
+           (t1 - t0) / BENCH_CALLS, (t2 - t1) / BENCH_CALLS, TIMESTAMP_CLOCK_EPOCHS - 2U,
+           (t3 - t2) / BENCH_CALLS, (unsigned long long)((stamp + ns) & 1U));
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+int main(void)
+{
+    EpochTest();
+    InitTest();
+    RaceTest();
+    OsIfTest();
+    Benchmark();
+
+    return HOST_TEST_RESULT();
+}
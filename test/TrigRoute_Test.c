@@ -0,0 +1,386 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+/*
+* Host validation of TrigRoute on the real Trgmux_Ip driver and a simulated TRGMUX register map
+* in rtd/. Applies a PWM-synchronous sampling pipeline and checks every selection and lock in the
+* map, checks that rejected graphs leave the map untouched, that a locked output is reported with
+* its edge, and compares loop detection with a reachability reference on random graphs.
+*/
+
+#include <string.h>
+#include "host_test.h"
+#include "Trgmux_Ip.h"
+#include "TrigRoute.h"
+#include "SchM_Host.h"
+
+/*==================================================================================================
+*                                       Local macro definitions
+==================================================================================================*/
+#define LOGIC_TRIGGERS      TRGMUX_IP_NOF_CFG_LOGIC_TRIGGERS
+#define MCL_EA_SET_INPUT    (20U)
+#define MAX_DMA_LOG         (8U)
+#define MAX_LCU_INPUTS      (16U)
+#define RANDOM_GRAPHS       (20000U)
+
+/* Signals of the sampling pipeline */
+#define SIG_EMIOS_FLAG      (0U)        /* eMIOS channel flag at the PWM centre */
+#define SIG_BCTU_TRIG       (1U)        /* TRGMUX output to the BCTU conversion trigger */
+#define SIG_LCU_IN          (2U)        /* TRGMUX output to the LCU input */
+#define SIG_LCU_OUT         (3U)        /* Gated LCU output */
+#define SIG_DMA_TRIG        (4U)        /* TRGMUX output to the DMAMUX */
+#define SIG_DMA_CH          (5U)        /* DMA channel copying the results */
+#define SIG_COUNT           (6U)
+
+#define IN_EMIOS0_CH0       (0x2CU)     /* TRGMUX input numbers of the pipeline sources */
+#define IN_LCU0_OUT0        (0x31U)
+
+/*==================================================================================================
+*                                      Local variables
+==================================================================================================*/
+/* Logic triggers spread over several TRGMUXn registers and selection fields */
+static const Trgmux_Ip_LogicTriggerType trigger[LOGIC_TRIGGERS] = {
+    { 0U, 0U, 0U, 0U, FALSE },
+    { 1U, 1U, 0U, 0U, FALSE },
+    { 2U, 5U, 0U, 0U, FALSE },
+    { 3U, 9U, 0U, 0U, FALSE },
+    { 4U, 14U, 0U, 0U, FALSE },
+    { 5U, 15U, 0U, 0U, FALSE },
+    { 6U, 40U, 0U, 0U, FALSE },
+    { 7U, 63U, 0U, 0U, FALSE },
+};
+
+static const Trgmux_Ip_InitType trgmux_init = {
+    { &trigger[0], &trigger[1], &trigger[2], &trigger[3],
+      &trigger[4], &trigger[5], &trigger[6], &trigger[7] }
+};
+
+/* DMA requests and LCU selections seen by the Mcl stand-ins, with the TRGMUX writes done by then */
+static uint32 dma_log[MAX_DMA_LOG];
+static uint32 dma_count;
+static uint8 lcu_mux[MAX_LCU_INPUTS];
+static uint32 lcu_calls;
+static uint32 trgmux_writes_before_consumers;
+
+static uint32 rng_state = 0x9E3779B9U;
+
+/*==================================================================================================
+*                                      Global variables
+==================================================================================================*/
+TRGMUX_Type Trgmux_Host_Regs;
+const uint8 Trgmux_Ip_InstanceArr[TRGMUX_IP_NOF_INSTANCE] = { 0U };
+
+/*==================================================================================================
+*                                       Local functions
+==================================================================================================*/
+static uint32 Random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+/* Selection of a TRGMUX output as read back from the register map */
+static uint32 Selection(uint32 Output)
+{
+    return (Trgmux_Host_Regs.TRGMUXn[Output / 4U] >> ((Output % 4U) * 8U)) & TRGMUX_TRGMUXn_SEL0_MASK;
+}
+
+static boolean Locked(uint32 Output)
+{
+    return ((Trgmux_Host_Regs.TRGMUXn[Output / 4U] & TRGMUX_TRGMUXn_LK_MASK) != 0U) ? TRUE : FALSE;
+}
+
+static void ResetMap(void)
+{
+    (void)memset(&Trgmux_Host_Regs, 0, sizeof(Trgmux_Host_Regs));
+    (void)memset(lcu_mux, 0, sizeof(lcu_mux));
+    dma_count = 0U;
+    lcu_calls = 0U;
+    trgmux_writes_before_consumers = 0U;
+    CHECK(Trgmux_Ip_Init(&trgmux_init) == TRGMUX_IP_STATUS_SUCCESS);
+}
+
+/* Check that every TRGMUX edge of a graph is routed and locked as requested */
+static void CheckMap(const TrigRoute_GraphType *Graph)
+{
+    const TrigRoute_EdgeType *edge;
+    uint32 i;
+
+    for (i = 0U; i < Graph->NumEdges; i++) {
+        edge = &Graph->Edges[i];
+        if (edge->Kind == TRIGROUTE_EDGE_TRGMUX) {
+            CHECK(Selection(trigger[edge->Target].Output) == edge->Value);
+            CHECK(Locked(trigger[edge->Target].Output) == edge->Lock);
+        } else if (edge->Kind == TRIGROUTE_EDGE_LCU_INPUT) {
+            CHECK(lcu_mux[edge->Target] == (uint8)edge->Value);
+        } else {
+            /* DMA requests are checked from the log */
+        }
+    }
+}
+
+/* PWM-synchronous sampling: the eMIOS flag starts the BCTU and, gated by the LCU, a DMA copy */
+static const TrigRoute_EdgeType pipeline_edges[] = {
+    { SIG_EMIOS_FLAG, SIG_BCTU_TRIG, TRIGROUTE_EDGE_TRGMUX, 0U, IN_EMIOS0_CH0, TRUE },
+    { SIG_EMIOS_FLAG, SIG_LCU_IN, TRIGROUTE_EDGE_TRGMUX, 2U, IN_EMIOS0_CH0, FALSE },
+    { SIG_LCU_IN, SIG_LCU_OUT, TRIGROUTE_EDGE_LCU_INPUT, 3U, 7U, FALSE },
+    { SIG_LCU_OUT, SIG_DMA_TRIG, TRIGROUTE_EDGE_TRGMUX, 6U, IN_LCU0_OUT0, FALSE },
+    { SIG_DMA_TRIG, SIG_DMA_CH, TRIGROUTE_EDGE_DMA_REQUEST, 5U, 0U, FALSE },
+};
+static const TrigRoute_GraphType pipeline = { pipeline_edges, 5U, SIG_COUNT };
+
+static void Pipeline(void)
+{
+    uint8 failed;
+    uint32 out;
+    boolean routed;
+    uint32 i;
+
+    ResetMap();
+    SchM_Host_MclArea[MCL_EA_SET_INPUT] = 0U;
+    CHECK(TrigRoute_Apply(&pipeline, &failed) == TRIGROUTE_OK);
+    CHECK(failed == TRIGROUTE_NO_EDGE);
+    CheckMap(&pipeline);
+
+    /* Consumers are armed before the first TRGMUX write, each TRGMUX edge is written once */
+    CHECK((dma_count == 1U) && (dma_log[0] == 5U));
+    CHECK(lcu_calls == 1U);
+    CHECK(trgmux_writes_before_consumers == 0U);
+    CHECK(SchM_Host_MclArea[MCL_EA_SET_INPUT] == 3U);
+
+    /* Outputs outside the graph keep their reset value */
+    for (out = 0U; out < (TRGMUX_HOST_REGISTERS * 4U); out++) {
+        routed = FALSE;
+        for (i = 0U; i < pipeline.NumEdges; i++) {
+            if ((pipeline_edges[i].Kind == TRIGROUTE_EDGE_TRGMUX) &&
+                (trigger[pipeline_edges[i].Target].Output == out)) {
+                routed = TRUE;
+            }
+        }
+        if (routed == FALSE) {
+            CHECK(Selection(out) == 0U);
+        }
+    }
+}
+
+/* Rejected graphs leave the register map as it was */
+static void Rejected(void)
+{
+    static const TrigRoute_EdgeType conflict_edges[] = {
+        { 0U, 1U, TRIGROUTE_EDGE_TRGMUX, 1U, 0x10U, FALSE },
+        { 2U, 3U, TRIGROUTE_EDGE_TRGMUX, 1U, 0x11U, FALSE },
+    };
+    static const TrigRoute_EdgeType cycle_edges[] = {
+        { 0U, 1U, TRIGROUTE_EDGE_TRGMUX, 1U, 0x10U, FALSE },
+        { 1U, 2U, TRIGROUTE_EDGE_LCU_INPUT, 0U, 3U, FALSE },
+        { 2U, 0U, TRIGROUTE_EDGE_TRGMUX, 3U, 0x12U, FALSE },
+    };
+    static const TrigRoute_EdgeType bad_edges[] = {
+        { 0U, 1U, TRIGROUTE_EDGE_TRGMUX, 1U, 0x10U, FALSE },
+        { 1U, 4U, TRIGROUTE_EDGE_TRGMUX, 3U, 0x12U, FALSE },
+    };
+    static const TrigRoute_GraphType conflict = { conflict_edges, 2U, 4U };
+    static const TrigRoute_GraphType cycle = { cycle_edges, 3U, 3U };
+    static const TrigRoute_GraphType bad = { bad_edges, 2U, 4U };
+    TRGMUX_Type before;
+    uint8 failed;
+
+    ResetMap();
+    (void)TrigRoute_Apply(&pipeline, &failed);
+    before = Trgmux_Host_Regs;
+    dma_count = 0U;
+    lcu_calls = 0U;
+
+    CHECK(TrigRoute_Apply(&conflict, &failed) == TRIGROUTE_CONFLICT);
+    CHECK(failed == 1U);
+    CHECK(TrigRoute_Apply(&cycle, &failed) == TRIGROUTE_CYCLE);
+    CHECK(failed != TRIGROUTE_NO_EDGE);
+    CHECK(TrigRoute_Apply(&bad, &failed) == TRIGROUTE_BAD_NODE);
+    CHECK(failed == 1U);
+
+    CHECK(memcmp((const void *)&before, (const void *)&Trgmux_Host_Regs, sizeof(before)) == 0);
+    CHECK((dma_count == 0U) && (lcu_calls == 0U));
+}
+
+/* A mode change reroutes the unlocked outputs and reports the locked one */
+static void ModeChange(void)
+{
+    static const TrigRoute_EdgeType mode_edges[] = {
+        { 0U, 1U, TRIGROUTE_EDGE_TRGMUX, 2U, 0x21U, FALSE },
+        { 1U, 2U, TRIGROUTE_EDGE_TRGMUX, 6U, 0x22U, FALSE },
+        { 2U, 3U, TRIGROUTE_EDGE_TRGMUX, 7U, 0x23U, FALSE },
+    };
+    static const TrigRoute_EdgeType relock_edges[] = {
+        { 0U, 1U, TRIGROUTE_EDGE_TRGMUX, 4U, 0x30U, FALSE },
+        { 0U, 2U, TRIGROUTE_EDGE_TRGMUX, 0U, 0x31U, FALSE },
+    };
+    static const TrigRoute_GraphType mode = { mode_edges, 3U, 4U };
+    static const TrigRoute_GraphType relock = { relock_edges, 2U, 3U };
+    uint8 failed;
+
+    ResetMap();
+    (void)TrigRoute_Apply(&pipeline, &failed);
+
+    CHECK(TrigRoute_Apply(&mode, &failed) == TRIGROUTE_OK);
+    CheckMap(&mode);
+    /* The locked BCTU trigger of the pipeline is untouched */
+    CHECK(Selection(trigger[0].Output) == IN_EMIOS0_CH0);
+    CHECK(Locked(trigger[0].Output) == TRUE);
+
+    CHECK(TrigRoute_Apply(&relock, &failed) == TRIGROUTE_LOCKED);
+    CHECK(failed == 1U);
+    CHECK(Selection(trigger[0].Output) == IN_EMIOS0_CH0);
+    /* Edges applied before the refused one stay routed */
+    CHECK(Selection(trigger[4].Output) == 0x30U);
+}
+
+/* Loop detection against transitive reachability on random graphs */
+static void RandomGraphs(void)
+{
+    TrigRoute_EdgeType edges[TRIGROUTE_MAX_EDGES];
+    TrigRoute_GraphType graph;
+    boolean reach[TRIGROUTE_MAX_NODES][TRIGROUTE_MAX_NODES];
+    boolean loop;
+    uint32 disagreements = 0U;
+    uint32 loops = 0U;
+    uint32 n;
+    uint32 i;
+    uint32 j;
+    uint32 k;
+    uint8 failed;
+    TrigRoute_ResultType ret;
+
+    for (n = 0U; n < RANDOM_GRAPHS; n++) {
+        graph.NumNodes = (uint8)(2U + (Random() % 14U));
+        graph.NumEdges = (uint8)(1U + (Random() % 20U));
+        graph.Edges = edges;
+        (void)memset(reach, 0, sizeof(reach));
+        for (i = 0U; i < graph.NumEdges; i++) {
+            edges[i].From = (uint8)(Random() % graph.NumNodes);
+            edges[i].To = (uint8)(Random() % graph.NumNodes);
+            if (edges[i].To == edges[i].From) {
+                edges[i].To = (uint8)((edges[i].To + 1U) % graph.NumNodes);
+            }
+            /* Distinct targets, so only loops can make the graph invalid */
+            edges[i].Kind = TRIGROUTE_EDGE_LCU_INPUT;
+            edges[i].Target = i;
+            edges[i].Value = 0U;
+            edges[i].Lock = FALSE;
+            reach[edges[i].From][edges[i].To] = TRUE;
+        }
+        for (k = 0U; k < graph.NumNodes; k++) {
+            for (i = 0U; i < graph.NumNodes; i++) {
+                for (j = 0U; j < graph.NumNodes; j++) {
+                    if ((reach[i][k] == TRUE) && (reach[k][j] == TRUE)) {
+                        reach[i][j] = TRUE;
+                    }
+                }
+            }
+        }
+        loop = FALSE;
+        for (i = 0U; i < graph.NumNodes; i++) {
+            if (reach[i][i] == TRUE) {
+                loop = TRUE;
+            }
+        }
+        loops += (loop == TRUE) ? 1U : 0U;
+
+        ret = TrigRoute_Validate(&graph, &failed);
+        if (ret != ((loop == TRUE) ? TRIGROUTE_CYCLE : TRIGROUTE_OK)) {
+            disagreements++;
+        }
+        /* The reported edge lies on a loop: its sink reaches its source */
+        if ((ret == TRIGROUTE_CYCLE) && (reach[edges[failed].To][edges[failed].From] == FALSE)) {
+            disagreements++;
+        }
+    }
+    printf("random graphs: %u, with loops %u, disagreements %u\n", RANDOM_GRAPHS, loops, disagreements);
+    CHECK(disagreements == 0U);
+    CHECK((loops > 0U) && (loops < RANDOM_GRAPHS));
+}
+
+static void Benchmark(void)
+{
+    uint8 failed;
+    double start;
+    uint32 n;
+
+    ResetMap();
+    start = host_test_ns();
+    for (n = 0U; n < 100000U; n++) {
+        (void)TrigRoute_Validate(&pipeline, &failed);
+    }
+    printf("validate pipeline %.1f ns", (host_test_ns() - start) / 1e5);
+
+    /* Unlocked copy of the pipeline so it can be applied again */
+    start = host_test_ns();
+    for (n = 0U; n < 100000U; n++) {
+        static const TrigRoute_EdgeType edges[] = {
+            { SIG_EMIOS_FLAG, SIG_BCTU_TRIG, TRIGROUTE_EDGE_TRGMUX, 0U, IN_EMIOS0_CH0, FALSE },
+            { SIG_EMIOS_FLAG, SIG_LCU_IN, TRIGROUTE_EDGE_TRGMUX, 2U, IN_EMIOS0_CH0, FALSE },
+            { SIG_LCU_IN, SIG_LCU_OUT, TRIGROUTE_EDGE_LCU_INPUT, 3U, 7U, FALSE },
+            { SIG_LCU_OUT, SIG_DMA_TRIG, TRIGROUTE_EDGE_TRGMUX, 6U, IN_LCU0_OUT0, FALSE },
+            { SIG_DMA_TRIG, SIG_DMA_CH, TRIGROUTE_EDGE_DMA_REQUEST, 5U, 0U, FALSE },
+        };
+        static const TrigRoute_GraphType graph = { edges, 5U, SIG_COUNT };
+
+        dma_count = 0U;
+        (void)TrigRoute_Apply(&graph, &failed);
+    }
+    printf("   apply pipeline %.1f ns   (100000 calls each)\n", (host_test_ns() - start) / 1e5);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/* Mcl stand-ins: the lock goes to the driver as in CDD_Mcl, DMA and LCU calls are recorded */
+void Mcl_SetTrgMuxLock(const uint32 Trigger)
+{
+    (void)Trgmux_Ip_SetLock(Trigger);
+}
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command)
+{
+    if ((Command == MCL_DMA_CH_START_REQUEST) && (dma_count < MAX_DMA_LOG)) {
+        dma_log[dma_count] = Channel;
+        dma_count++;
+    }
+    trgmux_writes_before_consumers += SchM_Host_MclArea[MCL_EA_SET_INPUT];
+}
+
+void Mcl_SetLcuSyncInputMuxSelect(const Mcl_LcuSyncInputValueType List[], const uint8 Dimension)
+{
+    uint8 i;
+
+    for (i = 0U; i < Dimension; i++) {
+        lcu_mux[List[i].LogicInputId] = List[i].Value;
+    }
+    lcu_calls++;
+    trgmux_writes_before_consumers += SchM_Host_MclArea[MCL_EA_SET_INPUT];
+}
+
+int main(void)
+{
+    Pipeline();
+    Rejected();
+    ModeChange();
+    RandomGraphs();
+    Benchmark();
+    CHECK(SchM_Host_Depth == 0U);
+
+    return HOST_TEST_RESULT();
+}
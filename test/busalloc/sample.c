@@ -0,0 +1,324 @@
+/*
+* eMIOS counter buses from busalloc/sample.csv: 15 outputs, 4 buses, 0 split sync groups
+*
+* output           instance channel      bus master  phase maxduty
+* led0_r                  0       1        F     22      0    1000
+* led0_g                  0       2        F     22      0    1000
+* led0_b                  0       3        F     22      0    1000
+* led1_r                  0       9        F     22      0    1000
+* led1_g                  0      10        F     22      0    1000
+* led1_b                  0      11        F     22      0    1000
+* bank_0                  0      17     BCDE     16      0    2000
+* bank_1                  0      18     BCDE     16    500    1500
+* bank_2                  0      19     BCDE     16   1000    1000
+* bank_3                  0      20     BCDE     16   1500     500
+* motor_u                 1       1        F     22      0     998
+* motor_v                 1       9        F     22      0     998
+* motor_w                 1      17        F     22      0     998
+* fan                     1       4 internal      -      0   40000
+* backlight               2      12        F     22      0    4096
+*/
+
+/* Mcl: master buses of eMIOS_0, prescalers at divide by 1 */
+const Emios_Ip_MasterBusConfigType BusAlloc_Emios0_MasterBuses[2] =
+{
+    { 16U, EMIOS_IP_MCB_UP_COUNTER, 2000U, 0U, 0U, 0U, FALSE },
+    { 22U, EMIOS_IP_MCB_UP_COUNTER, 1000U, 0U, 0U, 0U, FALSE }
+};
+
+/* Mcl: master buses of eMIOS_1, prescalers at divide by 1 */
+const Emios_Ip_MasterBusConfigType BusAlloc_Emios1_MasterBuses[1] =
+{
+    { 22U, EMIOS_IP_MCB_UP_DOWN_COUNTER, 500U, 0U, 0U, 0U, FALSE }
+};
+
+/* Mcl: master buses of eMIOS_2, prescalers at divide by 1 */
+const Emios_Ip_MasterBusConfigType BusAlloc_Emios2_MasterBuses[1] =
+{
+    { 22U, EMIOS_IP_MCB_UP_COUNTER, 4096U, 0U, 0U, 0U, FALSE }
+};
+
+/* Pwm: channels of eMIOS_0, starting at 0% duty */
+const Emios_Pwm_Ip_ChannelConfigType BusAlloc_Emios0_Channels[10] =
+{
+    /* led0_r */
+    {
+        .ChannelId = 1U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led0_g */
+    {
+        .ChannelId = 2U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led0_b */
+    {
+        .ChannelId = 3U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led1_r */
+    {
+        .ChannelId = 9U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led1_g */
+    {
+        .ChannelId = 10U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led1_b */
+    {
+        .ChannelId = 11U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* bank_0 */
+    {
+        .ChannelId = 17U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_BCDE,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 2000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* bank_1 */
+    {
+        .ChannelId = 18U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_BCDE,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1500U,
+        .DutyCycle = 0U,
+        .PhaseShift = 500U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* bank_2 */
+    {
+        .ChannelId = 19U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_BCDE,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 1000U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* bank_3 */
+    {
+        .ChannelId = 20U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_BCDE,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 500U,
+        .DutyCycle = 0U,
+        .PhaseShift = 1500U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    }
+};
+
+/* Pwm: channels of eMIOS_1, starting at 0% duty */
+const Emios_Pwm_Ip_ChannelConfigType BusAlloc_Emios1_Channels[4] =
+{
+    /* motor_u */
+    {
+        .ChannelId = 1U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 998U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* motor_v */
+    {
+        .ChannelId = 9U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 998U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* motor_w */
+    {
+        .ChannelId = 17U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 998U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* fan */
+    {
+        .ChannelId = 4U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWFMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_INTERNAL,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 40000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    }
+};
+
+/* Pwm: channels of eMIOS_2, starting at 0% duty */
+const Emios_Pwm_Ip_ChannelConfigType BusAlloc_Emios2_Channels[1] =
+{
+    /* backlight */
+    {
+        .ChannelId = 12U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .PeriodCount = 4096U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    }
+};
@@ -0,0 +1,63 @@
+/*==================================================================================================
+*   Copyright 2020 - 2024 NXP
+*
+*   NXP Confidential Proprietary. This software is owned or controlled by NXP and may only be
+*   used strictly in accordance with the applicable license terms. By expressly
+*   accepting these terms or by downloading, installing, activating and/or otherwise
+*   using the software, you are agreeing that you have read, and that you agree to
+*   comply with and are bound by, such license terms. If you do not agree to be
+*   bound by the applicable license terms, then you may not retain, install,
+*   activate or otherwise use the software.
+*
+*   This file contains sample code only. It is not part of the production code deliverables.
+==================================================================================================*/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <time.h>
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Record a failed check and carry on, so one run reports every failure */
+#define CHECK(cond) \
+    do { \
+        host_test_checks++; \
+        if (!(cond)) { \
+            host_test_failures++; \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+/* Exit status of a test program */
+#define HOST_TEST_RESULT() \
+    (printf("%u checks, %u failed\n", host_test_checks, host_test_failures), \
+     (host_test_failures == 0U) ? 0 : 1)
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+static unsigned int host_test_checks;
+static unsigned int host_test_failures;
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief        Monotonic time in nanoseconds for the benchmarks
+*/
+static inline double host_test_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+#endif /* HOST_TEST_H */
@@ -0,0 +1,246 @@
+/*
+* Sample Pwm configuration for PwmCfgCheck, in the form of the generated Pwm_PBcfg.c: eight
+* channels of eMIOS_0, four of them inconsistent (a variable period on a counter bus, the
+* channel running bus F on bus F, a trail edge dead time of more than half the pulse, a
+* notification on a channel raising DMA requests). The expected report is sample.txt.
+*/
+#include "Pwm.h"
+#include "Pwm_Notif.h"
+#include "Emios_Pwm_Ip.h"
+
+#define SAMPLE_CHANNELS     (8U)
+
+static void Sample_Notification(void)
+{
+}
+
+static const Emios_Pwm_Ip_ChannelConfigType Sample_EmiosChannels[SAMPLE_CHANNELS] =
+{
+    /* status_led */
+    {
+        .ChannelId = 0U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_INTERNAL,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST,
+        .UserCallback = { Pwm_Notification, 0U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 500U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led0_r */
+    {
+        .ChannelId = 1U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .UserCallback = { Pwm_Notification, 1U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* led0_g */
+    {
+        .ChannelId = 2U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .UserCallback = { Pwm_Notification, 2U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* bus_f */
+    {
+        .ChannelId = 22U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMB_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_F,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .UserCallback = { Pwm_Notification, 3U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* gate_hi */
+    {
+        .ChannelId = 9U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_BCDE,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .UserCallback = { Pwm_Notification, 4U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 100U,
+        .TriggerPosition = 0U
+    },
+    /* gate_lo */
+    {
+        .ChannelId = 10U,
+        .Mode = EMIOS_PWM_IP_MODE_OPWMCB_TRAIL_EDGE_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_BCDE,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .UserCallback = { Pwm_Notification, 5U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 150U,
+        .PhaseShift = 0U,
+        .DeadTime = 100U,
+        .TriggerPosition = 0U
+    },
+    /* adc_trigger */
+    {
+        .ChannelId = 12U,
+        .Mode = EMIOS_PWM_IP_MODE_DAOC_FLAG,
+        .Timebase = EMIOS_PWM_IP_BUS_INTERNAL,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_DMA_REQUEST,
+        .UserCallback = { Pwm_Notification, 6U },
+        .PeriodCount = 1000U,
+        .DutyCycle = 250U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    },
+    /* enable */
+    {
+        .ChannelId = 4U,
+        .Mode = EMIOS_PWM_IP_MODE_GPO,
+        .Timebase = EMIOS_PWM_IP_BUS_INTERNAL,
+        .DebugMode = FALSE,
+        .OutputDisableSource = EMIOS_PWM_IP_OUTPUT_DISABLE_NONE,
+        .InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1,
+        .InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK,
+        .OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH,
+        .IrqMode = EMIOS_PWM_IP_NOTIFICATION_DISABLED,
+        .UserCallback = { Pwm_Notification, 7U },
+        .PeriodCount = 0U,
+        .DutyCycle = 0U,
+        .PhaseShift = 0U,
+        .DeadTime = 0U,
+        .TriggerPosition = 0U
+    }
+};
+
+static const Pwm_ChannelConfigType Sample_Channels[SAMPLE_CHANNELS] =
+{
+    /* status_led */
+    {
+        (Pwm_ChannelType)0U,
+        PWM_VARIABLE_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[0], 0U, 0x0000U },
+        PWM_LOW,
+        Sample_Notification
+    },
+    /* led0_r */
+    {
+        (Pwm_ChannelType)1U,
+        PWM_FIXED_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[1], 0U, 0x0000U },
+        PWM_LOW,
+        NULL_PTR
+    },
+    /* led0_g */
+    {
+        (Pwm_ChannelType)2U,
+        PWM_VARIABLE_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[2], 0U, 0x0000U },
+        PWM_LOW,
+        NULL_PTR
+    },
+    /* bus_f */
+    {
+        (Pwm_ChannelType)3U,
+        PWM_FIXED_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[3], 0U, 0x0000U },
+        PWM_LOW,
+        NULL_PTR
+    },
+    /* gate_hi */
+    {
+        (Pwm_ChannelType)4U,
+        PWM_FIXED_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[4], 0U, 0x0000U },
+        PWM_LOW,
+        NULL_PTR
+    },
+    /* gate_lo */
+    {
+        (Pwm_ChannelType)5U,
+        PWM_FIXED_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[5], 0U, 0x0000U },
+        PWM_LOW,
+        NULL_PTR
+    },
+    /* adc_trigger */
+    {
+        (Pwm_ChannelType)6U,
+        PWM_VARIABLE_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[6], 0U, 0x0000U },
+        PWM_LOW,
+        Sample_Notification
+    },
+    /* enable */
+    {
+        (Pwm_ChannelType)7U,
+        PWM_FIXED_PERIOD,
+        { PWM_CHANNEL_EMIOS, &Sample_EmiosChannels[7], 0U, 0x0000U },
+        PWM_LOW,
+        NULL_PTR
+    }
+};
+
+const Pwm_ConfigType PwmCfgCheck_Sample =
+{
+    (Pwm_ChannelType)SAMPLE_CHANNELS,
+    &Sample_Channels,
+    { (Pwm_ChannelType)0, (Pwm_ChannelType)1, (Pwm_ChannelType)2, (Pwm_ChannelType)3, (Pwm_ChannelType)4, (Pwm_ChannelType)5, (Pwm_ChannelType)6, (Pwm_ChannelType)7 }
+};
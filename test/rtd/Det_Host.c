@@ -0,0 +1,34 @@
+/*
+* Host stand-in for Det: development and runtime errors are counted and the last one is kept,
+* so a host test can check which service reported what.
+*/
+#include "Det.h"
+#include "Det_Host.h"
+
+uint32 Det_Host_Errors;
+Det_Host_ErrorType Det_Host_Last;
+
+void Det_Host_Clear(void)
+{
+    Det_Host_Errors = 0U;
+    Det_Host_Last.ModuleId = 0U;
+    Det_Host_Last.InstanceId = 0U;
+    Det_Host_Last.ApiId = 0U;
+    Det_Host_Last.ErrorId = 0U;
+}
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    Det_Host_Errors++;
+    Det_Host_Last.ModuleId = ModuleId;
+    Det_Host_Last.InstanceId = InstanceId;
+    Det_Host_Last.ApiId = ApiId;
+    Det_Host_Last.ErrorId = ErrorId;
+
+    return E_OK;
+}
+
+Std_ReturnType Det_ReportRuntimeError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    return Det_ReportError(ModuleId, InstanceId, ApiId, ErrorId);
+}
@@ -0,0 +1,20 @@
+/* Host stand-in for Det: the errors the drivers report, inspected by the host tests */
+#ifndef DET_HOST_H
+#define DET_HOST_H
+
+#include "Std_Types.h"
+
+typedef struct {
+    uint16 ModuleId;
+    uint8 InstanceId;
+    uint8 ApiId;
+    uint8 ErrorId;
+} Det_Host_ErrorType;
+
+extern uint32 Det_Host_Errors;                  /* Reports since start or the last clear */
+extern Det_Host_ErrorType Det_Host_Last;        /* Most recent report */
+
+/* Forget the reports so far */
+void Det_Host_Clear(void);
+
+#endif /* DET_HOST_H */
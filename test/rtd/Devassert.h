@@ -0,0 +1,17 @@
+/* Host stand-in for the BaseNXP development assertion: stop the run where the target would halt */
+#ifndef DEVASSERT_H
+#define DEVASSERT_H
+
+#include "Mcal.h"
+
+#define DEVASSERT_AR_RELEASE_MAJOR_VERSION  4
+#define DEVASSERT_AR_RELEASE_MINOR_VERSION  7
+
+static inline void DevAssert(volatile boolean x)
+{
+    if (!x) {
+        ASM_KEYWORD("BKPT #0");
+    }
+}
+
+#endif /* DEVASSERT_H */
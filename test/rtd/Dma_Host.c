@@ -0,0 +1,154 @@
+/*
+* Host model of the eDMA3 engine. Every service request of a channel executes one minor loop:
+* NBYTES in SSIZE elements with SOFF/DOFF, then the minor loop offset when enabled, and writes
+* SADDR, DADDR and CITER back to the TCD as the engine does. The last minor loop applies
+* SLAST/DLAST or loads the next descriptor from DLAST_SGA, and raises DONE and the interrupt
+* flags. A minor or major loop channel link starts one minor loop of the linked channel right
+* after. Modulo and bandwidth control are not modelled.
+*/
+#include <stdint.h>
+#include <string.h>
+#include "Dma_Host.h"
+
+Dma_Ip_Hwv3InstRegType Dma_Host_Mp;
+Dma_Ip_Hwv3TcdArrayType Dma_Host_Tcd;
+uint32 Dma_Host_MinorLoops[DMA_HOST_CHANNELS];
+uint32 Dma_Host_MajorLoops[DMA_HOST_CHANNELS];
+uint32 Dma_Host_DescriptorLoads[DMA_HOST_CHANNELS];
+
+#define TCD_CSR_START       (0x0001U)
+#define TCD_CSR_INTMAJOR    (0x0002U)
+#define TCD_CSR_INTHALF     (0x0004U)
+#define TCD_CSR_DREQ        (0x0008U)
+#define TCD_CSR_ESG         (0x0010U)
+#define TCD_CSR_MAJORELINK  (0x0020U)
+#define NBYTES_SMLOE        (0x80000000UL)
+#define NBYTES_DMLOE        (0x40000000UL)
+#define ELINK               (0x8000U)
+#define NO_LINK             (0xFFFFFFFFUL)
+
+static uint8 *HostPtr(uint32 Addr)
+{
+    return (uint8 *)(uintptr_t)Addr;
+}
+
+static uint32 IterCount(uint16 Iter)
+{
+    return ((Iter & ELINK) != 0U) ? (uint32)(Iter & 0x1FFU) : (uint32)(Iter & 0x7FFFU);
+}
+
+static uint16 SetIterCount(uint16 Iter, uint32 Count)
+{
+    return ((Iter & ELINK) != 0U) ? (uint16)((Iter & ~0x1FFU) | (Count & 0x1FFU)) :
+                                    (uint16)((Iter & ~0x7FFFU) | (Count & 0x7FFFU));
+}
+
+static void MinorLoop(uint32 HwCh)
+{
+    Dma_Ip_ChRegType *ch = &Dma_Host_Tcd.TCD_RSV[HwCh].tChTcdReg.tChReg;
+    Dma_Ip_TcdRegType *tcd = &Dma_Host_Tcd.TCD_RSV[HwCh].tChTcdReg.tTcdReg;
+    boolean more = TRUE;
+    uint32 link = NO_LINK;
+
+    while (more == TRUE) {
+        uint32 mlno = tcd->reg_NBYTES.reg_MLOFFYES;
+        boolean mloe = ((mlno & (NBYTES_SMLOE | NBYTES_DMLOE)) != 0U) ? TRUE : FALSE;
+        uint32 nbytes = (mloe == TRUE) ? (mlno & 0x3FFU) : (mlno & 0x3FFFFFFFUL);
+        sint32 mloff = (mloe == TRUE) ? ((sint32)(mlno << 2) >> 12) : 0;
+        uint32 size = 1UL << ((tcd->reg_ATTR >> 8) & 0x7U);
+        uint32 citer = IterCount(tcd->reg_CITER.reg_ELINKYES);
+        uint32 biter = IterCount(tcd->reg_BITER.reg_ELINKYES);
+        uint32 saddr = tcd->reg_SADDR;
+        uint32 daddr = tcd->reg_DADDR;
+        uint32 i;
+
+        tcd->reg_CSR = (uint16)(tcd->reg_CSR & ~TCD_CSR_START);
+        more = FALSE;
+
+        for (i = 0U; i < nbytes; i += size) {
+            memcpy(HostPtr(daddr), HostPtr(saddr), size);
+            saddr += (uint32)(sint32)(sint16)tcd->reg_SOFF;
+            daddr += (uint32)(sint32)(sint16)tcd->reg_DOFF;
+        }
+        if ((mlno & NBYTES_SMLOE) != 0U) {
+            saddr += (uint32)mloff;
+        }
+        if ((mlno & NBYTES_DMLOE) != 0U) {
+            daddr += (uint32)mloff;
+        }
+        Dma_Host_MinorLoops[HwCh]++;
+        citer--;
+
+        if (((tcd->reg_CSR & TCD_CSR_INTHALF) != 0U) && (citer == (biter / 2U)) && (citer != 0U)) {
+            ch->reg_CH_INT |= DMA_IP_TCD_CH_INT_INT_MASK;
+        }
+
+        if (citer != 0U) {
+            if ((tcd->reg_CITER.reg_ELINKYES & ELINK) != 0U) {
+                link = ((uint32)tcd->reg_CITER.reg_ELINKYES >> 9U) & 0x1FU;
+            }
+            tcd->reg_SADDR = saddr;
+            tcd->reg_DADDR = daddr;
+            tcd->reg_CITER.reg_ELINKYES = SetIterCount(tcd->reg_CITER.reg_ELINKYES, citer);
+        } else {
+            Dma_Host_MajorLoops[HwCh]++;
+            if ((tcd->reg_CSR & TCD_CSR_MAJORELINK) != 0U) {
+                link = ((uint32)tcd->reg_CSR >> 8U) & 0x1FU;
+            }
+            ch->reg_CH_CSR |= DMA_IP_TCD_CH_CSR_DONE_MASK;
+            if ((tcd->reg_CSR & TCD_CSR_INTMAJOR) != 0U) {
+                ch->reg_CH_INT |= DMA_IP_TCD_CH_INT_INT_MASK;
+            }
+            if ((tcd->reg_CSR & TCD_CSR_DREQ) != 0U) {
+                ch->reg_CH_CSR &= ~DMA_IP_TCD_CH_CSR_ERQ_MASK;
+            }
+            if ((tcd->reg_CSR & TCD_CSR_ESG) != 0U) {
+                /* The next descriptor replaces the TCD and is served at once if it has START set */
+                memcpy((void *)tcd, HostPtr(tcd->reg_DLAST_SGA), sizeof(*tcd));
+                Dma_Host_DescriptorLoads[HwCh]++;
+                more = ((tcd->reg_CSR & TCD_CSR_START) != 0U) ? TRUE : FALSE;
+            } else {
+                tcd->reg_SADDR = saddr + tcd->reg_SLAST_SDA;
+                tcd->reg_DADDR = daddr + tcd->reg_DLAST_SGA;
+                tcd->reg_CITER.reg_ELINKYES = tcd->reg_BITER.reg_ELINKYES;
+            }
+        }
+    }
+
+    if (link != NO_LINK) {
+        Dma_Host_Tcd.TCD_RSV[link].tChTcdReg.tTcdReg.reg_CSR |= TCD_CSR_START;
+        MinorLoop(link);
+    }
+}
+
+void Dma_Host_Run(void)
+{
+    uint32 ch;
+
+    for (ch = 0U; ch < DMA_HOST_CHANNELS; ch++) {
+        if ((Dma_Host_Tcd.TCD_RSV[ch].tChTcdReg.tTcdReg.reg_CSR & TCD_CSR_START) != 0U) {
+            MinorLoop(ch);
+        }
+    }
+}
+
+boolean Dma_Host_Request(uint32 HwCh)
+{
+    boolean served = FALSE;
+
+    if ((Dma_Host_Tcd.TCD_RSV[HwCh].tChTcdReg.tChReg.reg_CH_CSR & DMA_IP_TCD_CH_CSR_ERQ_MASK) != 0U) {
+        MinorLoop(HwCh);
+        served = TRUE;
+    }
+
+    return served;
+}
+
+void Dma_Host_Reset(void)
+{
+    (void)memset(&Dma_Host_Mp, 0, sizeof(Dma_Host_Mp));
+    (void)memset(&Dma_Host_Tcd, 0, sizeof(Dma_Host_Tcd));
+    (void)memset(Dma_Host_MinorLoops, 0, sizeof(Dma_Host_MinorLoops));
+    (void)memset(Dma_Host_MajorLoops, 0, sizeof(Dma_Host_MajorLoops));
+    (void)memset(Dma_Host_DescriptorLoads, 0, sizeof(Dma_Host_DescriptorLoads));
+}
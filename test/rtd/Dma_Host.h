@@ -0,0 +1,29 @@
+/*
+* Host model of the eDMA3 instance behind the Dma_Ip driver: the management page and the channel
+* TCDs are RAM blocks, and a channel executes one minor loop each time the test raises a service
+* request. Write-one-to-clear flags are plain RAM, so a clear command reads back as the 1 the
+* driver wrote.
+*/
+#ifndef DMA_HOST_H
+#define DMA_HOST_H
+
+#include "Dma_Ip_Cfg_Devices.h"
+
+#define DMA_HOST_CHANNELS   (32U)
+
+/* Serve one minor loop of every channel whose TCD has START set, as for a software request.
+   A channel link serves one minor loop of the linked channel right after. */
+void Dma_Host_Run(void);
+
+/* Raise the peripheral request of a channel; it is served only while CH_CSR[ERQ] is set */
+boolean Dma_Host_Request(uint32 HwCh);
+
+/* Clear the register blocks and the counters */
+void Dma_Host_Reset(void);
+
+/* Per channel since the last reset: minor and major loops executed, descriptors fetched */
+extern uint32 Dma_Host_MinorLoops[DMA_HOST_CHANNELS];
+extern uint32 Dma_Host_MajorLoops[DMA_HOST_CHANNELS];
+extern uint32 Dma_Host_DescriptorLoads[DMA_HOST_CHANNELS];
+
+#endif /* DMA_HOST_H */
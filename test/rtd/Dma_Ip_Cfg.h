@@ -0,0 +1,18 @@
+/* Host stand-in for the generated Dma_Ip configuration: one eDMA3 instance with 32 channels */
+#ifndef DMA_IP_CFG_H
+#define DMA_IP_CFG_H
+
+#include "Dma_Ip_Types.h"
+
+#define DMA_IP_CFG_VENDOR_ID                    43
+#define DMA_IP_CFG_AR_RELEASE_MAJOR_VERSION     4
+#define DMA_IP_CFG_AR_RELEASE_MINOR_VERSION     7
+#define DMA_IP_CFG_AR_RELEASE_REVISION_VERSION  0
+#define DMA_IP_CFG_SW_MAJOR_VERSION             5
+#define DMA_IP_CFG_SW_MINOR_VERSION             0
+#define DMA_IP_CFG_SW_PATCH_VERSION             0
+
+#define DMA_IP_NOF_CFG_LOGIC_INSTANCES          (1U)
+#define DMA_IP_NOF_CFG_LOGIC_CHANNELS           (4U)
+
+#endif /* DMA_IP_CFG_H */
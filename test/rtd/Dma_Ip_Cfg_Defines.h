@@ -0,0 +1,62 @@
+/* Host stand-in for the generated Dma_Ip feature switches of S32K344 */
+#ifndef DMA_IP_CFG_DEFINES_H
+#define DMA_IP_CFG_DEFINES_H
+
+#include "Mcal.h"
+
+#define DMA_IP_CFG_DEFINES_VENDOR_ID                    43
+#define DMA_IP_CFG_DEFINES_AR_RELEASE_MAJOR_VERSION     4
+#define DMA_IP_CFG_DEFINES_AR_RELEASE_MINOR_VERSION     7
+#define DMA_IP_CFG_DEFINES_AR_RELEASE_REVISION_VERSION  0
+#define DMA_IP_CFG_DEFINES_SW_MAJOR_VERSION             5
+#define DMA_IP_CFG_DEFINES_SW_MINOR_VERSION             0
+#define DMA_IP_CFG_DEFINES_SW_PATCH_VERSION             0
+
+#define DMA_IP_IS_AVAILABLE                         STD_ON
+#define DMA_IP_DEV_ERROR_DETECT                     STD_ON
+#define DMA_IP_HWV2_IS_AVAILABLE                    STD_OFF
+#define DMA_IP_HWV3_IS_AVAILABLE                    STD_ON
+#define DMA_IP_HARDWARE_VERSION_3                   (3U)
+#define DMA_IP_HARDWARE_VERSION_4                   (4U)
+#define DMA_IP_MULTICORE_IS_AVAILABLE               STD_OFF
+#define DMA_IP_USER_MODE_SUPPORT_IS_AVAILABLE       STD_OFF
+#define DMA_IP_REG_PROT_AVAILABLE                   STD_OFF
+#define DMA_IP_TCD_REG_PROT_AVAILABLE               STD_OFF
+#define DMA_IP_MP_REG_PROT_AVAILABLE                STD_OFF
+#define DMA_IP_REG_PROT_SIZE                        (4U)
+#define DMA_IP_VIRTUAL_ADDRESS_MAPPING_IS_AVAILABLE STD_OFF
+#define DMA_IP_IRQ_DISPATCHER_IS_AVAILABLE          STD_OFF
+#define DMA_IP_DMACRC_IS_AVAILABLE                  STD_OFF
+#define DMA_IP_TCD_NOT_ALIGNED                      STD_OFF
+
+#define DMA_IP_MASTER_ID_REPLICATION_IS_AVAILABLE   STD_ON
+#define DMA_IP_BUFFERED_WRITES_IS_AVAILABLE         STD_ON
+#define DMA_IP_PREEMPTION_IS_AVAILABLE              STD_ON
+#define DMA_IP_DISABLE_PREEMPT_IS_AVAILABLE         STD_ON
+#define DMA_IP_GROUP_PRIORITY_IS_AVAILABLE          STD_ON
+#define DMA_IP_BANDWIDTH_CONTROL_IS_AVAILABLE       STD_ON
+#define DMA_IP_END_OF_PACKET_SIGNAL_IS_AVAILABLE    STD_OFF
+#define DMA_IP_STORE_DST_ADDR_IS_AVAILABLE          STD_ON
+#define DMA_IP_TRANSFER_MODE_CONTROL_IS_AVAILABLE   STD_OFF
+#define DMA_IP_PROTECTION_LEVEL_IS_AVAILABLE        STD_OFF
+#define DMA_IP_SECURITY_LEVEL_IS_AVAILABLE          STD_OFF
+#define DMA_IP_TRANSACTIONS_TYPE_IS_AVAILABLE       STD_OFF
+#define DMA_IP_SWAP_SIZE_IS_AVAILABLE               STD_OFF
+
+#define DMA_IP_DMA_NOF_HWV3_INST                    (1U)
+#define DMA_IP_TCD_NOF_HWV3_CH_INST                 (1U)
+#define DMA_IP_TCD_NOF_HWV3_CH                      (32U)
+#define DMA_IP_DMA_TOTAL_NOF_LOGIC_CHANNEL          (32U)
+#define DMA_IP_DMA_TOTAL_NOF_LOGIC_INST             (1U)
+#define DMA_IP_HWV3_LOC_GLOBAL_PARAM_LIST_DIMENSION (11U)
+
+/* ATTR[SSIZE]/ATTR[DSIZE] encodings */
+#define DMA_IP_TRANSFER_SIZE_1_BYTE                 (0U)
+#define DMA_IP_TRANSFER_SIZE_2_BYTE                 (1U)
+#define DMA_IP_TRANSFER_SIZE_4_BYTE                 (2U)
+#define DMA_IP_TRANSFER_SIZE_8_BYTE                 (3U)
+#define DMA_IP_TRANSFER_SIZE_16_BYTE                (4U)
+#define DMA_IP_TRANSFER_SIZE_32_BYTE                (5U)
+#define DMA_IP_TRANSFER_SIZE_64_BYTE                (6U)
+
+#endif /* DMA_IP_CFG_DEFINES_H */
@@ -0,0 +1,211 @@
+/*
+* Host stand-in for the generated Dma_Ip device description. The eDMA3 management page and
+* channel TCDs follow the S32K344 register layout; the base pointers select RAM blocks that a
+* host test defines and inspects in place of the peripheral.
+*/
+#ifndef DMA_IP_CFG_DEVICES_H
+#define DMA_IP_CFG_DEVICES_H
+
+#include "Mcal.h"
+
+#define DMA_IP_CFG_DEVICES_VENDOR_ID                    43
+#define DMA_IP_CFG_DEVICES_AR_RELEASE_MAJOR_VERSION     4
+#define DMA_IP_CFG_DEVICES_AR_RELEASE_MINOR_VERSION     7
+#define DMA_IP_CFG_DEVICES_AR_RELEASE_REVISION_VERSION  0
+#define DMA_IP_CFG_DEVICES_SW_MAJOR_VERSION             5
+#define DMA_IP_CFG_DEVICES_SW_MINOR_VERSION             0
+#define DMA_IP_CFG_DEVICES_SW_PATCH_VERSION             0
+
+/*==================================================================================================
+*                                     Register layout
+==================================================================================================*/
+/* Management page */
+typedef struct {
+    volatile uint32 reg_CSR;
+    volatile uint32 reg_ES;
+    volatile uint32 reg_INT;
+    volatile uint32 reg_HRS;
+    uint8 RESERVED_0[240];
+    volatile uint32 reg_CH_GRPRI[32];
+} Dma_Ip_Hwv3InstRegType;
+
+/* Channel control and status */
+typedef struct {
+    volatile uint32 reg_CH_CSR;
+    volatile uint32 reg_CH_ES;
+    volatile uint32 reg_CH_INT;
+    volatile uint32 reg_CH_SBR;
+    volatile uint32 reg_CH_PRI;
+    uint8 RESERVED_0[12];
+} Dma_Ip_ChRegType;
+
+/* Transfer control descriptor, shared by the hardware and the software TCDs */
+typedef struct {
+    volatile uint32 reg_SADDR;
+    volatile uint16 reg_SOFF;
+    volatile uint16 reg_ATTR;
+    union {
+        volatile uint32 reg_MLOFFNO;
+        volatile uint32 reg_MLOFFYES;
+    } reg_NBYTES;
+    volatile uint32 reg_SLAST_SDA;
+    volatile uint32 reg_DADDR;
+    volatile uint16 reg_DOFF;
+    union {
+        volatile uint16 reg_ELINKNO;
+        volatile uint16 reg_ELINKYES;
+    } reg_CITER;
+    volatile uint32 reg_DLAST_SGA;
+    volatile uint16 reg_CSR;
+    union {
+        volatile uint16 reg_ELINKNO;
+        volatile uint16 reg_ELINKYES;
+    } reg_BITER;
+} Dma_Ip_TcdRegType;
+
+typedef Dma_Ip_TcdRegType Dma_Ip_SwTcdRegType;
+
+typedef struct {
+    Dma_Ip_ChRegType tChReg;
+    Dma_Ip_TcdRegType tTcdReg;
+} Dma_Ip_Hwv3ChTcdRegType;
+
+typedef struct {
+    struct {
+        Dma_Ip_Hwv3ChTcdRegType tChTcdReg;
+    } TCD_RSV[32];
+} Dma_Ip_Hwv3TcdArrayType;
+
+/* Simulated peripheral, defined by the host test */
+extern Dma_Ip_Hwv3InstRegType Dma_Host_Mp;
+extern Dma_Ip_Hwv3TcdArrayType Dma_Host_Tcd;
+
+#define DMA_IP_DMA_BASE_PTRS                { &Dma_Host_Mp }
+#define DMA_IP_TCD_BASE_PTRS                { &Dma_Host_Tcd }
+#define DMA_IP_CSR_BASE_ADDR(x)             (&Dma_Host_Mp)
+
+/*==================================================================================================
+*                                       Bit fields
+==================================================================================================*/
+#define DMA_IP_FIELD(x, shift, mask)        ((((uint32)(x)) << (shift)) & (mask))
+
+#define DMA_IP_MP_CSR_EDBG_MASK             (0x00000002U)
+#define DMA_IP_MP_CSR_EDBG(x)               DMA_IP_FIELD(x, 1U, DMA_IP_MP_CSR_EDBG_MASK)
+#define DMA_IP_MP_CSR_ERCA_MASK             (0x00000004U)
+#define DMA_IP_MP_CSR_ERCA(x)               DMA_IP_FIELD(x, 2U, DMA_IP_MP_CSR_ERCA_MASK)
+#define DMA_IP_MP_CSR_HAE_MASK              (0x00000010U)
+#define DMA_IP_MP_CSR_HAE(x)                DMA_IP_FIELD(x, 4U, DMA_IP_MP_CSR_HAE_MASK)
+#define DMA_IP_MP_CSR_HALT_MASK             (0x00000020U)
+#define DMA_IP_MP_CSR_HALT(x)               DMA_IP_FIELD(x, 5U, DMA_IP_MP_CSR_HALT_MASK)
+#define DMA_IP_MP_CSR_GCLC_MASK             (0x00000040U)
+#define DMA_IP_MP_CSR_GCLC(x)               DMA_IP_FIELD(x, 6U, DMA_IP_MP_CSR_GCLC_MASK)
+#define DMA_IP_MP_CSR_GMRC_MASK             (0x00000080U)
+#define DMA_IP_MP_CSR_GMRC(x)               DMA_IP_FIELD(x, 7U, DMA_IP_MP_CSR_GMRC_MASK)
+#define DMA_IP_MP_CSR_ECX_MASK              (0x00000100U)
+#define DMA_IP_MP_CSR_ECX(x)                DMA_IP_FIELD(x, 8U, DMA_IP_MP_CSR_ECX_MASK)
+#define DMA_IP_MP_CSR_CX_MASK               (0x00000200U)
+#define DMA_IP_MP_CSR_CX(x)                 DMA_IP_FIELD(x, 9U, DMA_IP_MP_CSR_CX_MASK)
+#define DMA_IP_MP_CSR_ACTIVE_ID_MASK        (0x1F000000U)
+#define DMA_IP_MP_CSR_ACTIVE_ID_SHIFT       (24U)
+#define DMA_IP_MP_CSR_ACTIVE_MASK           (0x80000000U)
+#define DMA_IP_MP_CSR_ACTIVE_SHIFT          (31U)
+#define DMA_IP_MP_ES_MASK                   (0x800000FFU)
+#define DMA_IP_MP_CH_GRPRI_GRPRI_MASK       (0x0000001FU)
+#define DMA_IP_MP_CH_GRPRI_GRPRI(x)         DMA_IP_FIELD(x, 0U, DMA_IP_MP_CH_GRPRI_GRPRI_MASK)
+
+#define DMA_IP_TCD_CH_CSR_ERQ_MASK          (0x00000001U)
+#define DMA_IP_TCD_CH_CSR_ERQ(x)            DMA_IP_FIELD(x, 0U, DMA_IP_TCD_CH_CSR_ERQ_MASK)
+#define DMA_IP_TCD_CH_CSR_EEI_MASK          (0x00000004U)
+#define DMA_IP_TCD_CH_CSR_EEI(x)            DMA_IP_FIELD(x, 2U, DMA_IP_TCD_CH_CSR_EEI_MASK)
+#define DMA_IP_TCD_CH_CSR_EBW_MASK          (0x00000008U)
+#define DMA_IP_TCD_CH_CSR_EBW(x)            DMA_IP_FIELD(x, 3U, DMA_IP_TCD_CH_CSR_EBW_MASK)
+#define DMA_IP_TCD_CH_CSR_DONE_MASK         (0x40000000U)
+#define DMA_IP_TCD_CH_CSR_DONE_SHIFT        (30U)
+#define DMA_IP_TCD_CH_CSR_ACTIVE_MASK       (0x80000000U)
+#define DMA_IP_TCD_CH_CSR_ACTIVE_SHIFT      (31U)
+#define DMA_IP_TCD_CH_ES_ERR_MASK           (0x80000000U)
+#define DMA_IP_TCD_CH_ES_MASK               (0x800000FFU)
+#define DMA_IP_TCD_CH_INT_INT_MASK          (0x00000001U)
+#define DMA_IP_TCD_CH_SBR_MID_MASK          (0x0000000FU)
+#define DMA_IP_TCD_CH_SBR_MID_SHIFT         (0U)
+#define DMA_IP_TCD_CH_SBR_PAL_MASK          (0x00008000U)
+#define DMA_IP_TCD_CH_SBR_PAL_SHIFT         (15U)
+#define DMA_IP_TCD_CH_SBR_EMI_MASK          (0x00010000U)
+#define DMA_IP_TCD_CH_SBR_EMI(x)            DMA_IP_FIELD(x, 16U, DMA_IP_TCD_CH_SBR_EMI_MASK)
+#define DMA_IP_TCD_CH_PRI_APL_MASK          (0x00000007U)
+#define DMA_IP_TCD_CH_PRI_APL(x)            DMA_IP_FIELD(x, 0U, DMA_IP_TCD_CH_PRI_APL_MASK)
+#define DMA_IP_TCD_CH_PRI_DPA_MASK          (0x40000000U)
+#define DMA_IP_TCD_CH_PRI_DPA(x)            DMA_IP_FIELD(x, 30U, DMA_IP_TCD_CH_PRI_DPA_MASK)
+#define DMA_IP_TCD_CH_PRI_ECP_MASK          (0x80000000U)
+#define DMA_IP_TCD_CH_PRI_ECP(x)            DMA_IP_FIELD(x, 31U, DMA_IP_TCD_CH_PRI_ECP_MASK)
+
+#define DMA_IP_TCD_SADDR_SADDR(x)           ((uint32)(x))
+#define DMA_IP_TCD_DADDR_DADDR(x)           ((uint32)(x))
+#define DMA_IP_TCD_SLAST_SDA_SLAST_SDA(x)   ((uint32)(x))
+#define DMA_IP_TCD_DLAST_SGA_DLAST_SGA(x)   ((uint32)(x))
+#define DMA_IP_TCD_SOFF_SOFF_MASK           (0xFFFFU)
+#define DMA_IP_TCD_SOFF_SOFF(x)             DMA_IP_FIELD(x, 0U, DMA_IP_TCD_SOFF_SOFF_MASK)
+#define DMA_IP_TCD_DOFF_DOFF_MASK           (0xFFFFU)
+#define DMA_IP_TCD_DOFF_DOFF(x)             DMA_IP_FIELD(x, 0U, DMA_IP_TCD_DOFF_DOFF_MASK)
+#define DMA_IP_TCD_ATTR_DSIZE_MASK          (0x0007U)
+#define DMA_IP_TCD_ATTR_DSIZE(x)            DMA_IP_FIELD(x, 0U, DMA_IP_TCD_ATTR_DSIZE_MASK)
+#define DMA_IP_TCD_ATTR_DMOD_MASK           (0x00F8U)
+#define DMA_IP_TCD_ATTR_DMOD(x)             DMA_IP_FIELD(x, 3U, DMA_IP_TCD_ATTR_DMOD_MASK)
+#define DMA_IP_TCD_ATTR_SSIZE_MASK          (0x0700U)
+#define DMA_IP_TCD_ATTR_SSIZE(x)            DMA_IP_FIELD(x, 8U, DMA_IP_TCD_ATTR_SSIZE_MASK)
+#define DMA_IP_TCD_ATTR_SMOD_MASK           (0xF800U)
+#define DMA_IP_TCD_ATTR_SMOD(x)             DMA_IP_FIELD(x, 11U, DMA_IP_TCD_ATTR_SMOD_MASK)
+#define DMA_IP_TCD_NBYTES_MLOFFNO_NBYTES_MASK   (0x3FFFFFFFU)
+#define DMA_IP_TCD_NBYTES_MLOFFNO_NBYTES(x)     DMA_IP_FIELD(x, 0U, DMA_IP_TCD_NBYTES_MLOFFNO_NBYTES_MASK)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_NBYTES_MASK  (0x000003FFU)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_NBYTES(x)    DMA_IP_FIELD(x, 0U, DMA_IP_TCD_NBYTES_MLOFFYES_NBYTES_MASK)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_MLOFF_MASK   (0x3FFFFC00U)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_MLOFF(x)     DMA_IP_FIELD(x, 10U, DMA_IP_TCD_NBYTES_MLOFFYES_MLOFF_MASK)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_DMLOE_MASK   (0x40000000U)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_DMLOE(x)     DMA_IP_FIELD(x, 30U, DMA_IP_TCD_NBYTES_MLOFFYES_DMLOE_MASK)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_SMLOE_MASK   (0x80000000U)
+#define DMA_IP_TCD_NBYTES_MLOFFYES_SMLOE(x)     DMA_IP_FIELD(x, 31U, DMA_IP_TCD_NBYTES_MLOFFYES_SMLOE_MASK)
+#define DMA_IP_TCD_CITER_ELINKNO_CITER_MASK     (0x7FFFU)
+#define DMA_IP_TCD_CITER_ELINKNO_CITER_SHIFT    (0U)
+#define DMA_IP_TCD_CITER_ELINKNO_CITER(x)       DMA_IP_FIELD(x, 0U, DMA_IP_TCD_CITER_ELINKNO_CITER_MASK)
+#define DMA_IP_TCD_CITER_ELINKYES_CITER_MASK    (0x01FFU)
+#define DMA_IP_TCD_CITER_ELINKYES_CITER_SHIFT   (0U)
+#define DMA_IP_TCD_CITER_ELINKYES_CITER(x)      DMA_IP_FIELD(x, 0U, DMA_IP_TCD_CITER_ELINKYES_CITER_MASK)
+#define DMA_IP_TCD_CITER_ELINKYES_LINKCH_MASK   (0x3E00U)
+#define DMA_IP_TCD_CITER_ELINKYES_LINKCH(x)     DMA_IP_FIELD(x, 9U, DMA_IP_TCD_CITER_ELINKYES_LINKCH_MASK)
+#define DMA_IP_TCD_CITER_ELINKYES_ELINK_MASK    (0x8000U)
+#define DMA_IP_TCD_CITER_ELINKYES_ELINK(x)      DMA_IP_FIELD(x, 15U, DMA_IP_TCD_CITER_ELINKYES_ELINK_MASK)
+#define DMA_IP_TCD_BITER_ELINKNO_BITER_MASK     (0x7FFFU)
+#define DMA_IP_TCD_BITER_ELINKNO_BITER_SHIFT    (0U)
+#define DMA_IP_TCD_BITER_ELINKNO_BITER(x)       DMA_IP_FIELD(x, 0U, DMA_IP_TCD_BITER_ELINKNO_BITER_MASK)
+#define DMA_IP_TCD_BITER_ELINKYES_BITER_MASK    (0x01FFU)
+#define DMA_IP_TCD_BITER_ELINKYES_BITER_SHIFT   (0U)
+#define DMA_IP_TCD_BITER_ELINKYES_BITER(x)      DMA_IP_FIELD(x, 0U, DMA_IP_TCD_BITER_ELINKYES_BITER_MASK)
+#define DMA_IP_TCD_BITER_ELINKYES_LINKCH_MASK   (0x3E00U)
+#define DMA_IP_TCD_BITER_ELINKYES_LINKCH(x)     DMA_IP_FIELD(x, 9U, DMA_IP_TCD_BITER_ELINKYES_LINKCH_MASK)
+#define DMA_IP_TCD_BITER_ELINKYES_ELINK_MASK    (0x8000U)
+#define DMA_IP_TCD_BITER_ELINKYES_ELINK(x)      DMA_IP_FIELD(x, 15U, DMA_IP_TCD_BITER_ELINKYES_ELINK_MASK)
+#define DMA_IP_TCD_CSR_START_MASK           (0x0001U)
+#define DMA_IP_TCD_CSR_START(x)             DMA_IP_FIELD(x, 0U, DMA_IP_TCD_CSR_START_MASK)
+#define DMA_IP_TCD_CSR_INTMAJOR_MASK        (0x0002U)
+#define DMA_IP_TCD_CSR_INTMAJOR_SHIFT       (1U)
+#define DMA_IP_TCD_CSR_INTMAJOR(x)          DMA_IP_FIELD(x, 1U, DMA_IP_TCD_CSR_INTMAJOR_MASK)
+#define DMA_IP_TCD_CSR_INTHALF_MASK         (0x0004U)
+#define DMA_IP_TCD_CSR_INTHALF_SHIFT        (2U)
+#define DMA_IP_TCD_CSR_INTHALF(x)           DMA_IP_FIELD(x, 2U, DMA_IP_TCD_CSR_INTHALF_MASK)
+#define DMA_IP_TCD_CSR_DREQ_MASK            (0x0008U)
+#define DMA_IP_TCD_CSR_DREQ(x)              DMA_IP_FIELD(x, 3U, DMA_IP_TCD_CSR_DREQ_MASK)
+#define DMA_IP_TCD_CSR_ESG_MASK             (0x0010U)
+#define DMA_IP_TCD_CSR_ESG(x)               DMA_IP_FIELD(x, 4U, DMA_IP_TCD_CSR_ESG_MASK)
+#define DMA_IP_TCD_CSR_MAJORELINK_MASK      (0x0020U)
+#define DMA_IP_TCD_CSR_MAJORELINK(x)        DMA_IP_FIELD(x, 5U, DMA_IP_TCD_CSR_MAJORELINK_MASK)
+#define DMA_IP_TCD_CSR_EEOP_MASK            (0x0040U)
+#define DMA_IP_TCD_CSR_EEOP(x)              DMA_IP_FIELD(x, 6U, DMA_IP_TCD_CSR_EEOP_MASK)
+#define DMA_IP_TCD_CSR_ESDA_MASK            (0x0080U)
+#define DMA_IP_TCD_CSR_ESDA(x)              DMA_IP_FIELD(x, 7U, DMA_IP_TCD_CSR_ESDA_MASK)
+#define DMA_IP_TCD_CSR_MAJORLINKCH_MASK     (0x1F00U)
+#define DMA_IP_TCD_CSR_MAJORLINKCH(x)       DMA_IP_FIELD(x, 8U, DMA_IP_TCD_CSR_MAJORLINKCH_MASK)
+#define DMA_IP_TCD_CSR_BWC_MASK             (0xC000U)
+#define DMA_IP_TCD_CSR_BWC(x)               DMA_IP_FIELD(x, 14U, DMA_IP_TCD_CSR_BWC_MASK)
+
+#endif /* DMA_IP_CFG_DEVICES_H */
@@ -0,0 +1,71 @@
+/*
+* Host model of the eMIOS register blocks and of the Emios_Mcl_Ip counter bus services the
+* eMIOS PWM driver calls, see Emios_Host.h.
+*/
+#include <string.h>
+#include "Emios_Host.h"
+#include "Emios_Mcl_Ip.h"
+
+eMIOS_Type Emios_Host_Regs[eMIOS_INSTANCE_COUNT];
+
+static uint32 bus_period[eMIOS_INSTANCE_COUNT][eMIOS_CH_UC_UC_COUNT];
+
+void Emios_Host_Reset(void)
+{
+    memset(Emios_Host_Regs, 0, sizeof(Emios_Host_Regs));
+    memset(bus_period, 0, sizeof(bus_period));
+}
+
+void Emios_Host_SetBus(uint8 Instance, uint8 Channel, uint32 Period, uint32 Mode)
+{
+    Emios_Host_Regs[Instance].CH.UC[Channel].A = Period;
+    Emios_Host_Regs[Instance].CH.UC[Channel].C = eMIOS_C_MODE(Mode);
+    bus_period[Instance][Channel] = Period;
+}
+
+void Emios_Host_RaiseFlag(uint8 Instance, uint8 Channel)
+{
+    Emios_Host_Regs[Instance].CH.UC[Channel].S |= eMIOS_S_FLAG_MASK;
+}
+
+void Emios_Mcl_Ip_ComparatorTransferEnable(uint8 Instance, uint32 ChannelMask)
+{
+    DevAssert(Instance < eMIOS_INSTANCE_COUNT);
+    Emios_Host_Regs[Instance].OUDIS &= ~ChannelMask;
+}
+
+void Emios_Mcl_Ip_ComparatorTransferDisable(uint8 Instance, uint32 ChannelMask)
+{
+    DevAssert(Instance < eMIOS_INSTANCE_COUNT);
+    Emios_Host_Regs[Instance].OUDIS |= ChannelMask;
+}
+
+Emios_Ip_CommonStatusType Emios_Mcl_Ip_SetCounterBusPeriod(uint8 HwInstance, uint8 HwChannel, uint32 Period)
+{
+    DevAssert(Period < 0x00FFFFFFU);
+    DevAssert(HwInstance < eMIOS_INSTANCE_COUNT);
+    DevAssert(HwChannel < eMIOS_CH_UC_UC_COUNT);
+    if (Period < 1U) {
+        return EMIOS_IP_COMMON_STATUS_FAIL;
+    }
+    Emios_Host_Regs[HwInstance].CH.UC[HwChannel].A = Period;
+    bus_period[HwInstance][HwChannel] = Period;
+
+    return EMIOS_IP_COMMON_STATUS_SUCCESS;
+}
+
+uint32 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel)
+{
+    DevAssert(Instance < eMIOS_INSTANCE_COUNT);
+    DevAssert(Channel < eMIOS_CH_UC_UC_COUNT);
+
+    return bus_period[Instance][Channel];
+}
+
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel)
+{
+    DevAssert(Instance < eMIOS_INSTANCE_COUNT);
+    DevAssert(Channel < eMIOS_CH_UC_UC_COUNT);
+
+    return Emios_Host_Regs[Instance].CH.UC[Channel].CNT;
+}
@@ -0,0 +1,21 @@
+/*
+* Host model of the eMIOS instances behind the Emios_Pwm_Ip driver: the unified channel
+* registers are RAM blocks and the counter buses the driver takes from Emios_Mcl_Ip are
+* plain periods set by the test. Write-one-to-clear flags are plain RAM, so a clear reads
+* back as the 1 the driver wrote; a test raises and clears the flags itself.
+*/
+#ifndef EMIOS_HOST_H
+#define EMIOS_HOST_H
+
+#include "Emios_Pwm_Ip_CfgDefines.h"
+
+/* Clear the register blocks and the bus periods */
+void Emios_Host_Reset(void);
+
+/* Set up a counter bus channel as Emios_Mcl_Ip would: period in A, MCB mode in C */
+void Emios_Host_SetBus(uint8 Instance, uint8 Channel, uint32 Period, uint32 Mode);
+
+/* Raise the FLAG of a channel, as a match on the counter bus does */
+void Emios_Host_RaiseFlag(uint8 Instance, uint8 Channel);
+
+#endif /* EMIOS_HOST_H */
@@ -0,0 +1,28 @@
+/*
+* Host stand-in for the Emios_Mcl_Ip counter bus services the eMIOS PWM driver calls, backed
+* by the register blocks of rtd/Emios_Host.c. Application tests without the driver use the
+* smaller stubs/Emios_Mcl_Ip.h instead.
+*/
+#ifndef EMIOS_MCL_IP_H
+#define EMIOS_MCL_IP_H
+
+#include "Std_Types.h"
+#include "Devassert.h"
+
+#define EMIOS_MCL_IP_AR_RELEASE_MAJOR_VERSION   4
+#define EMIOS_MCL_IP_AR_RELEASE_MINOR_VERSION   7
+
+typedef enum
+{
+    EMIOS_IP_COMMON_STATUS_SUCCESS      = E_OK,
+    EMIOS_IP_COMMON_STATUS_FAIL         = E_NOT_OK,
+    EMIOS_IP_COMMON_STATUS_WRONG_CORE   = 0x02U
+} Emios_Ip_CommonStatusType;
+
+void Emios_Mcl_Ip_ComparatorTransferEnable(uint8 Instance, uint32 ChannelMask);
+void Emios_Mcl_Ip_ComparatorTransferDisable(uint8 Instance, uint32 ChannelMask);
+Emios_Ip_CommonStatusType Emios_Mcl_Ip_SetCounterBusPeriod(uint8 HwInstance, uint8 HwChannel, uint32 Period);
+uint32 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel);
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel);
+
+#endif /* EMIOS_MCL_IP_H */
@@ -0,0 +1,43 @@
+/*
+* Host stand-in for the generated Emios_Pwm_Ip_Cfg.h: the three eMIOS instances fully used,
+* 72 channels. Channel index = 24 * instance + channel. Every mode is compiled
+* in, with the notifications and the AUTOSAR mode the Pwm driver configuration turns on.
+*/
+#ifndef EMIOS_PWM_IP_CFG_H
+#define EMIOS_PWM_IP_CFG_H
+
+#include "Emios_Pwm_Ip_CfgDefines.h"
+
+#define EMIOS_PWM_IP_CFG_VENDOR_ID                      43
+#define EMIOS_PWM_IP_CFG_AR_RELEASE_MAJOR_VERSION       4
+#define EMIOS_PWM_IP_CFG_AR_RELEASE_MINOR_VERSION       7
+#define EMIOS_PWM_IP_CFG_AR_RELEASE_REVISION_VERSION    0
+#define EMIOS_PWM_IP_CFG_SW_MAJOR_VERSION               5
+#define EMIOS_PWM_IP_CFG_SW_MINOR_VERSION               0
+#define EMIOS_PWM_IP_CFG_SW_PATCH_VERSION               0
+
+#define EMIOS_PWM_IP_USED                               (STD_ON)
+#define EMIOS_PWM_IP_DEV_ERROR_DETECT                   (STD_ON)
+#define EMIOS_PWM_IP_NO_CACHE_NEEDED                    (STD_OFF)
+#define EMIOS_PWM_IP_NOTIFICATION_SUPPORT               (STD_ON)
+#define EMIOS_PWM_IP_AUTOSAR_MODE_IS_USED               (STD_ON)
+
+#define EMIOS_PWM_IP_MODE_OPWFMB_USED
+#define EMIOS_PWM_IP_MODE_OPWMCB_USED
+#define EMIOS_PWM_IP_MODE_OPWMB_USED
+#define EMIOS_PWM_IP_MODE_OPWMT_USED
+#define EMIOS_PWM_IP_MODE_DAOC_USED
+#define EMIOS_PWM_IP_MODE_OPWMC_USED
+#define EMIOS_PWM_IP_MODE_OPWM_USED
+#define EMIOS_PWM_IP_MODE_OPWFM_USED
+
+#define EMIOS_PWM_IP_NUM_OF_CHANNELS_USED_U8            ((uint8)72U)
+
+#define EMIOS_HOST_INSTANCE(b)  { (b) + 0U,  (b) + 1U,  (b) + 2U,  (b) + 3U,  (b) + 4U,  (b) + 5U,  \
+                                  (b) + 6U,  (b) + 7U,  (b) + 8U,  (b) + 9U,  (b) + 10U, (b) + 11U, \
+                                  (b) + 12U, (b) + 13U, (b) + 14U, (b) + 15U, (b) + 16U, (b) + 17U, \
+                                  (b) + 18U, (b) + 19U, (b) + 20U, (b) + 21U, (b) + 22U, (b) + 23U }
+#define EMIOS_PWM_IP_USED_CHANNELS                      { EMIOS_HOST_INSTANCE(0U), EMIOS_HOST_INSTANCE(24U), \
+                                                          EMIOS_HOST_INSTANCE(48U) }
+
+#endif /* EMIOS_PWM_IP_CFG_H */
@@ -0,0 +1,181 @@
+/*
+* Host stand-in for the generated Emios_Pwm_Ip_CfgDefines.h and the eMIOS part of the device
+* header. The unified channel registers follow the S32K344 layout; the base pointers select
+* the RAM blocks of rtd/Emios_Host.c, which a host test drives and inspects in place of the
+* peripheral. 24-bit counters and all PWM modes on every channel.
+*/
+#ifndef EMIOS_PWM_IP_CFGDEFINES_H
+#define EMIOS_PWM_IP_CFGDEFINES_H
+
+#include "Mcal.h"
+
+#define EMIOS_PWM_IP_CFGDEFINES_VENDOR_ID                    43
+#define EMIOS_PWM_IP_CFGDEFINES_AR_RELEASE_MAJOR_VERSION     4
+#define EMIOS_PWM_IP_CFGDEFINES_AR_RELEASE_MINOR_VERSION     7
+#define EMIOS_PWM_IP_CFGDEFINES_AR_RELEASE_REVISION_VERSION  0
+#define EMIOS_PWM_IP_CFGDEFINES_SW_MAJOR_VERSION             5
+#define EMIOS_PWM_IP_CFGDEFINES_SW_MINOR_VERSION             0
+#define EMIOS_PWM_IP_CFGDEFINES_SW_PATCH_VERSION             0
+
+/*==================================================================================================
+*                                     Register layout
+==================================================================================================*/
+#define eMIOS_INSTANCE_COUNT                (3U)
+#define eMIOS_CH_UC_UC_COUNT                (24U)
+
+typedef struct {
+    volatile uint32 MCR;
+    volatile uint32 GFLAG;
+    volatile uint32 OUDIS;
+    volatile uint32 UCDIS;
+    uint8 RESERVED_0[16];
+    union {
+        struct {
+            volatile uint32 A;
+            volatile uint32 B;
+            volatile uint32 CNT;
+            volatile uint32 C;
+            volatile uint32 S;
+            volatile uint32 ALTA;
+            volatile uint32 C2;
+            uint8 RESERVED_0[4];
+        } UC[eMIOS_CH_UC_UC_COUNT];
+    } CH;
+} eMIOS_Type;
+
+extern eMIOS_Type Emios_Host_Regs[eMIOS_INSTANCE_COUNT];
+#define IP_eMIOS_BASE_PTRS                  { &Emios_Host_Regs[0], &Emios_Host_Regs[1], &Emios_Host_Regs[2] }
+
+#define EMIOS_HOST_FIELD(x, shift, mask)    ((((uint32)(x)) << (shift)) & (mask))
+
+#define eMIOS_MCR_GPRE_MASK                 (0x0000FF00U)
+#define eMIOS_MCR_GPRE_SHIFT                (8U)
+#define eMIOS_MCR_GPRE(x)                   EMIOS_HOST_FIELD(x, eMIOS_MCR_GPRE_SHIFT, eMIOS_MCR_GPRE_MASK)
+#define eMIOS_MCR_GPREN_MASK                (0x04000000U)
+#define eMIOS_MCR_GPREN_SHIFT               (26U)
+#define eMIOS_MCR_GPREN(x)                  EMIOS_HOST_FIELD(x, eMIOS_MCR_GPREN_SHIFT, eMIOS_MCR_GPREN_MASK)
+#define eMIOS_MCR_GTBE_MASK                 (0x10000000U)
+#define eMIOS_MCR_GTBE_SHIFT                (28U)
+#define eMIOS_MCR_GTBE(x)                   EMIOS_HOST_FIELD(x, eMIOS_MCR_GTBE_SHIFT, eMIOS_MCR_GTBE_MASK)
+#define eMIOS_MCR_FRZ_MASK                  (0x20000000U)
+#define eMIOS_MCR_FRZ_SHIFT                 (29U)
+#define eMIOS_MCR_FRZ(x)                    EMIOS_HOST_FIELD(x, eMIOS_MCR_FRZ_SHIFT, eMIOS_MCR_FRZ_MASK)
+#define eMIOS_MCR_MDIS_MASK                 (0x40000000U)
+#define eMIOS_MCR_MDIS_SHIFT                (30U)
+#define eMIOS_MCR_MDIS(x)                   EMIOS_HOST_FIELD(x, eMIOS_MCR_MDIS_SHIFT, eMIOS_MCR_MDIS_MASK)
+
+#define eMIOS_OUDIS_OU0_MASK                (0x00000001U)
+#define eMIOS_OUDIS_OU0_SHIFT               (0U)
+#define eMIOS_OUDIS_OU0(x)                  EMIOS_HOST_FIELD(x, eMIOS_OUDIS_OU0_SHIFT, eMIOS_OUDIS_OU0_MASK)
+
+#define eMIOS_A_A_MASK                      (0x00FFFFFFU)
+#define eMIOS_A_A_SHIFT                     (0U)
+#define eMIOS_A_A(x)                        EMIOS_HOST_FIELD(x, eMIOS_A_A_SHIFT, eMIOS_A_A_MASK)
+#define eMIOS_B_B_MASK                      (0x00FFFFFFU)
+#define eMIOS_B_B_SHIFT                     (0U)
+#define eMIOS_B_B(x)                        EMIOS_HOST_FIELD(x, eMIOS_B_B_SHIFT, eMIOS_B_B_MASK)
+#define eMIOS_CNT_C_MASK                    (0x00FFFFFFU)
+#define eMIOS_CNT_C_SHIFT                   (0U)
+#define eMIOS_CNT_C(x)                      EMIOS_HOST_FIELD(x, eMIOS_CNT_C_SHIFT, eMIOS_CNT_C_MASK)
+#define eMIOS_ALTA_ALTA_MASK                (0x00FFFFFFU)
+#define eMIOS_ALTA_ALTA_SHIFT               (0U)
+#define eMIOS_ALTA_ALTA(x)                  EMIOS_HOST_FIELD(x, eMIOS_ALTA_ALTA_SHIFT, eMIOS_ALTA_ALTA_MASK)
+
+#define eMIOS_C_MODE_MASK                   (0x0000007FU)
+#define eMIOS_C_MODE_SHIFT                  (0U)
+#define eMIOS_C_MODE(x)                     EMIOS_HOST_FIELD(x, eMIOS_C_MODE_SHIFT, eMIOS_C_MODE_MASK)
+#define eMIOS_C_EDPOL_MASK                  (0x00000080U)
+#define eMIOS_C_EDPOL_SHIFT                 (7U)
+#define eMIOS_C_EDPOL(x)                    EMIOS_HOST_FIELD(x, eMIOS_C_EDPOL_SHIFT, eMIOS_C_EDPOL_MASK)
+#define eMIOS_C_EDSEL_MASK                  (0x00000100U)
+#define eMIOS_C_EDSEL_SHIFT                 (8U)
+#define eMIOS_C_EDSEL(x)                    EMIOS_HOST_FIELD(x, eMIOS_C_EDSEL_SHIFT, eMIOS_C_EDSEL_MASK)
+#define eMIOS_C_BSL_MASK                    (0x00000600U)
+#define eMIOS_C_BSL_SHIFT                   (9U)
+#define eMIOS_C_BSL(x)                      EMIOS_HOST_FIELD(x, eMIOS_C_BSL_SHIFT, eMIOS_C_BSL_MASK)
+#define eMIOS_C_FORCMB_MASK                 (0x00001000U)
+#define eMIOS_C_FORCMB_SHIFT                (12U)
+#define eMIOS_C_FORCMB(x)                   EMIOS_HOST_FIELD(x, eMIOS_C_FORCMB_SHIFT, eMIOS_C_FORCMB_MASK)
+#define eMIOS_C_FORCMA_MASK                 (0x00002000U)
+#define eMIOS_C_FORCMA_SHIFT                (13U)
+#define eMIOS_C_FORCMA(x)                   EMIOS_HOST_FIELD(x, eMIOS_C_FORCMA_SHIFT, eMIOS_C_FORCMA_MASK)
+#define eMIOS_C_FEN_MASK                    (0x00020000U)
+#define eMIOS_C_FEN_SHIFT                   (17U)
+#define eMIOS_C_FEN(x)                      EMIOS_HOST_FIELD(x, eMIOS_C_FEN_SHIFT, eMIOS_C_FEN_MASK)
+#define eMIOS_C_FCK_MASK                    (0x00040000U)
+#define eMIOS_C_FCK_SHIFT                   (18U)
+#define eMIOS_C_FCK(x)                      EMIOS_HOST_FIELD(x, eMIOS_C_FCK_SHIFT, eMIOS_C_FCK_MASK)
+#define eMIOS_C_IF_MASK                     (0x00780000U)
+#define eMIOS_C_IF_SHIFT                    (19U)
+#define eMIOS_C_IF(x)                       EMIOS_HOST_FIELD(x, eMIOS_C_IF_SHIFT, eMIOS_C_IF_MASK)
+#define eMIOS_C_DMA_MASK                    (0x01000000U)
+#define eMIOS_C_DMA_SHIFT                   (24U)
+#define eMIOS_C_DMA(x)                      EMIOS_HOST_FIELD(x, eMIOS_C_DMA_SHIFT, eMIOS_C_DMA_MASK)
+#define eMIOS_C_UCPREN_MASK                 (0x02000000U)
+#define eMIOS_C_UCPREN_SHIFT                (25U)
+#define eMIOS_C_UCPREN(x)                   EMIOS_HOST_FIELD(x, eMIOS_C_UCPREN_SHIFT, eMIOS_C_UCPREN_MASK)
+#define eMIOS_C_UCPRE_MASK                  (0x0C000000U)
+#define eMIOS_C_UCPRE_SHIFT                 (26U)
+#define eMIOS_C_UCPRE(x)                    EMIOS_HOST_FIELD(x, eMIOS_C_UCPRE_SHIFT, eMIOS_C_UCPRE_MASK)
+#define eMIOS_C_ODISSL_MASK                 (0x30000000U)
+#define eMIOS_C_ODISSL_SHIFT                (28U)
+#define eMIOS_C_ODISSL(x)                   EMIOS_HOST_FIELD(x, eMIOS_C_ODISSL_SHIFT, eMIOS_C_ODISSL_MASK)
+#define eMIOS_C_ODIS_MASK                   (0x40000000U)
+#define eMIOS_C_ODIS_SHIFT                  (30U)
+#define eMIOS_C_ODIS(x)                     EMIOS_HOST_FIELD(x, eMIOS_C_ODIS_SHIFT, eMIOS_C_ODIS_MASK)
+#define eMIOS_C_FREN_MASK                   (0x80000000U)
+#define eMIOS_C_FREN_SHIFT                  (31U)
+#define eMIOS_C_FREN(x)                     EMIOS_HOST_FIELD(x, eMIOS_C_FREN_SHIFT, eMIOS_C_FREN_MASK)
+
+#define eMIOS_S_FLAG_MASK                   (0x00000001U)
+#define eMIOS_S_FLAG_SHIFT                  (0U)
+#define eMIOS_S_FLAG(x)                     EMIOS_HOST_FIELD(x, eMIOS_S_FLAG_SHIFT, eMIOS_S_FLAG_MASK)
+#define eMIOS_S_UCOUT_MASK                  (0x00000002U)
+#define eMIOS_S_UCOUT_SHIFT                 (1U)
+#define eMIOS_S_UCOUT(x)                    EMIOS_HOST_FIELD(x, eMIOS_S_UCOUT_SHIFT, eMIOS_S_UCOUT_MASK)
+#define eMIOS_S_UCIN_MASK                   (0x00000004U)
+#define eMIOS_S_UCIN_SHIFT                  (2U)
+#define eMIOS_S_OVFL_MASK                   (0x00008000U)
+#define eMIOS_S_OVFL_SHIFT                  (15U)
+#define eMIOS_S_OVFL(x)                     EMIOS_HOST_FIELD(x, eMIOS_S_OVFL_SHIFT, eMIOS_S_OVFL_MASK)
+#define eMIOS_S_OVR_MASK                    (0x80000000U)
+#define eMIOS_S_OVR_SHIFT                   (31U)
+#define eMIOS_S_OVR(x)                      EMIOS_HOST_FIELD(x, eMIOS_S_OVR_SHIFT, eMIOS_S_OVR_MASK)
+
+#define eMIOS_C2_UCRELDEL_INT_MASK          (0x0000001FU)
+#define eMIOS_C2_UCPRECLK_MASK              (0x00004000U)
+#define eMIOS_C2_UCPRECLK_SHIFT             (14U)
+#define eMIOS_C2_UCPRECLK(x)                EMIOS_HOST_FIELD(x, eMIOS_C2_UCPRECLK_SHIFT, eMIOS_C2_UCPRECLK_MASK)
+#define eMIOS_C2_UCEXTPRE_MASK              (0x000F0000U)
+#define eMIOS_C2_UCEXTPRE_SHIFT             (16U)
+#define eMIOS_C2_UCEXTPRE(x)                EMIOS_HOST_FIELD(x, eMIOS_C2_UCEXTPRE_SHIFT, eMIOS_C2_UCEXTPRE_MASK)
+
+/*==================================================================================================
+*                                     Driver definitions
+==================================================================================================*/
+typedef eMIOS_Type Emios_Pwm_Ip_HwAddrType;
+
+#define EMIOS_PWM_IP_INSTANCE_COUNT         (eMIOS_INSTANCE_COUNT)
+#define EMIOS_PWM_IP_CHANNEL_COUNT          (eMIOS_CH_UC_UC_COUNT)
+#define EMIOS_PWM_IP_TIMER_WIDTH_24BITS
+#define EMIOS_PWM_IP_MAX_CNT_VAL            (0x00FFFFFFUL)
+#define EMIOS_PWM_IP_MIN_CNT_VAL            (0x00000001UL)
+
+/* Counter bus channels: A on 23, F on 22, B, C, D and E on the first channel of each group of 8 */
+#define EMIOS_PWM_IP_COUNTER_BUS_A          (23U)
+#define EMIOS_PWM_IP_COUNTER_BUS_F          (22U)
+#define EMIOS_PWM_IP_COUNTER_BUS_BCDE       (0xF8U)
+
+typedef uint32 Emios_Pwm_Ip_PeriodType;
+typedef uint32 Emios_Pwm_Ip_DutyType;
+
+/* Channels that support each mode, one word per mode and instance: all of them on the host */
+#define EMIOS_PWM_IP_MODES                  (8U)
+#define EMIOS_HOST_ALL_CHANNELS             (0x00FFFFFFUL)
+#define EMIOS_HOST_ALL_MODES                { EMIOS_HOST_ALL_CHANNELS, EMIOS_HOST_ALL_CHANNELS, \
+                                              EMIOS_HOST_ALL_CHANNELS, EMIOS_HOST_ALL_CHANNELS, \
+                                              EMIOS_HOST_ALL_CHANNELS, EMIOS_HOST_ALL_CHANNELS, \
+                                              EMIOS_HOST_ALL_CHANNELS, EMIOS_HOST_ALL_CHANNELS }
+#define EMIOS_PWM_IP_CHANNEL_MODES          { EMIOS_HOST_ALL_MODES, EMIOS_HOST_ALL_MODES, EMIOS_HOST_ALL_MODES }
+
+#endif /* EMIOS_PWM_IP_CFGDEFINES_H */
@@ -0,0 +1,39 @@
+/*
+* Host model of the FlexIO register block and of a transmit shifter, see Flexio_Host.h.
+*/
+#include <string.h>
+#include "Flexio_Host.h"
+
+#define FIELD(Reg, Mask, Shift)     (((Reg) & (Mask)) >> (Shift))
+
+FLEXIO_Type Flexio_Host_Regs;
+
+void Flexio_Host_Reset(void)
+{
+    (void)memset(&Flexio_Host_Regs, 0, sizeof(Flexio_Host_Regs));
+}
+
+uint32 Flexio_Host_ShiftWord(uint8 Shifter, uint8 Bits[])
+{
+    uint32 shiftctl = Flexio_Host_Regs.SHIFTCTL[Shifter];
+    uint32 timer = FIELD(shiftctl, FLEXIO_SHIFTCTL_TIMSEL_MASK, FLEXIO_SHIFTCTL_TIMSEL_SHIFT);
+    uint32 timctl = Flexio_Host_Regs.TIMCTL[timer];
+    uint32 timcfg = Flexio_Host_Regs.TIMCFG[timer];
+    uint32 word = Flexio_Host_Regs.SHIFTBUFBIS[Shifter];
+    uint32 bits = 0U;
+    uint32 i;
+
+    if ((FIELD(shiftctl, FLEXIO_SHIFTCTL_SMOD_MASK, 0U) == (uint32)FLEXIO_SHIFTER_MODE_TRANSMIT) &&
+        (((Flexio_Host_Regs.SHIFTSDEN >> Shifter) & 1U) != 0U) &&
+        (FIELD(timctl, FLEXIO_TIMCTL_TIMOD_MASK, 0U) == (uint32)FLEXIO_TIMER_MODE_8BIT_BAUD) &&
+        (FIELD(timctl, FLEXIO_TIMCTL_TRGSEL_MASK, FLEXIO_TIMCTL_TRGSEL_SHIFT) == ((Shifter * 4U) + 1U)) &&
+        (FIELD(timcfg, FLEXIO_TIMCFG_TIMENA_MASK, FLEXIO_TIMCFG_TIMENA_SHIFT) == (uint32)FLEXIO_TIMER_ENABLE_TRG_HIGH) &&
+        (FIELD(timcfg, FLEXIO_TIMCFG_TIMDIS_MASK, FLEXIO_TIMCFG_TIMDIS_SHIFT) == (uint32)FLEXIO_TIMER_DISABLE_TIM_CMP)) {
+        bits = (((Flexio_Host_Regs.TIMCMP[timer] >> 8U) & 0xFFU) + 1U) / 2U;
+        for (i = 0U; i < bits; i++) {
+            Bits[i] = (uint8)((word >> (31U - i)) & 1U);
+        }
+    }
+
+    return bits;
+}
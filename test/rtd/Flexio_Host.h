@@ -0,0 +1,20 @@
+/*
+* Host model of the FlexIO instance behind the Flexio_Mcl_Ip driver: the registers are a RAM
+* block, and a transmit shifter sends the word last written to its SHIFTBUFBIS when the test
+* asks, as its clock timer would once the eDMA has filled the buffer.
+*/
+#ifndef FLEXIO_HOST_H
+#define FLEXIO_HOST_H
+
+#include "Flexio_Mcl_Ip_HwAccess.h"
+
+/* Clear the register block */
+void Flexio_Host_Reset(void);
+
+/* Shift out the buffer of a transmit shifter, most significant bit first, into Bits[], one bit
+   per entry. The number of bits comes from the compare value of the timer selected by the
+   shifter. Returns 0 unless the shifter transmits, requests DMA, and its timer is an 8-bit
+   baud timer started by the shifter status flag and stopped on compare. */
+uint32 Flexio_Host_ShiftWord(uint8 Shifter, uint8 Bits[]);
+
+#endif /* FLEXIO_HOST_H */
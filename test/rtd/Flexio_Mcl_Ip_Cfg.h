@@ -0,0 +1,20 @@
+/*
+* Host stand-in for the generated Flexio_Mcl_Ip configuration: development error detection on,
+* so the register helpers check their shifter, timer and pin arguments.
+*/
+#ifndef FLEXIO_MCL_IP_CFG_H
+#define FLEXIO_MCL_IP_CFG_H
+
+#include "Mcal.h"
+
+#define FLEXIO_MCL_IP_CFG_VENDOR_ID                     43
+#define FLEXIO_MCL_IP_CFG_AR_RELEASE_MAJOR_VERSION      4
+#define FLEXIO_MCL_IP_CFG_AR_RELEASE_MINOR_VERSION      7
+#define FLEXIO_MCL_IP_CFG_AR_RELEASE_REVISION_VERSION   0
+#define FLEXIO_MCL_IP_CFG_SW_MAJOR_VERSION              5
+#define FLEXIO_MCL_IP_CFG_SW_MINOR_VERSION              0
+#define FLEXIO_MCL_IP_CFG_SW_PATCH_VERSION              0
+
+#define FLEXIO_MCL_IP_DEV_ERROR_DETECT      (STD_ON)
+
+#endif /* FLEXIO_MCL_IP_CFG_H */
@@ -0,0 +1,21 @@
+/*
+* Host stand-in for the generated Flexio_Mcl_Ip feature defines of the S32K344: pin status and
+* timer DMA requests are available.
+*/
+#ifndef FLEXIO_MCL_IP_CFG_DEFINES_H
+#define FLEXIO_MCL_IP_CFG_DEFINES_H
+
+#include "Mcal.h"
+
+#define FLEXIO_MCL_IP_CFG_DEFINES_VENDOR_ID                     43
+#define FLEXIO_MCL_IP_CFG_DEFINES_AR_RELEASE_MAJOR_VERSION      4
+#define FLEXIO_MCL_IP_CFG_DEFINES_AR_RELEASE_MINOR_VERSION      7
+#define FLEXIO_MCL_IP_CFG_DEFINES_AR_RELEASE_REVISION_VERSION   0
+#define FLEXIO_MCL_IP_CFG_DEFINES_SW_MAJOR_VERSION              5
+#define FLEXIO_MCL_IP_CFG_DEFINES_SW_MINOR_VERSION              0
+#define FLEXIO_MCL_IP_CFG_DEFINES_SW_PATCH_VERSION              0
+
+#define FLEXIO_MCL_IP_PIN_STS_IS_AVAILABLE      (STD_ON)
+#define FLEXIO_MCL_IP_TIMERSDEN_IS_AVAILABLE    (STD_ON)
+
+#endif /* FLEXIO_MCL_IP_CFG_DEFINES_H */
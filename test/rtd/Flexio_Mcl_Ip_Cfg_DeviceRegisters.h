@@ -0,0 +1,122 @@
+/*
+* Host stand-in for the FlexIO device description the Flexio_Mcl_Ip driver takes from the
+* S32K344 header. The register file and field layout follow the S32K344 FLEXIO block with
+* eight shifters, eight timers and 32 pins; the base pointer selects a RAM block defined by
+* rtd/Flexio_Host.c in place of the peripheral.
+*/
+#ifndef FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_H
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_H
+
+#include "Mcal.h"
+
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_VENDOR_ID                     43
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_AR_RELEASE_MAJOR_VERSION      4
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_AR_RELEASE_MINOR_VERSION      7
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_AR_RELEASE_REVISION_VERSION   0
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_SW_MAJOR_VERSION              5
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_SW_MINOR_VERSION              0
+#define FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_SW_PATCH_VERSION              0
+
+#define FLEXIO_SHIFTCTL_COUNT       (8U)
+#define FLEXIO_SHIFTCFG_COUNT       (8U)
+#define FLEXIO_SHIFTBUF_COUNT       (8U)
+#define FLEXIO_SHIFTBUFBIS_COUNT    (8U)
+#define FLEXIO_TIMCTL_COUNT         (8U)
+#define FLEXIO_TIMCFG_COUNT         (8U)
+#define FLEXIO_TIMCMP_COUNT         (8U)
+
+typedef struct {
+    volatile uint32 VERID;
+    volatile uint32 PARAM;
+    volatile uint32 CTRL;
+    volatile uint32 PIN;
+    volatile uint32 SHIFTSTAT;
+    volatile uint32 SHIFTERR;
+    volatile uint32 TIMSTAT;
+    volatile uint32 SHIFTSIEN;
+    volatile uint32 SHIFTEIEN;
+    volatile uint32 TIMIEN;
+    volatile uint32 SHIFTSDEN;
+    volatile uint32 TIMERSDEN;
+    volatile uint32 SHIFTSTATE;
+    volatile uint32 TRGSTAT;
+    volatile uint32 TRIGIEN;
+    volatile uint32 PINSTAT;
+    volatile uint32 PINIEN;
+    volatile uint32 PINREN;
+    volatile uint32 PINFEN;
+    volatile uint32 PINOUTD;
+    volatile uint32 PINOUTE;
+    volatile uint32 SHIFTCTL[FLEXIO_SHIFTCTL_COUNT];
+    volatile uint32 SHIFTCFG[FLEXIO_SHIFTCFG_COUNT];
+    volatile uint32 SHIFTBUF[FLEXIO_SHIFTBUF_COUNT];
+    volatile uint32 SHIFTBUFBIS[FLEXIO_SHIFTBUFBIS_COUNT];
+    volatile uint32 TIMCTL[FLEXIO_TIMCTL_COUNT];
+    volatile uint32 TIMCFG[FLEXIO_TIMCFG_COUNT];
+    volatile uint32 TIMCMP[FLEXIO_TIMCMP_COUNT];
+} FLEXIO_Type;
+
+#define FLEXIO_FIELD(x, Shift, Mask)        (((uint32)(x) << (Shift)) & (Mask))
+
+#define FLEXIO_CTRL_FLEXEN_MASK             (0x1U)
+#define FLEXIO_CTRL_FLEXEN(x)               FLEXIO_FIELD(x, 0U, FLEXIO_CTRL_FLEXEN_MASK)
+#define FLEXIO_CTRL_SWRST_MASK              (0x2U)
+#define FLEXIO_CTRL_SWRST(x)                FLEXIO_FIELD(x, 1U, FLEXIO_CTRL_SWRST_MASK)
+#define FLEXIO_CTRL_DBGE_MASK               (0x40000000U)
+#define FLEXIO_CTRL_DBGE(x)                 FLEXIO_FIELD(x, 30U, FLEXIO_CTRL_DBGE_MASK)
+
+#define FLEXIO_SHIFTCTL_SMOD_MASK           (0x7U)
+#define FLEXIO_SHIFTCTL_SMOD(x)             FLEXIO_FIELD(x, 0U, FLEXIO_SHIFTCTL_SMOD_MASK)
+#define FLEXIO_SHIFTCTL_PINPOL(x)           FLEXIO_FIELD(x, 7U, 0x80U)
+#define FLEXIO_SHIFTCTL_PINSEL_MASK         (0x1F00U)
+#define FLEXIO_SHIFTCTL_PINSEL_SHIFT        (8U)
+#define FLEXIO_SHIFTCTL_PINSEL(x)           FLEXIO_FIELD(x, 8U, FLEXIO_SHIFTCTL_PINSEL_MASK)
+#define FLEXIO_SHIFTCTL_PINCFG_MASK         (0x30000U)
+#define FLEXIO_SHIFTCTL_PINCFG_SHIFT        (16U)
+#define FLEXIO_SHIFTCTL_PINCFG(x)           FLEXIO_FIELD(x, 16U, FLEXIO_SHIFTCTL_PINCFG_MASK)
+#define FLEXIO_SHIFTCTL_TIMPOL_MASK         (0x800000U)
+#define FLEXIO_SHIFTCTL_TIMPOL(x)           FLEXIO_FIELD(x, 23U, FLEXIO_SHIFTCTL_TIMPOL_MASK)
+#define FLEXIO_SHIFTCTL_TIMSEL_MASK         (0x7000000U)
+#define FLEXIO_SHIFTCTL_TIMSEL_SHIFT        (24U)
+#define FLEXIO_SHIFTCTL_TIMSEL(x)           FLEXIO_FIELD(x, 24U, FLEXIO_SHIFTCTL_TIMSEL_MASK)
+
+#define FLEXIO_SHIFTCFG_SSTART(x)           FLEXIO_FIELD(x, 0U, 0x3U)
+#define FLEXIO_SHIFTCFG_SSTOP(x)            FLEXIO_FIELD(x, 4U, 0x30U)
+#define FLEXIO_SHIFTCFG_INSRC(x)            FLEXIO_FIELD(x, 8U, 0x100U)
+
+#define FLEXIO_TIMCTL_TIMOD_MASK            (0x7U)
+#define FLEXIO_TIMCTL_TIMOD(x)              FLEXIO_FIELD(x, 0U, FLEXIO_TIMCTL_TIMOD_MASK)
+#define FLEXIO_TIMCTL_PINPOL(x)             FLEXIO_FIELD(x, 7U, 0x80U)
+#define FLEXIO_TIMCTL_PINSEL_MASK           (0x1F00U)
+#define FLEXIO_TIMCTL_PINSEL_SHIFT          (8U)
+#define FLEXIO_TIMCTL_PINSEL(x)             FLEXIO_FIELD(x, 8U, FLEXIO_TIMCTL_PINSEL_MASK)
+#define FLEXIO_TIMCTL_PINCFG_MASK           (0x30000U)
+#define FLEXIO_TIMCTL_PINCFG_SHIFT          (16U)
+#define FLEXIO_TIMCTL_PINCFG(x)             FLEXIO_FIELD(x, 16U, FLEXIO_TIMCTL_PINCFG_MASK)
+#define FLEXIO_TIMCTL_TRGSRC(x)             FLEXIO_FIELD(x, 22U, 0x400000U)
+#define FLEXIO_TIMCTL_TRGPOL(x)             FLEXIO_FIELD(x, 23U, 0x800000U)
+#define FLEXIO_TIMCTL_TRGSEL_MASK           (0x3F000000U)
+#define FLEXIO_TIMCTL_TRGSEL_SHIFT          (24U)
+#define FLEXIO_TIMCTL_TRGSEL(x)             FLEXIO_FIELD(x, 24U, FLEXIO_TIMCTL_TRGSEL_MASK)
+
+#define FLEXIO_TIMCFG_TSTART(x)             FLEXIO_FIELD(x, 1U, 0x2U)
+#define FLEXIO_TIMCFG_TSTOP(x)              FLEXIO_FIELD(x, 4U, 0x30U)
+#define FLEXIO_TIMCFG_TIMENA_MASK           (0x700U)
+#define FLEXIO_TIMCFG_TIMENA_SHIFT          (8U)
+#define FLEXIO_TIMCFG_TIMENA(x)             FLEXIO_FIELD(x, 8U, FLEXIO_TIMCFG_TIMENA_MASK)
+#define FLEXIO_TIMCFG_TIMDIS_MASK           (0x7000U)
+#define FLEXIO_TIMCFG_TIMDIS_SHIFT          (12U)
+#define FLEXIO_TIMCFG_TIMDIS(x)             FLEXIO_FIELD(x, 12U, FLEXIO_TIMCFG_TIMDIS_MASK)
+#define FLEXIO_TIMCFG_TIMRST(x)             FLEXIO_FIELD(x, 16U, 0x70000U)
+#define FLEXIO_TIMCFG_TIMDEC(x)             FLEXIO_FIELD(x, 20U, 0x700000U)
+#define FLEXIO_TIMCFG_TIMOUT(x)             FLEXIO_FIELD(x, 24U, 0x3000000U)
+
+#define FLEXIO_TIMCMP_CMP_MASK              (0xFFFFU)
+#define FLEXIO_TIMCMP_CMP(x)                FLEXIO_FIELD(x, 0U, FLEXIO_TIMCMP_CMP_MASK)
+
+#define FLEXIO_INSTANCE_COUNT       (1U)
+
+extern FLEXIO_Type Flexio_Host_Regs;
+#define IP_FLEXIO_BASE_PTRS         { &Flexio_Host_Regs }
+
+#endif /* FLEXIO_MCL_IP_CFG_DEVICEREGISTERS_H */
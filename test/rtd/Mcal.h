@@ -0,0 +1,29 @@
+/* Host stand-in for the platform definitions the RTD drivers take from Mcal.h */
+#ifndef MCAL_H
+#define MCAL_H
+
+#include <stdlib.h>
+#include "Std_Types.h"
+
+#define MCAL_AR_RELEASE_MAJOR_VERSION       4
+#define MCAL_AR_RELEASE_MINOR_VERSION       7
+
+#define CPU_TYPE_8          8
+#define CPU_TYPE_16         16
+#define CPU_TYPE_32         32
+#define CPU_TYPE_64         64
+#define CPU_TYPE            CPU_TYPE_64
+
+/* Driver assertions stop the host run where the target would hit BKPT */
+#define ASM_KEYWORD(x)      abort()
+#define INLINE              inline
+#define LOCAL_INLINE        static inline
+
+#define ISR(IsrName)        void IsrName(void)
+#define VAR_ALIGN(v, size)  __attribute__((aligned(size))) v;
+#define MCAL_FAULT_INJECTION_POINT(label)
+
+#define MCAL_DATA_SYNC_BARRIER()            __sync_synchronize()
+#define MCAL_INSTRUCTION_SYNC_BARRIER()     __sync_synchronize()
+
+#endif /* MCAL_H */
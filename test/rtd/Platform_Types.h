@@ -0,0 +1,10 @@
+/* Host stand-in for the AUTOSAR platform types, which the host takes from Std_Types.h */
+#ifndef PLATFORM_TYPES_H
+#define PLATFORM_TYPES_H
+
+#include "Std_Types.h"
+
+#define PLATFORM_AR_RELEASE_MAJOR_VERSION   4
+#define PLATFORM_AR_RELEASE_MINOR_VERSION   7
+
+#endif /* PLATFORM_TYPES_H */
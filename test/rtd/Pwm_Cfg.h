@@ -0,0 +1,61 @@
+/*
+* Host stand-in for the generated Pwm_Cfg.h: one partition, 48 logical channels mapped one to
+* one onto eMIOS_0 and eMIOS_1 channels (see Emios_Pwm_Ip_Cfg.h), the configuration passed to
+* Pwm_Init by the test, development error detection and every optional service on.
+*/
+#ifndef PWM_CFG_H
+#define PWM_CFG_H
+
+#include "Std_Types.h"
+
+#define PWM_CFG_VENDOR_ID                           43
+#define PWM_CFG_AR_RELEASE_MAJOR_VERSION            4
+#define PWM_CFG_AR_RELEASE_MINOR_VERSION            7
+#define PWM_CFG_AR_RELEASE_REVISION_VERSION         0
+#define PWM_CFG_SW_MAJOR_VERSION                    5
+#define PWM_CFG_SW_MINOR_VERSION                    0
+#define PWM_CFG_SW_PATCH_VERSION                    0
+
+#define PWM_INDEX                                   (0U)
+#define PWM_PRECOMPILE_SUPPORT                      (STD_OFF)
+#define PWM_CONFIG_EXTERNAL
+#define PWM_MULTIPARTITION_ENABLED                  (STD_OFF)
+#define PWM_MAX_PARTITION_NO                        (1U)
+#define PWM_NO_CACHE_NEEDED                         (STD_OFF)
+
+#define PWM_DEV_ERROR_DETECT                        (STD_ON)
+#define PWM_NOTIFICATION_SUPPORTED                  (STD_ON)
+#define PWM_POWER_STATE_SUPPORTED                   (STD_OFF)
+#define PWM_ENABLE_MASKING_OPERATIONS               (STD_OFF)
+
+#define PWM_DE_INIT_API                             (STD_ON)
+#define PWM_GET_OUTPUT_STATE_API                    (STD_ON)
+#define PWM_SET_DUTY_CYCLE_API                      (STD_ON)
+#define PWM_SET_OUTPUT_TO_IDLE_API                  (STD_ON)
+#define PWM_SET_PERIOD_AND_DUTY_API                 (STD_ON)
+#define PWM_VERSION_INFO_API                        (STD_ON)
+#define PWM_SET_COUNTER_BUS_API                     (STD_ON)
+#define PWM_SET_CHANNEL_OUTPUT_API                  (STD_ON)
+#define PWM_SET_TRIGGER_DELAY_API                   (STD_ON)
+#define PWM_SET_CLOCK_MODE_API                      (STD_ON)
+#define PWM_SET_DUTY_CYCLE_NO_UPDATE_API            (STD_ON)
+#define PWM_SET_PERIOD_AND_DUTY_NO_UPDATE_API       (STD_ON)
+#define PWM_SYNC_UPDATE_API                         (STD_ON)
+#define PWM_SET_DUTY_PHASE_SHIFT_API                (STD_ON)
+#define PWM_SET_CHANNEL_DEAD_TIME_API               (STD_ON)
+#define PWM_GET_CHANNEL_STATE_API                   (STD_ON)
+#define PWM_FAST_UPDATE_API                         (STD_OFF)
+#define PWM_UPDATE_DUTY_SYNCHRONOUS                 (STD_ON)
+
+#define PWM_CONFIG_LOGIC_CHANNELS                   (48U)
+#define PWM_HW_CHANNEL_NO                           (48U)
+#define PWM_HW_MODULE_NO                            (2U)
+#define PWM_HW_MODULE_EMIOS_NO_U8                   (2U)
+#define PWM_HW_MODULE_FLEXPWM_NO_U8                 (0U)
+#define PWM_EMIOS_INSTANCE_0                        (0U)
+#define PWM_EMIOS_INSTANCE_1                        (1U)
+
+#define PWM_DRIVER_STATE_INITIALIZATION             { { PWM_STATE_UNINIT, NULL_PTR, PWM_FULL_POWER, \
+                                                        PWM_FULL_POWER, { NULL_PTR }, { FALSE } } }
+
+#endif /* PWM_CFG_H */
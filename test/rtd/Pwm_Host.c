@@ -0,0 +1,207 @@
+/*
+* Host configuration of the Pwm driver on the eMIOS register model, see Pwm_Host.h.
+*/
+#include <string.h>
+#include "Pwm_Host.h"
+#include "Pwm_Notif.h"
+#include "Emios_Pwm_Ip_Irq.h"
+
+Emios_Pwm_Ip_ChannelConfigType Pwm_Host_EmiosChannels[PWM_HOST_CHANNELS];
+uint32 Pwm_Host_Notifications[PWM_HOST_CHANNELS];
+
+#define PWM_HOST_NOTIFY(n) \
+    static void Notify##n(void) \
+    { \
+        Pwm_Host_Notifications[n]++; \
+    }
+
+PWM_HOST_NOTIFY(0)
+PWM_HOST_NOTIFY(1)
+PWM_HOST_NOTIFY(2)
+PWM_HOST_NOTIFY(3)
+PWM_HOST_NOTIFY(4)
+PWM_HOST_NOTIFY(5)
+PWM_HOST_NOTIFY(6)
+PWM_HOST_NOTIFY(7)
+PWM_HOST_NOTIFY(8)
+PWM_HOST_NOTIFY(9)
+PWM_HOST_NOTIFY(10)
+PWM_HOST_NOTIFY(11)
+PWM_HOST_NOTIFY(12)
+PWM_HOST_NOTIFY(13)
+PWM_HOST_NOTIFY(14)
+PWM_HOST_NOTIFY(15)
+PWM_HOST_NOTIFY(16)
+PWM_HOST_NOTIFY(17)
+PWM_HOST_NOTIFY(18)
+PWM_HOST_NOTIFY(19)
+PWM_HOST_NOTIFY(20)
+PWM_HOST_NOTIFY(21)
+PWM_HOST_NOTIFY(22)
+PWM_HOST_NOTIFY(23)
+PWM_HOST_NOTIFY(24)
+PWM_HOST_NOTIFY(25)
+PWM_HOST_NOTIFY(26)
+PWM_HOST_NOTIFY(27)
+PWM_HOST_NOTIFY(28)
+PWM_HOST_NOTIFY(29)
+PWM_HOST_NOTIFY(30)
+PWM_HOST_NOTIFY(31)
+PWM_HOST_NOTIFY(32)
+PWM_HOST_NOTIFY(33)
+PWM_HOST_NOTIFY(34)
+PWM_HOST_NOTIFY(35)
+PWM_HOST_NOTIFY(36)
+PWM_HOST_NOTIFY(37)
+PWM_HOST_NOTIFY(38)
+PWM_HOST_NOTIFY(39)
+PWM_HOST_NOTIFY(40)
+PWM_HOST_NOTIFY(41)
+PWM_HOST_NOTIFY(42)
+PWM_HOST_NOTIFY(43)
+PWM_HOST_NOTIFY(44)
+PWM_HOST_NOTIFY(45)
+PWM_HOST_NOTIFY(46)
+PWM_HOST_NOTIFY(47)
+
+#define PWM_HOST_CHANNEL(n) \
+    { (Pwm_ChannelType)(n), PWM_VARIABLE_PERIOD, \
+      { PWM_CHANNEL_EMIOS, &Pwm_Host_EmiosChannels[n], PWM_HOST_INSTANCE(n), 0x4000U }, \
+      PWM_LOW, Notify##n }
+
+static const Pwm_ChannelConfigType channels[PWM_HOST_CHANNELS] = {
+    PWM_HOST_CHANNEL(0),
+    PWM_HOST_CHANNEL(1),
+    PWM_HOST_CHANNEL(2),
+    PWM_HOST_CHANNEL(3),
+    PWM_HOST_CHANNEL(4),
+    PWM_HOST_CHANNEL(5),
+    PWM_HOST_CHANNEL(6),
+    PWM_HOST_CHANNEL(7),
+    PWM_HOST_CHANNEL(8),
+    PWM_HOST_CHANNEL(9),
+    PWM_HOST_CHANNEL(10),
+    PWM_HOST_CHANNEL(11),
+    PWM_HOST_CHANNEL(12),
+    PWM_HOST_CHANNEL(13),
+    PWM_HOST_CHANNEL(14),
+    PWM_HOST_CHANNEL(15),
+    PWM_HOST_CHANNEL(16),
+    PWM_HOST_CHANNEL(17),
+    PWM_HOST_CHANNEL(18),
+    PWM_HOST_CHANNEL(19),
+    PWM_HOST_CHANNEL(20),
+    PWM_HOST_CHANNEL(21),
+    PWM_HOST_CHANNEL(22),
+    PWM_HOST_CHANNEL(23),
+    PWM_HOST_CHANNEL(24),
+    PWM_HOST_CHANNEL(25),
+    PWM_HOST_CHANNEL(26),
+    PWM_HOST_CHANNEL(27),
+    PWM_HOST_CHANNEL(28),
+    PWM_HOST_CHANNEL(29),
+    PWM_HOST_CHANNEL(30),
+    PWM_HOST_CHANNEL(31),
+    PWM_HOST_CHANNEL(32),
+    PWM_HOST_CHANNEL(33),
+    PWM_HOST_CHANNEL(34),
+    PWM_HOST_CHANNEL(35),
+    PWM_HOST_CHANNEL(36),
+    PWM_HOST_CHANNEL(37),
+    PWM_HOST_CHANNEL(38),
+    PWM_HOST_CHANNEL(39),
+    PWM_HOST_CHANNEL(40),
+    PWM_HOST_CHANNEL(41),
+    PWM_HOST_CHANNEL(42),
+    PWM_HOST_CHANNEL(43),
+    PWM_HOST_CHANNEL(44),
+    PWM_HOST_CHANNEL(45),
+    PWM_HOST_CHANNEL(46),
+    PWM_HOST_CHANNEL(47)
+};
+
+const Pwm_ConfigType Pwm_Host_Config = {
+    (Pwm_ChannelType)PWM_HOST_CHANNELS,
+    &channels,
+    {
+        (Pwm_ChannelType)0,
+        (Pwm_ChannelType)1,
+        (Pwm_ChannelType)2,
+        (Pwm_ChannelType)3,
+        (Pwm_ChannelType)4,
+        (Pwm_ChannelType)5,
+        (Pwm_ChannelType)6,
+        (Pwm_ChannelType)7,
+        (Pwm_ChannelType)8,
+        (Pwm_ChannelType)9,
+        (Pwm_ChannelType)10,
+        (Pwm_ChannelType)11,
+        (Pwm_ChannelType)12,
+        (Pwm_ChannelType)13,
+        (Pwm_ChannelType)14,
+        (Pwm_ChannelType)15,
+        (Pwm_ChannelType)16,
+        (Pwm_ChannelType)17,
+        (Pwm_ChannelType)18,
+        (Pwm_ChannelType)19,
+        (Pwm_ChannelType)20,
+        (Pwm_ChannelType)21,
+        (Pwm_ChannelType)22,
+        (Pwm_ChannelType)23,
+        (Pwm_ChannelType)24,
+        (Pwm_ChannelType)25,
+        (Pwm_ChannelType)26,
+        (Pwm_ChannelType)27,
+        (Pwm_ChannelType)28,
+        (Pwm_ChannelType)29,
+        (Pwm_ChannelType)30,
+        (Pwm_ChannelType)31,
+        (Pwm_ChannelType)32,
+        (Pwm_ChannelType)33,
+        (Pwm_ChannelType)34,
+        (Pwm_ChannelType)35,
+        (Pwm_ChannelType)36,
+        (Pwm_ChannelType)37,
+        (Pwm_ChannelType)38,
+        (Pwm_ChannelType)39,
+        (Pwm_ChannelType)40,
+        (Pwm_ChannelType)41,
+        (Pwm_ChannelType)42,
+        (Pwm_ChannelType)43,
+        (Pwm_ChannelType)44,
+        (Pwm_ChannelType)45,
+        (Pwm_ChannelType)46,
+        (Pwm_ChannelType)47
+    }
+};
+
+void Pwm_Host_Setup(uint32 Period, uint32 DutyTicks)
+{
+    Emios_Pwm_Ip_ChannelConfigType *config;
+    uint32 i;
+
+    Emios_Host_Reset();
+    for (i = 0U; i < PWM_HOST_CHANNELS; i++) {
+        config = &Pwm_Host_EmiosChannels[i];
+        memset(config, 0, sizeof(*config));
+        config->ChannelId = PWM_HOST_HW_CHANNEL(i);
+        config->Mode = EMIOS_PWM_IP_MODE_OPWFM_NEXT_PERIOD_UPDATE_FLAG;
+        config->Timebase = EMIOS_PWM_IP_BUS_INTERNAL;
+        config->InternalPs = EMIOS_PWM_IP_CLOCK_DIV_1;
+        config->InternalPsAlt = EMIOS_PWM_IP_CLOCK_DIV_1;
+        config->InternalPsSrc = EMIOS_PWM_IP_PS_SRC_MODULE_CLOCK;
+        config->OutputPolarity = EMIOS_PWM_IP_ACTIVE_HIGH;
+        config->IrqMode = EMIOS_PWM_IP_INTERRUPT_REQUEST;
+        config->UserCallback.CbFunction = Pwm_Notification;
+        config->UserCallback.CbParameter = (uint8)i;
+        config->PeriodCount = Period;
+        config->DutyCycle = DutyTicks;
+        Pwm_Host_Notifications[i] = 0U;
+    }
+}
+
+void Pwm_Host_Edge(Pwm_ChannelType Channel)
+{
+    Emios_Host_RaiseFlag(PWM_HOST_INSTANCE(Channel), PWM_HOST_HW_CHANNEL(Channel));
+    Emios_Pwm_Ip_IrqHandler(PWM_HOST_INSTANCE(Channel), PWM_HOST_HW_CHANNEL(Channel));
+}
@@ -0,0 +1,29 @@
+/*
+* Host configuration of the Pwm driver for the tests that run it on the eMIOS register model:
+* logical channel n is eMIOS_0 channel n for n < 24 and eMIOS_1 channel n - 24 above, with the
+* notifications routed through Pwm_Notification to a counter per channel. The eMIOS channel
+* configurations are plain data the test fills in before Pwm_Init.
+*/
+#ifndef PWM_HOST_H
+#define PWM_HOST_H
+
+#include "Pwm.h"
+#include "Emios_Host.h"
+
+#define PWM_HOST_CHANNELS           (48U)
+
+extern Emios_Pwm_Ip_ChannelConfigType Pwm_Host_EmiosChannels[PWM_HOST_CHANNELS];
+extern const Pwm_ConfigType Pwm_Host_Config;
+extern uint32 Pwm_Host_Notifications[PWM_HOST_CHANNELS];  /* User notifications per channel */
+
+/* Reset the registers and set every channel to OPWFM, with its notification registered on FLAG */
+void Pwm_Host_Setup(uint32 Period, uint32 DutyTicks);
+
+/* eMIOS instance and channel of a logical channel */
+#define PWM_HOST_INSTANCE(Channel)  ((uint8)((Channel) / 24U))
+#define PWM_HOST_HW_CHANNEL(Channel) ((uint8)((Channel) % 24U))
+
+/* One edge of a logical channel: raise its FLAG and take the eMIOS interrupt */
+void Pwm_Host_Edge(Pwm_ChannelType Channel);
+
+#endif /* PWM_HOST_H */
@@ -0,0 +1,28 @@
+/*
+* Host stand-in for the generated Pwm_Ipw_Cfg.h: the eMIOS PWM channels only, with 24-bit
+* periods.
+*/
+#ifndef PWM_IPW_CFG_H
+#define PWM_IPW_CFG_H
+
+#include "Std_Types.h"
+#include "Pwm_Cfg.h"
+
+#define PWM_IPW_CFG_VENDOR_ID                       43
+#define PWM_IPW_CFG_AR_RELEASE_MAJOR_VERSION        4
+#define PWM_IPW_CFG_AR_RELEASE_MINOR_VERSION        7
+#define PWM_IPW_CFG_AR_RELEASE_REVISION_VERSION     0
+#define PWM_IPW_CFG_SW_MAJOR_VERSION                5
+#define PWM_IPW_CFG_SW_MINOR_VERSION                0
+#define PWM_IPW_CFG_SW_PATCH_VERSION                0
+
+#define PWM_EMIOS_USED                              (STD_ON)
+#define PWM_FLEXIO_USED                             (STD_OFF)
+#define PWM_FLEXPWM_USED                            (STD_OFF)
+#define PWM_ETPU_USED                               (STD_OFF)
+#define PWM_HW_INSTANCE_USED                        (STD_OFF)
+
+typedef uint32 Pwm_Ipw_PeriodType;
+typedef uint32 Pwm_Ipw_DutyType;
+
+#endif /* PWM_IPW_CFG_H */
@@ -0,0 +1,188 @@
+/*
+* Host stand-in for the SchM exclusive areas of the Mcl and Pwm drivers. Every area counts its
+* entries and tracks the nesting depth, so a host test can check that a service is protected
+* and that every enter is matched by an exit.
+*
+* On the target an area masks the interrupts of the core, which excludes every other area as
+* well. The host does the same with one lock for all areas, taken recursively, so tests that
+* run producers and consumers on threads see the exclusion the target gives. An interrupt a
+* test raises inside an area is held until the thread leaves the last one.
+*/
+#include <pthread.h>
+#include "SchM_Host.h"
+
+uint32 SchM_Host_Depth;
+uint32 SchM_Host_Entries;
+uint32 SchM_Host_MclArea[SCHM_HOST_AREAS];
+uint32 SchM_Host_PwmArea[SCHM_HOST_AREAS];
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32 nesting;     /* Nesting depth of this thread */
+static __thread void (*pending)(void);
+static __thread void (*armed)(void);
+
+static void Enter(uint32 *Count)
+{
+    if (nesting == 0U) {
+        (void)pthread_mutex_lock(&lock);
+    }
+    nesting++;
+    SchM_Host_Depth++;
+    SchM_Host_Entries++;
+    (*Count)++;
+    if (armed != NULL) {
+        pending = armed;
+        armed = NULL;
+    }
+}
+
+static void Exit(void)
+{
+    SchM_Host_Depth--;
+    nesting--;
+    if (nesting == 0U) {
+        (void)pthread_mutex_unlock(&lock);
+        if (pending != NULL) {
+            void (*isr)(void) = pending;
+
+            pending = NULL;
+            isr();
+        }
+    }
+}
+
+void SchM_Host_RaiseInterrupt(void (*Isr)(void))
+{
+    if (nesting == 0U) {
+        Isr();
+    } else {
+        pending = Isr;
+    }
+}
+
+void SchM_Host_RaiseInterruptOnEnter(void (*Isr)(void))
+{
+    armed = Isr;
+}
+
+#define SCHM_HOST_AREA(Module, MODULE, Counts, Id) \
+    void SchM_Enter_##Module##_##MODULE##_EXCLUSIVE_AREA_##Id(void) \
+    { \
+        Enter(&Counts[1##Id - 100]); \
+    } \
+    void SchM_Exit_##Module##_##MODULE##_EXCLUSIVE_AREA_##Id(void) \
+    { \
+        Exit(); \
+    }
+
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 00)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 01)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 02)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 03)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 04)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 05)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 06)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 07)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 08)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 09)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 10)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 11)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 12)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 13)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 14)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 15)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 16)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 17)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 18)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 19)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 20)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 21)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 22)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 23)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 24)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 25)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 26)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 27)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 28)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 29)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 30)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 31)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 32)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 33)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 34)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 35)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 36)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 37)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 38)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 39)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 40)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 41)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 42)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 43)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 44)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 45)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 46)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 47)
+SCHM_HOST_AREA(Mcl, MCL, SchM_Host_MclArea, 48)
+
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 00)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 01)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 03)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 04)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 05)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 07)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 08)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 09)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 10)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 11)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 12)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 13)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 14)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 15)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 16)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 17)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 18)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 19)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 20)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 21)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 22)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 23)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 24)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 25)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 26)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 27)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 28)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 29)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 30)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 31)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 32)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 33)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 34)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 35)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 36)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 37)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 38)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 39)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 40)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 41)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 42)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 43)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 44)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 45)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 47)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 50)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 51)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 52)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 53)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 54)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 55)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 56)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 57)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 58)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 59)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 60)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 61)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 62)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 63)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 64)
+SCHM_HOST_AREA(Pwm, PWM, SchM_Host_PwmArea, 65)
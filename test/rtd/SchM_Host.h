@@ -0,0 +1,22 @@
+/* Host stand-in for the SchM exclusive areas: entry counters inspected by the host tests */
+#ifndef SCHM_HOST_H
+#define SCHM_HOST_H
+
+#include "Std_Types.h"
+
+#define SCHM_HOST_AREAS     (66U)
+
+extern uint32 SchM_Host_Depth;                          /* Exclusive areas currently entered */
+extern uint32 SchM_Host_Entries;                        /* Enters since start, all areas */
+extern uint32 SchM_Host_MclArea[SCHM_HOST_AREAS];       /* Enters per MCL_EXCLUSIVE_AREA_nn */
+extern uint32 SchM_Host_PwmArea[SCHM_HOST_AREAS];       /* Enters per PWM_EXCLUSIVE_AREA_nn */
+
+/* Raise an interrupt on the calling thread: Isr runs at once outside the exclusive areas, else
+   when the thread leaves the last one, as the interrupt mask of the target would have it */
+void SchM_Host_RaiseInterrupt(void (*Isr)(void));
+
+/* Raise the interrupt when the calling thread next enters an exclusive area, i.e. in the middle
+   of the protected update: it runs after the last exit */
+void SchM_Host_RaiseInterruptOnEnter(void (*Isr)(void));
+
+#endif /* SCHM_HOST_H */
@@ -0,0 +1,25 @@
+/*
+* Host stand-in for the generated Siul2_Dio_Ip configuration: one SIUL2 instance and no virtual
+* wrapper. Applications only take the parallel port type from the driver header.
+*/
+#ifndef SIUL2_DIO_IP_CFG_H
+#define SIUL2_DIO_IP_CFG_H
+
+#include "Mcal.h"
+
+#define SIUL2_DIO_IP_VENDOR_ID_CFG_H                    43
+#define SIUL2_DIO_IP_AR_RELEASE_MAJOR_VERSION_CFG_H     4
+#define SIUL2_DIO_IP_AR_RELEASE_MINOR_VERSION_CFG_H     7
+#define SIUL2_DIO_IP_AR_RELEASE_REVISION_VERSION_CFG_H  0
+#define SIUL2_DIO_IP_SW_MAJOR_VERSION_CFG_H             5
+#define SIUL2_DIO_IP_SW_MINOR_VERSION_CFG_H             0
+#define SIUL2_DIO_IP_SW_PATCH_VERSION_CFG_H             0
+
+/* Register access qualifiers of the device header the generated file includes */
+#define __I                         volatile const
+#define __IO                        volatile
+
+#define DIO_VIRTWRAPPER_SUPPORT     (STD_OFF)
+#define SIUL2_INSTANCE_COUNT        (1U)
+
+#endif /* SIUL2_DIO_IP_CFG_H */
@@ -0,0 +1,21 @@
+/*
+* Host stand-in for the generated Trgmux_Ip configuration. The instance and logic trigger counts
+* are in Trgmux_Ip_Cfg_Defines.h, where the driver types need them.
+*/
+#ifndef TRGMUX_IP_CFG_H
+#define TRGMUX_IP_CFG_H
+
+#include "Trgmux_Ip_Types.h"
+
+#define TRGMUX_IP_CFG_VENDOR_ID                     43
+#define TRGMUX_IP_CFG_AR_RELEASE_MAJOR_VERSION      4
+#define TRGMUX_IP_CFG_AR_RELEASE_MINOR_VERSION      7
+#define TRGMUX_IP_CFG_AR_RELEASE_REVISION_VERSION   0
+#define TRGMUX_IP_CFG_SW_MAJOR_VERSION              5
+#define TRGMUX_IP_CFG_SW_MINOR_VERSION              0
+#define TRGMUX_IP_CFG_SW_PATCH_VERSION              0
+
+/* Hardware instance of each configured instance, defined with the configuration by the test */
+extern const uint8 Trgmux_Ip_InstanceArr[TRGMUX_IP_NOF_INSTANCE];
+
+#endif /* TRGMUX_IP_CFG_H */
@@ -0,0 +1,24 @@
+/* Host stand-in for the generated Trgmux_Ip feature switches of S32K344 */
+#ifndef TRGMUX_IP_CFG_DEFINES_H
+#define TRGMUX_IP_CFG_DEFINES_H
+
+#include "Mcal.h"
+
+#define TRGMUX_IP_CFG_DEFINES_VENDOR_ID                     43
+#define TRGMUX_IP_CFG_DEFINES_AR_RELEASE_MAJOR_VERSION      4
+#define TRGMUX_IP_CFG_DEFINES_AR_RELEASE_MINOR_VERSION      7
+#define TRGMUX_IP_CFG_DEFINES_AR_RELEASE_REVISION_VERSION   0
+#define TRGMUX_IP_CFG_DEFINES_SW_MAJOR_VERSION              5
+#define TRGMUX_IP_CFG_DEFINES_SW_MINOR_VERSION              0
+#define TRGMUX_IP_CFG_DEFINES_SW_PATCH_VERSION              0
+
+#define TRGMUX_IP_IS_AVAILABLE                      STD_ON
+#define TRGMUX_IP_DEV_ERROR_DETECT                  STD_ON
+#define TRGMUX_IP_MULTICORE_IS_AVAILABLE            STD_OFF
+#define TRGMUX_IP_USER_MODE_SUPPORT_IS_AVAILABLE    STD_OFF
+
+/* One instance, eight logic triggers */
+#define TRGMUX_IP_NOF_INSTANCE                      (1U)
+#define TRGMUX_IP_NOF_CFG_LOGIC_TRIGGERS            (8U)
+
+#endif /* TRGMUX_IP_CFG_DEFINES_H */
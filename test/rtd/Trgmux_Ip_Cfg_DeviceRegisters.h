@@ -0,0 +1,40 @@
+/*
+* Host stand-in for the generated Trgmux_Ip device description. The TRGMUX register file follows
+* the S32K344 layout, four output selections and a lock bit per register; the base pointer selects
+* a RAM block that a host test defines and inspects in place of the peripheral.
+*/
+#ifndef TRGMUX_IP_CFG_DEVICEREGISTERS_H
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_H
+
+#include "Mcal.h"
+
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_VENDOR_ID                     43
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_AR_RELEASE_MAJOR_VERSION      4
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_AR_RELEASE_MINOR_VERSION      7
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_AR_RELEASE_REVISION_VERSION   0
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_SW_MAJOR_VERSION              5
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_SW_MINOR_VERSION              0
+#define TRGMUX_IP_CFG_DEVICEREGISTERS_SW_PATCH_VERSION              0
+
+/* TRGMUXn registers of the instance, four outputs each */
+#define TRGMUX_HOST_REGISTERS       (64U)
+
+typedef struct {
+    volatile uint32 TRGMUXn[TRGMUX_HOST_REGISTERS];
+} TRGMUX_Type;
+
+#define TRGMUX_TRGMUXn_SEL0_MASK    (0x7FU)
+#define TRGMUX_TRGMUXn_SEL1_MASK    (0x7F00U)
+#define TRGMUX_TRGMUXn_SEL1_SHIFT   (8U)
+#define TRGMUX_TRGMUXn_SEL2_MASK    (0x7F0000U)
+#define TRGMUX_TRGMUXn_SEL3_MASK    (0x7F000000U)
+#define TRGMUX_TRGMUXn_LK_MASK      (0x80000000U)
+#define TRGMUX_TRGMUXn_LK_SHIFT     (31U)
+
+#define TRGMUX_INSTANCE_COUNT                       (1U)
+#define TRGMUX_IP_TRGMUXn_INSTANCE_COUNT(Instance)  ((uint8)TRGMUX_HOST_REGISTERS)
+
+extern TRGMUX_Type Trgmux_Host_Regs;
+#define IP_TRGMUX_BASE_PTRS         { &Trgmux_Host_Regs }
+
+#endif /* TRGMUX_IP_CFG_DEVICEREGISTERS_H */
@@ -0,0 +1,63 @@
+/* Host stand-in for the Clock_Ip interface used by the application modules */
+#ifndef CLOCK_IP_H
+#define CLOCK_IP_H
+
+#include "Std_Types.h"
+
+typedef enum
+{
+    CLOCK_IS_OFF = 0,
+    FIRC_CLK,
+    PLL_PHI0_CLK,
+    SCS_CLK,
+    CORE_CLK,
+    AIPS_PLAT_CLK,
+    AIPS_SLOW_CLK,
+    EMIOS0_CLK,
+    EMIOS1_CLK,
+    EMIOS2_CLK,
+    FLEXIO0_CLK,
+    EDMA0_CLK,
+    LCU0_CLK,
+    LCU1_CLK
+} Clock_Ip_NameType;
+
+/* Subset of the generated clock configuration the application modules look at */
+typedef struct
+{
+    Clock_Ip_NameType Name;
+    uint32            Value;
+} Clock_Ip_SelectorConfigType;
+
+typedef struct
+{
+    Clock_Ip_NameType Name;
+    uint32            Value;
+} Clock_Ip_DividerConfigType;
+
+typedef struct
+{
+    Clock_Ip_NameType Name;
+    uint32            MaxAllowableIDDchange;
+    uint32            StepDuration;
+    Clock_Ip_NameType SelectorName;
+    uint32            ClockSourceFrequency;
+} Clock_Ip_PcfsConfigType;
+
+typedef struct
+{
+    uint32                               ClkConfigId;
+    uint8                                SelectorsCount;
+    uint8                                DividersCount;
+    uint8                                PcfsCount;
+    const Clock_Ip_SelectorConfigType  (*Selectors)[];
+    const Clock_Ip_DividerConfigType   (*Dividers)[];
+    const Clock_Ip_PcfsConfigType      (*Pcfs)[];
+} Clock_Ip_ClockConfigType;
+
+void Clock_Ip_InitClock(Clock_Ip_ClockConfigType const * Config);
+void Clock_Ip_DisableModuleClock(Clock_Ip_NameType ClockName);
+void Clock_Ip_EnableModuleClock(Clock_Ip_NameType ClockName);
+uint64 Clock_Ip_GetClockFrequency(Clock_Ip_NameType ClockName);
+
+#endif /* CLOCK_IP_H */
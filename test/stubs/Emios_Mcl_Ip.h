@@ -0,0 +1,17 @@
+/* Host stand-in for the Emios_Mcl_Ip counter bus services */
+#ifndef EMIOS_MCL_IP_H
+#define EMIOS_MCL_IP_H
+
+#include "Std_Types.h"
+
+typedef enum
+{
+    EMIOS_IP_COMMON_STATUS_SUCCESS = E_OK,
+    EMIOS_IP_COMMON_STATUS_FAIL    = E_NOT_OK
+} Emios_Ip_CommonStatusType;
+
+Emios_Ip_CommonStatusType Emios_Mcl_Ip_SetCounterBusPeriod(uint8 HwInstance, uint8 HwChannel, uint32 Period);
+uint32 Emios_Mcl_Ip_GetCounterBusPeriod(uint8 Instance, uint8 Channel);
+uint32 Emios_Mcl_Ip_GetCounterValue(uint8 Instance, uint8 Channel);
+
+#endif /* EMIOS_MCL_IP_H */
@@ -0,0 +1,28 @@
+/* Host stand-in for the Lcu_Ip logic cell services */
+#ifndef LCU_IP_H
+#define LCU_IP_H
+
+#include "Std_Types.h"
+
+#define LCU_NUM_OUTPUT_PER_LC   (4U)
+
+typedef enum
+{
+    LCU_IP_STATUS_SUCCESS = E_OK,
+    LCU_IP_STATUS_ERROR = E_NOT_OK,
+    LCU_IP_STATUS_PROTECTED = 2U
+} Lcu_Ip_ReturnType;
+
+typedef struct
+{
+    uint8 MuxSel[LCU_NUM_OUTPUT_PER_LC];
+    uint16 LutCtrl[LCU_NUM_OUTPUT_PER_LC];
+    uint16 RiseFilt[LCU_NUM_OUTPUT_PER_LC];
+    uint16 FallFilt[LCU_NUM_OUTPUT_PER_LC];
+    uint8 OutPol;
+    uint8 OutEn;
+} Lcu_Ip_LogicCellImageType;
+
+Lcu_Ip_ReturnType Lcu_Ip_SetLogicCellImage(const uint8 LogicInstance, const uint8 HwLogicCell, const Lcu_Ip_LogicCellImageType * const pxImage);
+
+#endif /* LCU_IP_H */
@@ -0,0 +1,60 @@
+/* Host stand-in for the Mcl driver interface used by the application modules */
+#ifndef MCL_H
+#define MCL_H
+
+#include "Std_Types.h"
+
+/* eMIOS clock configuration: main and alternate prescaler of the simulated instance */
+typedef struct
+{
+    uint8  Instance;
+    uint16 Prescaler;
+    uint16 AltPrescaler;
+} Mcl_EmiosInitConfigType;
+
+typedef enum
+{
+    MCL_EMIOS_PRESCALER = 0,
+    MCL_EMIOS_ALTERNATIVE_PRESCALER = 1
+} Mcl_EmiosSelectPrescalerType;
+
+typedef enum
+{
+    MCL_DMA_CH_START_REQUEST = 0,
+    MCL_DMA_CH_STOP_REQUEST = 1,
+    MCL_DMA_CH_START_SERVICE = 2,
+    MCL_DMA_CH_ACK_DONE = 3,
+    MCL_DMA_CH_ACK_ERROR = 4,
+    MCL_DMA_CH_ACK_INTERRUPT_STATUS = 5
+} Mcl_DmaChannelCmdType;
+
+typedef enum
+{
+    MCL_CACHE_LMEM = 0,
+    MCL_CACHE_CORE = 1
+} Mcl_CacheType;
+
+typedef enum
+{
+    MCL_CACHE_PC_BUS = 0,
+    MCL_CACHE_PS_BUS = 1,
+    MCL_CACHE_ALL_BUS = 2,
+    MCL_CACHE_INSTRUCTION = 3,
+    MCL_CACHE_DATA = 4
+} Mcl_CacheBusType;
+
+/* LCU logic input and the value to set */
+typedef struct
+{
+    uint8 LogicInputId;
+    uint8 Value;
+} Mcl_LcuSyncInputValueType;
+
+void Mcl_SetDmaChannelCommand(const uint32 Channel, const Mcl_DmaChannelCmdType Command);
+void Mcl_CacheInvalidateByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, uint32 Addr, uint32 Length);
+void Mcl_CacheCleanByAddr(Mcl_CacheType CacheType, Mcl_CacheBusType BusType, boolean EnableInvalidate, uint32 Addr, uint32 Length);
+void Mcl_SetTrgMuxLock(const uint32 Trigger);
+void Mcl_SetLcuSyncInputMuxSelect(const Mcl_LcuSyncInputValueType List[], const uint8 Dimension);
+void Mcl_Emios_SetClockMode(const Mcl_EmiosInitConfigType * const pConfig, Mcl_EmiosSelectPrescalerType Prescaler);
+
+#endif /* MCL_H */
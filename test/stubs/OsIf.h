@@ -0,0 +1,23 @@
+/* Host stand-in for the OsIf timer and interrupt services */
+#ifndef OSIF_H
+#define OSIF_H
+
+#include "Std_Types.h"
+
+typedef enum
+{
+    OSIF_COUNTER_DUMMY = 0,
+    OSIF_COUNTER_SYSTEM,
+    OSIF_COUNTER_CUSTOM
+} OsIf_CounterType;
+
+uint32 OsIf_GetCounter(OsIf_CounterType SelectedCounter);
+uint32 OsIf_GetElapsed(uint32 * const CurrentRef, OsIf_CounterType SelectedCounter);
+uint32 OsIf_MicrosToTicks(uint32 Micros, OsIf_CounterType SelectedCounter);
+void OsIf_SuspendAllInterrupts(void);
+void OsIf_ResumeAllInterrupts(void);
+
+/* Host only: advance the simulated counter */
+void OsIf_Host_Advance(uint32 Ticks);
+
+#endif /* OSIF_H */
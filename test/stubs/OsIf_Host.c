@@ -0,0 +1,40 @@
+/* Host stand-in for the OsIf timer: a counter advanced by the test, 1 tick per microsecond */
+#include "OsIf.h"
+
+static uint32 osif_host_counter;
+
+uint32 OsIf_GetCounter(OsIf_CounterType SelectedCounter)
+{
+    (void)SelectedCounter;
+    return osif_host_counter;
+}
+
+uint32 OsIf_GetElapsed(uint32 * const CurrentRef, OsIf_CounterType SelectedCounter)
+{
+    uint32 elapsed = osif_host_counter - *CurrentRef;
+
+    (void)SelectedCounter;
+    *CurrentRef = osif_host_counter;
+    *CurrentRef = osif_host_counter;
+
+    return elapsed;
+}
+
+uint32 OsIf_MicrosToTicks(uint32 Micros, OsIf_CounterType SelectedCounter)
+{
+    (void)SelectedCounter;
+    return Micros;
+}
+
+void OsIf_SuspendAllInterrupts(void)
+{
+}
+
+void OsIf_ResumeAllInterrupts(void)
+{
+}
+
+void OsIf_Host_Advance(uint32 Ticks)
+{
+    osif_host_counter += Ticks;
+}
@@ -0,0 +1,19 @@
+/* Host stand-in for the Pwm driver interface used by the application modules */
+#ifndef PWM_H
+#define PWM_H
+
+#include "Std_Types.h"
+
+typedef uint8  Pwm_ChannelType;
+typedef uint32 Pwm_PeriodType;
+
+typedef enum { PWM_HIGH = 0, PWM_LOW = 1 } Pwm_OutputStateType;
+typedef enum { PWM_RISING_EDGE = 0, PWM_FALLING_EDGE = 1, PWM_BOTH_EDGES = 2 } Pwm_EdgeNotificationType;
+
+#define PWM_DUTY_CYCLE_100_U16      (0x8000U)
+
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle);
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
+
+#endif /* PWM_H */
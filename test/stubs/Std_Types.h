@@ -0,0 +1,44 @@
+/* Host stand-in for the AUTOSAR standard types */
+#ifndef STD_TYPES_H
+#define STD_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+typedef int64_t  sint64;
+typedef uint8    boolean;
+typedef uint8    Std_ReturnType;
+
+#define STD_AR_RELEASE_MAJOR_VERSION    4
+#define STD_AR_RELEASE_MINOR_VERSION    7
+
+#define TRUE        (1U)
+#define FALSE       (0U)
+#define E_OK        (0U)
+#define E_NOT_OK    (1U)
+#define STD_ON      (1U)
+#define STD_OFF     (0U)
+#define STD_HIGH    (1U)
+#define STD_LOW     (0U)
+
+#ifndef NULL_PTR
+#define NULL_PTR    ((void *)0)
+#endif
+
+typedef struct
+{
+    uint16 vendorID;
+    uint16 moduleID;
+    uint8  sw_major_version;
+    uint8  sw_minor_version;
+    uint8  sw_patch_version;
+} Std_VersionInfoType;
+
+#endif /* STD_TYPES_H */